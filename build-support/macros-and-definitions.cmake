@@ -846,6 +846,14 @@ macro(process_options)
     endif()
   endif()
 
+  if(${NS3_MTP})
+    add_definitions(-DNS3_MTP)
+  endif()
+
+  if(${NS3_PROFILE_COUNTERS})
+    add_definitions(-DNS3_PROFILE_COUNTERS)
+  endif()
+
   mark_as_advanced(Boost_INCLUDE_DIR)
   find_package(Boost)
   if(${Boost_FOUND})
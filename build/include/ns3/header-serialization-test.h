@@ -0,0 +1 @@
+#include "/root/repo/src/network/test/header-serialization-test.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lr-wpan/helper/lr-wpan-energy-source-helper.h"
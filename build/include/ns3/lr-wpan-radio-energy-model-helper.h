@@ -0,0 +1 @@
+#include "/root/repo/src/lr-wpan/helper/lr-wpan-radio-energy-model-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lr-wpan/model/rl-agent-pool.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/single-model-spectrum-channel.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/helper/waveform-generator-helper.h"
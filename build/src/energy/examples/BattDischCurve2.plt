@@ -0,0 +1,4274 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "BattDisch2.eps"
+set xlabel " Time (Minutes)"
+set ylabel "Voltage (V)"
+set xrange[1:1800]
+                               set yrange [7:14]
+                               set logscale x 
+                               set tics scale 3
+                               set xtics (1,2,3,5,10,20,30,60,120,180,300,600,1200,1800)
+                               set ytics (0,8,9,10,11,12,13,14)
+                               set grid
+                               set style line 1 linewidth 5
+                               set style line 2 linewidth 5
+                               set style line 3 linewidth 5
+                               set style line 4 linewidth 5
+                               set style line 5 linewidth 5
+                               set style line 6 linewidth 5
+                               set style line 7 linewidth 5
+                               set style line 8 linewidth 5
+                               set style increment user
+                               set key reverse Left
+plot "-"  title "CSB GP1272 0.36 A (0.05C)" with lines, "-"  title "CSB GP1272 0.648 A (0.09C)" with lines
+0 12.8
+0.333333 12.786
+0.666667 12.7777
+1 12.773
+1.33333 12.77
+1.66667 12.768
+2 12.7665
+2.33333 12.7652
+2.66667 12.764
+3 12.7629
+3.33333 12.7618
+3.66667 12.7608
+4 12.7597
+4.33333 12.7587
+4.66667 12.7576
+5 12.7566
+5.33333 12.7556
+5.66667 12.7546
+6 12.7536
+6.33333 12.7525
+6.66667 12.7515
+7 12.7505
+7.33333 12.7495
+7.66667 12.7485
+8 12.7475
+8.33333 12.7465
+8.66667 12.7455
+9 12.7445
+9.33333 12.7435
+9.66667 12.7425
+10 12.7415
+10.3333 12.7405
+10.6667 12.7396
+11 12.7386
+11.3333 12.7376
+11.6667 12.7366
+12 12.7356
+12.3333 12.7347
+12.6667 12.7337
+13 12.7327
+13.3333 12.7318
+13.6667 12.7308
+14 12.7298
+14.3333 12.7289
+14.6667 12.7279
+15 12.727
+15.3333 12.726
+15.6667 12.7251
+16 12.7241
+16.3333 12.7232
+16.6667 12.7222
+17 12.7213
+17.3333 12.7204
+17.6667 12.7194
+18 12.7185
+18.3333 12.7176
+18.6667 12.7166
+19 12.7157
+19.3333 12.7148
+19.6667 12.7139
+20 12.7129
+20.3333 12.712
+20.6667 12.7111
+21 12.7102
+21.3333 12.7093
+21.6667 12.7084
+22 12.7075
+22.3333 12.7066
+22.6667 12.7057
+23 12.7047
+23.3333 12.7038
+23.6667 12.703
+24 12.7021
+24.3333 12.7012
+24.6667 12.7003
+25 12.6994
+25.3333 12.6985
+25.6667 12.6976
+26 12.6967
+26.3333 12.6958
+26.6667 12.695
+27 12.6941
+27.3333 12.6932
+27.6667 12.6923
+28 12.6915
+28.3333 12.6906
+28.6667 12.6897
+29 12.6889
+29.3333 12.688
+29.6667 12.6872
+30 12.6863
+30.3333 12.6854
+30.6667 12.6846
+31 12.6837
+31.3333 12.6829
+31.6667 12.682
+32 12.6812
+32.3333 12.6803
+32.6667 12.6795
+33 12.6787
+33.3333 12.6778
+33.6667 12.677
+34 12.6761
+34.3333 12.6753
+34.6667 12.6745
+35 12.6736
+35.3333 12.6728
+35.6667 12.672
+36 12.6712
+36.3333 12.6703
+36.6667 12.6695
+37 12.6687
+37.3333 12.6679
+37.6667 12.6671
+38 12.6663
+38.3333 12.6654
+38.6667 12.6646
+39 12.6638
+39.3333 12.663
+39.6667 12.6622
+40 12.6614
+40.3333 12.6606
+40.6667 12.6598
+41 12.659
+41.3333 12.6582
+41.6667 12.6574
+42 12.6566
+42.3333 12.6558
+42.6667 12.6551
+43 12.6543
+43.3333 12.6535
+43.6667 12.6527
+44 12.6519
+44.3333 12.6511
+44.6667 12.6504
+45 12.6496
+45.3333 12.6488
+45.6667 12.648
+46 12.6473
+46.3333 12.6465
+46.6667 12.6457
+47 12.645
+47.3333 12.6442
+47.6667 12.6434
+48 12.6427
+48.3333 12.6419
+48.6667 12.6412
+49 12.6404
+49.3333 12.6397
+49.6667 12.6389
+50 12.6381
+50.3333 12.6374
+50.6667 12.6367
+51 12.6359
+51.3333 12.6352
+51.6667 12.6344
+52 12.6337
+52.3333 12.6329
+52.6667 12.6322
+53 12.6315
+53.3333 12.6307
+53.6667 12.63
+54 12.6293
+54.3333 12.6285
+54.6667 12.6278
+55 12.6271
+55.3333 12.6263
+55.6667 12.6256
+56 12.6249
+56.3333 12.6242
+56.6667 12.6235
+57 12.6227
+57.3333 12.622
+57.6667 12.6213
+58 12.6206
+58.3333 12.6199
+58.6667 12.6192
+59 12.6185
+59.3333 12.6177
+59.6667 12.617
+60 12.6163
+60.3333 12.6156
+60.6667 12.6149
+61 12.6142
+61.3333 12.6135
+61.6667 12.6128
+62 12.6121
+62.3333 12.6114
+62.6667 12.6108
+63 12.6101
+63.3333 12.6094
+63.6667 12.6087
+64 12.608
+64.3333 12.6073
+64.6667 12.6066
+65 12.6059
+65.3333 12.6053
+65.6667 12.6046
+66 12.6039
+66.3333 12.6032
+66.6667 12.6025
+67 12.6019
+67.3333 12.6012
+67.6667 12.6005
+68 12.5998
+68.3333 12.5992
+68.6667 12.5985
+69 12.5978
+69.3333 12.5972
+69.6667 12.5965
+70 12.5959
+70.3333 12.5952
+70.6667 12.5945
+71 12.5939
+71.3333 12.5932
+71.6667 12.5926
+72 12.5919
+72.3333 12.5912
+72.6667 12.5906
+73 12.5899
+73.3333 12.5893
+73.6667 12.5886
+74 12.588
+74.3333 12.5874
+74.6667 12.5867
+75 12.5861
+75.3333 12.5854
+75.6667 12.5848
+76 12.5841
+76.3333 12.5835
+76.6667 12.5829
+77 12.5822
+77.3333 12.5816
+77.6667 12.581
+78 12.5803
+78.3333 12.5797
+78.6667 12.5791
+79 12.5784
+79.3333 12.5778
+79.6667 12.5772
+80 12.5766
+80.3333 12.5759
+80.6667 12.5753
+81 12.5747
+81.3333 12.5741
+81.6667 12.5735
+82 12.5728
+82.3333 12.5722
+82.6667 12.5716
+83 12.571
+83.3333 12.5704
+83.6667 12.5698
+84 12.5692
+84.3333 12.5685
+84.6667 12.5679
+85 12.5673
+85.3333 12.5667
+85.6667 12.5661
+86 12.5655
+86.3333 12.5649
+86.6667 12.5643
+87 12.5637
+87.3333 12.5631
+87.6667 12.5625
+88 12.5619
+88.3333 12.5613
+88.6667 12.5607
+89 12.5601
+89.3333 12.5595
+89.6667 12.559
+90 12.5584
+90.3333 12.5578
+90.6667 12.5572
+91 12.5566
+91.3333 12.556
+91.6667 12.5554
+92 12.5548
+92.3333 12.5543
+92.6667 12.5537
+93 12.5531
+93.3333 12.5525
+93.6667 12.5519
+94 12.5514
+94.3333 12.5508
+94.6667 12.5502
+95 12.5496
+95.3333 12.5491
+95.6667 12.5485
+96 12.5479
+96.3333 12.5473
+96.6667 12.5468
+97 12.5462
+97.3333 12.5456
+97.6667 12.5451
+98 12.5445
+98.3333 12.5439
+98.6667 12.5434
+99 12.5428
+99.3333 12.5423
+99.6667 12.5417
+100 12.5411
+100.333 12.5406
+100.667 12.54
+101 12.5395
+101.333 12.5389
+101.667 12.5384
+102 12.5378
+102.333 12.5372
+102.667 12.5367
+103 12.5361
+103.333 12.5356
+103.667 12.535
+104 12.5345
+104.333 12.534
+104.667 12.5334
+105 12.5329
+105.333 12.5323
+105.667 12.5318
+106 12.5312
+106.333 12.5307
+106.667 12.5302
+107 12.5296
+107.333 12.5291
+107.667 12.5285
+108 12.528
+108.333 12.5275
+108.667 12.5269
+109 12.5264
+109.333 12.5259
+109.667 12.5253
+110 12.5248
+110.333 12.5243
+110.667 12.5237
+111 12.5232
+111.333 12.5227
+111.667 12.5222
+112 12.5216
+112.333 12.5211
+112.667 12.5206
+113 12.5201
+113.333 12.5195
+113.667 12.519
+114 12.5185
+114.333 12.518
+114.667 12.5175
+115 12.5169
+115.333 12.5164
+115.667 12.5159
+116 12.5154
+116.333 12.5149
+116.667 12.5144
+117 12.5138
+117.333 12.5133
+117.667 12.5128
+118 12.5123
+118.333 12.5118
+118.667 12.5113
+119 12.5108
+119.333 12.5103
+119.667 12.5098
+120 12.5093
+120.333 12.5087
+120.667 12.5082
+121 12.5077
+121.333 12.5072
+121.667 12.5067
+122 12.5062
+122.333 12.5057
+122.667 12.5052
+123 12.5047
+123.333 12.5042
+123.667 12.5037
+124 12.5032
+124.333 12.5027
+124.667 12.5022
+125 12.5018
+125.333 12.5013
+125.667 12.5008
+126 12.5003
+126.333 12.4998
+126.667 12.4993
+127 12.4988
+127.333 12.4983
+127.667 12.4978
+128 12.4973
+128.333 12.4969
+128.667 12.4964
+129 12.4959
+129.333 12.4954
+129.667 12.4949
+130 12.4944
+130.333 12.4939
+130.667 12.4935
+131 12.493
+131.333 12.4925
+131.667 12.492
+132 12.4915
+132.333 12.4911
+132.667 12.4906
+133 12.4901
+133.333 12.4896
+133.667 12.4892
+134 12.4887
+134.333 12.4882
+134.667 12.4877
+135 12.4873
+135.333 12.4868
+135.667 12.4863
+136 12.4858
+136.333 12.4854
+136.667 12.4849
+137 12.4844
+137.333 12.484
+137.667 12.4835
+138 12.483
+138.333 12.4826
+138.667 12.4821
+139 12.4816
+139.333 12.4812
+139.667 12.4807
+140 12.4802
+140.333 12.4798
+140.667 12.4793
+141 12.4789
+141.333 12.4784
+141.667 12.4779
+142 12.4775
+142.333 12.477
+142.667 12.4766
+143 12.4761
+143.333 12.4756
+143.667 12.4752
+144 12.4747
+144.333 12.4743
+144.667 12.4738
+145 12.4734
+145.333 12.4729
+145.667 12.4725
+146 12.472
+146.333 12.4716
+146.667 12.4711
+147 12.4706
+147.333 12.4702
+147.667 12.4697
+148 12.4693
+148.333 12.4689
+148.667 12.4684
+149 12.468
+149.333 12.4675
+149.667 12.4671
+150 12.4666
+150.333 12.4662
+150.667 12.4657
+151 12.4653
+151.333 12.4648
+151.667 12.4644
+152 12.464
+152.333 12.4635
+152.667 12.4631
+153 12.4626
+153.333 12.4622
+153.667 12.4618
+154 12.4613
+154.333 12.4609
+154.667 12.4604
+155 12.46
+155.333 12.4596
+155.667 12.4591
+156 12.4587
+156.333 12.4583
+156.667 12.4578
+157 12.4574
+157.333 12.457
+157.667 12.4565
+158 12.4561
+158.333 12.4557
+158.667 12.4552
+159 12.4548
+159.333 12.4544
+159.667 12.4539
+160 12.4535
+160.333 12.4531
+160.667 12.4527
+161 12.4522
+161.333 12.4518
+161.667 12.4514
+162 12.4509
+162.333 12.4505
+162.667 12.4501
+163 12.4497
+163.333 12.4492
+163.667 12.4488
+164 12.4484
+164.333 12.448
+164.667 12.4476
+165 12.4471
+165.333 12.4467
+165.667 12.4463
+166 12.4459
+166.333 12.4455
+166.667 12.445
+167 12.4446
+167.333 12.4442
+167.667 12.4438
+168 12.4434
+168.333 12.4429
+168.667 12.4425
+169 12.4421
+169.333 12.4417
+169.667 12.4413
+170 12.4409
+170.333 12.4404
+170.667 12.44
+171 12.4396
+171.333 12.4392
+171.667 12.4388
+172 12.4384
+172.333 12.438
+172.667 12.4376
+173 12.4371
+173.333 12.4367
+173.667 12.4363
+174 12.4359
+174.333 12.4355
+174.667 12.4351
+175 12.4347
+175.333 12.4343
+175.667 12.4339
+176 12.4335
+176.333 12.4331
+176.667 12.4326
+177 12.4322
+177.333 12.4318
+177.667 12.4314
+178 12.431
+178.333 12.4306
+178.667 12.4302
+179 12.4298
+179.333 12.4294
+179.667 12.429
+180 12.4286
+180.333 12.4282
+180.667 12.4278
+181 12.4274
+181.333 12.427
+181.667 12.4266
+182 12.4262
+182.333 12.4258
+182.667 12.4254
+183 12.425
+183.333 12.4246
+183.667 12.4242
+184 12.4238
+184.333 12.4234
+184.667 12.423
+185 12.4226
+185.333 12.4222
+185.667 12.4218
+186 12.4214
+186.333 12.421
+186.667 12.4206
+187 12.4202
+187.333 12.4198
+187.667 12.4194
+188 12.4191
+188.333 12.4187
+188.667 12.4183
+189 12.4179
+189.333 12.4175
+189.667 12.4171
+190 12.4167
+190.333 12.4163
+190.667 12.4159
+191 12.4155
+191.333 12.4151
+191.667 12.4147
+192 12.4144
+192.333 12.414
+192.667 12.4136
+193 12.4132
+193.333 12.4128
+193.667 12.4124
+194 12.412
+194.333 12.4116
+194.667 12.4112
+195 12.4109
+195.333 12.4105
+195.667 12.4101
+196 12.4097
+196.333 12.4093
+196.667 12.4089
+197 12.4085
+197.333 12.4082
+197.667 12.4078
+198 12.4074
+198.333 12.407
+198.667 12.4066
+199 12.4062
+199.333 12.4059
+199.667 12.4055
+200 12.4051
+200.333 12.4047
+200.667 12.4043
+201 12.4039
+201.333 12.4036
+201.667 12.4032
+202 12.4028
+202.333 12.4024
+202.667 12.402
+203 12.4017
+203.333 12.4013
+203.667 12.4009
+204 12.4005
+204.333 12.4001
+204.667 12.3998
+205 12.3994
+205.333 12.399
+205.667 12.3986
+206 12.3983
+206.333 12.3979
+206.667 12.3975
+207 12.3971
+207.333 12.3968
+207.667 12.3964
+208 12.396
+208.333 12.3956
+208.667 12.3953
+209 12.3949
+209.333 12.3945
+209.667 12.3941
+210 12.3938
+210.333 12.3934
+210.667 12.393
+211 12.3926
+211.333 12.3923
+211.667 12.3919
+212 12.3915
+212.333 12.3911
+212.667 12.3908
+213 12.3904
+213.333 12.39
+213.667 12.3897
+214 12.3893
+214.333 12.3889
+214.667 12.3885
+215 12.3882
+215.333 12.3878
+215.667 12.3874
+216 12.3871
+216.333 12.3867
+216.667 12.3863
+217 12.3859
+217.333 12.3856
+217.667 12.3852
+218 12.3848
+218.333 12.3845
+218.667 12.3841
+219 12.3837
+219.333 12.3834
+219.667 12.383
+220 12.3826
+220.333 12.3823
+220.667 12.3819
+221 12.3815
+221.333 12.3812
+221.667 12.3808
+222 12.3804
+222.333 12.3801
+222.667 12.3797
+223 12.3793
+223.333 12.379
+223.667 12.3786
+224 12.3782
+224.333 12.3779
+224.667 12.3775
+225 12.3771
+225.333 12.3768
+225.667 12.3764
+226 12.3761
+226.333 12.3757
+226.667 12.3753
+227 12.375
+227.333 12.3746
+227.667 12.3742
+228 12.3739
+228.333 12.3735
+228.667 12.3732
+229 12.3728
+229.333 12.3724
+229.667 12.3721
+230 12.3717
+230.333 12.3713
+230.667 12.371
+231 12.3706
+231.333 12.3703
+231.667 12.3699
+232 12.3695
+232.333 12.3692
+232.667 12.3688
+233 12.3685
+233.333 12.3681
+233.667 12.3677
+234 12.3674
+234.333 12.367
+234.667 12.3667
+235 12.3663
+235.333 12.3659
+235.667 12.3656
+236 12.3652
+236.333 12.3649
+236.667 12.3645
+237 12.3641
+237.333 12.3638
+237.667 12.3634
+238 12.3631
+238.333 12.3627
+238.667 12.3624
+239 12.362
+239.333 12.3616
+239.667 12.3613
+240 12.3609
+240.333 12.3606
+240.667 12.3602
+241 12.3599
+241.333 12.3595
+241.667 12.3591
+242 12.3588
+242.333 12.3584
+242.667 12.3581
+243 12.3577
+243.333 12.3574
+243.667 12.357
+244 12.3567
+244.333 12.3563
+244.667 12.3559
+245 12.3556
+245.333 12.3552
+245.667 12.3549
+246 12.3545
+246.333 12.3542
+246.667 12.3538
+247 12.3535
+247.333 12.3531
+247.667 12.3527
+248 12.3524
+248.333 12.352
+248.667 12.3517
+249 12.3513
+249.333 12.351
+249.667 12.3506
+250 12.3503
+250.333 12.3499
+250.667 12.3496
+251 12.3492
+251.333 12.3489
+251.667 12.3485
+252 12.3482
+252.333 12.3478
+252.667 12.3474
+253 12.3471
+253.333 12.3467
+253.667 12.3464
+254 12.346
+254.333 12.3457
+254.667 12.3453
+255 12.345
+255.333 12.3446
+255.667 12.3443
+256 12.3439
+256.333 12.3436
+256.667 12.3432
+257 12.3429
+257.333 12.3425
+257.667 12.3422
+258 12.3418
+258.333 12.3415
+258.667 12.3411
+259 12.3408
+259.333 12.3404
+259.667 12.3401
+260 12.3397
+260.333 12.3394
+260.667 12.339
+261 12.3387
+261.333 12.3383
+261.667 12.338
+262 12.3376
+262.333 12.3373
+262.667 12.3369
+263 12.3366
+263.333 12.3362
+263.667 12.3359
+264 12.3355
+264.333 12.3352
+264.667 12.3348
+265 12.3345
+265.333 12.3341
+265.667 12.3338
+266 12.3334
+266.333 12.3331
+266.667 12.3327
+267 12.3324
+267.333 12.332
+267.667 12.3317
+268 12.3313
+268.333 12.331
+268.667 12.3306
+269 12.3303
+269.333 12.3299
+269.667 12.3296
+270 12.3292
+270.333 12.3289
+270.667 12.3285
+271 12.3282
+271.333 12.3278
+271.667 12.3275
+272 12.3271
+272.333 12.3268
+272.667 12.3264
+273 12.3261
+273.333 12.3257
+273.667 12.3254
+274 12.325
+274.333 12.3247
+274.667 12.3243
+275 12.324
+275.333 12.3236
+275.667 12.3233
+276 12.3229
+276.333 12.3226
+276.667 12.3222
+277 12.3219
+277.333 12.3215
+277.667 12.3212
+278 12.3208
+278.333 12.3205
+278.667 12.3201
+279 12.3198
+279.333 12.3195
+279.667 12.3191
+280 12.3188
+280.333 12.3184
+280.667 12.3181
+281 12.3177
+281.333 12.3174
+281.667 12.317
+282 12.3167
+282.333 12.3163
+282.667 12.316
+283 12.3156
+283.333 12.3153
+283.667 12.3149
+284 12.3146
+284.333 12.3142
+284.667 12.3139
+285 12.3135
+285.333 12.3132
+285.667 12.3128
+286 12.3125
+286.333 12.3121
+286.667 12.3118
+287 12.3114
+287.333 12.3111
+287.667 12.3108
+288 12.3104
+288.333 12.3101
+288.667 12.3097
+289 12.3094
+289.333 12.309
+289.667 12.3087
+290 12.3083
+290.333 12.308
+290.667 12.3076
+291 12.3073
+291.333 12.3069
+291.667 12.3066
+292 12.3062
+292.333 12.3059
+292.667 12.3055
+293 12.3052
+293.333 12.3048
+293.667 12.3045
+294 12.3041
+294.333 12.3038
+294.667 12.3034
+295 12.3031
+295.333 12.3027
+295.667 12.3024
+296 12.302
+296.333 12.3017
+296.667 12.3014
+297 12.301
+297.333 12.3007
+297.667 12.3003
+298 12.3
+298.333 12.2996
+298.667 12.2993
+299 12.2989
+299.333 12.2986
+299.667 12.2982
+300 12.2979
+300.333 12.2975
+300.667 12.2972
+301 12.2968
+301.333 12.2965
+301.667 12.2961
+302 12.2958
+302.333 12.2954
+302.667 12.2951
+303 12.2947
+303.333 12.2944
+303.667 12.294
+304 12.2937
+304.333 12.2933
+304.667 12.293
+305 12.2926
+305.333 12.2923
+305.667 12.2919
+306 12.2916
+306.333 12.2912
+306.667 12.2909
+307 12.2905
+307.333 12.2902
+307.667 12.2898
+308 12.2895
+308.333 12.2891
+308.667 12.2888
+309 12.2884
+309.333 12.2881
+309.667 12.2877
+310 12.2874
+310.333 12.287
+310.667 12.2867
+311 12.2863
+311.333 12.286
+311.667 12.2856
+312 12.2853
+312.333 12.2849
+312.667 12.2846
+313 12.2842
+313.333 12.2839
+313.667 12.2835
+314 12.2832
+314.333 12.2828
+314.667 12.2825
+315 12.2821
+315.333 12.2818
+315.667 12.2814
+316 12.2811
+316.333 12.2807
+316.667 12.2804
+317 12.28
+317.333 12.2797
+317.667 12.2793
+318 12.279
+318.333 12.2786
+318.667 12.2783
+319 12.2779
+319.333 12.2776
+319.667 12.2772
+320 12.2769
+320.333 12.2765
+320.667 12.2762
+321 12.2758
+321.333 12.2755
+321.667 12.2751
+322 12.2748
+322.333 12.2744
+322.667 12.274
+323 12.2737
+323.333 12.2733
+323.667 12.273
+324 12.2726
+324.333 12.2723
+324.667 12.2719
+325 12.2716
+325.333 12.2712
+325.667 12.2709
+326 12.2705
+326.333 12.2702
+326.667 12.2698
+327 12.2695
+327.333 12.2691
+327.667 12.2687
+328 12.2684
+328.333 12.268
+328.667 12.2677
+329 12.2673
+329.333 12.267
+329.667 12.2666
+330 12.2663
+330.333 12.2659
+330.667 12.2656
+331 12.2652
+331.333 12.2648
+331.667 12.2645
+332 12.2641
+332.333 12.2638
+332.667 12.2634
+333 12.2631
+333.333 12.2627
+333.667 12.2624
+334 12.262
+334.333 12.2617
+334.667 12.2613
+335 12.2609
+335.333 12.2606
+335.667 12.2602
+336 12.2599
+336.333 12.2595
+336.667 12.2592
+337 12.2588
+337.333 12.2584
+337.667 12.2581
+338 12.2577
+338.333 12.2574
+338.667 12.257
+339 12.2567
+339.333 12.2563
+339.667 12.2559
+340 12.2556
+340.333 12.2552
+340.667 12.2549
+341 12.2545
+341.333 12.2542
+341.667 12.2538
+342 12.2534
+342.333 12.2531
+342.667 12.2527
+343 12.2524
+343.333 12.252
+343.667 12.2516
+344 12.2513
+344.333 12.2509
+344.667 12.2506
+345 12.2502
+345.333 12.2498
+345.667 12.2495
+346 12.2491
+346.333 12.2488
+346.667 12.2484
+347 12.248
+347.333 12.2477
+347.667 12.2473
+348 12.247
+348.333 12.2466
+348.667 12.2462
+349 12.2459
+349.333 12.2455
+349.667 12.2452
+350 12.2448
+350.333 12.2444
+350.667 12.2441
+351 12.2437
+351.333 12.2433
+351.667 12.243
+352 12.2426
+352.333 12.2423
+352.667 12.2419
+353 12.2415
+353.333 12.2412
+353.667 12.2408
+354 12.2404
+354.333 12.2401
+354.667 12.2397
+355 12.2394
+355.333 12.239
+355.667 12.2386
+356 12.2383
+356.333 12.2379
+356.667 12.2375
+357 12.2372
+357.333 12.2368
+357.667 12.2364
+358 12.2361
+358.333 12.2357
+358.667 12.2353
+359 12.235
+359.333 12.2346
+359.667 12.2342
+360 12.2339
+360.333 12.2335
+360.667 12.2332
+361 12.2328
+361.333 12.2324
+361.667 12.2321
+362 12.2317
+362.333 12.2313
+362.667 12.231
+363 12.2306
+363.333 12.2302
+363.667 12.2298
+364 12.2295
+364.333 12.2291
+364.667 12.2287
+365 12.2284
+365.333 12.228
+365.667 12.2276
+366 12.2273
+366.333 12.2269
+366.667 12.2265
+367 12.2262
+367.333 12.2258
+367.667 12.2254
+368 12.2251
+368.333 12.2247
+368.667 12.2243
+369 12.2239
+369.333 12.2236
+369.667 12.2232
+370 12.2228
+370.333 12.2225
+370.667 12.2221
+371 12.2217
+371.333 12.2213
+371.667 12.221
+372 12.2206
+372.333 12.2202
+372.667 12.2199
+373 12.2195
+373.333 12.2191
+373.667 12.2187
+374 12.2184
+374.333 12.218
+374.667 12.2176
+375 12.2172
+375.333 12.2169
+375.667 12.2165
+376 12.2161
+376.333 12.2157
+376.667 12.2154
+377 12.215
+377.333 12.2146
+377.667 12.2142
+378 12.2139
+378.333 12.2135
+378.667 12.2131
+379 12.2127
+379.333 12.2124
+379.667 12.212
+380 12.2116
+380.333 12.2112
+380.667 12.2109
+381 12.2105
+381.333 12.2101
+381.667 12.2097
+382 12.2094
+382.333 12.209
+382.667 12.2086
+383 12.2082
+383.333 12.2078
+383.667 12.2075
+384 12.2071
+384.333 12.2067
+384.667 12.2063
+385 12.2059
+385.333 12.2056
+385.667 12.2052
+386 12.2048
+386.333 12.2044
+386.667 12.204
+387 12.2037
+387.333 12.2033
+387.667 12.2029
+388 12.2025
+388.333 12.2021
+388.667 12.2018
+389 12.2014
+389.333 12.201
+389.667 12.2006
+390 12.2002
+390.333 12.1998
+390.667 12.1995
+391 12.1991
+391.333 12.1987
+391.667 12.1983
+392 12.1979
+392.333 12.1975
+392.667 12.1972
+393 12.1968
+393.333 12.1964
+393.667 12.196
+394 12.1956
+394.333 12.1952
+394.667 12.1949
+395 12.1945
+395.333 12.1941
+395.667 12.1937
+396 12.1933
+396.333 12.1929
+396.667 12.1925
+397 12.1921
+397.333 12.1918
+397.667 12.1914
+398 12.191
+398.333 12.1906
+398.667 12.1902
+399 12.1898
+399.333 12.1894
+399.667 12.189
+400 12.1887
+400.333 12.1883
+400.667 12.1879
+401 12.1875
+401.333 12.1871
+401.667 12.1867
+402 12.1863
+402.333 12.1859
+402.667 12.1855
+403 12.1851
+403.333 12.1847
+403.667 12.1844
+404 12.184
+404.333 12.1836
+404.667 12.1832
+405 12.1828
+405.333 12.1824
+405.667 12.182
+406 12.1816
+406.333 12.1812
+406.667 12.1808
+407 12.1804
+407.333 12.18
+407.667 12.1796
+408 12.1792
+408.333 12.1788
+408.667 12.1785
+409 12.1781
+409.333 12.1777
+409.667 12.1773
+410 12.1769
+410.333 12.1765
+410.667 12.1761
+411 12.1757
+411.333 12.1753
+411.667 12.1749
+412 12.1745
+412.333 12.1741
+412.667 12.1737
+413 12.1733
+413.333 12.1729
+413.667 12.1725
+414 12.1721
+414.333 12.1717
+414.667 12.1713
+415 12.1709
+415.333 12.1705
+415.667 12.1701
+416 12.1697
+416.333 12.1693
+416.667 12.1689
+417 12.1685
+417.333 12.1681
+417.667 12.1677
+418 12.1673
+418.333 12.1669
+418.667 12.1665
+419 12.1661
+419.333 12.1657
+419.667 12.1653
+420 12.1649
+420.333 12.1645
+420.667 12.1641
+421 12.1636
+421.333 12.1632
+421.667 12.1628
+422 12.1624
+422.333 12.162
+422.667 12.1616
+423 12.1612
+423.333 12.1608
+423.667 12.1604
+424 12.16
+424.333 12.1596
+424.667 12.1592
+425 12.1588
+425.333 12.1584
+425.667 12.158
+426 12.1575
+426.333 12.1571
+426.667 12.1567
+427 12.1563
+427.333 12.1559
+427.667 12.1555
+428 12.1551
+428.333 12.1547
+428.667 12.1543
+429 12.1538
+429.333 12.1534
+429.667 12.153
+430 12.1526
+430.333 12.1522
+430.667 12.1518
+431 12.1514
+431.333 12.151
+431.667 12.1505
+432 12.1501
+432.333 12.1497
+432.667 12.1493
+433 12.1489
+433.333 12.1485
+433.667 12.1481
+434 12.1476
+434.333 12.1472
+434.667 12.1468
+435 12.1464
+435.333 12.146
+435.667 12.1456
+436 12.1451
+436.333 12.1447
+436.667 12.1443
+437 12.1439
+437.333 12.1435
+437.667 12.1431
+438 12.1426
+438.333 12.1422
+438.667 12.1418
+439 12.1414
+439.333 12.141
+439.667 12.1405
+440 12.1401
+440.333 12.1397
+440.667 12.1393
+441 12.1388
+441.333 12.1384
+441.667 12.138
+442 12.1376
+442.333 12.1372
+442.667 12.1367
+443 12.1363
+443.333 12.1359
+443.667 12.1355
+444 12.135
+444.333 12.1346
+444.667 12.1342
+445 12.1338
+445.333 12.1333
+445.667 12.1329
+446 12.1325
+446.333 12.1321
+446.667 12.1316
+447 12.1312
+447.333 12.1308
+447.667 12.1303
+448 12.1299
+448.333 12.1295
+448.667 12.1291
+449 12.1286
+449.333 12.1282
+449.667 12.1278
+450 12.1273
+450.333 12.1269
+450.667 12.1265
+451 12.126
+451.333 12.1256
+451.667 12.1252
+452 12.1247
+452.333 12.1243
+452.667 12.1239
+453 12.1234
+453.333 12.123
+453.667 12.1226
+454 12.1221
+454.333 12.1217
+454.667 12.1213
+455 12.1208
+455.333 12.1204
+455.667 12.12
+456 12.1195
+456.333 12.1191
+456.667 12.1187
+457 12.1182
+457.333 12.1178
+457.667 12.1173
+458 12.1169
+458.333 12.1165
+458.667 12.116
+459 12.1156
+459.333 12.1151
+459.667 12.1147
+460 12.1143
+460.333 12.1138
+460.667 12.1134
+461 12.1129
+461.333 12.1125
+461.667 12.1121
+462 12.1116
+462.333 12.1112
+462.667 12.1107
+463 12.1103
+463.333 12.1098
+463.667 12.1094
+464 12.109
+464.333 12.1085
+464.667 12.1081
+465 12.1076
+465.333 12.1072
+465.667 12.1067
+466 12.1063
+466.333 12.1058
+466.667 12.1054
+467 12.1049
+467.333 12.1045
+467.667 12.104
+468 12.1036
+468.333 12.1031
+468.667 12.1027
+469 12.1022
+469.333 12.1018
+469.667 12.1013
+470 12.1009
+470.333 12.1004
+470.667 12.1
+471 12.0995
+471.333 12.0991
+471.667 12.0986
+472 12.0982
+472.333 12.0977
+472.667 12.0973
+473 12.0968
+473.333 12.0964
+473.667 12.0959
+474 12.0955
+474.333 12.095
+474.667 12.0945
+475 12.0941
+475.333 12.0936
+475.667 12.0932
+476 12.0927
+476.333 12.0923
+476.667 12.0918
+477 12.0913
+477.333 12.0909
+477.667 12.0904
+478 12.09
+478.333 12.0895
+478.667 12.089
+479 12.0886
+479.333 12.0881
+479.667 12.0877
+480 12.0872
+480.333 12.0867
+480.667 12.0863
+481 12.0858
+481.333 12.0853
+481.667 12.0849
+482 12.0844
+482.333 12.084
+482.667 12.0835
+483 12.083
+483.333 12.0826
+483.667 12.0821
+484 12.0816
+484.333 12.0812
+484.667 12.0807
+485 12.0802
+485.333 12.0798
+485.667 12.0793
+486 12.0788
+486.333 12.0783
+486.667 12.0779
+487 12.0774
+487.333 12.0769
+487.667 12.0765
+488 12.076
+488.333 12.0755
+488.667 12.075
+489 12.0746
+489.333 12.0741
+489.667 12.0736
+490 12.0732
+490.333 12.0727
+490.667 12.0722
+491 12.0717
+491.333 12.0713
+491.667 12.0708
+492 12.0703
+492.333 12.0698
+492.667 12.0694
+493 12.0689
+493.333 12.0684
+493.667 12.0679
+494 12.0674
+494.333 12.067
+494.667 12.0665
+495 12.066
+495.333 12.0655
+495.667 12.065
+496 12.0646
+496.333 12.0641
+496.667 12.0636
+497 12.0631
+497.333 12.0626
+497.667 12.0621
+498 12.0617
+498.333 12.0612
+498.667 12.0607
+499 12.0602
+499.333 12.0597
+499.667 12.0592
+500 12.0588
+500.333 12.0583
+500.667 12.0578
+501 12.0573
+501.333 12.0568
+501.667 12.0563
+502 12.0558
+502.333 12.0553
+502.667 12.0548
+503 12.0544
+503.333 12.0539
+503.667 12.0534
+504 12.0529
+504.333 12.0524
+504.667 12.0519
+505 12.0514
+505.333 12.0509
+505.667 12.0504
+506 12.0499
+506.333 12.0494
+506.667 12.0489
+507 12.0484
+507.333 12.048
+507.667 12.0475
+508 12.047
+508.333 12.0465
+508.667 12.046
+509 12.0455
+509.333 12.045
+509.667 12.0445
+510 12.044
+510.333 12.0435
+510.667 12.043
+511 12.0425
+511.333 12.042
+511.667 12.0415
+512 12.041
+512.333 12.0405
+512.667 12.04
+513 12.0395
+513.333 12.039
+513.667 12.0384
+514 12.0379
+514.333 12.0374
+514.667 12.0369
+515 12.0364
+515.333 12.0359
+515.667 12.0354
+516 12.0349
+516.333 12.0344
+516.667 12.0339
+517 12.0334
+517.333 12.0329
+517.667 12.0324
+518 12.0319
+518.333 12.0313
+518.667 12.0308
+519 12.0303
+519.333 12.0298
+519.667 12.0293
+520 12.0288
+520.333 12.0283
+520.667 12.0278
+521 12.0272
+521.333 12.0267
+521.667 12.0262
+522 12.0257
+522.333 12.0252
+522.667 12.0247
+523 12.0241
+523.333 12.0236
+523.667 12.0231
+524 12.0226
+524.333 12.0221
+524.667 12.0216
+525 12.021
+525.333 12.0205
+525.667 12.02
+526 12.0195
+526.333 12.0189
+526.667 12.0184
+527 12.0179
+527.333 12.0174
+527.667 12.0169
+528 12.0163
+528.333 12.0158
+528.667 12.0153
+529 12.0148
+529.333 12.0142
+529.667 12.0137
+530 12.0132
+530.333 12.0126
+530.667 12.0121
+531 12.0116
+531.333 12.0111
+531.667 12.0105
+532 12.01
+532.333 12.0095
+532.667 12.0089
+533 12.0084
+533.333 12.0079
+533.667 12.0073
+534 12.0068
+534.333 12.0063
+534.667 12.0057
+535 12.0052
+535.333 12.0047
+535.667 12.0041
+536 12.0036
+536.333 12.0031
+536.667 12.0025
+537 12.002
+537.333 12.0014
+537.667 12.0009
+538 12.0004
+538.333 11.9998
+538.667 11.9993
+539 11.9987
+539.333 11.9982
+539.667 11.9977
+540 11.9971
+540.333 11.9966
+540.667 11.996
+541 11.9955
+541.333 11.9949
+541.667 11.9944
+542 11.9939
+542.333 11.9933
+542.667 11.9928
+543 11.9922
+543.333 11.9917
+543.667 11.9911
+544 11.9906
+544.333 11.99
+544.667 11.9895
+545 11.9889
+545.333 11.9884
+545.667 11.9878
+546 11.9873
+546.333 11.9867
+546.667 11.9862
+547 11.9856
+547.333 11.9851
+547.667 11.9845
+548 11.9839
+548.333 11.9834
+548.667 11.9828
+549 11.9823
+549.333 11.9817
+549.667 11.9812
+550 11.9806
+550.333 11.98
+550.667 11.9795
+551 11.9789
+551.333 11.9784
+551.667 11.9778
+552 11.9772
+552.333 11.9767
+552.667 11.9761
+553 11.9755
+553.333 11.975
+553.667 11.9744
+554 11.9739
+554.333 11.9733
+554.667 11.9727
+555 11.9722
+555.333 11.9716
+555.667 11.971
+556 11.9705
+556.333 11.9699
+556.667 11.9693
+557 11.9687
+557.333 11.9682
+557.667 11.9676
+558 11.967
+558.333 11.9665
+558.667 11.9659
+559 11.9653
+559.333 11.9647
+559.667 11.9642
+560 11.9636
+560.333 11.963
+560.667 11.9624
+561 11.9619
+561.333 11.9613
+561.667 11.9607
+562 11.9601
+562.333 11.9595
+562.667 11.959
+563 11.9584
+563.333 11.9578
+563.667 11.9572
+564 11.9566
+564.333 11.9561
+564.667 11.9555
+565 11.9549
+565.333 11.9543
+565.667 11.9537
+566 11.9531
+566.333 11.9525
+566.667 11.952
+567 11.9514
+567.333 11.9508
+567.667 11.9502
+568 11.9496
+568.333 11.949
+568.667 11.9484
+569 11.9478
+569.333 11.9472
+569.667 11.9466
+570 11.9461
+570.333 11.9455
+570.667 11.9449
+571 11.9443
+571.333 11.9437
+571.667 11.9431
+572 11.9425
+572.333 11.9419
+572.667 11.9413
+573 11.9407
+573.333 11.9401
+573.667 11.9395
+574 11.9389
+574.333 11.9383
+574.667 11.9377
+575 11.9371
+575.333 11.9365
+575.667 11.9359
+576 11.9353
+576.333 11.9347
+576.667 11.9341
+577 11.9335
+577.333 11.9328
+577.667 11.9322
+578 11.9316
+578.333 11.931
+578.667 11.9304
+579 11.9298
+579.333 11.9292
+579.667 11.9286
+580 11.928
+580.333 11.9274
+580.667 11.9267
+581 11.9261
+581.333 11.9255
+581.667 11.9249
+582 11.9243
+582.333 11.9237
+582.667 11.9231
+583 11.9224
+583.333 11.9218
+583.667 11.9212
+584 11.9206
+584.333 11.92
+584.667 11.9193
+585 11.9187
+585.333 11.9181
+585.667 11.9175
+586 11.9169
+586.333 11.9162
+586.667 11.9156
+587 11.915
+587.333 11.9144
+587.667 11.9137
+588 11.9131
+588.333 11.9125
+588.667 11.9118
+589 11.9112
+589.333 11.9106
+589.667 11.91
+590 11.9093
+590.333 11.9087
+590.667 11.9081
+591 11.9074
+591.333 11.9068
+591.667 11.9062
+592 11.9055
+592.333 11.9049
+592.667 11.9042
+593 11.9036
+593.333 11.903
+593.667 11.9023
+594 11.9017
+594.333 11.901
+594.667 11.9004
+595 11.8998
+595.333 11.8991
+595.667 11.8985
+596 11.8978
+596.333 11.8972
+596.667 11.8965
+597 11.8959
+597.333 11.8953
+597.667 11.8946
+598 11.894
+598.333 11.8933
+598.667 11.8927
+599 11.892
+599.333 11.8914
+599.667 11.8907
+600 11.8901
+600.333 11.8894
+600.667 11.8888
+601 11.8881
+601.333 11.8874
+601.667 11.8868
+602 11.8861
+602.333 11.8855
+602.667 11.8848
+603 11.8842
+603.333 11.8835
+603.667 11.8828
+604 11.8822
+604.333 11.8815
+604.667 11.8809
+605 11.8802
+605.333 11.8795
+605.667 11.8789
+606 11.8782
+606.333 11.8775
+606.667 11.8769
+607 11.8762
+607.333 11.8755
+607.667 11.8749
+608 11.8742
+608.333 11.8735
+608.667 11.8729
+609 11.8722
+609.333 11.8715
+609.667 11.8708
+610 11.8702
+610.333 11.8695
+610.667 11.8688
+611 11.8681
+611.333 11.8675
+611.667 11.8668
+612 11.8661
+612.333 11.8654
+612.667 11.8647
+613 11.8641
+613.333 11.8634
+613.667 11.8627
+614 11.862
+614.333 11.8613
+614.667 11.8607
+615 11.86
+615.333 11.8593
+615.667 11.8586
+616 11.8579
+616.333 11.8572
+616.667 11.8565
+617 11.8558
+617.333 11.8551
+617.667 11.8545
+618 11.8538
+618.333 11.8531
+618.667 11.8524
+619 11.8517
+619.333 11.851
+619.667 11.8503
+620 11.8496
+620.333 11.8489
+620.667 11.8482
+621 11.8475
+621.333 11.8468
+621.667 11.8461
+622 11.8454
+622.333 11.8447
+622.667 11.844
+623 11.8433
+623.333 11.8426
+623.667 11.8419
+624 11.8412
+624.333 11.8405
+624.667 11.8398
+625 11.839
+625.333 11.8383
+625.667 11.8376
+626 11.8369
+626.333 11.8362
+626.667 11.8355
+627 11.8348
+627.333 11.8341
+627.667 11.8333
+628 11.8326
+628.333 11.8319
+628.667 11.8312
+629 11.8305
+629.333 11.8298
+629.667 11.829
+630 11.8283
+630.333 11.8276
+630.667 11.8269
+631 11.8262
+631.333 11.8254
+631.667 11.8247
+632 11.824
+632.333 11.8232
+632.667 11.8225
+633 11.8218
+633.333 11.8211
+633.667 11.8203
+634 11.8196
+634.333 11.8189
+634.667 11.8181
+635 11.8174
+635.333 11.8167
+635.667 11.8159
+636 11.8152
+636.333 11.8145
+636.667 11.8137
+637 11.813
+637.333 11.8122
+637.667 11.8115
+638 11.8108
+638.333 11.81
+638.667 11.8093
+639 11.8085
+639.333 11.8078
+639.667 11.807
+640 11.8063
+640.333 11.8055
+640.667 11.8048
+641 11.804
+641.333 11.8033
+641.667 11.8025
+642 11.8018
+642.333 11.801
+642.667 11.8003
+643 11.7995
+643.333 11.7988
+643.667 11.798
+644 11.7973
+644.333 11.7965
+644.667 11.7957
+645 11.795
+645.333 11.7942
+645.667 11.7935
+646 11.7927
+646.333 11.7919
+646.667 11.7912
+647 11.7904
+647.333 11.7896
+647.667 11.7889
+648 11.7881
+648.333 11.7873
+648.667 11.7866
+649 11.7858
+649.333 11.785
+649.667 11.7843
+650 11.7835
+650.333 11.7827
+650.667 11.7819
+651 11.7812
+651.333 11.7804
+651.667 11.7796
+652 11.7788
+652.333 11.778
+652.667 11.7773
+653 11.7765
+653.333 11.7757
+653.667 11.7749
+654 11.7741
+654.333 11.7733
+654.667 11.7725
+655 11.7718
+655.333 11.771
+655.667 11.7702
+656 11.7694
+656.333 11.7686
+656.667 11.7678
+657 11.767
+657.333 11.7662
+657.667 11.7654
+658 11.7646
+658.333 11.7638
+658.667 11.763
+659 11.7622
+659.333 11.7614
+659.667 11.7606
+660 11.7598
+660.333 11.759
+660.667 11.7582
+661 11.7574
+661.333 11.7566
+661.667 11.7558
+662 11.755
+662.333 11.7542
+662.667 11.7534
+663 11.7526
+663.333 11.7518
+663.667 11.7509
+664 11.7501
+664.333 11.7493
+664.667 11.7485
+665 11.7477
+665.333 11.7469
+665.667 11.746
+666 11.7452
+666.333 11.7444
+666.667 11.7436
+667 11.7428
+667.333 11.7419
+667.667 11.7411
+668 11.7403
+668.333 11.7394
+668.667 11.7386
+669 11.7378
+669.333 11.737
+669.667 11.7361
+670 11.7353
+670.333 11.7345
+670.667 11.7336
+671 11.7328
+671.333 11.732
+671.667 11.7311
+672 11.7303
+672.333 11.7294
+672.667 11.7286
+673 11.7278
+673.333 11.7269
+673.667 11.7261
+674 11.7252
+674.333 11.7244
+674.667 11.7235
+675 11.7227
+675.333 11.7218
+675.667 11.721
+676 11.7201
+676.333 11.7193
+676.667 11.7184
+677 11.7176
+677.333 11.7167
+677.667 11.7159
+678 11.715
+678.333 11.7141
+678.667 11.7133
+679 11.7124
+679.333 11.7116
+679.667 11.7107
+680 11.7098
+680.333 11.709
+680.667 11.7081
+681 11.7072
+681.333 11.7064
+681.667 11.7055
+682 11.7046
+682.333 11.7037
+682.667 11.7029
+683 11.702
+683.333 11.7011
+683.667 11.7002
+684 11.6994
+684.333 11.6985
+684.667 11.6976
+685 11.6967
+685.333 11.6958
+685.667 11.695
+686 11.6941
+686.333 11.6932
+686.667 11.6923
+687 11.6914
+687.333 11.6905
+687.667 11.6896
+688 11.6887
+688.333 11.6878
+688.667 11.687
+689 11.6861
+689.333 11.6852
+689.667 11.6843
+690 11.6834
+690.333 11.6825
+690.667 11.6816
+691 11.6807
+691.333 11.6798
+691.667 11.6789
+692 11.678
+692.333 11.677
+692.667 11.6761
+693 11.6752
+693.333 11.6743
+693.667 11.6734
+694 11.6725
+694.333 11.6716
+694.667 11.6707
+695 11.6697
+695.333 11.6688
+695.667 11.6679
+696 11.667
+696.333 11.6661
+696.667 11.6651
+697 11.6642
+697.333 11.6633
+697.667 11.6624
+698 11.6614
+698.333 11.6605
+698.667 11.6596
+699 11.6587
+699.333 11.6577
+699.667 11.6568
+700 11.6559
+700.333 11.6549
+700.667 11.654
+701 11.653
+701.333 11.6521
+701.667 11.6512
+702 11.6502
+702.333 11.6493
+702.667 11.6483
+703 11.6474
+703.333 11.6464
+703.667 11.6455
+704 11.6445
+704.333 11.6436
+704.667 11.6426
+705 11.6417
+705.333 11.6407
+705.667 11.6398
+706 11.6388
+706.333 11.6379
+706.667 11.6369
+707 11.6359
+707.333 11.635
+707.667 11.634
+708 11.633
+708.333 11.6321
+708.667 11.6311
+709 11.6301
+709.333 11.6292
+709.667 11.6282
+710 11.6272
+710.333 11.6263
+710.667 11.6253
+711 11.6243
+711.333 11.6233
+711.667 11.6223
+712 11.6214
+712.333 11.6204
+712.667 11.6194
+713 11.6184
+713.333 11.6174
+713.667 11.6164
+714 11.6155
+714.333 11.6145
+714.667 11.6135
+715 11.6125
+715.333 11.6115
+715.667 11.6105
+716 11.6095
+716.333 11.6085
+716.667 11.6075
+717 11.6065
+717.333 11.6055
+717.667 11.6045
+718 11.6035
+718.333 11.6025
+718.667 11.6015
+719 11.6005
+719.333 11.5994
+719.667 11.5984
+720 11.5974
+720.333 11.5964
+720.667 11.5954
+721 11.5944
+721.333 11.5933
+721.667 11.5923
+722 11.5913
+722.333 11.5903
+722.667 11.5893
+723 11.5882
+723.333 11.5872
+723.667 11.5862
+724 11.5851
+724.333 11.5841
+724.667 11.5831
+725 11.582
+725.333 11.581
+725.667 11.58
+726 11.5789
+726.333 11.5779
+726.667 11.5768
+727 11.5758
+727.333 11.5748
+727.667 11.5737
+728 11.5727
+728.333 11.5716
+728.667 11.5706
+729 11.5695
+729.333 11.5685
+729.667 11.5674
+730 11.5663
+730.333 11.5653
+730.667 11.5642
+731 11.5632
+731.333 11.5621
+731.667 11.561
+732 11.56
+732.333 11.5589
+732.667 11.5578
+733 11.5568
+733.333 11.5557
+733.667 11.5546
+734 11.5535
+734.333 11.5525
+734.667 11.5514
+735 11.5503
+735.333 11.5492
+735.667 11.5481
+736 11.5471
+736.333 11.546
+736.667 11.5449
+737 11.5438
+737.333 11.5427
+737.667 11.5416
+738 11.5405
+738.333 11.5394
+738.667 11.5383
+739 11.5372
+739.333 11.5361
+739.667 11.535
+740 11.5339
+740.333 11.5328
+740.667 11.5317
+741 11.5306
+741.333 11.5295
+741.667 11.5284
+742 11.5273
+742.333 11.5261
+742.667 11.525
+743 11.5239
+743.333 11.5228
+743.667 11.5217
+744 11.5206
+744.333 11.5194
+744.667 11.5183
+745 11.5172
+745.333 11.516
+745.667 11.5149
+746 11.5138
+746.333 11.5126
+746.667 11.5115
+747 11.5104
+747.333 11.5092
+747.667 11.5081
+748 11.5069
+748.333 11.5058
+748.667 11.5047
+749 11.5035
+749.333 11.5024
+749.667 11.5012
+750 11.5001
+750.333 11.4989
+750.667 11.4977
+751 11.4966
+751.333 11.4954
+751.667 11.4943
+752 11.4931
+752.333 11.4919
+752.667 11.4908
+753 11.4896
+753.333 11.4884
+753.667 11.4873
+754 11.4861
+754.333 11.4849
+754.667 11.4837
+755 11.4826
+755.333 11.4814
+755.667 11.4802
+756 11.479
+756.333 11.4778
+756.667 11.4766
+757 11.4754
+757.333 11.4743
+757.667 11.4731
+758 11.4719
+758.333 11.4707
+758.667 11.4695
+759 11.4683
+759.333 11.4671
+759.667 11.4659
+760 11.4647
+760.333 11.4635
+760.667 11.4622
+761 11.461
+761.333 11.4598
+761.667 11.4586
+762 11.4574
+762.333 11.4562
+762.667 11.455
+763 11.4537
+763.333 11.4525
+763.667 11.4513
+764 11.4501
+764.333 11.4488
+764.667 11.4476
+765 11.4464
+765.333 11.4451
+765.667 11.4439
+766 11.4426
+766.333 11.4414
+766.667 11.4402
+767 11.4389
+767.333 11.4377
+767.667 11.4364
+768 11.4352
+768.333 11.4339
+768.667 11.4327
+769 11.4314
+769.333 11.4302
+769.667 11.4289
+770 11.4276
+770.333 11.4264
+770.667 11.4251
+771 11.4238
+771.333 11.4226
+771.667 11.4213
+772 11.42
+772.333 11.4187
+772.667 11.4175
+773 11.4162
+773.333 11.4149
+773.667 11.4136
+774 11.4123
+774.333 11.411
+774.667 11.4098
+775 11.4085
+775.333 11.4072
+775.667 11.4059
+776 11.4046
+776.333 11.4033
+776.667 11.402
+777 11.4007
+777.333 11.3994
+777.667 11.398
+778 11.3967
+778.333 11.3954
+778.667 11.3941
+779 11.3928
+779.333 11.3915
+779.667 11.3902
+780 11.3888
+780.333 11.3875
+780.667 11.3862
+781 11.3849
+781.333 11.3835
+781.667 11.3822
+782 11.3809
+782.333 11.3795
+782.667 11.3782
+783 11.3768
+783.333 11.3755
+783.667 11.3741
+784 11.3728
+784.333 11.3714
+784.667 11.3701
+785 11.3687
+785.333 11.3674
+785.667 11.366
+786 11.3647
+786.333 11.3633
+786.667 11.3619
+787 11.3606
+787.333 11.3592
+787.667 11.3578
+788 11.3564
+788.333 11.3551
+788.667 11.3537
+789 11.3523
+789.333 11.3509
+789.667 11.3495
+790 11.3481
+790.333 11.3468
+790.667 11.3454
+791 11.344
+791.333 11.3426
+791.667 11.3412
+792 11.3398
+792.333 11.3384
+792.667 11.337
+793 11.3356
+793.333 11.3341
+793.667 11.3327
+794 11.3313
+794.333 11.3299
+794.667 11.3285
+795 11.3271
+795.333 11.3256
+795.667 11.3242
+796 11.3228
+796.333 11.3213
+796.667 11.3199
+797 11.3185
+797.333 11.317
+797.667 11.3156
+798 11.3141
+798.333 11.3127
+798.667 11.3113
+799 11.3098
+799.333 11.3083
+799.667 11.3069
+800 11.3054
+800.333 11.304
+800.667 11.3025
+801 11.301
+801.333 11.2996
+801.667 11.2981
+802 11.2966
+802.333 11.2952
+802.667 11.2937
+803 11.2922
+803.333 11.2907
+803.667 11.2892
+804 11.2877
+804.333 11.2863
+804.667 11.2848
+805 11.2833
+805.333 11.2818
+805.667 11.2803
+806 11.2788
+806.333 11.2773
+806.667 11.2758
+807 11.2742
+807.333 11.2727
+807.667 11.2712
+808 11.2697
+808.333 11.2682
+808.667 11.2666
+809 11.2651
+809.333 11.2636
+809.667 11.2621
+810 11.2605
+810.333 11.259
+810.667 11.2575
+811 11.2559
+811.333 11.2544
+811.667 11.2528
+812 11.2513
+812.333 11.2497
+812.667 11.2482
+813 11.2466
+813.333 11.245
+813.667 11.2435
+814 11.2419
+814.333 11.2403
+814.667 11.2388
+815 11.2372
+815.333 11.2356
+815.667 11.234
+816 11.2325
+816.333 11.2309
+816.667 11.2293
+817 11.2277
+817.333 11.2261
+817.667 11.2245
+818 11.2229
+818.333 11.2213
+818.667 11.2197
+819 11.2181
+819.333 11.2165
+819.667 11.2149
+820 11.2133
+820.333 11.2116
+820.667 11.21
+821 11.2084
+821.333 11.2068
+821.667 11.2051
+822 11.2035
+822.333 11.2019
+822.667 11.2002
+823 11.1986
+823.333 11.197
+823.667 11.1953
+824 11.1937
+824.333 11.192
+824.667 11.1903
+825 11.1887
+825.333 11.187
+825.667 11.1854
+826 11.1837
+826.333 11.182
+826.667 11.1804
+827 11.1787
+827.333 11.177
+827.667 11.1753
+828 11.1736
+828.333 11.1719
+828.667 11.1702
+829 11.1686
+829.333 11.1669
+829.667 11.1652
+830 11.1635
+830.333 11.1617
+830.667 11.16
+831 11.1583
+831.333 11.1566
+831.667 11.1549
+832 11.1532
+832.333 11.1514
+832.667 11.1497
+833 11.148
+833.333 11.1462
+833.667 11.1445
+834 11.1428
+834.333 11.141
+834.667 11.1393
+835 11.1375
+835.333 11.1358
+835.667 11.134
+836 11.1322
+836.333 11.1305
+836.667 11.1287
+837 11.1269
+837.333 11.1252
+837.667 11.1234
+838 11.1216
+838.333 11.1198
+838.667 11.118
+839 11.1163
+839.333 11.1145
+839.667 11.1127
+840 11.1109
+840.333 11.1091
+840.667 11.1073
+841 11.1055
+841.333 11.1036
+841.667 11.1018
+842 11.1
+842.333 11.0982
+842.667 11.0964
+843 11.0945
+843.333 11.0927
+843.667 11.0909
+844 11.089
+844.333 11.0872
+844.667 11.0853
+845 11.0835
+845.333 11.0816
+845.667 11.0798
+846 11.0779
+846.333 11.076
+846.667 11.0742
+847 11.0723
+847.333 11.0704
+847.667 11.0685
+848 11.0667
+848.333 11.0648
+848.667 11.0629
+849 11.061
+849.333 11.0591
+849.667 11.0572
+850 11.0553
+850.333 11.0534
+850.667 11.0515
+851 11.0496
+851.333 11.0476
+851.667 11.0457
+852 11.0438
+852.333 11.0419
+852.667 11.0399
+853 11.038
+853.333 11.036
+853.667 11.0341
+854 11.0322
+854.333 11.0302
+854.667 11.0282
+855 11.0263
+855.333 11.0243
+855.667 11.0224
+856 11.0204
+856.333 11.0184
+856.667 11.0164
+857 11.0145
+857.333 11.0125
+857.667 11.0105
+858 11.0085
+858.333 11.0065
+858.667 11.0045
+859 11.0025
+859.333 11.0005
+859.667 10.9985
+860 10.9964
+860.333 10.9944
+860.667 10.9924
+861 10.9904
+861.333 10.9883
+861.667 10.9863
+862 10.9842
+862.333 10.9822
+862.667 10.9802
+863 10.9781
+863.333 10.976
+863.667 10.974
+864 10.9719
+864.333 10.9698
+864.667 10.9678
+865 10.9657
+865.333 10.9636
+865.667 10.9615
+866 10.9594
+866.333 10.9573
+866.667 10.9552
+867 10.9531
+867.333 10.951
+867.667 10.9489
+868 10.9468
+868.333 10.9447
+868.667 10.9426
+869 10.9404
+869.333 10.9383
+869.667 10.9362
+870 10.934
+870.333 10.9319
+870.667 10.9297
+871 10.9276
+871.333 10.9254
+871.667 10.9232
+872 10.9211
+872.333 10.9189
+872.667 10.9167
+873 10.9146
+873.333 10.9124
+873.667 10.9102
+874 10.908
+874.333 10.9058
+874.667 10.9036
+875 10.9014
+875.333 10.8992
+875.667 10.8969
+876 10.8947
+876.333 10.8925
+876.667 10.8903
+877 10.888
+877.333 10.8858
+877.667 10.8835
+878 10.8813
+878.333 10.879
+878.667 10.8768
+879 10.8745
+879.333 10.8723
+879.667 10.87
+880 10.8677
+880.333 10.8654
+880.667 10.8631
+881 10.8608
+881.333 10.8585
+881.667 10.8562
+882 10.8539
+882.333 10.8516
+882.667 10.8493
+883 10.847
+883.333 10.8447
+883.667 10.8423
+884 10.84
+884.333 10.8377
+884.667 10.8353
+885 10.833
+885.333 10.8306
+885.667 10.8283
+886 10.8259
+886.333 10.8235
+886.667 10.8211
+887 10.8188
+887.333 10.8164
+887.667 10.814
+888 10.8116
+888.333 10.8092
+888.667 10.8068
+889 10.8044
+889.333 10.802
+889.667 10.7995
+890 10.7971
+890.333 10.7947
+890.667 10.7922
+891 10.7898
+891.333 10.7874
+891.667 10.7849
+892 10.7824
+892.333 10.78
+892.667 10.7775
+893 10.775
+893.333 10.7726
+893.667 10.7701
+894 10.7676
+894.333 10.7651
+894.667 10.7626
+895 10.7601
+895.333 10.7576
+895.667 10.7551
+896 10.7525
+896.333 10.75
+896.667 10.7475
+897 10.7449
+897.333 10.7424
+897.667 10.7398
+898 10.7373
+898.333 10.7347
+898.667 10.7321
+899 10.7296
+899.333 10.727
+899.667 10.7244
+900 10.7218
+900.333 10.7192
+900.667 10.7166
+901 10.714
+901.333 10.7114
+901.667 10.7088
+902 10.7062
+902.333 10.7035
+902.667 10.7009
+903 10.6982
+903.333 10.6956
+903.667 10.6929
+904 10.6903
+904.333 10.6876
+904.667 10.6849
+905 10.6823
+905.333 10.6796
+905.667 10.6769
+906 10.6742
+906.333 10.6715
+906.667 10.6688
+907 10.6661
+907.333 10.6633
+907.667 10.6606
+908 10.6579
+908.333 10.6551
+908.667 10.6524
+909 10.6496
+909.333 10.6469
+909.667 10.6441
+910 10.6413
+910.333 10.6386
+910.667 10.6358
+911 10.633
+911.333 10.6302
+911.667 10.6274
+912 10.6246
+912.333 10.6217
+912.667 10.6189
+913 10.6161
+913.333 10.6133
+913.667 10.6104
+914 10.6076
+914.333 10.6047
+914.667 10.6018
+915 10.599
+915.333 10.5961
+915.667 10.5932
+916 10.5903
+916.333 10.5874
+e
+0 12.7839
+0.333333 12.7586
+0.666667 12.7438
+1 12.7352
+1.33333 12.7299
+1.66667 12.7263
+2 12.7235
+2.33333 12.7212
+2.66667 12.7191
+3 12.7171
+3.33333 12.7152
+3.66667 12.7133
+4 12.7115
+4.33333 12.7096
+4.66667 12.7078
+5 12.706
+5.33333 12.7042
+5.66667 12.7024
+6 12.7006
+6.33333 12.6989
+6.66667 12.6971
+7 12.6953
+7.33333 12.6936
+7.66667 12.6918
+8 12.6901
+8.33333 12.6884
+8.66667 12.6867
+9 12.6849
+9.33333 12.6832
+9.66667 12.6815
+10 12.6798
+10.3333 12.6781
+10.6667 12.6765
+11 12.6748
+11.3333 12.6731
+11.6667 12.6715
+12 12.6698
+12.3333 12.6682
+12.6667 12.6665
+13 12.6649
+13.3333 12.6633
+13.6667 12.6617
+14 12.66
+14.3333 12.6584
+14.6667 12.6568
+15 12.6552
+15.3333 12.6537
+15.6667 12.6521
+16 12.6505
+16.3333 12.6489
+16.6667 12.6474
+17 12.6458
+17.3333 12.6443
+17.6667 12.6427
+18 12.6412
+18.3333 12.6397
+18.6667 12.6382
+19 12.6367
+19.3333 12.6351
+19.6667 12.6336
+20 12.6321
+20.3333 12.6306
+20.6667 12.6292
+21 12.6277
+21.3333 12.6262
+21.6667 12.6247
+22 12.6233
+22.3333 12.6218
+22.6667 12.6204
+23 12.6189
+23.3333 12.6175
+23.6667 12.6161
+24 12.6146
+24.3333 12.6132
+24.6667 12.6118
+25 12.6104
+25.3333 12.609
+25.6667 12.6076
+26 12.6062
+26.3333 12.6048
+26.6667 12.6034
+27 12.602
+27.3333 12.6007
+27.6667 12.5993
+28 12.5979
+28.3333 12.5966
+28.6667 12.5952
+29 12.5939
+29.3333 12.5925
+29.6667 12.5912
+30 12.5899
+30.3333 12.5885
+30.6667 12.5872
+31 12.5859
+31.3333 12.5846
+31.6667 12.5833
+32 12.582
+32.3333 12.5807
+32.6667 12.5794
+33 12.5781
+33.3333 12.5768
+33.6667 12.5755
+34 12.5743
+34.3333 12.573
+34.6667 12.5717
+35 12.5705
+35.3333 12.5692
+35.6667 12.568
+36 12.5667
+36.3333 12.5655
+36.6667 12.5643
+37 12.563
+37.3333 12.5618
+37.6667 12.5606
+38 12.5594
+38.3333 12.5581
+38.6667 12.5569
+39 12.5557
+39.3333 12.5545
+39.6667 12.5533
+40 12.5521
+40.3333 12.5509
+40.6667 12.5498
+41 12.5486
+41.3333 12.5474
+41.6667 12.5462
+42 12.5451
+42.3333 12.5439
+42.6667 12.5427
+43 12.5416
+43.3333 12.5404
+43.6667 12.5393
+44 12.5381
+44.3333 12.537
+44.6667 12.5359
+45 12.5347
+45.3333 12.5336
+45.6667 12.5325
+46 12.5314
+46.3333 12.5302
+46.6667 12.5291
+47 12.528
+47.3333 12.5269
+47.6667 12.5258
+48 12.5247
+48.3333 12.5236
+48.6667 12.5225
+49 12.5214
+49.3333 12.5204
+49.6667 12.5193
+50 12.5182
+50.3333 12.5171
+50.6667 12.5161
+51 12.515
+51.3333 12.5139
+51.6667 12.5129
+52 12.5118
+52.3333 12.5108
+52.6667 12.5097
+53 12.5087
+53.3333 12.5076
+53.6667 12.5066
+54 12.5056
+54.3333 12.5045
+54.6667 12.5035
+55 12.5025
+55.3333 12.5014
+55.6667 12.5004
+56 12.4994
+56.3333 12.4984
+56.6667 12.4974
+57 12.4964
+57.3333 12.4954
+57.6667 12.4944
+58 12.4934
+58.3333 12.4924
+58.6667 12.4914
+59 12.4904
+59.3333 12.4894
+59.6667 12.4884
+60 12.4874
+60.3333 12.4865
+60.6667 12.4855
+61 12.4845
+61.3333 12.4836
+61.6667 12.4826
+62 12.4816
+62.3333 12.4807
+62.6667 12.4797
+63 12.4788
+63.3333 12.4778
+63.6667 12.4769
+64 12.4759
+64.3333 12.475
+64.6667 12.474
+65 12.4731
+65.3333 12.4721
+65.6667 12.4712
+66 12.4703
+66.3333 12.4694
+66.6667 12.4684
+67 12.4675
+67.3333 12.4666
+67.6667 12.4657
+68 12.4648
+68.3333 12.4638
+68.6667 12.4629
+69 12.462
+69.3333 12.4611
+69.6667 12.4602
+70 12.4593
+70.3333 12.4584
+70.6667 12.4575
+71 12.4566
+71.3333 12.4557
+71.6667 12.4548
+72 12.454
+72.3333 12.4531
+72.6667 12.4522
+73 12.4513
+73.3333 12.4504
+73.6667 12.4496
+74 12.4487
+74.3333 12.4478
+74.6667 12.4469
+75 12.4461
+75.3333 12.4452
+75.6667 12.4444
+76 12.4435
+76.3333 12.4426
+76.6667 12.4418
+77 12.4409
+77.3333 12.4401
+77.6667 12.4392
+78 12.4384
+78.3333 12.4375
+78.6667 12.4367
+79 12.4358
+79.3333 12.435
+79.6667 12.4342
+80 12.4333
+80.3333 12.4325
+80.6667 12.4317
+81 12.4308
+81.3333 12.43
+81.6667 12.4292
+82 12.4284
+82.3333 12.4275
+82.6667 12.4267
+83 12.4259
+83.3333 12.4251
+83.6667 12.4243
+84 12.4235
+84.3333 12.4226
+84.6667 12.4218
+85 12.421
+85.3333 12.4202
+85.6667 12.4194
+86 12.4186
+86.3333 12.4178
+86.6667 12.417
+87 12.4162
+87.3333 12.4154
+87.6667 12.4146
+88 12.4138
+88.3333 12.413
+88.6667 12.4123
+89 12.4115
+89.3333 12.4107
+89.6667 12.4099
+90 12.4091
+90.3333 12.4083
+90.6667 12.4076
+91 12.4068
+91.3333 12.406
+91.6667 12.4052
+92 12.4045
+92.3333 12.4037
+92.6667 12.4029
+93 12.4021
+93.3333 12.4014
+93.6667 12.4006
+94 12.3998
+94.3333 12.3991
+94.6667 12.3983
+95 12.3976
+95.3333 12.3968
+95.6667 12.396
+96 12.3953
+96.3333 12.3945
+96.6667 12.3938
+97 12.393
+97.3333 12.3923
+97.6667 12.3915
+98 12.3908
+98.3333 12.39
+98.6667 12.3893
+99 12.3885
+99.3333 12.3878
+99.6667 12.3871
+100 12.3863
+100.333 12.3856
+100.667 12.3848
+101 12.3841
+101.333 12.3834
+101.667 12.3826
+102 12.3819
+102.333 12.3812
+102.667 12.3804
+103 12.3797
+103.333 12.379
+103.667 12.3783
+104 12.3775
+104.333 12.3768
+104.667 12.3761
+105 12.3754
+105.333 12.3746
+105.667 12.3739
+106 12.3732
+106.333 12.3725
+106.667 12.3718
+107 12.371
+107.333 12.3703
+107.667 12.3696
+108 12.3689
+108.333 12.3682
+108.667 12.3675
+109 12.3668
+109.333 12.3661
+109.667 12.3653
+110 12.3646
+110.333 12.3639
+110.667 12.3632
+111 12.3625
+111.333 12.3618
+111.667 12.3611
+112 12.3604
+112.333 12.3597
+112.667 12.359
+113 12.3583
+113.333 12.3576
+113.667 12.3569
+114 12.3562
+114.333 12.3555
+114.667 12.3548
+115 12.3541
+115.333 12.3534
+115.667 12.3528
+116 12.3521
+116.333 12.3514
+116.667 12.3507
+117 12.35
+117.333 12.3493
+117.667 12.3486
+118 12.3479
+118.333 12.3472
+118.667 12.3466
+119 12.3459
+119.333 12.3452
+119.667 12.3445
+120 12.3438
+120.333 12.3431
+120.667 12.3425
+121 12.3418
+121.333 12.3411
+121.667 12.3404
+122 12.3397
+122.333 12.3391
+122.667 12.3384
+123 12.3377
+123.333 12.337
+123.667 12.3364
+124 12.3357
+124.333 12.335
+124.667 12.3343
+125 12.3337
+125.333 12.333
+125.667 12.3323
+126 12.3316
+126.333 12.331
+126.667 12.3303
+127 12.3296
+127.333 12.329
+127.667 12.3283
+128 12.3276
+128.333 12.327
+128.667 12.3263
+129 12.3256
+129.333 12.325
+129.667 12.3243
+130 12.3236
+130.333 12.323
+130.667 12.3223
+131 12.3216
+131.333 12.321
+131.667 12.3203
+132 12.3197
+132.333 12.319
+132.667 12.3183
+133 12.3177
+133.333 12.317
+133.667 12.3164
+134 12.3157
+134.333 12.315
+134.667 12.3144
+135 12.3137
+135.333 12.3131
+135.667 12.3124
+136 12.3117
+136.333 12.3111
+136.667 12.3104
+137 12.3098
+137.333 12.3091
+137.667 12.3085
+138 12.3078
+138.333 12.3072
+138.667 12.3065
+139 12.3058
+139.333 12.3052
+139.667 12.3045
+140 12.3039
+140.333 12.3032
+140.667 12.3026
+141 12.3019
+141.333 12.3013
+141.667 12.3006
+142 12.3
+142.333 12.2993
+142.667 12.2987
+143 12.298
+143.333 12.2974
+143.667 12.2967
+144 12.2961
+144.333 12.2954
+144.667 12.2948
+145 12.2941
+145.333 12.2935
+145.667 12.2928
+146 12.2922
+146.333 12.2915
+146.667 12.2909
+147 12.2902
+147.333 12.2896
+147.667 12.2889
+148 12.2883
+148.333 12.2876
+148.667 12.287
+149 12.2863
+149.333 12.2857
+149.667 12.2851
+150 12.2844
+150.333 12.2838
+150.667 12.2831
+151 12.2825
+151.333 12.2818
+151.667 12.2812
+152 12.2805
+152.333 12.2799
+152.667 12.2792
+153 12.2786
+153.333 12.2779
+153.667 12.2773
+154 12.2766
+154.333 12.276
+154.667 12.2754
+155 12.2747
+155.333 12.2741
+155.667 12.2734
+156 12.2728
+156.333 12.2721
+156.667 12.2715
+157 12.2708
+157.333 12.2702
+157.667 12.2695
+158 12.2689
+158.333 12.2683
+158.667 12.2676
+159 12.267
+159.333 12.2663
+159.667 12.2657
+160 12.265
+160.333 12.2644
+160.667 12.2637
+161 12.2631
+161.333 12.2624
+161.667 12.2618
+162 12.2612
+162.333 12.2605
+162.667 12.2599
+163 12.2592
+163.333 12.2586
+163.667 12.2579
+164 12.2573
+164.333 12.2566
+164.667 12.256
+165 12.2553
+165.333 12.2547
+165.667 12.254
+166 12.2534
+166.333 12.2528
+166.667 12.2521
+167 12.2515
+167.333 12.2508
+167.667 12.2502
+168 12.2495
+168.333 12.2489
+168.667 12.2482
+169 12.2476
+169.333 12.2469
+169.667 12.2463
+170 12.2456
+170.333 12.245
+170.667 12.2443
+171 12.2437
+171.333 12.243
+171.667 12.2424
+172 12.2417
+172.333 12.2411
+172.667 12.2404
+173 12.2398
+173.333 12.2391
+173.667 12.2385
+174 12.2378
+174.333 12.2372
+174.667 12.2365
+175 12.2359
+175.333 12.2352
+175.667 12.2346
+176 12.2339
+176.333 12.2333
+176.667 12.2326
+177 12.232
+177.333 12.2313
+177.667 12.2306
+178 12.23
+178.333 12.2293
+178.667 12.2287
+179 12.228
+179.333 12.2274
+179.667 12.2267
+180 12.2261
+180.333 12.2254
+180.667 12.2247
+181 12.2241
+181.333 12.2234
+181.667 12.2228
+182 12.2221
+182.333 12.2215
+182.667 12.2208
+183 12.2201
+183.333 12.2195
+183.667 12.2188
+184 12.2182
+184.333 12.2175
+184.667 12.2168
+185 12.2162
+185.333 12.2155
+185.667 12.2149
+186 12.2142
+186.333 12.2135
+186.667 12.2129
+187 12.2122
+187.333 12.2115
+187.667 12.2109
+188 12.2102
+188.333 12.2096
+188.667 12.2089
+189 12.2082
+189.333 12.2076
+189.667 12.2069
+190 12.2062
+190.333 12.2056
+190.667 12.2049
+191 12.2042
+191.333 12.2036
+191.667 12.2029
+192 12.2022
+192.333 12.2015
+192.667 12.2009
+193 12.2002
+193.333 12.1995
+193.667 12.1989
+194 12.1982
+194.333 12.1975
+194.667 12.1968
+195 12.1962
+195.333 12.1955
+195.667 12.1948
+196 12.1941
+196.333 12.1935
+196.667 12.1928
+197 12.1921
+197.333 12.1914
+197.667 12.1908
+198 12.1901
+198.333 12.1894
+198.667 12.1887
+199 12.188
+199.333 12.1874
+199.667 12.1867
+200 12.186
+200.333 12.1853
+200.667 12.1846
+201 12.184
+201.333 12.1833
+201.667 12.1826
+202 12.1819
+202.333 12.1812
+202.667 12.1805
+203 12.1799
+203.333 12.1792
+203.667 12.1785
+204 12.1778
+204.333 12.1771
+204.667 12.1764
+205 12.1757
+205.333 12.175
+205.667 12.1743
+206 12.1736
+206.333 12.173
+206.667 12.1723
+207 12.1716
+207.333 12.1709
+207.667 12.1702
+208 12.1695
+208.333 12.1688
+208.667 12.1681
+209 12.1674
+209.333 12.1667
+209.667 12.166
+210 12.1653
+210.333 12.1646
+210.667 12.1639
+211 12.1632
+211.333 12.1625
+211.667 12.1618
+212 12.1611
+212.333 12.1604
+212.667 12.1597
+213 12.159
+213.333 12.1583
+213.667 12.1576
+214 12.1569
+214.333 12.1562
+214.667 12.1554
+215 12.1547
+215.333 12.154
+215.667 12.1533
+216 12.1526
+216.333 12.1519
+216.667 12.1512
+217 12.1505
+217.333 12.1498
+217.667 12.149
+218 12.1483
+218.333 12.1476
+218.667 12.1469
+219 12.1462
+219.333 12.1455
+219.667 12.1447
+220 12.144
+220.333 12.1433
+220.667 12.1426
+221 12.1418
+221.333 12.1411
+221.667 12.1404
+222 12.1397
+222.333 12.1389
+222.667 12.1382
+223 12.1375
+223.333 12.1368
+223.667 12.136
+224 12.1353
+224.333 12.1346
+224.667 12.1338
+225 12.1331
+225.333 12.1324
+225.667 12.1317
+226 12.1309
+226.333 12.1302
+226.667 12.1294
+227 12.1287
+227.333 12.128
+227.667 12.1272
+228 12.1265
+228.333 12.1258
+228.667 12.125
+229 12.1243
+229.333 12.1235
+229.667 12.1228
+230 12.122
+230.333 12.1213
+230.667 12.1205
+231 12.1198
+231.333 12.1191
+231.667 12.1183
+232 12.1176
+232.333 12.1168
+232.667 12.1161
+233 12.1153
+233.333 12.1145
+233.667 12.1138
+234 12.113
+234.333 12.1123
+234.667 12.1115
+235 12.1108
+235.333 12.11
+235.667 12.1092
+236 12.1085
+236.333 12.1077
+236.667 12.107
+237 12.1062
+237.333 12.1054
+237.667 12.1047
+238 12.1039
+238.333 12.1031
+238.667 12.1024
+239 12.1016
+239.333 12.1008
+239.667 12.1001
+240 12.0993
+240.333 12.0985
+240.667 12.0977
+241 12.097
+241.333 12.0962
+241.667 12.0954
+242 12.0946
+242.333 12.0939
+242.667 12.0931
+243 12.0923
+243.333 12.0915
+243.667 12.0907
+244 12.0899
+244.333 12.0892
+244.667 12.0884
+245 12.0876
+245.333 12.0868
+245.667 12.086
+246 12.0852
+246.333 12.0844
+246.667 12.0836
+247 12.0828
+247.333 12.082
+247.667 12.0812
+248 12.0805
+248.333 12.0797
+248.667 12.0789
+249 12.0781
+249.333 12.0773
+249.667 12.0765
+250 12.0757
+250.333 12.0748
+250.667 12.074
+251 12.0732
+251.333 12.0724
+251.667 12.0716
+252 12.0708
+252.333 12.07
+252.667 12.0692
+253 12.0684
+253.333 12.0676
+253.667 12.0667
+254 12.0659
+254.333 12.0651
+254.667 12.0643
+255 12.0635
+255.333 12.0627
+255.667 12.0618
+256 12.061
+256.333 12.0602
+256.667 12.0594
+257 12.0585
+257.333 12.0577
+257.667 12.0569
+258 12.056
+258.333 12.0552
+258.667 12.0544
+259 12.0535
+259.333 12.0527
+259.667 12.0519
+260 12.051
+260.333 12.0502
+260.667 12.0494
+261 12.0485
+261.333 12.0477
+261.667 12.0468
+262 12.046
+262.333 12.0451
+262.667 12.0443
+263 12.0434
+263.333 12.0426
+263.667 12.0417
+264 12.0409
+264.333 12.04
+264.667 12.0392
+265 12.0383
+265.333 12.0375
+265.667 12.0366
+266 12.0358
+266.333 12.0349
+266.667 12.034
+267 12.0332
+267.333 12.0323
+267.667 12.0314
+268 12.0306
+268.333 12.0297
+268.667 12.0288
+269 12.028
+269.333 12.0271
+269.667 12.0262
+270 12.0253
+270.333 12.0245
+270.667 12.0236
+271 12.0227
+271.333 12.0218
+271.667 12.0209
+272 12.0201
+272.333 12.0192
+272.667 12.0183
+273 12.0174
+273.333 12.0165
+273.667 12.0156
+274 12.0147
+274.333 12.0138
+274.667 12.0129
+275 12.0121
+275.333 12.0112
+275.667 12.0103
+276 12.0094
+276.333 12.0085
+276.667 12.0076
+277 12.0066
+277.333 12.0057
+277.667 12.0048
+278 12.0039
+278.333 12.003
+278.667 12.0021
+279 12.0012
+279.333 12.0003
+279.667 11.9994
+280 11.9984
+280.333 11.9975
+280.667 11.9966
+281 11.9957
+281.333 11.9948
+281.667 11.9938
+282 11.9929
+282.333 11.992
+282.667 11.9911
+283 11.9901
+283.333 11.9892
+283.667 11.9883
+284 11.9873
+284.333 11.9864
+284.667 11.9855
+285 11.9845
+285.333 11.9836
+285.667 11.9826
+286 11.9817
+286.333 11.9807
+286.667 11.9798
+287 11.9789
+287.333 11.9779
+287.667 11.9769
+288 11.976
+288.333 11.975
+288.667 11.9741
+289 11.9731
+289.333 11.9722
+289.667 11.9712
+290 11.9702
+290.333 11.9693
+290.667 11.9683
+291 11.9673
+291.333 11.9664
+291.667 11.9654
+292 11.9644
+292.333 11.9635
+292.667 11.9625
+293 11.9615
+293.333 11.9605
+293.667 11.9595
+294 11.9586
+294.333 11.9576
+294.667 11.9566
+295 11.9556
+295.333 11.9546
+295.667 11.9536
+296 11.9526
+296.333 11.9516
+296.667 11.9506
+297 11.9497
+297.333 11.9487
+297.667 11.9477
+298 11.9466
+298.333 11.9456
+298.667 11.9446
+299 11.9436
+299.333 11.9426
+299.667 11.9416
+300 11.9406
+300.333 11.9396
+300.667 11.9386
+301 11.9375
+301.333 11.9365
+301.667 11.9355
+302 11.9345
+302.333 11.9335
+302.667 11.9324
+303 11.9314
+303.333 11.9304
+303.667 11.9293
+304 11.9283
+304.333 11.9273
+304.667 11.9262
+305 11.9252
+305.333 11.9241
+305.667 11.9231
+306 11.9221
+306.333 11.921
+306.667 11.92
+307 11.9189
+307.333 11.9179
+307.667 11.9168
+308 11.9158
+308.333 11.9147
+308.667 11.9136
+309 11.9126
+309.333 11.9115
+309.667 11.9104
+310 11.9094
+310.333 11.9083
+310.667 11.9072
+311 11.9062
+311.333 11.9051
+311.667 11.904
+312 11.9029
+312.333 11.9018
+312.667 11.9008
+313 11.8997
+313.333 11.8986
+313.667 11.8975
+314 11.8964
+314.333 11.8953
+314.667 11.8942
+315 11.8931
+315.333 11.892
+315.667 11.8909
+316 11.8898
+316.333 11.8887
+316.667 11.8876
+317 11.8865
+317.333 11.8854
+317.667 11.8843
+318 11.8832
+318.333 11.882
+318.667 11.8809
+319 11.8798
+319.333 11.8787
+319.667 11.8775
+320 11.8764
+320.333 11.8753
+320.667 11.8742
+321 11.873
+321.333 11.8719
+321.667 11.8707
+322 11.8696
+322.333 11.8685
+322.667 11.8673
+323 11.8662
+323.333 11.865
+323.667 11.8639
+324 11.8627
+324.333 11.8616
+324.667 11.8604
+325 11.8592
+325.333 11.8581
+325.667 11.8569
+326 11.8557
+326.333 11.8546
+326.667 11.8534
+327 11.8522
+327.333 11.8511
+327.667 11.8499
+328 11.8487
+328.333 11.8475
+328.667 11.8463
+329 11.8451
+329.333 11.844
+329.667 11.8428
+330 11.8416
+330.333 11.8404
+330.667 11.8392
+331 11.838
+331.333 11.8368
+331.667 11.8356
+332 11.8344
+332.333 11.8331
+332.667 11.8319
+333 11.8307
+333.333 11.8295
+333.667 11.8283
+334 11.8271
+334.333 11.8258
+334.667 11.8246
+335 11.8234
+335.333 11.8221
+335.667 11.8209
+336 11.8197
+336.333 11.8184
+336.667 11.8172
+337 11.8159
+337.333 11.8147
+337.667 11.8135
+338 11.8122
+338.333 11.8109
+338.667 11.8097
+339 11.8084
+339.333 11.8072
+339.667 11.8059
+340 11.8046
+340.333 11.8034
+340.667 11.8021
+341 11.8008
+341.333 11.7995
+341.667 11.7983
+342 11.797
+342.333 11.7957
+342.667 11.7944
+343 11.7931
+343.333 11.7918
+343.667 11.7905
+344 11.7892
+344.333 11.7879
+344.667 11.7866
+345 11.7853
+345.333 11.784
+345.667 11.7827
+346 11.7814
+346.333 11.7801
+346.667 11.7788
+347 11.7774
+347.333 11.7761
+347.667 11.7748
+348 11.7735
+348.333 11.7721
+348.667 11.7708
+349 11.7695
+349.333 11.7681
+349.667 11.7668
+350 11.7654
+350.333 11.7641
+350.667 11.7627
+351 11.7614
+351.333 11.76
+351.667 11.7586
+352 11.7573
+352.333 11.7559
+352.667 11.7545
+353 11.7532
+353.333 11.7518
+353.667 11.7504
+354 11.749
+354.333 11.7477
+354.667 11.7463
+355 11.7449
+355.333 11.7435
+355.667 11.7421
+356 11.7407
+356.333 11.7393
+356.667 11.7379
+357 11.7365
+357.333 11.7351
+357.667 11.7337
+358 11.7322
+358.333 11.7308
+358.667 11.7294
+359 11.728
+359.333 11.7266
+359.667 11.7251
+360 11.7237
+360.333 11.7222
+360.667 11.7208
+361 11.7194
+361.333 11.7179
+361.667 11.7165
+362 11.715
+362.333 11.7136
+362.667 11.7121
+363 11.7106
+363.333 11.7092
+363.667 11.7077
+364 11.7062
+364.333 11.7048
+364.667 11.7033
+365 11.7018
+365.333 11.7003
+365.667 11.6988
+366 11.6973
+366.333 11.6958
+366.667 11.6943
+367 11.6928
+367.333 11.6913
+367.667 11.6898
+368 11.6883
+368.333 11.6868
+368.667 11.6853
+369 11.6838
+369.333 11.6822
+369.667 11.6807
+370 11.6792
+370.333 11.6776
+370.667 11.6761
+371 11.6746
+371.333 11.673
+371.667 11.6715
+372 11.6699
+372.333 11.6684
+372.667 11.6668
+373 11.6652
+373.333 11.6637
+373.667 11.6621
+374 11.6605
+374.333 11.6589
+374.667 11.6574
+375 11.6558
+375.333 11.6542
+375.667 11.6526
+376 11.651
+376.333 11.6494
+376.667 11.6478
+377 11.6462
+377.333 11.6446
+377.667 11.643
+378 11.6414
+378.333 11.6397
+378.667 11.6381
+379 11.6365
+379.333 11.6349
+379.667 11.6332
+380 11.6316
+380.333 11.6299
+380.667 11.6283
+381 11.6266
+381.333 11.625
+381.667 11.6233
+382 11.6217
+382.333 11.62
+382.667 11.6183
+383 11.6166
+383.333 11.615
+383.667 11.6133
+384 11.6116
+384.333 11.6099
+384.667 11.6082
+385 11.6065
+385.333 11.6048
+385.667 11.6031
+386 11.6014
+386.333 11.5997
+386.667 11.598
+387 11.5963
+387.333 11.5945
+387.667 11.5928
+388 11.5911
+388.333 11.5893
+388.667 11.5876
+389 11.5858
+389.333 11.5841
+389.667 11.5823
+390 11.5806
+390.333 11.5788
+390.667 11.577
+391 11.5753
+391.333 11.5735
+391.667 11.5717
+392 11.5699
+392.333 11.5681
+392.667 11.5663
+393 11.5645
+393.333 11.5627
+393.667 11.5609
+394 11.5591
+394.333 11.5573
+394.667 11.5555
+395 11.5537
+395.333 11.5518
+395.667 11.55
+396 11.5482
+396.333 11.5463
+396.667 11.5445
+397 11.5426
+397.333 11.5408
+397.667 11.5389
+398 11.537
+398.333 11.5352
+398.667 11.5333
+399 11.5314
+399.333 11.5295
+399.667 11.5276
+400 11.5258
+400.333 11.5239
+400.667 11.522
+401 11.52
+401.333 11.5181
+401.667 11.5162
+402 11.5143
+402.333 11.5124
+402.667 11.5104
+403 11.5085
+403.333 11.5066
+403.667 11.5046
+404 11.5027
+404.333 11.5007
+404.667 11.4988
+405 11.4968
+405.333 11.4948
+405.667 11.4928
+406 11.4909
+406.333 11.4889
+406.667 11.4869
+407 11.4849
+407.333 11.4829
+407.667 11.4809
+408 11.4789
+408.333 11.4769
+408.667 11.4748
+409 11.4728
+409.333 11.4708
+409.667 11.4687
+410 11.4667
+410.333 11.4646
+410.667 11.4626
+411 11.4605
+411.333 11.4585
+411.667 11.4564
+412 11.4543
+412.333 11.4522
+412.667 11.4502
+413 11.4481
+413.333 11.446
+413.667 11.4439
+414 11.4418
+414.333 11.4396
+414.667 11.4375
+415 11.4354
+415.333 11.4333
+415.667 11.4311
+416 11.429
+416.333 11.4269
+416.667 11.4247
+417 11.4225
+417.333 11.4204
+417.667 11.4182
+418 11.416
+418.333 11.4138
+418.667 11.4117
+419 11.4095
+419.333 11.4073
+419.667 11.4051
+420 11.4029
+420.333 11.4006
+420.667 11.3984
+421 11.3962
+421.333 11.3939
+421.667 11.3917
+422 11.3895
+422.333 11.3872
+422.667 11.3849
+423 11.3827
+423.333 11.3804
+423.667 11.3781
+424 11.3758
+424.333 11.3736
+424.667 11.3713
+425 11.369
+425.333 11.3666
+425.667 11.3643
+426 11.362
+426.333 11.3597
+426.667 11.3573
+427 11.355
+427.333 11.3527
+427.667 11.3503
+428 11.3479
+428.333 11.3456
+428.667 11.3432
+429 11.3408
+429.333 11.3384
+429.667 11.336
+430 11.3336
+430.333 11.3312
+430.667 11.3288
+431 11.3264
+431.333 11.324
+431.667 11.3215
+432 11.3191
+432.333 11.3166
+432.667 11.3142
+433 11.3117
+433.333 11.3092
+433.667 11.3068
+434 11.3043
+434.333 11.3018
+434.667 11.2993
+435 11.2968
+435.333 11.2943
+435.667 11.2918
+436 11.2892
+436.333 11.2867
+436.667 11.2842
+437 11.2816
+437.333 11.279
+437.667 11.2765
+438 11.2739
+438.333 11.2713
+438.667 11.2687
+439 11.2662
+439.333 11.2635
+439.667 11.2609
+440 11.2583
+440.333 11.2557
+440.667 11.2531
+441 11.2504
+441.333 11.2478
+441.667 11.2451
+442 11.2425
+442.333 11.2398
+442.667 11.2371
+443 11.2344
+443.333 11.2317
+443.667 11.229
+444 11.2263
+444.333 11.2236
+444.667 11.2209
+445 11.2181
+445.333 11.2154
+445.667 11.2126
+446 11.2099
+446.333 11.2071
+446.667 11.2043
+447 11.2015
+447.333 11.1987
+447.667 11.1959
+448 11.1931
+448.333 11.1903
+448.667 11.1875
+449 11.1846
+449.333 11.1818
+449.667 11.1789
+450 11.1761
+450.333 11.1732
+450.667 11.1703
+451 11.1674
+451.333 11.1645
+451.667 11.1616
+452 11.1587
+452.333 11.1558
+452.667 11.1528
+453 11.1499
+453.333 11.1469
+453.667 11.144
+454 11.141
+454.333 11.138
+454.667 11.135
+455 11.132
+455.333 11.129
+455.667 11.126
+456 11.123
+456.333 11.1199
+456.667 11.1169
+457 11.1138
+457.333 11.1108
+457.667 11.1077
+458 11.1046
+458.333 11.1015
+458.667 11.0984
+459 11.0953
+459.333 11.0921
+459.667 11.089
+460 11.0859
+460.333 11.0827
+460.667 11.0795
+461 11.0764
+461.333 11.0732
+461.667 11.07
+462 11.0668
+462.333 11.0635
+462.667 11.0603
+463 11.0571
+463.333 11.0538
+463.667 11.0506
+464 11.0473
+464.333 11.044
+464.667 11.0407
+465 11.0374
+465.333 11.0341
+465.667 11.0308
+466 11.0274
+466.333 11.0241
+466.667 11.0207
+467 11.0173
+467.333 11.014
+467.667 11.0106
+468 11.0072
+468.333 11.0037
+468.667 11.0003
+469 10.9969
+469.333 10.9934
+469.667 10.99
+470 10.9865
+470.333 10.983
+470.667 10.9795
+471 10.976
+471.333 10.9725
+471.667 10.9689
+472 10.9654
+472.333 10.9618
+472.667 10.9583
+473 10.9547
+473.333 10.9511
+473.667 10.9475
+474 10.9439
+474.333 10.9402
+474.667 10.9366
+475 10.9329
+475.333 10.9293
+475.667 10.9256
+476 10.9219
+476.333 10.9182
+476.667 10.9144
+477 10.9107
+477.333 10.907
+477.667 10.9032
+478 10.8994
+478.333 10.8956
+478.667 10.8918
+479 10.888
+479.333 10.8842
+479.667 10.8803
+480 10.8765
+480.333 10.8726
+480.667 10.8687
+481 10.8648
+481.333 10.8609
+481.667 10.857
+482 10.8531
+482.333 10.8491
+482.667 10.8451
+483 10.8411
+483.333 10.8371
+483.667 10.8331
+484 10.8291
+484.333 10.8251
+484.667 10.821
+485 10.8169
+485.333 10.8129
+485.667 10.8088
+486 10.8046
+486.333 10.8005
+486.667 10.7964
+487 10.7922
+487.333 10.788
+487.667 10.7838
+488 10.7796
+488.333 10.7754
+488.667 10.7711
+489 10.7669
+489.333 10.7626
+489.667 10.7583
+490 10.754
+490.333 10.7497
+490.667 10.7454
+491 10.741
+491.333 10.7366
+491.667 10.7323
+492 10.7279
+492.333 10.7234
+492.667 10.719
+493 10.7145
+493.333 10.7101
+493.667 10.7056
+494 10.7011
+494.333 10.6966
+494.667 10.692
+495 10.6875
+495.333 10.6829
+495.667 10.6783
+496 10.6737
+496.333 10.669
+496.667 10.6644
+497 10.6597
+497.333 10.655
+497.667 10.6503
+498 10.6456
+498.333 10.6409
+498.667 10.6361
+499 10.6313
+499.333 10.6265
+499.667 10.6217
+e
@@ -0,0 +1,1174 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "BattDisch3.eps"
+set xlabel " Discharge Capacity (mAh)"
+set ylabel "Voltage (V)"
+set xrange[0:2400]
+                               set yrange [2.6:4.4]
+                               set xtics 400
+                               set ytics 0.2
+                               set grid
+                               set style line 1 linewidth 5
+                               set style line 2 linewidth 5
+                               set style line 3 linewidth 5
+                               set style line 4 linewidth 5
+                               set style line 5 linewidth 5
+                               set style line 6 linewidth 5
+                               set style line 7 linewidth 5
+                               set style line 8 linewidth 5
+                               set style increment user
+                               set key reverse Left
+plot "-"  title "Panasonic Li-on CGR18650DA 0.466 A (0.2C)" with lines, "-"  title "Panasonic Li-on CGR18650DA 2.33 A (1C)" with lines, "-"  title "Panasonic Li-on CGR18650DA 4.66 A (2C)" with lines
+0 4.17
+2.45944 4.16699
+5.04833 4.16437
+7.63722 4.16204
+10.2261 4.15987
+12.815 4.15778
+15.4039 4.15574
+17.9928 4.15372
+20.5817 4.15173
+23.1706 4.14975
+25.7594 4.14778
+28.3483 4.14582
+30.9372 4.14387
+33.5261 4.14192
+36.115 4.13999
+38.7039 4.13807
+41.2928 4.13615
+43.8817 4.13425
+46.4706 4.13235
+49.0594 4.13046
+51.6483 4.12858
+54.2372 4.1267
+56.8261 4.12484
+59.415 4.12298
+62.0039 4.12113
+64.5928 4.11929
+67.1817 4.11746
+69.7706 4.11563
+72.3594 4.11381
+74.9483 4.11201
+77.5372 4.1102
+80.1261 4.10841
+82.715 4.10663
+85.3039 4.10485
+87.8928 4.10308
+90.4817 4.10132
+93.0706 4.09956
+95.6594 4.09782
+98.2483 4.09608
+100.837 4.09435
+103.426 4.09263
+106.015 4.09091
+108.604 4.0892
+111.193 4.0875
+113.782 4.08581
+116.371 4.08412
+118.959 4.08244
+121.548 4.08077
+124.137 4.07911
+126.726 4.07745
+129.315 4.0758
+131.904 4.07416
+134.493 4.07253
+137.082 4.0709
+139.671 4.06928
+142.259 4.06767
+144.848 4.06606
+147.437 4.06446
+150.026 4.06287
+152.615 4.06128
+155.204 4.0597
+157.793 4.05813
+160.382 4.05657
+162.971 4.05501
+165.559 4.05346
+168.148 4.05192
+170.737 4.05038
+173.326 4.04885
+175.915 4.04732
+178.504 4.04581
+181.093 4.0443
+183.682 4.04279
+186.271 4.04129
+188.859 4.0398
+191.448 4.03832
+194.037 4.03684
+196.626 4.03537
+199.215 4.0339
+201.804 4.03245
+204.393 4.03099
+206.982 4.02955
+209.571 4.02811
+212.159 4.02668
+214.748 4.02525
+217.337 4.02383
+219.926 4.02241
+222.515 4.021
+225.104 4.0196
+227.693 4.01821
+230.282 4.01682
+232.871 4.01543
+235.459 4.01405
+238.048 4.01268
+240.637 4.01132
+243.226 4.00996
+245.815 4.0086
+248.404 4.00725
+250.993 4.00591
+253.582 4.00458
+256.171 4.00324
+258.759 4.00192
+261.348 4.0006
+263.937 3.99929
+266.526 3.99798
+269.115 3.99668
+271.704 3.99538
+274.293 3.99409
+276.882 3.99281
+279.471 3.99153
+282.059 3.99025
+284.648 3.98898
+287.237 3.98772
+289.826 3.98646
+292.415 3.98521
+295.004 3.98397
+297.593 3.98272
+300.182 3.98149
+302.771 3.98026
+305.359 3.97903
+307.948 3.97781
+310.537 3.9766
+313.126 3.97539
+315.715 3.97419
+318.304 3.97299
+320.893 3.97179
+323.482 3.97061
+326.071 3.96942
+328.659 3.96825
+331.248 3.96707
+333.837 3.9659
+336.426 3.96474
+339.015 3.96358
+341.604 3.96243
+344.193 3.96128
+346.782 3.96014
+349.371 3.959
+351.959 3.95787
+354.548 3.95674
+357.137 3.95562
+359.726 3.9545
+362.315 3.95339
+364.904 3.95228
+367.493 3.95118
+370.082 3.95008
+372.671 3.94898
+375.259 3.94789
+377.848 3.94681
+380.437 3.94573
+383.026 3.94465
+385.615 3.94358
+388.204 3.94251
+390.793 3.94145
+393.382 3.9404
+395.971 3.93934
+398.559 3.9383
+401.148 3.93725
+403.737 3.93621
+406.326 3.93518
+408.915 3.93415
+411.504 3.93312
+414.093 3.9321
+416.682 3.93108
+419.271 3.93007
+421.859 3.92906
+424.448 3.92806
+427.037 3.92706
+429.626 3.92606
+432.215 3.92507
+434.804 3.92409
+437.393 3.9231
+439.982 3.92213
+442.571 3.92115
+445.159 3.92018
+447.748 3.91922
+450.337 3.91825
+452.926 3.9173
+455.515 3.91634
+458.104 3.91539
+460.693 3.91445
+463.282 3.91351
+465.871 3.91257
+468.459 3.91164
+471.048 3.91071
+473.637 3.90978
+476.226 3.90886
+478.815 3.90794
+481.404 3.90703
+483.993 3.90612
+486.582 3.90522
+489.171 3.90431
+491.759 3.90342
+494.348 3.90252
+496.937 3.90163
+499.526 3.90074
+502.115 3.89986
+504.704 3.89898
+507.293 3.89811
+509.882 3.89724
+512.471 3.89637
+515.059 3.8955
+517.648 3.89464
+520.237 3.89379
+522.826 3.89293
+525.415 3.89208
+528.004 3.89124
+530.593 3.89039
+533.182 3.88956
+535.771 3.88872
+538.359 3.88789
+540.948 3.88706
+543.537 3.88624
+546.126 3.88541
+548.715 3.8846
+551.304 3.88378
+553.893 3.88297
+556.482 3.88216
+559.071 3.88136
+561.659 3.88056
+564.248 3.87976
+566.837 3.87897
+569.426 3.87818
+572.015 3.87739
+574.604 3.8766
+577.193 3.87582
+579.782 3.87505
+582.371 3.87427
+584.959 3.8735
+587.548 3.87273
+590.137 3.87197
+592.726 3.87121
+595.315 3.87045
+597.904 3.86969
+600.493 3.86894
+603.082 3.86819
+605.671 3.86745
+608.259 3.86671
+610.848 3.86597
+613.437 3.86523
+616.026 3.8645
+618.615 3.86377
+621.204 3.86304
+623.793 3.86232
+626.382 3.8616
+628.971 3.86088
+631.559 3.86016
+634.148 3.85945
+636.737 3.85874
+639.326 3.85804
+641.915 3.85733
+644.504 3.85663
+647.093 3.85593
+649.682 3.85524
+652.271 3.85455
+654.859 3.85386
+657.448 3.85317
+660.037 3.85249
+662.626 3.85181
+665.215 3.85113
+667.804 3.85046
+670.393 3.84979
+672.982 3.84912
+675.571 3.84845
+678.159 3.84779
+680.748 3.84713
+683.337 3.84647
+685.926 3.84581
+688.515 3.84516
+691.104 3.84451
+693.693 3.84386
+696.282 3.84322
+698.871 3.84258
+701.459 3.84194
+704.048 3.8413
+706.637 3.84066
+709.226 3.84003
+711.815 3.8394
+714.404 3.83878
+716.993 3.83815
+719.582 3.83753
+722.171 3.83691
+724.759 3.8363
+727.348 3.83568
+729.937 3.83507
+732.526 3.83446
+735.115 3.83386
+737.704 3.83325
+740.293 3.83265
+742.882 3.83205
+745.471 3.83145
+748.059 3.83086
+750.648 3.83027
+753.237 3.82968
+755.826 3.82909
+758.415 3.82851
+761.004 3.82792
+763.593 3.82734
+766.182 3.82676
+768.771 3.82619
+771.359 3.82562
+773.948 3.82505
+776.537 3.82448
+779.126 3.82391
+781.715 3.82335
+784.304 3.82278
+786.893 3.82222
+789.482 3.82167
+792.071 3.82111
+794.659 3.82056
+797.248 3.82001
+799.837 3.81946
+802.426 3.81891
+805.015 3.81837
+807.604 3.81783
+810.193 3.81729
+812.782 3.81675
+815.371 3.81621
+817.959 3.81568
+820.548 3.81515
+823.137 3.81462
+825.726 3.81409
+828.315 3.81356
+830.904 3.81304
+833.493 3.81252
+836.082 3.812
+838.671 3.81148
+841.259 3.81097
+843.848 3.81045
+846.437 3.80994
+849.026 3.80943
+851.615 3.80893
+854.204 3.80842
+856.793 3.80792
+859.382 3.80742
+861.971 3.80692
+864.559 3.80642
+867.148 3.80592
+869.737 3.80543
+872.326 3.80494
+874.915 3.80445
+877.504 3.80396
+880.093 3.80347
+882.682 3.80299
+885.271 3.80251
+887.859 3.80203
+890.448 3.80155
+893.037 3.80107
+895.626 3.80059
+898.215 3.80012
+900.804 3.79965
+903.393 3.79918
+905.982 3.79871
+908.571 3.79825
+911.159 3.79778
+913.748 3.79732
+916.337 3.79686
+918.926 3.7964
+921.515 3.79594
+924.104 3.79548
+926.693 3.79503
+929.282 3.79458
+931.871 3.79413
+934.459 3.79368
+937.048 3.79323
+939.637 3.79278
+942.226 3.79234
+944.815 3.7919
+947.404 3.79145
+949.993 3.79101
+952.582 3.79058
+955.171 3.79014
+957.759 3.78971
+960.348 3.78927
+962.937 3.78884
+965.526 3.78841
+968.115 3.78798
+970.704 3.78756
+973.293 3.78713
+975.882 3.78671
+978.471 3.78628
+981.059 3.78586
+983.648 3.78544
+986.237 3.78503
+988.826 3.78461
+991.415 3.78419
+994.004 3.78378
+996.593 3.78337
+999.182 3.78296
+1001.77 3.78255
+1004.36 3.78214
+1006.95 3.78174
+1009.54 3.78133
+1012.13 3.78093
+1014.71 3.78053
+1017.3 3.78012
+1019.89 3.77973
+1022.48 3.77933
+1025.07 3.77893
+1027.66 3.77854
+1030.25 3.77814
+1032.84 3.77775
+1035.43 3.77736
+1038.01 3.77697
+1040.6 3.77658
+1043.19 3.77619
+1045.78 3.77581
+1048.37 3.77542
+1050.96 3.77504
+1053.55 3.77466
+1056.14 3.77428
+1058.73 3.7739
+1061.31 3.77352
+1063.9 3.77314
+1066.49 3.77277
+1069.08 3.77239
+1071.67 3.77202
+1074.26 3.77165
+1076.85 3.77128
+1079.44 3.77091
+1082.03 3.77054
+1084.61 3.77017
+1087.2 3.76981
+1089.79 3.76944
+1092.38 3.76908
+1094.97 3.76872
+1097.56 3.76835
+1100.15 3.76799
+1102.74 3.76764
+1105.33 3.76728
+1107.91 3.76692
+1110.5 3.76656
+1113.09 3.76621
+1115.68 3.76586
+1118.27 3.7655
+1120.86 3.76515
+1123.45 3.7648
+1126.04 3.76445
+1128.63 3.76411
+1131.21 3.76376
+1133.8 3.76341
+1136.39 3.76307
+1138.98 3.76272
+1141.57 3.76238
+1144.16 3.76204
+1146.75 3.7617
+1149.34 3.76136
+1151.93 3.76102
+1154.51 3.76068
+1157.1 3.76034
+1159.69 3.76001
+1162.28 3.75967
+1164.87 3.75934
+1167.46 3.75901
+1170.05 3.75867
+1172.64 3.75834
+1175.23 3.75801
+1177.81 3.75768
+1180.4 3.75735
+1182.99 3.75703
+1185.58 3.7567
+1188.17 3.75637
+1190.76 3.75605
+1193.35 3.75573
+1195.94 3.7554
+1198.53 3.75508
+1201.11 3.75476
+1203.7 3.75444
+1206.29 3.75412
+1208.88 3.7538
+1211.47 3.75348
+1214.06 3.75316
+1216.65 3.75285
+1219.24 3.75253
+1221.83 3.75222
+1224.41 3.7519
+1227 3.75159
+1229.59 3.75128
+1232.18 3.75097
+1234.77 3.75066
+1237.36 3.75035
+1239.95 3.75004
+1242.54 3.74973
+1245.13 3.74942
+1247.71 3.74911
+1250.3 3.74881
+1252.89 3.7485
+1255.48 3.74819
+1258.07 3.74789
+1260.66 3.74759
+1263.25 3.74728
+1265.84 3.74698
+1268.43 3.74668
+1271.01 3.74638
+1273.6 3.74608
+1276.19 3.74578
+1278.78 3.74548
+1281.37 3.74518
+1283.96 3.74488
+1286.55 3.74459
+1289.14 3.74429
+1291.73 3.74399
+1294.31 3.7437
+1296.9 3.7434
+1299.49 3.74311
+1302.08 3.74282
+1304.67 3.74252
+1307.26 3.74223
+1309.85 3.74194
+1312.44 3.74165
+1315.03 3.74136
+1317.61 3.74107
+1320.2 3.74078
+1322.79 3.74049
+1325.38 3.7402
+1327.97 3.73991
+1330.56 3.73962
+1333.15 3.73934
+1335.74 3.73905
+1338.33 3.73876
+1340.91 3.73848
+1343.5 3.73819
+1346.09 3.73791
+1348.68 3.73762
+1351.27 3.73734
+1353.86 3.73706
+1356.45 3.73677
+1359.04 3.73649
+1361.63 3.73621
+1364.21 3.73593
+1366.8 3.73565
+1369.39 3.73537
+1371.98 3.73508
+1374.57 3.7348
+1377.16 3.73452
+1379.75 3.73424
+1382.34 3.73397
+1384.93 3.73369
+1387.51 3.73341
+1390.1 3.73313
+1392.69 3.73285
+1395.28 3.73257
+1397.87 3.7323
+1400.46 3.73202
+1403.05 3.73174
+1405.64 3.73147
+1408.23 3.73119
+1410.81 3.73091
+1413.4 3.73064
+1415.99 3.73036
+1418.58 3.73009
+1421.17 3.72981
+1423.76 3.72954
+1426.35 3.72926
+1428.94 3.72899
+1431.53 3.72872
+1434.11 3.72844
+1436.7 3.72817
+1439.29 3.72789
+1441.88 3.72762
+1444.47 3.72735
+1447.06 3.72707
+1449.65 3.7268
+1452.24 3.72653
+1454.83 3.72625
+1457.41 3.72598
+1460 3.72571
+1462.59 3.72544
+1465.18 3.72516
+1467.77 3.72489
+1470.36 3.72462
+1472.95 3.72435
+1475.54 3.72408
+1478.13 3.7238
+1480.71 3.72353
+1483.3 3.72326
+1485.89 3.72299
+1488.48 3.72271
+1491.07 3.72244
+1493.66 3.72217
+1496.25 3.7219
+1498.84 3.72163
+1501.43 3.72135
+1504.01 3.72108
+1506.6 3.72081
+1509.19 3.72054
+1511.78 3.72026
+1514.37 3.71999
+1516.96 3.71972
+1519.55 3.71944
+1522.14 3.71917
+1524.73 3.7189
+1527.31 3.71863
+1529.9 3.71835
+1532.49 3.71808
+1535.08 3.7178
+1537.67 3.71753
+1540.26 3.71726
+1542.85 3.71698
+1545.44 3.71671
+1548.03 3.71643
+1550.61 3.71616
+1553.2 3.71588
+1555.79 3.7156
+1558.38 3.71533
+1560.97 3.71505
+1563.56 3.71477
+1566.15 3.7145
+1568.74 3.71422
+1571.33 3.71394
+1573.91 3.71366
+1576.5 3.71339
+1579.09 3.71311
+1581.68 3.71283
+1584.27 3.71255
+1586.86 3.71227
+1589.45 3.71199
+1592.04 3.7117
+1594.63 3.71142
+1597.21 3.71114
+1599.8 3.71086
+1602.39 3.71058
+1604.98 3.71029
+1607.57 3.71001
+1610.16 3.70972
+1612.75 3.70944
+1615.34 3.70915
+1617.93 3.70887
+1620.51 3.70858
+1623.1 3.70829
+1625.69 3.708
+1628.28 3.70771
+1630.87 3.70742
+1633.46 3.70713
+1636.05 3.70684
+1638.64 3.70655
+1641.23 3.70626
+1643.81 3.70596
+1646.4 3.70567
+1648.99 3.70537
+1651.58 3.70508
+1654.17 3.70478
+1656.76 3.70448
+1659.35 3.70419
+1661.94 3.70389
+1664.53 3.70359
+1667.11 3.70329
+1669.7 3.70298
+1672.29 3.70268
+1674.88 3.70238
+1677.47 3.70207
+1680.06 3.70177
+1682.65 3.70146
+1685.24 3.70115
+1687.83 3.70084
+1690.41 3.70053
+1693 3.70022
+1695.59 3.69991
+1698.18 3.69959
+1700.77 3.69928
+1703.36 3.69896
+1705.95 3.69864
+1708.54 3.69833
+1711.13 3.69801
+1713.71 3.69769
+1716.3 3.69736
+1718.89 3.69704
+1721.48 3.69671
+1724.07 3.69639
+1726.66 3.69606
+1729.25 3.69573
+1731.84 3.6954
+1734.43 3.69506
+1737.01 3.69473
+1739.6 3.69439
+1742.19 3.69406
+1744.78 3.69372
+1747.37 3.69338
+1749.96 3.69303
+1752.55 3.69269
+1755.14 3.69234
+1757.73 3.692
+1760.31 3.69165
+1762.9 3.6913
+1765.49 3.69094
+1768.08 3.69059
+1770.67 3.69023
+1773.26 3.68987
+1775.85 3.68951
+1778.44 3.68915
+1781.03 3.68878
+1783.61 3.68841
+1786.2 3.68804
+1788.79 3.68767
+1791.38 3.6873
+1793.97 3.68692
+1796.56 3.68654
+1799.15 3.68616
+1801.74 3.68578
+1804.33 3.68539
+1806.91 3.685
+1809.5 3.68461
+1812.09 3.68422
+1814.68 3.68382
+1817.27 3.68342
+1819.86 3.68302
+1822.45 3.68261
+1825.04 3.68221
+1827.63 3.68179
+1830.21 3.68138
+1832.8 3.68096
+1835.39 3.68054
+1837.98 3.68012
+1840.57 3.6797
+1843.16 3.67927
+1845.75 3.67883
+1848.34 3.6784
+1850.93 3.67796
+1853.51 3.67752
+1856.1 3.67707
+1858.69 3.67662
+1861.28 3.67617
+1863.87 3.67571
+1866.46 3.67525
+1869.05 3.67478
+1871.64 3.67431
+1874.23 3.67384
+1876.81 3.67336
+1879.4 3.67288
+1881.99 3.6724
+1884.58 3.67191
+1887.17 3.67141
+1889.76 3.67091
+1892.35 3.67041
+1894.94 3.6699
+1897.53 3.66939
+1900.11 3.66887
+1902.7 3.66835
+1905.29 3.66782
+1907.88 3.66728
+1910.47 3.66674
+1913.06 3.6662
+1915.65 3.66565
+1918.24 3.6651
+1920.83 3.66453
+1923.41 3.66397
+1926 3.66339
+1928.59 3.66282
+1931.18 3.66223
+1933.77 3.66164
+1936.36 3.66104
+1938.95 3.66044
+1941.54 3.65982
+1944.13 3.65921
+1946.71 3.65858
+1949.3 3.65795
+1951.89 3.65731
+1954.48 3.65666
+1957.07 3.656
+1959.66 3.65534
+1962.25 3.65467
+1964.84 3.65399
+1967.43 3.6533
+1970.01 3.6526
+1972.6 3.6519
+1975.19 3.65118
+1977.78 3.65046
+1980.37 3.64973
+1982.96 3.64899
+1985.55 3.64823
+1988.14 3.64747
+1990.73 3.6467
+1993.31 3.64591
+1995.9 3.64512
+1998.49 3.64431
+2001.08 3.6435
+2003.67 3.64267
+2006.26 3.64183
+2008.85 3.64098
+2011.44 3.64011
+2014.03 3.63923
+2016.61 3.63834
+2019.2 3.63744
+2021.79 3.63652
+2024.38 3.63558
+2026.97 3.63464
+2029.56 3.63368
+2032.15 3.6327
+2034.74 3.6317
+2037.33 3.63069
+2039.91 3.62967
+2042.5 3.62862
+2045.09 3.62756
+2047.68 3.62648
+2050.27 3.62539
+2052.86 3.62427
+2055.45 3.62313
+2058.04 3.62197
+2060.63 3.6208
+2063.21 3.6196
+2065.8 3.61838
+2068.39 3.61713
+2070.98 3.61586
+2073.57 3.61457
+2076.16 3.61326
+2078.75 3.61191
+2081.34 3.61054
+2083.93 3.60915
+2086.51 3.60772
+2089.1 3.60627
+2091.69 3.60479
+2094.28 3.60327
+2096.87 3.60172
+2099.46 3.60014
+2102.05 3.59853
+2104.64 3.59688
+2107.23 3.59519
+2109.81 3.59346
+2112.4 3.5917
+2114.99 3.58989
+2117.58 3.58804
+2120.17 3.58615
+2122.76 3.58421
+2125.35 3.58223
+2127.94 3.58019
+2130.53 3.57811
+2133.11 3.57597
+2135.7 3.57377
+2138.29 3.57152
+2140.88 3.56921
+2143.47 3.56683
+2146.06 3.56439
+2148.65 3.56188
+2151.24 3.5593
+2153.83 3.55665
+2156.41 3.55392
+2159 3.5511
+2161.59 3.54821
+2164.18 3.54522
+2166.77 3.54214
+2169.36 3.53897
+2171.95 3.53569
+2174.54 3.5323
+2177.13 3.5288
+2179.71 3.52519
+2182.3 3.52145
+2184.89 3.51757
+2187.48 3.51356
+2190.07 3.5094
+2192.66 3.50509
+2195.25 3.50061
+2197.84 3.49596
+2200.43 3.49112
+2203.01 3.48609
+2205.6 3.48086
+2208.19 3.4754
+2210.78 3.46971
+2213.37 3.46376
+2215.96 3.45755
+2218.55 3.45106
+2221.14 3.44425
+2223.73 3.43712
+2226.31 3.42963
+2228.9 3.42177
+2231.49 3.41349
+2234.08 3.40477
+2236.67 3.39556
+2239.26 3.38584
+2241.85 3.37554
+2244.44 3.36463
+2247.03 3.35303
+2249.61 3.34069
+2252.2 3.32754
+2254.79 3.31348
+2257.38 3.29842
+2259.97 3.28226
+2262.56 3.26485
+2265.15 3.24606
+2267.74 3.22571
+2270.33 3.20359
+2272.91 3.17948
+2275.5 3.15308
+2278.09 3.12405
+2280.68 3.09197
+2283.27 3.05635
+2285.86 3.01655
+2288.45 2.9718
+2291.04 2.9211
+e
+0 4.01529
+12.2972 4.00032
+25.2417 3.98741
+38.1861 3.97614
+51.1306 3.9658
+64.075 3.95605
+77.0194 3.9467
+89.9639 3.93765
+102.908 3.92883
+115.853 3.92024
+128.797 3.91184
+141.742 3.90363
+154.686 3.8956
+167.631 3.88775
+180.575 3.88006
+193.519 3.87254
+206.464 3.86518
+219.408 3.85798
+232.353 3.85093
+245.297 3.84403
+258.242 3.83728
+271.186 3.83067
+284.131 3.8242
+297.075 3.81787
+310.019 3.81168
+322.964 3.80561
+335.908 3.79967
+348.853 3.79386
+361.797 3.78817
+374.742 3.7826
+387.686 3.77714
+400.631 3.7718
+413.575 3.76657
+426.519 3.76145
+439.464 3.75644
+452.408 3.75153
+465.353 3.74672
+478.297 3.74201
+491.242 3.7374
+504.186 3.73288
+517.131 3.72845
+530.075 3.72412
+543.019 3.71987
+555.964 3.71571
+568.908 3.71163
+581.853 3.70763
+594.797 3.70372
+607.742 3.69988
+620.686 3.69612
+633.631 3.69243
+646.575 3.68882
+659.519 3.68527
+672.464 3.6818
+685.408 3.67839
+698.353 3.67505
+711.297 3.67177
+724.242 3.66856
+737.186 3.6654
+750.131 3.66231
+763.075 3.65927
+776.019 3.65629
+788.964 3.65336
+801.908 3.65049
+814.853 3.64767
+827.797 3.6449
+840.742 3.64218
+853.686 3.63951
+866.631 3.63688
+879.575 3.6343
+892.519 3.63176
+905.464 3.62927
+918.408 3.62682
+931.353 3.6244
+944.297 3.62203
+957.242 3.6197
+970.186 3.6174
+983.131 3.61514
+996.075 3.61291
+1009.02 3.61071
+1021.96 3.60855
+1034.91 3.60642
+1047.85 3.60432
+1060.8 3.60225
+1073.74 3.6002
+1086.69 3.59818
+1099.63 3.59619
+1112.58 3.59422
+1125.52 3.59228
+1138.46 3.59036
+1151.41 3.58846
+1164.35 3.58658
+1177.3 3.58472
+1190.24 3.58287
+1203.19 3.58105
+1216.13 3.57924
+1229.08 3.57745
+1242.02 3.57567
+1254.96 3.5739
+1267.91 3.57215
+1280.85 3.5704
+1293.8 3.56867
+1306.74 3.56694
+1319.69 3.56522
+1332.63 3.56351
+1345.58 3.5618
+1358.52 3.5601
+1371.46 3.5584
+1384.41 3.5567
+1397.35 3.555
+1410.3 3.5533
+1423.24 3.55159
+1436.19 3.54988
+1449.13 3.54817
+1462.08 3.54645
+1475.02 3.54472
+1487.96 3.54298
+1500.91 3.54122
+1513.85 3.53946
+1526.8 3.53768
+1539.74 3.53588
+1552.69 3.53406
+1565.63 3.53221
+1578.58 3.53035
+1591.52 3.52845
+1604.46 3.52653
+1617.41 3.52458
+1630.35 3.52259
+1643.3 3.52056
+1656.24 3.51849
+1669.19 3.51637
+1682.13 3.51421
+1695.08 3.512
+1708.02 3.50973
+1720.96 3.50739
+1733.91 3.50499
+1746.85 3.50252
+1759.8 3.49997
+1772.74 3.49733
+1785.69 3.49461
+1798.63 3.49178
+1811.58 3.48885
+1824.52 3.4858
+1837.46 3.48262
+1850.41 3.4793
+1863.35 3.47583
+1876.3 3.4722
+1889.24 3.46839
+1902.19 3.46438
+1915.13 3.46015
+1928.08 3.45568
+1941.02 3.45094
+1953.96 3.44592
+1966.91 3.44057
+1979.85 3.43485
+1992.8 3.42873
+2005.74 3.42216
+2018.69 3.41507
+2031.63 3.4074
+2044.58 3.39908
+2057.52 3.38999
+2070.46 3.38004
+2083.41 3.36908
+2096.35 3.35694
+2109.3 3.34342
+2122.24 3.32825
+2135.19 3.3111
+2148.13 3.29156
+2161.08 3.26907
+2174.02 3.24289
+2186.96 3.21202
+2199.91 3.17506
+2212.85 3.12999
+2225.8 3.07379
+2238.74 3.0017
+2251.69 2.90587
+2264.63 2.77217
+2277.58 2.57255
+e
+0 3.8219
+24.5944 3.7921
+50.4833 3.76679
+76.3722 3.74511
+102.261 3.72567
+128.15 3.70775
+154.039 3.69093
+179.928 3.67501
+205.817 3.65985
+231.706 3.64537
+257.594 3.63152
+283.483 3.61825
+309.372 3.60554
+335.261 3.59335
+361.15 3.58166
+387.039 3.57044
+412.928 3.55967
+438.817 3.54934
+464.706 3.53942
+490.594 3.52989
+516.483 3.52073
+542.372 3.51192
+568.261 3.50346
+594.15 3.49532
+620.039 3.48748
+645.928 3.47993
+671.817 3.47266
+697.706 3.46565
+723.594 3.45889
+749.483 3.45237
+775.372 3.44607
+801.261 3.43997
+827.15 3.43408
+853.039 3.42838
+878.928 3.42285
+904.817 3.41748
+930.706 3.41227
+956.594 3.4072
+982.483 3.40227
+1008.37 3.39746
+1034.26 3.39276
+1060.15 3.38817
+1086.04 3.38367
+1111.93 3.37926
+1137.82 3.37492
+1163.71 3.37065
+1189.59 3.36643
+1215.48 3.36226
+1241.37 3.35812
+1267.26 3.354
+1293.15 3.3499
+1319.04 3.34581
+1344.93 3.3417
+1370.82 3.33757
+1396.71 3.33341
+1422.59 3.3292
+1448.48 3.32492
+1474.37 3.32056
+1500.26 3.31611
+1526.15 3.31154
+1552.04 3.30683
+1577.93 3.30195
+1603.82 3.29689
+1629.71 3.2916
+1655.59 3.28606
+1681.48 3.28023
+1707.37 3.27405
+1733.26 3.26749
+1759.15 3.26047
+1785.04 3.25292
+1810.93 3.24475
+1836.82 3.23587
+1862.71 3.22613
+1888.59 3.21539
+1914.48 3.20344
+1940.37 3.19005
+1966.26 3.17488
+1992.15 3.15753
+2018.04 3.13743
+2043.93 3.11384
+2069.82 3.08571
+2095.71 3.05152
+2121.59 3.00899
+2147.48 2.95458
+2173.37 2.88237
+2199.26 2.78178
+2225.15 2.63177
+2251.04 2.38371
+e
@@ -0,0 +1,3414 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "BattDisch4.eps"
+set xlabel " Time (Minutes)"
+set ylabel "Voltage (V)"
+set xrange[1:1800]
+                               set yrange [7:13]
+                               set logscale 
+                               set tics scale 3
+                               set xtics (1,2,4,6,8,10,20,40,60,120,240,360,480,600,1200)
+                               set ytics (7,8,9,10,11,12,13)
+                               set grid
+                               set style line 1 linewidth 5
+                               set style line 2 linewidth 5
+                               set style line 3 linewidth 5
+                               set style line 4 linewidth 5
+                               set style line 5 linewidth 5
+                               set style line 6 linewidth 5
+                               set style line 7 linewidth 5
+                               set style line 8 linewidth 5
+                               set style increment user
+                               set key reverse Left
+plot "-"  title "Rs PRO LGP12100  5A (0.05C)" with lines, "-"  title "Rs PRO LGP12100  100A (1C)" with lines
+0 12.6
+0.333333 12.5891
+0.666667 12.5827
+1 12.5792
+1.33333 12.577
+1.66667 12.5756
+2 12.5745
+2.33333 12.5737
+2.66667 12.5729
+3 12.5722
+3.33333 12.5715
+3.66667 12.5709
+4 12.5702
+4.33333 12.5696
+4.66667 12.5689
+5 12.5683
+5.33333 12.5677
+5.66667 12.5671
+6 12.5664
+6.33333 12.5658
+6.66667 12.5652
+7 12.5646
+7.33333 12.564
+7.66667 12.5634
+8 12.5628
+8.33333 12.5622
+8.66667 12.5616
+9 12.561
+9.33333 12.5604
+9.66667 12.5598
+10 12.5593
+10.3333 12.5587
+10.6667 12.5581
+11 12.5575
+11.3333 12.557
+11.6667 12.5564
+12 12.5558
+12.3333 12.5553
+12.6667 12.5547
+13 12.5542
+13.3333 12.5536
+13.6667 12.5531
+14 12.5525
+14.3333 12.552
+14.6667 12.5514
+15 12.5509
+15.3333 12.5504
+15.6667 12.5498
+16 12.5493
+16.3333 12.5488
+16.6667 12.5483
+17 12.5477
+17.3333 12.5472
+17.6667 12.5467
+18 12.5462
+18.3333 12.5457
+18.6667 12.5452
+19 12.5447
+19.3333 12.5442
+19.6667 12.5437
+20 12.5432
+20.3333 12.5427
+20.6667 12.5422
+21 12.5417
+21.3333 12.5412
+21.6667 12.5407
+22 12.5402
+22.3333 12.5398
+22.6667 12.5393
+23 12.5388
+23.3333 12.5383
+23.6667 12.5379
+24 12.5374
+24.3333 12.5369
+24.6667 12.5365
+25 12.536
+25.3333 12.5355
+25.6667 12.5351
+26 12.5346
+26.3333 12.5342
+26.6667 12.5337
+27 12.5333
+27.3333 12.5328
+27.6667 12.5324
+28 12.5319
+28.3333 12.5315
+28.6667 12.5311
+29 12.5306
+29.3333 12.5302
+29.6667 12.5298
+30 12.5293
+30.3333 12.5289
+30.6667 12.5285
+31 12.5281
+31.3333 12.5276
+31.6667 12.5272
+32 12.5268
+32.3333 12.5264
+32.6667 12.526
+33 12.5256
+33.3333 12.5251
+33.6667 12.5247
+34 12.5243
+34.3333 12.5239
+34.6667 12.5235
+35 12.5231
+35.3333 12.5227
+35.6667 12.5223
+36 12.5219
+36.3333 12.5215
+36.6667 12.5211
+37 12.5207
+37.3333 12.5204
+37.6667 12.52
+38 12.5196
+38.3333 12.5192
+38.6667 12.5188
+39 12.5184
+39.3333 12.5181
+39.6667 12.5177
+40 12.5173
+40.3333 12.5169
+40.6667 12.5166
+41 12.5162
+41.3333 12.5158
+41.6667 12.5155
+42 12.5151
+42.3333 12.5147
+42.6667 12.5144
+43 12.514
+43.3333 12.5136
+43.6667 12.5133
+44 12.5129
+44.3333 12.5126
+44.6667 12.5122
+45 12.5119
+45.3333 12.5115
+45.6667 12.5112
+46 12.5108
+46.3333 12.5105
+46.6667 12.5101
+47 12.5098
+47.3333 12.5094
+47.6667 12.5091
+48 12.5088
+48.3333 12.5084
+48.6667 12.5081
+49 12.5077
+49.3333 12.5074
+49.6667 12.5071
+50 12.5067
+50.3333 12.5064
+50.6667 12.5061
+51 12.5058
+51.3333 12.5054
+51.6667 12.5051
+52 12.5048
+52.3333 12.5045
+52.6667 12.5041
+53 12.5038
+53.3333 12.5035
+53.6667 12.5032
+54 12.5029
+54.3333 12.5026
+54.6667 12.5022
+55 12.5019
+55.3333 12.5016
+55.6667 12.5013
+56 12.501
+56.3333 12.5007
+56.6667 12.5004
+57 12.5001
+57.3333 12.4998
+57.6667 12.4995
+58 12.4992
+58.3333 12.4989
+58.6667 12.4986
+59 12.4983
+59.3333 12.498
+59.6667 12.4977
+60 12.4974
+60.3333 12.4971
+60.6667 12.4968
+61 12.4965
+61.3333 12.4962
+61.6667 12.4959
+62 12.4956
+62.3333 12.4953
+62.6667 12.495
+63 12.4947
+63.3333 12.4945
+63.6667 12.4942
+64 12.4939
+64.3333 12.4936
+64.6667 12.4933
+65 12.493
+65.3333 12.4928
+65.6667 12.4925
+66 12.4922
+66.3333 12.4919
+66.6667 12.4916
+67 12.4914
+67.3333 12.4911
+67.6667 12.4908
+68 12.4906
+68.3333 12.4903
+68.6667 12.49
+69 12.4897
+69.3333 12.4895
+69.6667 12.4892
+70 12.4889
+70.3333 12.4887
+70.6667 12.4884
+71 12.4881
+71.3333 12.4879
+71.6667 12.4876
+72 12.4873
+72.3333 12.4871
+72.6667 12.4868
+73 12.4866
+73.3333 12.4863
+73.6667 12.486
+74 12.4858
+74.3333 12.4855
+74.6667 12.4853
+75 12.485
+75.3333 12.4847
+75.6667 12.4845
+76 12.4842
+76.3333 12.484
+76.6667 12.4837
+77 12.4835
+77.3333 12.4832
+77.6667 12.483
+78 12.4827
+78.3333 12.4825
+78.6667 12.4822
+79 12.482
+79.3333 12.4817
+79.6667 12.4815
+80 12.4812
+80.3333 12.481
+80.6667 12.4808
+81 12.4805
+81.3333 12.4803
+81.6667 12.48
+82 12.4798
+82.3333 12.4795
+82.6667 12.4793
+83 12.4791
+83.3333 12.4788
+83.6667 12.4786
+84 12.4783
+84.3333 12.4781
+84.6667 12.4779
+85 12.4776
+85.3333 12.4774
+85.6667 12.4772
+86 12.4769
+86.3333 12.4767
+86.6667 12.4765
+87 12.4762
+87.3333 12.476
+87.6667 12.4758
+88 12.4755
+88.3333 12.4753
+88.6667 12.4751
+89 12.4748
+89.3333 12.4746
+89.6667 12.4744
+90 12.4742
+90.3333 12.4739
+90.6667 12.4737
+91 12.4735
+91.3333 12.4733
+91.6667 12.473
+92 12.4728
+92.3333 12.4726
+92.6667 12.4724
+93 12.4721
+93.3333 12.4719
+93.6667 12.4717
+94 12.4715
+94.3333 12.4712
+94.6667 12.471
+95 12.4708
+95.3333 12.4706
+95.6667 12.4704
+96 12.4702
+96.3333 12.4699
+96.6667 12.4697
+97 12.4695
+97.3333 12.4693
+97.6667 12.4691
+98 12.4688
+98.3333 12.4686
+98.6667 12.4684
+99 12.4682
+99.3333 12.468
+99.6667 12.4678
+100 12.4676
+100.333 12.4673
+100.667 12.4671
+101 12.4669
+101.333 12.4667
+101.667 12.4665
+102 12.4663
+102.333 12.4661
+102.667 12.4659
+103 12.4657
+103.333 12.4654
+103.667 12.4652
+104 12.465
+104.333 12.4648
+104.667 12.4646
+105 12.4644
+105.333 12.4642
+105.667 12.464
+106 12.4638
+106.333 12.4636
+106.667 12.4634
+107 12.4632
+107.333 12.463
+107.667 12.4628
+108 12.4625
+108.333 12.4623
+108.667 12.4621
+109 12.4619
+109.333 12.4617
+109.667 12.4615
+110 12.4613
+110.333 12.4611
+110.667 12.4609
+111 12.4607
+111.333 12.4605
+111.667 12.4603
+112 12.4601
+112.333 12.4599
+112.667 12.4597
+113 12.4595
+113.333 12.4593
+113.667 12.4591
+114 12.4589
+114.333 12.4587
+114.667 12.4585
+115 12.4583
+115.333 12.4581
+115.667 12.4579
+116 12.4577
+116.333 12.4575
+116.667 12.4573
+117 12.4571
+117.333 12.4569
+117.667 12.4568
+118 12.4566
+118.333 12.4564
+118.667 12.4562
+119 12.456
+119.333 12.4558
+119.667 12.4556
+120 12.4554
+120.333 12.4552
+120.667 12.455
+121 12.4548
+121.333 12.4546
+121.667 12.4544
+122 12.4542
+122.333 12.454
+122.667 12.4538
+123 12.4537
+123.333 12.4535
+123.667 12.4533
+124 12.4531
+124.333 12.4529
+124.667 12.4527
+125 12.4525
+125.333 12.4523
+125.667 12.4521
+126 12.4519
+126.333 12.4517
+126.667 12.4516
+127 12.4514
+127.333 12.4512
+127.667 12.451
+128 12.4508
+128.333 12.4506
+128.667 12.4504
+129 12.4502
+129.333 12.4501
+129.667 12.4499
+130 12.4497
+130.333 12.4495
+130.667 12.4493
+131 12.4491
+131.333 12.4489
+131.667 12.4487
+132 12.4486
+132.333 12.4484
+132.667 12.4482
+133 12.448
+133.333 12.4478
+133.667 12.4476
+134 12.4474
+134.333 12.4473
+134.667 12.4471
+135 12.4469
+135.333 12.4467
+135.667 12.4465
+136 12.4463
+136.333 12.4461
+136.667 12.446
+137 12.4458
+137.333 12.4456
+137.667 12.4454
+138 12.4452
+138.333 12.445
+138.667 12.4449
+139 12.4447
+139.333 12.4445
+139.667 12.4443
+140 12.4441
+140.333 12.4439
+140.667 12.4438
+141 12.4436
+141.333 12.4434
+141.667 12.4432
+142 12.443
+142.333 12.4429
+142.667 12.4427
+143 12.4425
+143.333 12.4423
+143.667 12.4421
+144 12.442
+144.333 12.4418
+144.667 12.4416
+145 12.4414
+145.333 12.4412
+145.667 12.441
+146 12.4409
+146.333 12.4407
+146.667 12.4405
+147 12.4403
+147.333 12.4401
+147.667 12.44
+148 12.4398
+148.333 12.4396
+148.667 12.4394
+149 12.4392
+149.333 12.4391
+149.667 12.4389
+150 12.4387
+150.333 12.4385
+150.667 12.4384
+151 12.4382
+151.333 12.438
+151.667 12.4378
+152 12.4376
+152.333 12.4375
+152.667 12.4373
+153 12.4371
+153.333 12.4369
+153.667 12.4367
+154 12.4366
+154.333 12.4364
+154.667 12.4362
+155 12.436
+155.333 12.4359
+155.667 12.4357
+156 12.4355
+156.333 12.4353
+156.667 12.4351
+157 12.435
+157.333 12.4348
+157.667 12.4346
+158 12.4344
+158.333 12.4343
+158.667 12.4341
+159 12.4339
+159.333 12.4337
+159.667 12.4336
+160 12.4334
+160.333 12.4332
+160.667 12.433
+161 12.4328
+161.333 12.4327
+161.667 12.4325
+162 12.4323
+162.333 12.4321
+162.667 12.432
+163 12.4318
+163.333 12.4316
+163.667 12.4314
+164 12.4313
+164.333 12.4311
+164.667 12.4309
+165 12.4307
+165.333 12.4306
+165.667 12.4304
+166 12.4302
+166.333 12.43
+166.667 12.4299
+167 12.4297
+167.333 12.4295
+167.667 12.4293
+168 12.4292
+168.333 12.429
+168.667 12.4288
+169 12.4286
+169.333 12.4285
+169.667 12.4283
+170 12.4281
+170.333 12.4279
+170.667 12.4278
+171 12.4276
+171.333 12.4274
+171.667 12.4272
+172 12.4271
+172.333 12.4269
+172.667 12.4267
+173 12.4265
+173.333 12.4264
+173.667 12.4262
+174 12.426
+174.333 12.4258
+174.667 12.4257
+175 12.4255
+175.333 12.4253
+175.667 12.4251
+176 12.425
+176.333 12.4248
+176.667 12.4246
+177 12.4244
+177.333 12.4243
+177.667 12.4241
+178 12.4239
+178.333 12.4237
+178.667 12.4236
+179 12.4234
+179.333 12.4232
+179.667 12.423
+180 12.4229
+180.333 12.4227
+180.667 12.4225
+181 12.4223
+181.333 12.4222
+181.667 12.422
+182 12.4218
+182.333 12.4216
+182.667 12.4215
+183 12.4213
+183.333 12.4211
+183.667 12.4209
+184 12.4208
+184.333 12.4206
+184.667 12.4204
+185 12.4202
+185.333 12.4201
+185.667 12.4199
+186 12.4197
+186.333 12.4195
+186.667 12.4194
+187 12.4192
+187.333 12.419
+187.667 12.4188
+188 12.4187
+188.333 12.4185
+188.667 12.4183
+189 12.4181
+189.333 12.418
+189.667 12.4178
+190 12.4176
+190.333 12.4175
+190.667 12.4173
+191 12.4171
+191.333 12.4169
+191.667 12.4168
+192 12.4166
+192.333 12.4164
+192.667 12.4162
+193 12.4161
+193.333 12.4159
+193.667 12.4157
+194 12.4155
+194.333 12.4154
+194.667 12.4152
+195 12.415
+195.333 12.4148
+195.667 12.4147
+196 12.4145
+196.333 12.4143
+196.667 12.4141
+197 12.414
+197.333 12.4138
+197.667 12.4136
+198 12.4134
+198.333 12.4133
+198.667 12.4131
+199 12.4129
+199.333 12.4127
+199.667 12.4126
+200 12.4124
+200.333 12.4122
+200.667 12.412
+201 12.4119
+201.333 12.4117
+201.667 12.4115
+202 12.4113
+202.333 12.4112
+202.667 12.411
+203 12.4108
+203.333 12.4106
+203.667 12.4105
+204 12.4103
+204.333 12.4101
+204.667 12.4099
+205 12.4098
+205.333 12.4096
+205.667 12.4094
+206 12.4092
+206.333 12.4091
+206.667 12.4089
+207 12.4087
+207.333 12.4085
+207.667 12.4084
+208 12.4082
+208.333 12.408
+208.667 12.4078
+209 12.4077
+209.333 12.4075
+209.667 12.4073
+210 12.4071
+210.333 12.407
+210.667 12.4068
+211 12.4066
+211.333 12.4064
+211.667 12.4063
+212 12.4061
+212.333 12.4059
+212.667 12.4057
+213 12.4055
+213.333 12.4054
+213.667 12.4052
+214 12.405
+214.333 12.4048
+214.667 12.4047
+215 12.4045
+215.333 12.4043
+215.667 12.4041
+216 12.404
+216.333 12.4038
+216.667 12.4036
+217 12.4034
+217.333 12.4033
+217.667 12.4031
+218 12.4029
+218.333 12.4027
+218.667 12.4025
+219 12.4024
+219.333 12.4022
+219.667 12.402
+220 12.4018
+220.333 12.4017
+220.667 12.4015
+221 12.4013
+221.333 12.4011
+221.667 12.401
+222 12.4008
+222.333 12.4006
+222.667 12.4004
+223 12.4002
+223.333 12.4001
+223.667 12.3999
+224 12.3997
+224.333 12.3995
+224.667 12.3994
+225 12.3992
+225.333 12.399
+225.667 12.3988
+226 12.3986
+226.333 12.3985
+226.667 12.3983
+227 12.3981
+227.333 12.3979
+227.667 12.3978
+228 12.3976
+228.333 12.3974
+228.667 12.3972
+229 12.397
+229.333 12.3969
+229.667 12.3967
+230 12.3965
+230.333 12.3963
+230.667 12.3962
+231 12.396
+231.333 12.3958
+231.667 12.3956
+232 12.3954
+232.333 12.3953
+232.667 12.3951
+233 12.3949
+233.333 12.3947
+233.667 12.3945
+234 12.3944
+234.333 12.3942
+234.667 12.394
+235 12.3938
+235.333 12.3937
+235.667 12.3935
+236 12.3933
+236.333 12.3931
+236.667 12.3929
+237 12.3928
+237.333 12.3926
+237.667 12.3924
+238 12.3922
+238.333 12.392
+238.667 12.3919
+239 12.3917
+239.333 12.3915
+239.667 12.3913
+240 12.3911
+240.333 12.391
+240.667 12.3908
+241 12.3906
+241.333 12.3904
+241.667 12.3902
+242 12.3901
+242.333 12.3899
+242.667 12.3897
+243 12.3895
+243.333 12.3893
+243.667 12.3891
+244 12.389
+244.333 12.3888
+244.667 12.3886
+245 12.3884
+245.333 12.3882
+245.667 12.3881
+246 12.3879
+246.333 12.3877
+246.667 12.3875
+247 12.3873
+247.333 12.3872
+247.667 12.387
+248 12.3868
+248.333 12.3866
+248.667 12.3864
+249 12.3862
+249.333 12.3861
+249.667 12.3859
+250 12.3857
+250.333 12.3855
+250.667 12.3853
+251 12.3852
+251.333 12.385
+251.667 12.3848
+252 12.3846
+252.333 12.3844
+252.667 12.3842
+253 12.3841
+253.333 12.3839
+253.667 12.3837
+254 12.3835
+254.333 12.3833
+254.667 12.3831
+255 12.383
+255.333 12.3828
+255.667 12.3826
+256 12.3824
+256.333 12.3822
+256.667 12.382
+257 12.3819
+257.333 12.3817
+257.667 12.3815
+258 12.3813
+258.333 12.3811
+258.667 12.3809
+259 12.3808
+259.333 12.3806
+259.667 12.3804
+260 12.3802
+260.333 12.38
+260.667 12.3798
+261 12.3796
+261.333 12.3795
+261.667 12.3793
+262 12.3791
+262.333 12.3789
+262.667 12.3787
+263 12.3785
+263.333 12.3784
+263.667 12.3782
+264 12.378
+264.333 12.3778
+264.667 12.3776
+265 12.3774
+265.333 12.3772
+265.667 12.3771
+266 12.3769
+266.333 12.3767
+266.667 12.3765
+267 12.3763
+267.333 12.3761
+267.667 12.3759
+268 12.3758
+268.333 12.3756
+268.667 12.3754
+269 12.3752
+269.333 12.375
+269.667 12.3748
+270 12.3746
+270.333 12.3744
+270.667 12.3743
+271 12.3741
+271.333 12.3739
+271.667 12.3737
+272 12.3735
+272.333 12.3733
+272.667 12.3731
+273 12.3729
+273.333 12.3728
+273.667 12.3726
+274 12.3724
+274.333 12.3722
+274.667 12.372
+275 12.3718
+275.333 12.3716
+275.667 12.3714
+276 12.3713
+276.333 12.3711
+276.667 12.3709
+277 12.3707
+277.333 12.3705
+277.667 12.3703
+278 12.3701
+278.333 12.3699
+278.667 12.3697
+279 12.3696
+279.333 12.3694
+279.667 12.3692
+280 12.369
+280.333 12.3688
+280.667 12.3686
+281 12.3684
+281.333 12.3682
+281.667 12.368
+282 12.3679
+282.333 12.3677
+282.667 12.3675
+283 12.3673
+283.333 12.3671
+283.667 12.3669
+284 12.3667
+284.333 12.3665
+284.667 12.3663
+285 12.3661
+285.333 12.366
+285.667 12.3658
+286 12.3656
+286.333 12.3654
+286.667 12.3652
+287 12.365
+287.333 12.3648
+287.667 12.3646
+288 12.3644
+288.333 12.3642
+288.667 12.364
+289 12.3638
+289.333 12.3637
+289.667 12.3635
+290 12.3633
+290.333 12.3631
+290.667 12.3629
+291 12.3627
+291.333 12.3625
+291.667 12.3623
+292 12.3621
+292.333 12.3619
+292.667 12.3617
+293 12.3615
+293.333 12.3613
+293.667 12.3612
+294 12.361
+294.333 12.3608
+294.667 12.3606
+295 12.3604
+295.333 12.3602
+295.667 12.36
+296 12.3598
+296.333 12.3596
+296.667 12.3594
+297 12.3592
+297.333 12.359
+297.667 12.3588
+298 12.3586
+298.333 12.3584
+298.667 12.3583
+299 12.3581
+299.333 12.3579
+299.667 12.3577
+300 12.3575
+300.333 12.3573
+300.667 12.3571
+301 12.3569
+301.333 12.3567
+301.667 12.3565
+302 12.3563
+302.333 12.3561
+302.667 12.3559
+303 12.3557
+303.333 12.3555
+303.667 12.3553
+304 12.3551
+304.333 12.3549
+304.667 12.3547
+305 12.3545
+305.333 12.3543
+305.667 12.3541
+306 12.354
+306.333 12.3538
+306.667 12.3536
+307 12.3534
+307.333 12.3532
+307.667 12.353
+308 12.3528
+308.333 12.3526
+308.667 12.3524
+309 12.3522
+309.333 12.352
+309.667 12.3518
+310 12.3516
+310.333 12.3514
+310.667 12.3512
+311 12.351
+311.333 12.3508
+311.667 12.3506
+312 12.3504
+312.333 12.3502
+312.667 12.35
+313 12.3498
+313.333 12.3496
+313.667 12.3494
+314 12.3492
+314.333 12.349
+314.667 12.3488
+315 12.3486
+315.333 12.3484
+315.667 12.3482
+316 12.348
+316.333 12.3478
+316.667 12.3476
+317 12.3474
+317.333 12.3472
+317.667 12.347
+318 12.3468
+318.333 12.3466
+318.667 12.3464
+319 12.3462
+319.333 12.346
+319.667 12.3458
+320 12.3456
+320.333 12.3454
+320.667 12.3452
+321 12.345
+321.333 12.3448
+321.667 12.3446
+322 12.3444
+322.333 12.3442
+322.667 12.344
+323 12.3438
+323.333 12.3436
+323.667 12.3434
+324 12.3432
+324.333 12.343
+324.667 12.3428
+325 12.3426
+325.333 12.3424
+325.667 12.3422
+326 12.342
+326.333 12.3418
+326.667 12.3416
+327 12.3414
+327.333 12.3412
+327.667 12.341
+328 12.3408
+328.333 12.3406
+328.667 12.3404
+329 12.3402
+329.333 12.34
+329.667 12.3397
+330 12.3395
+330.333 12.3393
+330.667 12.3391
+331 12.3389
+331.333 12.3387
+331.667 12.3385
+332 12.3383
+332.333 12.3381
+332.667 12.3379
+333 12.3377
+333.333 12.3375
+333.667 12.3373
+334 12.3371
+334.333 12.3369
+334.667 12.3367
+335 12.3365
+335.333 12.3363
+335.667 12.3361
+336 12.3359
+336.333 12.3357
+336.667 12.3354
+337 12.3352
+337.333 12.335
+337.667 12.3348
+338 12.3346
+338.333 12.3344
+338.667 12.3342
+339 12.334
+339.333 12.3338
+339.667 12.3336
+340 12.3334
+340.333 12.3332
+340.667 12.333
+341 12.3328
+341.333 12.3326
+341.667 12.3323
+342 12.3321
+342.333 12.3319
+342.667 12.3317
+343 12.3315
+343.333 12.3313
+343.667 12.3311
+344 12.3309
+344.333 12.3307
+344.667 12.3305
+345 12.3303
+345.333 12.3301
+345.667 12.3298
+346 12.3296
+346.333 12.3294
+346.667 12.3292
+347 12.329
+347.333 12.3288
+347.667 12.3286
+348 12.3284
+348.333 12.3282
+348.667 12.328
+349 12.3278
+349.333 12.3275
+349.667 12.3273
+350 12.3271
+350.333 12.3269
+350.667 12.3267
+351 12.3265
+351.333 12.3263
+351.667 12.3261
+352 12.3259
+352.333 12.3256
+352.667 12.3254
+353 12.3252
+353.333 12.325
+353.667 12.3248
+354 12.3246
+354.333 12.3244
+354.667 12.3242
+355 12.324
+355.333 12.3237
+355.667 12.3235
+356 12.3233
+356.333 12.3231
+356.667 12.3229
+357 12.3227
+357.333 12.3225
+357.667 12.3223
+358 12.322
+358.333 12.3218
+358.667 12.3216
+359 12.3214
+359.333 12.3212
+359.667 12.321
+360 12.3208
+360.333 12.3205
+360.667 12.3203
+361 12.3201
+361.333 12.3199
+361.667 12.3197
+362 12.3195
+362.333 12.3193
+362.667 12.319
+363 12.3188
+363.333 12.3186
+363.667 12.3184
+364 12.3182
+364.333 12.318
+364.667 12.3178
+365 12.3175
+365.333 12.3173
+365.667 12.3171
+366 12.3169
+366.333 12.3167
+366.667 12.3165
+367 12.3162
+367.333 12.316
+367.667 12.3158
+368 12.3156
+368.333 12.3154
+368.667 12.3152
+369 12.3149
+369.333 12.3147
+369.667 12.3145
+370 12.3143
+370.333 12.3141
+370.667 12.3139
+371 12.3136
+371.333 12.3134
+371.667 12.3132
+372 12.313
+372.333 12.3128
+372.667 12.3125
+373 12.3123
+373.333 12.3121
+373.667 12.3119
+374 12.3117
+374.333 12.3115
+374.667 12.3112
+375 12.311
+375.333 12.3108
+375.667 12.3106
+376 12.3104
+376.333 12.3101
+376.667 12.3099
+377 12.3097
+377.333 12.3095
+377.667 12.3093
+378 12.309
+378.333 12.3088
+378.667 12.3086
+379 12.3084
+379.333 12.3082
+379.667 12.3079
+380 12.3077
+380.333 12.3075
+380.667 12.3073
+381 12.3071
+381.333 12.3068
+381.667 12.3066
+382 12.3064
+382.333 12.3062
+382.667 12.3059
+383 12.3057
+383.333 12.3055
+383.667 12.3053
+384 12.3051
+384.333 12.3048
+384.667 12.3046
+385 12.3044
+385.333 12.3042
+385.667 12.3039
+386 12.3037
+386.333 12.3035
+386.667 12.3033
+387 12.303
+387.333 12.3028
+387.667 12.3026
+388 12.3024
+388.333 12.3022
+388.667 12.3019
+389 12.3017
+389.333 12.3015
+389.667 12.3013
+390 12.301
+390.333 12.3008
+390.667 12.3006
+391 12.3004
+391.333 12.3001
+391.667 12.2999
+392 12.2997
+392.333 12.2995
+392.667 12.2992
+393 12.299
+393.333 12.2988
+393.667 12.2985
+394 12.2983
+394.333 12.2981
+394.667 12.2979
+395 12.2976
+395.333 12.2974
+395.667 12.2972
+396 12.297
+396.333 12.2967
+396.667 12.2965
+397 12.2963
+397.333 12.2961
+397.667 12.2958
+398 12.2956
+398.333 12.2954
+398.667 12.2951
+399 12.2949
+399.333 12.2947
+399.667 12.2945
+400 12.2942
+400.333 12.294
+400.667 12.2938
+401 12.2935
+401.333 12.2933
+401.667 12.2931
+402 12.2929
+402.333 12.2926
+402.667 12.2924
+403 12.2922
+403.333 12.2919
+403.667 12.2917
+404 12.2915
+404.333 12.2912
+404.667 12.291
+405 12.2908
+405.333 12.2906
+405.667 12.2903
+406 12.2901
+406.333 12.2899
+406.667 12.2896
+407 12.2894
+407.333 12.2892
+407.667 12.2889
+408 12.2887
+408.333 12.2885
+408.667 12.2882
+409 12.288
+409.333 12.2878
+409.667 12.2875
+410 12.2873
+410.333 12.2871
+410.667 12.2868
+411 12.2866
+411.333 12.2864
+411.667 12.2861
+412 12.2859
+412.333 12.2857
+412.667 12.2854
+413 12.2852
+413.333 12.285
+413.667 12.2847
+414 12.2845
+414.333 12.2843
+414.667 12.284
+415 12.2838
+415.333 12.2836
+415.667 12.2833
+416 12.2831
+416.333 12.2829
+416.667 12.2826
+417 12.2824
+417.333 12.2822
+417.667 12.2819
+418 12.2817
+418.333 12.2815
+418.667 12.2812
+419 12.281
+419.333 12.2807
+419.667 12.2805
+420 12.2803
+420.333 12.28
+420.667 12.2798
+421 12.2796
+421.333 12.2793
+421.667 12.2791
+422 12.2788
+422.333 12.2786
+422.667 12.2784
+423 12.2781
+423.333 12.2779
+423.667 12.2777
+424 12.2774
+424.333 12.2772
+424.667 12.2769
+425 12.2767
+425.333 12.2765
+425.667 12.2762
+426 12.276
+426.333 12.2757
+426.667 12.2755
+427 12.2753
+427.333 12.275
+427.667 12.2748
+428 12.2745
+428.333 12.2743
+428.667 12.2741
+429 12.2738
+429.333 12.2736
+429.667 12.2733
+430 12.2731
+430.333 12.2729
+430.667 12.2726
+431 12.2724
+431.333 12.2721
+431.667 12.2719
+432 12.2717
+432.333 12.2714
+432.667 12.2712
+433 12.2709
+433.333 12.2707
+433.667 12.2704
+434 12.2702
+434.333 12.27
+434.667 12.2697
+435 12.2695
+435.333 12.2692
+435.667 12.269
+436 12.2687
+436.333 12.2685
+436.667 12.2683
+437 12.268
+437.333 12.2678
+437.667 12.2675
+438 12.2673
+438.333 12.267
+438.667 12.2668
+439 12.2666
+439.333 12.2663
+439.667 12.2661
+440 12.2658
+440.333 12.2656
+440.667 12.2653
+441 12.2651
+441.333 12.2648
+441.667 12.2646
+442 12.2643
+442.333 12.2641
+442.667 12.2639
+443 12.2636
+443.333 12.2634
+443.667 12.2631
+444 12.2629
+444.333 12.2626
+444.667 12.2624
+445 12.2621
+445.333 12.2619
+445.667 12.2616
+446 12.2614
+446.333 12.2611
+446.667 12.2609
+447 12.2606
+447.333 12.2604
+447.667 12.2601
+448 12.2599
+448.333 12.2596
+448.667 12.2594
+449 12.2591
+449.333 12.2589
+449.667 12.2586
+450 12.2584
+450.333 12.2581
+450.667 12.2579
+451 12.2576
+451.333 12.2574
+451.667 12.2571
+452 12.2569
+452.333 12.2566
+452.667 12.2564
+453 12.2561
+453.333 12.2559
+453.667 12.2556
+454 12.2554
+454.333 12.2551
+454.667 12.2549
+455 12.2546
+455.333 12.2544
+455.667 12.2541
+456 12.2539
+456.333 12.2536
+456.667 12.2534
+457 12.2531
+457.333 12.2529
+457.667 12.2526
+458 12.2524
+458.333 12.2521
+458.667 12.2519
+459 12.2516
+459.333 12.2513
+459.667 12.2511
+460 12.2508
+460.333 12.2506
+460.667 12.2503
+461 12.2501
+461.333 12.2498
+461.667 12.2496
+462 12.2493
+462.333 12.2491
+462.667 12.2488
+463 12.2485
+463.333 12.2483
+463.667 12.248
+464 12.2478
+464.333 12.2475
+464.667 12.2473
+465 12.247
+465.333 12.2468
+465.667 12.2465
+466 12.2462
+466.333 12.246
+466.667 12.2457
+467 12.2455
+467.333 12.2452
+467.667 12.245
+468 12.2447
+468.333 12.2444
+468.667 12.2442
+469 12.2439
+469.333 12.2437
+469.667 12.2434
+470 12.2431
+470.333 12.2429
+470.667 12.2426
+471 12.2424
+471.333 12.2421
+471.667 12.2418
+472 12.2416
+472.333 12.2413
+472.667 12.2411
+473 12.2408
+473.333 12.2405
+473.667 12.2403
+474 12.24
+474.333 12.2398
+474.667 12.2395
+475 12.2392
+475.333 12.239
+475.667 12.2387
+476 12.2385
+476.333 12.2382
+476.667 12.2379
+477 12.2377
+477.333 12.2374
+477.667 12.2371
+478 12.2369
+478.333 12.2366
+478.667 12.2364
+479 12.2361
+479.333 12.2358
+479.667 12.2356
+480 12.2353
+480.333 12.235
+480.667 12.2348
+481 12.2345
+481.333 12.2343
+481.667 12.234
+482 12.2337
+482.333 12.2335
+482.667 12.2332
+483 12.2329
+483.333 12.2327
+483.667 12.2324
+484 12.2321
+484.333 12.2319
+484.667 12.2316
+485 12.2313
+485.333 12.2311
+485.667 12.2308
+486 12.2305
+486.333 12.2303
+486.667 12.23
+487 12.2297
+487.333 12.2295
+487.667 12.2292
+488 12.2289
+488.333 12.2287
+488.667 12.2284
+489 12.2281
+489.333 12.2279
+489.667 12.2276
+490 12.2273
+490.333 12.2271
+490.667 12.2268
+491 12.2265
+491.333 12.2262
+491.667 12.226
+492 12.2257
+492.333 12.2254
+492.667 12.2252
+493 12.2249
+493.333 12.2246
+493.667 12.2244
+494 12.2241
+494.333 12.2238
+494.667 12.2235
+495 12.2233
+495.333 12.223
+495.667 12.2227
+496 12.2225
+496.333 12.2222
+496.667 12.2219
+497 12.2216
+497.333 12.2214
+497.667 12.2211
+498 12.2208
+498.333 12.2206
+498.667 12.2203
+499 12.22
+499.333 12.2197
+499.667 12.2195
+500 12.2192
+500.333 12.2189
+500.667 12.2186
+501 12.2184
+501.333 12.2181
+501.667 12.2178
+502 12.2175
+502.333 12.2173
+502.667 12.217
+503 12.2167
+503.333 12.2164
+503.667 12.2162
+504 12.2159
+504.333 12.2156
+504.667 12.2153
+505 12.2151
+505.333 12.2148
+505.667 12.2145
+506 12.2142
+506.333 12.214
+506.667 12.2137
+507 12.2134
+507.333 12.2131
+507.667 12.2129
+508 12.2126
+508.333 12.2123
+508.667 12.212
+509 12.2117
+509.333 12.2115
+509.667 12.2112
+510 12.2109
+510.333 12.2106
+510.667 12.2103
+511 12.2101
+511.333 12.2098
+511.667 12.2095
+512 12.2092
+512.333 12.2089
+512.667 12.2087
+513 12.2084
+513.333 12.2081
+513.667 12.2078
+514 12.2075
+514.333 12.2073
+514.667 12.207
+515 12.2067
+515.333 12.2064
+515.667 12.2061
+516 12.2059
+516.333 12.2056
+516.667 12.2053
+517 12.205
+517.333 12.2047
+517.667 12.2044
+518 12.2042
+518.333 12.2039
+518.667 12.2036
+519 12.2033
+519.333 12.203
+519.667 12.2027
+520 12.2025
+520.333 12.2022
+520.667 12.2019
+521 12.2016
+521.333 12.2013
+521.667 12.201
+522 12.2007
+522.333 12.2005
+522.667 12.2002
+523 12.1999
+523.333 12.1996
+523.667 12.1993
+524 12.199
+524.333 12.1987
+524.667 12.1985
+525 12.1982
+525.333 12.1979
+525.667 12.1976
+526 12.1973
+526.333 12.197
+526.667 12.1967
+527 12.1964
+527.333 12.1962
+527.667 12.1959
+528 12.1956
+528.333 12.1953
+528.667 12.195
+529 12.1947
+529.333 12.1944
+529.667 12.1941
+530 12.1938
+530.333 12.1936
+530.667 12.1933
+531 12.193
+531.333 12.1927
+531.667 12.1924
+532 12.1921
+532.333 12.1918
+532.667 12.1915
+533 12.1912
+533.333 12.1909
+533.667 12.1906
+534 12.1904
+534.333 12.1901
+534.667 12.1898
+535 12.1895
+535.333 12.1892
+535.667 12.1889
+536 12.1886
+536.333 12.1883
+536.667 12.188
+537 12.1877
+537.333 12.1874
+537.667 12.1871
+538 12.1868
+538.333 12.1865
+538.667 12.1862
+539 12.186
+539.333 12.1857
+539.667 12.1854
+540 12.1851
+540.333 12.1848
+540.667 12.1845
+541 12.1842
+541.333 12.1839
+541.667 12.1836
+542 12.1833
+542.333 12.183
+542.667 12.1827
+543 12.1824
+543.333 12.1821
+543.667 12.1818
+544 12.1815
+544.333 12.1812
+544.667 12.1809
+545 12.1806
+545.333 12.1803
+545.667 12.18
+546 12.1797
+546.333 12.1794
+546.667 12.1791
+547 12.1788
+547.333 12.1785
+547.667 12.1782
+548 12.1779
+548.333 12.1776
+548.667 12.1773
+549 12.177
+549.333 12.1767
+549.667 12.1764
+550 12.1761
+550.333 12.1758
+550.667 12.1755
+551 12.1752
+551.333 12.1749
+551.667 12.1746
+552 12.1743
+552.333 12.174
+552.667 12.1737
+553 12.1734
+553.333 12.1731
+553.667 12.1728
+554 12.1725
+554.333 12.1722
+554.667 12.1719
+555 12.1716
+555.333 12.1713
+555.667 12.171
+556 12.1707
+556.333 12.1703
+556.667 12.17
+557 12.1697
+557.333 12.1694
+557.667 12.1691
+558 12.1688
+558.333 12.1685
+558.667 12.1682
+559 12.1679
+559.333 12.1676
+559.667 12.1673
+560 12.167
+560.333 12.1667
+560.667 12.1664
+561 12.1661
+561.333 12.1657
+561.667 12.1654
+562 12.1651
+562.333 12.1648
+562.667 12.1645
+563 12.1642
+563.333 12.1639
+563.667 12.1636
+564 12.1633
+564.333 12.163
+564.667 12.1627
+565 12.1623
+565.333 12.162
+565.667 12.1617
+566 12.1614
+566.333 12.1611
+566.667 12.1608
+567 12.1605
+567.333 12.1602
+567.667 12.1599
+568 12.1595
+568.333 12.1592
+568.667 12.1589
+569 12.1586
+569.333 12.1583
+569.667 12.158
+570 12.1577
+570.333 12.1573
+570.667 12.157
+571 12.1567
+571.333 12.1564
+571.667 12.1561
+572 12.1558
+572.333 12.1555
+572.667 12.1551
+573 12.1548
+573.333 12.1545
+573.667 12.1542
+574 12.1539
+574.333 12.1536
+574.667 12.1532
+575 12.1529
+575.333 12.1526
+575.667 12.1523
+576 12.152
+576.333 12.1517
+576.667 12.1513
+577 12.151
+577.333 12.1507
+577.667 12.1504
+578 12.1501
+578.333 12.1498
+578.667 12.1494
+579 12.1491
+579.333 12.1488
+579.667 12.1485
+580 12.1482
+580.333 12.1478
+580.667 12.1475
+581 12.1472
+581.333 12.1469
+581.667 12.1465
+582 12.1462
+582.333 12.1459
+582.667 12.1456
+583 12.1453
+583.333 12.1449
+583.667 12.1446
+584 12.1443
+584.333 12.144
+584.667 12.1436
+585 12.1433
+585.333 12.143
+585.667 12.1427
+586 12.1424
+586.333 12.142
+586.667 12.1417
+587 12.1414
+587.333 12.1411
+587.667 12.1407
+588 12.1404
+588.333 12.1401
+588.667 12.1398
+589 12.1394
+589.333 12.1391
+589.667 12.1388
+590 12.1384
+590.333 12.1381
+590.667 12.1378
+591 12.1375
+591.333 12.1371
+591.667 12.1368
+592 12.1365
+592.333 12.1362
+592.667 12.1358
+593 12.1355
+593.333 12.1352
+593.667 12.1348
+594 12.1345
+594.333 12.1342
+594.667 12.1339
+595 12.1335
+595.333 12.1332
+595.667 12.1329
+596 12.1325
+596.333 12.1322
+596.667 12.1319
+597 12.1315
+597.333 12.1312
+597.667 12.1309
+598 12.1305
+598.333 12.1302
+598.667 12.1299
+599 12.1295
+599.333 12.1292
+599.667 12.1289
+600 12.1285
+600.333 12.1282
+600.667 12.1279
+601 12.1275
+601.333 12.1272
+601.667 12.1269
+602 12.1265
+602.333 12.1262
+602.667 12.1259
+603 12.1255
+603.333 12.1252
+603.667 12.1249
+604 12.1245
+604.333 12.1242
+604.667 12.1238
+605 12.1235
+605.333 12.1232
+605.667 12.1228
+606 12.1225
+606.333 12.1222
+606.667 12.1218
+607 12.1215
+607.333 12.1211
+607.667 12.1208
+608 12.1205
+608.333 12.1201
+608.667 12.1198
+609 12.1194
+609.333 12.1191
+609.667 12.1188
+610 12.1184
+610.333 12.1181
+610.667 12.1177
+611 12.1174
+611.333 12.1171
+611.667 12.1167
+612 12.1164
+612.333 12.116
+612.667 12.1157
+613 12.1154
+613.333 12.115
+613.667 12.1147
+614 12.1143
+614.333 12.114
+614.667 12.1136
+615 12.1133
+615.333 12.1129
+615.667 12.1126
+616 12.1123
+616.333 12.1119
+616.667 12.1116
+617 12.1112
+617.333 12.1109
+617.667 12.1105
+618 12.1102
+618.333 12.1098
+618.667 12.1095
+619 12.1091
+619.333 12.1088
+619.667 12.1084
+620 12.1081
+620.333 12.1078
+620.667 12.1074
+621 12.1071
+621.333 12.1067
+621.667 12.1064
+622 12.106
+622.333 12.1057
+622.667 12.1053
+623 12.105
+623.333 12.1046
+623.667 12.1043
+624 12.1039
+624.333 12.1036
+624.667 12.1032
+625 12.1029
+625.333 12.1025
+625.667 12.1021
+626 12.1018
+626.333 12.1014
+626.667 12.1011
+627 12.1007
+627.333 12.1004
+627.667 12.1
+628 12.0997
+628.333 12.0993
+628.667 12.099
+629 12.0986
+629.333 12.0983
+629.667 12.0979
+630 12.0975
+630.333 12.0972
+630.667 12.0968
+631 12.0965
+631.333 12.0961
+631.667 12.0958
+632 12.0954
+632.333 12.0951
+632.667 12.0947
+633 12.0943
+633.333 12.094
+633.667 12.0936
+634 12.0933
+634.333 12.0929
+634.667 12.0925
+635 12.0922
+635.333 12.0918
+635.667 12.0915
+636 12.0911
+636.333 12.0907
+636.667 12.0904
+637 12.09
+637.333 12.0897
+637.667 12.0893
+638 12.0889
+638.333 12.0886
+638.667 12.0882
+639 12.0879
+639.333 12.0875
+639.667 12.0871
+640 12.0868
+640.333 12.0864
+640.667 12.086
+641 12.0857
+641.333 12.0853
+641.667 12.0849
+642 12.0846
+642.333 12.0842
+642.667 12.0839
+643 12.0835
+643.333 12.0831
+643.667 12.0828
+644 12.0824
+644.333 12.082
+644.667 12.0817
+645 12.0813
+645.333 12.0809
+645.667 12.0806
+646 12.0802
+646.333 12.0798
+646.667 12.0794
+647 12.0791
+647.333 12.0787
+647.667 12.0783
+648 12.078
+648.333 12.0776
+648.667 12.0772
+649 12.0769
+649.333 12.0765
+649.667 12.0761
+650 12.0757
+650.333 12.0754
+650.667 12.075
+651 12.0746
+651.333 12.0743
+651.667 12.0739
+652 12.0735
+652.333 12.0731
+652.667 12.0728
+653 12.0724
+653.333 12.072
+653.667 12.0716
+654 12.0713
+654.333 12.0709
+654.667 12.0705
+655 12.0701
+655.333 12.0698
+655.667 12.0694
+656 12.069
+656.333 12.0686
+656.667 12.0683
+657 12.0679
+657.333 12.0675
+657.667 12.0671
+658 12.0668
+658.333 12.0664
+658.667 12.066
+659 12.0656
+659.333 12.0652
+659.667 12.0649
+660 12.0645
+660.333 12.0641
+660.667 12.0637
+661 12.0633
+661.333 12.063
+661.667 12.0626
+662 12.0622
+662.333 12.0618
+662.667 12.0614
+663 12.0611
+663.333 12.0607
+663.667 12.0603
+664 12.0599
+664.333 12.0595
+664.667 12.0591
+665 12.0588
+665.333 12.0584
+665.667 12.058
+666 12.0576
+666.333 12.0572
+666.667 12.0568
+667 12.0565
+667.333 12.0561
+667.667 12.0557
+668 12.0553
+668.333 12.0549
+668.667 12.0545
+669 12.0541
+669.333 12.0537
+669.667 12.0534
+670 12.053
+670.333 12.0526
+670.667 12.0522
+671 12.0518
+671.333 12.0514
+671.667 12.051
+672 12.0506
+672.333 12.0502
+672.667 12.0499
+673 12.0495
+673.333 12.0491
+673.667 12.0487
+674 12.0483
+674.333 12.0479
+674.667 12.0475
+675 12.0471
+675.333 12.0467
+675.667 12.0463
+676 12.0459
+676.333 12.0455
+676.667 12.0451
+677 12.0448
+677.333 12.0444
+677.667 12.044
+678 12.0436
+678.333 12.0432
+678.667 12.0428
+679 12.0424
+679.333 12.042
+679.667 12.0416
+680 12.0412
+680.333 12.0408
+680.667 12.0404
+681 12.04
+681.333 12.0396
+681.667 12.0392
+682 12.0388
+682.333 12.0384
+682.667 12.038
+683 12.0376
+683.333 12.0372
+683.667 12.0368
+684 12.0364
+684.333 12.036
+684.667 12.0356
+685 12.0352
+685.333 12.0348
+685.667 12.0344
+686 12.034
+686.333 12.0336
+686.667 12.0332
+687 12.0328
+687.333 12.0324
+687.667 12.032
+688 12.0316
+688.333 12.0312
+688.667 12.0308
+689 12.0304
+689.333 12.03
+689.667 12.0295
+690 12.0291
+690.333 12.0287
+690.667 12.0283
+691 12.0279
+691.333 12.0275
+691.667 12.0271
+692 12.0267
+692.333 12.0263
+692.667 12.0259
+693 12.0255
+693.333 12.0251
+693.667 12.0247
+694 12.0242
+694.333 12.0238
+694.667 12.0234
+695 12.023
+695.333 12.0226
+695.667 12.0222
+696 12.0218
+696.333 12.0214
+696.667 12.021
+697 12.0205
+697.333 12.0201
+697.667 12.0197
+698 12.0193
+698.333 12.0189
+698.667 12.0185
+699 12.0181
+699.333 12.0176
+699.667 12.0172
+700 12.0168
+700.333 12.0164
+700.667 12.016
+701 12.0156
+701.333 12.0151
+701.667 12.0147
+702 12.0143
+702.333 12.0139
+702.667 12.0135
+703 12.0131
+703.333 12.0126
+703.667 12.0122
+704 12.0118
+704.333 12.0114
+704.667 12.011
+705 12.0105
+705.333 12.0101
+705.667 12.0097
+706 12.0093
+706.333 12.0089
+706.667 12.0084
+707 12.008
+707.333 12.0076
+707.667 12.0072
+708 12.0067
+708.333 12.0063
+708.667 12.0059
+709 12.0055
+709.333 12.005
+709.667 12.0046
+710 12.0042
+710.333 12.0038
+710.667 12.0033
+711 12.0029
+711.333 12.0025
+711.667 12.0021
+712 12.0016
+712.333 12.0012
+712.667 12.0008
+713 12.0004
+713.333 11.9999
+713.667 11.9995
+714 11.9991
+714.333 11.9986
+714.667 11.9982
+715 11.9978
+715.333 11.9973
+715.667 11.9969
+716 11.9965
+716.333 11.996
+716.667 11.9956
+717 11.9952
+717.333 11.9948
+717.667 11.9943
+718 11.9939
+718.333 11.9935
+718.667 11.993
+719 11.9926
+719.333 11.9921
+719.667 11.9917
+720 11.9913
+720.333 11.9908
+720.667 11.9904
+721 11.99
+721.333 11.9895
+721.667 11.9891
+722 11.9887
+722.333 11.9882
+722.667 11.9878
+723 11.9873
+723.333 11.9869
+723.667 11.9865
+724 11.986
+724.333 11.9856
+724.667 11.9851
+725 11.9847
+725.333 11.9843
+725.667 11.9838
+726 11.9834
+726.333 11.9829
+726.667 11.9825
+727 11.982
+727.333 11.9816
+727.667 11.9812
+728 11.9807
+728.333 11.9803
+728.667 11.9798
+729 11.9794
+729.333 11.9789
+729.667 11.9785
+730 11.978
+730.333 11.9776
+730.667 11.9772
+731 11.9767
+731.333 11.9763
+731.667 11.9758
+732 11.9754
+732.333 11.9749
+732.667 11.9745
+733 11.974
+733.333 11.9736
+733.667 11.9731
+734 11.9727
+734.333 11.9722
+734.667 11.9718
+735 11.9713
+735.333 11.9709
+735.667 11.9704
+736 11.97
+736.333 11.9695
+736.667 11.969
+737 11.9686
+737.333 11.9681
+737.667 11.9677
+738 11.9672
+738.333 11.9668
+738.667 11.9663
+739 11.9659
+739.333 11.9654
+739.667 11.965
+740 11.9645
+740.333 11.964
+740.667 11.9636
+741 11.9631
+741.333 11.9627
+741.667 11.9622
+742 11.9617
+742.333 11.9613
+742.667 11.9608
+743 11.9604
+743.333 11.9599
+743.667 11.9594
+744 11.959
+744.333 11.9585
+744.667 11.9581
+745 11.9576
+745.333 11.9571
+745.667 11.9567
+746 11.9562
+746.333 11.9557
+746.667 11.9553
+747 11.9548
+747.333 11.9543
+747.667 11.9539
+748 11.9534
+748.333 11.9529
+748.667 11.9525
+749 11.952
+749.333 11.9515
+749.667 11.9511
+750 11.9506
+750.333 11.9501
+750.667 11.9497
+751 11.9492
+751.333 11.9487
+751.667 11.9483
+752 11.9478
+752.333 11.9473
+752.667 11.9468
+753 11.9464
+753.333 11.9459
+753.667 11.9454
+754 11.945
+754.333 11.9445
+754.667 11.944
+755 11.9435
+755.333 11.9431
+755.667 11.9426
+756 11.9421
+756.333 11.9416
+756.667 11.9412
+757 11.9407
+757.333 11.9402
+757.667 11.9397
+758 11.9392
+758.333 11.9388
+758.667 11.9383
+759 11.9378
+759.333 11.9373
+759.667 11.9369
+760 11.9364
+760.333 11.9359
+760.667 11.9354
+761 11.9349
+761.333 11.9344
+761.667 11.934
+762 11.9335
+762.333 11.933
+762.667 11.9325
+763 11.932
+763.333 11.9315
+763.667 11.9311
+764 11.9306
+764.333 11.9301
+764.667 11.9296
+765 11.9291
+765.333 11.9286
+765.667 11.9281
+766 11.9277
+766.333 11.9272
+766.667 11.9267
+767 11.9262
+767.333 11.9257
+767.667 11.9252
+768 11.9247
+768.333 11.9242
+768.667 11.9237
+769 11.9233
+769.333 11.9228
+769.667 11.9223
+770 11.9218
+770.333 11.9213
+770.667 11.9208
+771 11.9203
+771.333 11.9198
+771.667 11.9193
+772 11.9188
+772.333 11.9183
+772.667 11.9178
+773 11.9173
+773.333 11.9168
+773.667 11.9163
+774 11.9158
+774.333 11.9153
+774.667 11.9148
+775 11.9143
+775.333 11.9138
+775.667 11.9133
+776 11.9128
+776.333 11.9123
+776.667 11.9118
+777 11.9113
+777.333 11.9108
+777.667 11.9103
+778 11.9098
+778.333 11.9093
+778.667 11.9088
+779 11.9083
+779.333 11.9078
+779.667 11.9073
+780 11.9068
+780.333 11.9063
+780.667 11.9058
+781 11.9053
+781.333 11.9048
+781.667 11.9043
+782 11.9038
+782.333 11.9033
+782.667 11.9027
+783 11.9022
+783.333 11.9017
+783.667 11.9012
+784 11.9007
+784.333 11.9002
+784.667 11.8997
+785 11.8992
+785.333 11.8987
+785.667 11.8982
+786 11.8976
+786.333 11.8971
+786.667 11.8966
+787 11.8961
+787.333 11.8956
+787.667 11.8951
+788 11.8946
+788.333 11.894
+788.667 11.8935
+789 11.893
+789.333 11.8925
+789.667 11.892
+790 11.8914
+790.333 11.8909
+790.667 11.8904
+791 11.8899
+791.333 11.8894
+791.667 11.8888
+792 11.8883
+792.333 11.8878
+792.667 11.8873
+793 11.8868
+793.333 11.8862
+793.667 11.8857
+794 11.8852
+794.333 11.8847
+794.667 11.8841
+795 11.8836
+795.333 11.8831
+795.667 11.8826
+796 11.882
+796.333 11.8815
+796.667 11.881
+797 11.8805
+797.333 11.8799
+797.667 11.8794
+798 11.8789
+798.333 11.8783
+798.667 11.8778
+799 11.8773
+799.333 11.8767
+799.667 11.8762
+800 11.8757
+800.333 11.8752
+800.667 11.8746
+801 11.8741
+801.333 11.8736
+801.667 11.873
+802 11.8725
+802.333 11.8719
+802.667 11.8714
+803 11.8709
+803.333 11.8703
+803.667 11.8698
+804 11.8693
+804.333 11.8687
+804.667 11.8682
+805 11.8676
+805.333 11.8671
+805.667 11.8666
+806 11.866
+806.333 11.8655
+806.667 11.8649
+807 11.8644
+807.333 11.8639
+807.667 11.8633
+808 11.8628
+808.333 11.8622
+808.667 11.8617
+809 11.8611
+809.333 11.8606
+809.667 11.86
+810 11.8595
+810.333 11.859
+810.667 11.8584
+811 11.8579
+811.333 11.8573
+811.667 11.8568
+812 11.8562
+812.333 11.8557
+812.667 11.8551
+813 11.8546
+813.333 11.854
+813.667 11.8535
+814 11.8529
+814.333 11.8524
+814.667 11.8518
+815 11.8512
+815.333 11.8507
+815.667 11.8501
+816 11.8496
+816.333 11.849
+816.667 11.8485
+817 11.8479
+817.333 11.8474
+817.667 11.8468
+818 11.8462
+818.333 11.8457
+818.667 11.8451
+819 11.8446
+819.333 11.844
+819.667 11.8434
+820 11.8429
+820.333 11.8423
+820.667 11.8418
+821 11.8412
+821.333 11.8406
+821.667 11.8401
+822 11.8395
+822.333 11.8389
+822.667 11.8384
+823 11.8378
+823.333 11.8372
+823.667 11.8367
+824 11.8361
+824.333 11.8355
+824.667 11.835
+825 11.8344
+825.333 11.8338
+825.667 11.8333
+826 11.8327
+826.333 11.8321
+826.667 11.8316
+827 11.831
+827.333 11.8304
+827.667 11.8298
+828 11.8293
+828.333 11.8287
+828.667 11.8281
+829 11.8275
+829.333 11.827
+829.667 11.8264
+830 11.8258
+830.333 11.8252
+830.667 11.8247
+831 11.8241
+831.333 11.8235
+831.667 11.8229
+832 11.8223
+832.333 11.8218
+832.667 11.8212
+833 11.8206
+833.333 11.82
+833.667 11.8194
+834 11.8188
+834.333 11.8183
+834.667 11.8177
+835 11.8171
+835.333 11.8165
+835.667 11.8159
+836 11.8153
+836.333 11.8147
+836.667 11.8142
+837 11.8136
+837.333 11.813
+837.667 11.8124
+838 11.8118
+838.333 11.8112
+838.667 11.8106
+839 11.81
+839.333 11.8094
+839.667 11.8089
+840 11.8083
+840.333 11.8077
+840.667 11.8071
+841 11.8065
+841.333 11.8059
+841.667 11.8053
+842 11.8047
+842.333 11.8041
+842.667 11.8035
+843 11.8029
+843.333 11.8023
+843.667 11.8017
+844 11.8011
+844.333 11.8005
+844.667 11.7999
+845 11.7993
+845.333 11.7987
+845.667 11.7981
+846 11.7975
+846.333 11.7969
+846.667 11.7963
+847 11.7957
+847.333 11.7951
+847.667 11.7945
+848 11.7939
+848.333 11.7933
+848.667 11.7926
+849 11.792
+849.333 11.7914
+849.667 11.7908
+850 11.7902
+850.333 11.7896
+850.667 11.789
+851 11.7884
+851.333 11.7878
+851.667 11.7872
+852 11.7865
+852.333 11.7859
+852.667 11.7853
+853 11.7847
+853.333 11.7841
+853.667 11.7835
+854 11.7829
+854.333 11.7822
+854.667 11.7816
+855 11.781
+855.333 11.7804
+855.667 11.7798
+856 11.7791
+856.333 11.7785
+856.667 11.7779
+857 11.7773
+857.333 11.7767
+857.667 11.776
+858 11.7754
+858.333 11.7748
+858.667 11.7742
+859 11.7735
+859.333 11.7729
+859.667 11.7723
+860 11.7717
+860.333 11.771
+860.667 11.7704
+861 11.7698
+861.333 11.7691
+861.667 11.7685
+862 11.7679
+862.333 11.7672
+862.667 11.7666
+863 11.766
+863.333 11.7653
+863.667 11.7647
+864 11.7641
+864.333 11.7634
+864.667 11.7628
+865 11.7622
+865.333 11.7615
+865.667 11.7609
+866 11.7603
+866.333 11.7596
+866.667 11.759
+867 11.7583
+867.333 11.7577
+867.667 11.7571
+868 11.7564
+868.333 11.7558
+868.667 11.7551
+869 11.7545
+869.333 11.7538
+869.667 11.7532
+870 11.7526
+870.333 11.7519
+870.667 11.7513
+871 11.7506
+871.333 11.75
+871.667 11.7493
+872 11.7487
+872.333 11.748
+872.667 11.7474
+873 11.7467
+873.333 11.7461
+873.667 11.7454
+874 11.7448
+874.333 11.7441
+874.667 11.7435
+875 11.7428
+875.333 11.7421
+875.667 11.7415
+876 11.7408
+876.333 11.7402
+876.667 11.7395
+877 11.7389
+877.333 11.7382
+877.667 11.7375
+878 11.7369
+878.333 11.7362
+878.667 11.7356
+879 11.7349
+879.333 11.7342
+879.667 11.7336
+880 11.7329
+880.333 11.7322
+880.667 11.7316
+881 11.7309
+881.333 11.7302
+881.667 11.7296
+882 11.7289
+882.333 11.7282
+882.667 11.7276
+883 11.7269
+883.333 11.7262
+883.667 11.7255
+884 11.7249
+884.333 11.7242
+884.667 11.7235
+885 11.7228
+885.333 11.7222
+885.667 11.7215
+886 11.7208
+886.333 11.7201
+886.667 11.7195
+887 11.7188
+887.333 11.7181
+887.667 11.7174
+888 11.7167
+888.333 11.7161
+888.667 11.7154
+889 11.7147
+889.333 11.714
+889.667 11.7133
+890 11.7127
+890.333 11.712
+890.667 11.7113
+891 11.7106
+891.333 11.7099
+891.667 11.7092
+892 11.7085
+892.333 11.7078
+892.667 11.7071
+893 11.7065
+893.333 11.7058
+893.667 11.7051
+894 11.7044
+894.333 11.7037
+894.667 11.703
+895 11.7023
+895.333 11.7016
+895.667 11.7009
+896 11.7002
+896.333 11.6995
+896.667 11.6988
+897 11.6981
+897.333 11.6974
+897.667 11.6967
+898 11.696
+898.333 11.6953
+898.667 11.6946
+899 11.6939
+899.333 11.6932
+899.667 11.6925
+900 11.6918
+900.333 11.6911
+900.667 11.6904
+901 11.6897
+901.333 11.689
+901.667 11.6883
+902 11.6875
+902.333 11.6868
+902.667 11.6861
+903 11.6854
+903.333 11.6847
+903.667 11.684
+904 11.6833
+904.333 11.6826
+904.667 11.6818
+905 11.6811
+905.333 11.6804
+905.667 11.6797
+906 11.679
+906.333 11.6783
+906.667 11.6775
+907 11.6768
+907.333 11.6761
+907.667 11.6754
+908 11.6746
+908.333 11.6739
+908.667 11.6732
+909 11.6725
+909.333 11.6717
+909.667 11.671
+910 11.6703
+910.333 11.6696
+910.667 11.6688
+911 11.6681
+911.333 11.6674
+911.667 11.6666
+912 11.6659
+912.333 11.6652
+912.667 11.6644
+913 11.6637
+913.333 11.663
+913.667 11.6622
+914 11.6615
+914.333 11.6608
+914.667 11.66
+915 11.6593
+915.333 11.6586
+915.667 11.6578
+916 11.6571
+916.333 11.6563
+916.667 11.6556
+917 11.6548
+917.333 11.6541
+917.667 11.6534
+918 11.6526
+918.333 11.6519
+918.667 11.6511
+919 11.6504
+919.333 11.6496
+919.667 11.6489
+920 11.6481
+920.333 11.6474
+920.667 11.6466
+921 11.6459
+921.333 11.6451
+921.667 11.6444
+922 11.6436
+922.333 11.6428
+922.667 11.6421
+923 11.6413
+923.333 11.6406
+923.667 11.6398
+924 11.6391
+924.333 11.6383
+924.667 11.6375
+925 11.6368
+925.333 11.636
+925.667 11.6352
+926 11.6345
+926.333 11.6337
+926.667 11.6329
+927 11.6322
+927.333 11.6314
+927.667 11.6306
+928 11.6299
+928.333 11.6291
+928.667 11.6283
+929 11.6276
+929.333 11.6268
+929.667 11.626
+930 11.6252
+930.333 11.6245
+930.667 11.6237
+931 11.6229
+931.333 11.6221
+931.667 11.6214
+932 11.6206
+932.333 11.6198
+932.667 11.619
+933 11.6182
+933.333 11.6175
+933.667 11.6167
+934 11.6159
+934.333 11.6151
+934.667 11.6143
+935 11.6135
+935.333 11.6127
+935.667 11.612
+936 11.6112
+936.333 11.6104
+936.667 11.6096
+937 11.6088
+937.333 11.608
+937.667 11.6072
+938 11.6064
+938.333 11.6056
+938.667 11.6048
+939 11.604
+939.333 11.6032
+939.667 11.6024
+940 11.6016
+940.333 11.6008
+940.667 11.6
+941 11.5992
+941.333 11.5984
+941.667 11.5976
+942 11.5968
+942.333 11.596
+942.667 11.5952
+943 11.5944
+943.333 11.5936
+943.667 11.5928
+944 11.592
+944.333 11.5912
+944.667 11.5903
+945 11.5895
+945.333 11.5887
+945.667 11.5879
+946 11.5871
+946.333 11.5863
+946.667 11.5855
+947 11.5846
+947.333 11.5838
+947.667 11.583
+948 11.5822
+948.333 11.5814
+948.667 11.5805
+949 11.5797
+949.333 11.5789
+949.667 11.5781
+950 11.5772
+950.333 11.5764
+950.667 11.5756
+951 11.5748
+951.333 11.5739
+951.667 11.5731
+952 11.5723
+952.333 11.5714
+952.667 11.5706
+953 11.5698
+953.333 11.5689
+953.667 11.5681
+954 11.5673
+954.333 11.5664
+954.667 11.5656
+955 11.5647
+955.333 11.5639
+955.667 11.5631
+956 11.5622
+956.333 11.5614
+956.667 11.5605
+957 11.5597
+957.333 11.5588
+957.667 11.558
+958 11.5571
+958.333 11.5563
+958.667 11.5554
+959 11.5546
+959.333 11.5537
+959.667 11.5529
+960 11.552
+960.333 11.5512
+960.667 11.5503
+961 11.5495
+961.333 11.5486
+961.667 11.5478
+962 11.5469
+962.333 11.546
+962.667 11.5452
+963 11.5443
+963.333 11.5434
+963.667 11.5426
+964 11.5417
+964.333 11.5408
+964.667 11.54
+965 11.5391
+965.333 11.5382
+965.667 11.5374
+966 11.5365
+966.333 11.5356
+966.667 11.5348
+967 11.5339
+967.333 11.533
+967.667 11.5321
+968 11.5313
+968.333 11.5304
+968.667 11.5295
+969 11.5286
+969.333 11.5277
+969.667 11.5269
+970 11.526
+970.333 11.5251
+970.667 11.5242
+971 11.5233
+971.333 11.5224
+971.667 11.5215
+972 11.5207
+972.333 11.5198
+972.667 11.5189
+973 11.518
+973.333 11.5171
+973.667 11.5162
+974 11.5153
+974.333 11.5144
+974.667 11.5135
+975 11.5126
+975.333 11.5117
+975.667 11.5108
+976 11.5099
+976.333 11.509
+976.667 11.5081
+977 11.5072
+977.333 11.5063
+977.667 11.5054
+978 11.5045
+978.333 11.5036
+978.667 11.5027
+979 11.5018
+979.333 11.5008
+979.667 11.4999
+980 11.499
+980.333 11.4981
+980.667 11.4972
+981 11.4963
+981.333 11.4954
+981.667 11.4944
+982 11.4935
+982.333 11.4926
+982.667 11.4917
+983 11.4908
+983.333 11.4898
+983.667 11.4889
+984 11.488
+984.333 11.487
+984.667 11.4861
+985 11.4852
+985.333 11.4843
+985.667 11.4833
+986 11.4824
+986.333 11.4815
+986.667 11.4805
+987 11.4796
+987.333 11.4787
+987.667 11.4777
+988 11.4768
+988.333 11.4758
+988.667 11.4749
+989 11.474
+989.333 11.473
+989.667 11.4721
+990 11.4711
+990.333 11.4702
+990.667 11.4692
+991 11.4683
+991.333 11.4673
+991.667 11.4664
+992 11.4654
+992.333 11.4645
+992.667 11.4635
+993 11.4626
+993.333 11.4616
+993.667 11.4606
+994 11.4597
+994.333 11.4587
+994.667 11.4578
+995 11.4568
+995.333 11.4558
+995.667 11.4549
+996 11.4539
+996.333 11.4529
+996.667 11.452
+997 11.451
+997.333 11.45
+997.667 11.4491
+998 11.4481
+998.333 11.4471
+998.667 11.4461
+999 11.4452
+999.333 11.4442
+999.667 11.4432
+1000 11.4422
+1000.33 11.4412
+1000.67 11.4403
+1001 11.4393
+1001.33 11.4383
+1001.67 11.4373
+1002 11.4363
+1002.33 11.4353
+1002.67 11.4343
+1003 11.4334
+1003.33 11.4324
+1003.67 11.4314
+1004 11.4304
+1004.33 11.4294
+1004.67 11.4284
+1005 11.4274
+1005.33 11.4264
+1005.67 11.4254
+1006 11.4244
+1006.33 11.4234
+1006.67 11.4224
+1007 11.4214
+1007.33 11.4204
+1007.67 11.4194
+1008 11.4184
+1008.33 11.4173
+1008.67 11.4163
+1009 11.4153
+1009.33 11.4143
+1009.67 11.4133
+1010 11.4123
+1010.33 11.4113
+1010.67 11.4102
+1011 11.4092
+1011.33 11.4082
+1011.67 11.4072
+1012 11.4062
+1012.33 11.4051
+1012.67 11.4041
+1013 11.4031
+1013.33 11.402
+1013.67 11.401
+1014 11.4
+1014.33 11.399
+1014.67 11.3979
+1015 11.3969
+1015.33 11.3959
+1015.67 11.3948
+1016 11.3938
+1016.33 11.3927
+1016.67 11.3917
+1017 11.3907
+1017.33 11.3896
+1017.67 11.3886
+1018 11.3875
+1018.33 11.3865
+1018.67 11.3854
+1019 11.3844
+1019.33 11.3833
+1019.67 11.3823
+1020 11.3812
+1020.33 11.3802
+1020.67 11.3791
+1021 11.378
+1021.33 11.377
+1021.67 11.3759
+1022 11.3749
+1022.33 11.3738
+1022.67 11.3727
+1023 11.3717
+1023.33 11.3706
+1023.67 11.3695
+1024 11.3685
+1024.33 11.3674
+1024.67 11.3663
+1025 11.3653
+1025.33 11.3642
+1025.67 11.3631
+1026 11.362
+1026.33 11.3609
+1026.67 11.3599
+1027 11.3588
+1027.33 11.3577
+1027.67 11.3566
+1028 11.3555
+1028.33 11.3544
+1028.67 11.3534
+1029 11.3523
+1029.33 11.3512
+1029.67 11.3501
+1030 11.349
+1030.33 11.3479
+1030.67 11.3468
+1031 11.3457
+1031.33 11.3446
+1031.67 11.3435
+1032 11.3424
+1032.33 11.3413
+1032.67 11.3402
+1033 11.3391
+1033.33 11.338
+1033.67 11.3369
+1034 11.3358
+1034.33 11.3346
+1034.67 11.3335
+1035 11.3324
+1035.33 11.3313
+1035.67 11.3302
+1036 11.3291
+1036.33 11.3279
+1036.67 11.3268
+1037 11.3257
+1037.33 11.3246
+1037.67 11.3234
+1038 11.3223
+1038.33 11.3212
+1038.67 11.3201
+1039 11.3189
+1039.33 11.3178
+1039.67 11.3167
+1040 11.3155
+1040.33 11.3144
+1040.67 11.3132
+1041 11.3121
+1041.33 11.311
+1041.67 11.3098
+1042 11.3087
+1042.33 11.3075
+1042.67 11.3064
+1043 11.3052
+1043.33 11.3041
+1043.67 11.3029
+1044 11.3018
+1044.33 11.3006
+1044.67 11.2995
+1045 11.2983
+1045.33 11.2971
+1045.67 11.296
+1046 11.2948
+1046.33 11.2936
+1046.67 11.2925
+1047 11.2913
+1047.33 11.2901
+1047.67 11.289
+1048 11.2878
+1048.33 11.2866
+1048.67 11.2855
+1049 11.2843
+1049.33 11.2831
+1049.67 11.2819
+1050 11.2807
+1050.33 11.2796
+1050.67 11.2784
+1051 11.2772
+1051.33 11.276
+1051.67 11.2748
+1052 11.2736
+1052.33 11.2724
+1052.67 11.2712
+1053 11.27
+1053.33 11.2688
+1053.67 11.2676
+1054 11.2664
+1054.33 11.2652
+1054.67 11.264
+1055 11.2628
+1055.33 11.2616
+1055.67 11.2604
+1056 11.2592
+1056.33 11.258
+1056.67 11.2568
+1057 11.2556
+1057.33 11.2544
+1057.67 11.2531
+1058 11.2519
+1058.33 11.2507
+1058.67 11.2495
+1059 11.2482
+1059.33 11.247
+1059.67 11.2458
+1060 11.2446
+1060.33 11.2433
+1060.67 11.2421
+1061 11.2409
+1061.33 11.2396
+1061.67 11.2384
+1062 11.2372
+1062.33 11.2359
+1062.67 11.2347
+1063 11.2334
+1063.33 11.2322
+1063.67 11.2309
+1064 11.2297
+1064.33 11.2284
+1064.67 11.2272
+1065 11.2259
+1065.33 11.2247
+1065.67 11.2234
+1066 11.2222
+1066.33 11.2209
+1066.67 11.2196
+1067 11.2184
+1067.33 11.2171
+1067.67 11.2158
+1068 11.2146
+1068.33 11.2133
+1068.67 11.212
+1069 11.2108
+1069.33 11.2095
+1069.67 11.2082
+1070 11.2069
+1070.33 11.2056
+1070.67 11.2044
+1071 11.2031
+1071.33 11.2018
+1071.67 11.2005
+1072 11.1992
+1072.33 11.1979
+1072.67 11.1966
+1073 11.1953
+1073.33 11.194
+1073.67 11.1927
+1074 11.1914
+1074.33 11.1901
+1074.67 11.1888
+1075 11.1875
+1075.33 11.1862
+1075.67 11.1849
+1076 11.1836
+1076.33 11.1823
+1076.67 11.181
+1077 11.1796
+1077.33 11.1783
+1077.67 11.177
+1078 11.1757
+1078.33 11.1743
+1078.67 11.173
+1079 11.1717
+1079.33 11.1704
+1079.67 11.169
+1080 11.1677
+1080.33 11.1664
+1080.67 11.165
+1081 11.1637
+1081.33 11.1623
+1081.67 11.161
+1082 11.1597
+1082.33 11.1583
+1082.67 11.157
+1083 11.1556
+e
+0 12.5344
+0.333333 12.3158
+0.666667 12.1892
+1 12.1185
+1.33333 12.0771
+1.66667 12.0511
+2 12.0334
+2.33333 12.0202
+2.66667 12.0095
+3 12.0003
+3.33333 11.9921
+3.66667 11.9845
+4 11.9773
+4.33333 11.9705
+4.66667 11.9639
+5 11.9575
+5.33333 11.9513
+5.66667 11.9452
+6 11.9392
+6.33333 11.9333
+6.66667 11.9274
+7 11.9216
+7.33333 11.9158
+7.66667 11.9101
+8 11.9043
+8.33333 11.8986
+8.66667 11.8929
+9 11.8871
+9.33333 11.8814
+9.66667 11.8756
+10 11.8698
+10.3333 11.8639
+10.6667 11.858
+11 11.8521
+11.3333 11.8461
+11.6667 11.8401
+12 11.8341
+12.3333 11.828
+12.6667 11.8218
+13 11.8156
+13.3333 11.8093
+13.6667 11.803
+14 11.7966
+14.3333 11.7901
+14.6667 11.7836
+15 11.777
+15.3333 11.7704
+15.6667 11.7637
+16 11.7569
+16.3333 11.75
+16.6667 11.7431
+17 11.7361
+17.3333 11.729
+17.6667 11.7219
+18 11.7146
+18.3333 11.7073
+18.6667 11.6999
+19 11.6924
+19.3333 11.6848
+19.6667 11.6772
+20 11.6695
+20.3333 11.6616
+20.6667 11.6537
+21 11.6457
+21.3333 11.6376
+21.6667 11.6294
+22 11.6211
+22.3333 11.6127
+22.6667 11.6042
+23 11.5956
+23.3333 11.5869
+23.6667 11.5781
+24 11.5691
+24.3333 11.5601
+24.6667 11.551
+25 11.5417
+25.3333 11.5323
+25.6667 11.5228
+26 11.5132
+26.3333 11.5035
+26.6667 11.4936
+27 11.4836
+27.3333 11.4735
+27.6667 11.4632
+28 11.4528
+28.3333 11.4423
+28.6667 11.4316
+29 11.4207
+29.3333 11.4098
+29.6667 11.3986
+30 11.3874
+30.3333 11.3759
+30.6667 11.3643
+31 11.3526
+31.3333 11.3406
+31.6667 11.3285
+32 11.3162
+32.3333 11.3038
+32.6667 11.2911
+33 11.2783
+33.3333 11.2653
+33.6667 11.2521
+34 11.2386
+34.3333 11.225
+34.6667 11.2112
+35 11.1971
+35.3333 11.1829
+35.6667 11.1684
+36 11.1537
+36.3333 11.1387
+36.6667 11.1235
+37 11.1081
+37.3333 11.0924
+37.6667 11.0764
+38 11.0602
+38.3333 11.0437
+38.6667 11.0269
+39 11.0099
+39.3333 10.9925
+39.6667 10.9749
+40 10.9569
+40.3333 10.9386
+40.6667 10.92
+41 10.9011
+41.3333 10.8818
+41.6667 10.8621
+42 10.8421
+42.3333 10.8217
+42.6667 10.801
+43 10.7798
+43.3333 10.7582
+43.6667 10.7363
+44 10.7138
+44.3333 10.691
+44.6667 10.6677
+45 10.6439
+45.3333 10.6196
+45.6667 10.5948
+46 10.5695
+46.3333 10.5437
+e
@@ -0,0 +1,3294 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "BattDisch5.eps"
+set xlabel " Time (Hours)"
+set ylabel "Voltage (V)"
+set xrange[0:16]
+                            set yrange [0.7:1.5]
+                            set tics scale 3
+                            set xtics 2
+                            set ytics 0.1
+                            set grid
+                            set style line 1 linewidth 5
+                            set style line 2 linewidth 5
+                            set style line 3 linewidth 5
+                            set style line 4 linewidth 5
+                            set style line 5 linewidth 5
+                            set style line 6 linewidth 5
+                            set style line 7 linewidth 5
+                            set style line 8 linewidth 5
+                            set style increment user
+                            set key reverse Left
+plot "-"  title "Panasonic N-700AAC  0.7A (0.01C)" with lines, "-"  title "Panasonic N-700AAC 0.14A (0.2C)" with lines, "-"  title "Panasonic N-700AAC 0.35A (0.5C)" with lines
+0 1.39008
+0.00555556 1.38899
+0.0111111 1.38809
+0.0166667 1.38732
+0.0222222 1.38662
+0.0277778 1.38596
+0.0333333 1.38532
+0.0388889 1.38469
+0.0444444 1.38407
+0.05 1.38345
+0.0555556 1.38284
+0.0611111 1.38223
+0.0666667 1.38163
+0.0722222 1.38103
+0.0777778 1.38043
+0.0833333 1.37983
+0.0888889 1.37924
+0.0944444 1.37865
+0.1 1.37806
+0.105556 1.37748
+0.111111 1.3769
+0.116667 1.37632
+0.122222 1.37574
+0.127778 1.37517
+0.133333 1.3746
+0.138889 1.37403
+0.144444 1.37347
+0.15 1.3729
+0.155556 1.37234
+0.161111 1.37179
+0.166667 1.37123
+0.172222 1.37068
+0.177778 1.37013
+0.183333 1.36959
+0.188889 1.36904
+0.194444 1.3685
+0.2 1.36796
+0.205556 1.36743
+0.211111 1.36689
+0.216667 1.36636
+0.222222 1.36583
+0.227778 1.36531
+0.233333 1.36478
+0.238889 1.36426
+0.244444 1.36375
+0.25 1.36323
+0.255556 1.36272
+0.261111 1.36221
+0.266667 1.3617
+0.272222 1.36119
+0.277778 1.36069
+0.283333 1.36019
+0.288889 1.35969
+0.294444 1.35919
+0.3 1.3587
+0.305556 1.3582
+0.311111 1.35772
+0.316667 1.35723
+0.322222 1.35674
+0.327778 1.35626
+0.333333 1.35578
+0.338889 1.3553
+0.344444 1.35483
+0.35 1.35435
+0.355556 1.35388
+0.361111 1.35341
+0.366667 1.35295
+0.372222 1.35248
+0.377778 1.35202
+0.383333 1.35156
+0.388889 1.3511
+0.394444 1.35065
+0.4 1.3502
+0.405556 1.34974
+0.411111 1.3493
+0.416667 1.34885
+0.422222 1.3484
+0.427778 1.34796
+0.433333 1.34752
+0.438889 1.34708
+0.444444 1.34665
+0.45 1.34621
+0.455556 1.34578
+0.461111 1.34535
+0.466667 1.34492
+0.472222 1.34449
+0.477778 1.34407
+0.483333 1.34365
+0.488889 1.34323
+0.494444 1.34281
+0.5 1.34239
+0.505556 1.34198
+0.511111 1.34157
+0.516667 1.34116
+0.522222 1.34075
+0.527778 1.34034
+0.533333 1.33994
+0.538889 1.33954
+0.544444 1.33914
+0.55 1.33874
+0.555556 1.33834
+0.561111 1.33795
+0.566667 1.33755
+0.572222 1.33716
+0.577778 1.33677
+0.583333 1.33639
+0.588889 1.336
+0.594444 1.33562
+0.6 1.33523
+0.605556 1.33485
+0.611111 1.33448
+0.616667 1.3341
+0.622222 1.33372
+0.627778 1.33335
+0.633333 1.33298
+0.638889 1.33261
+0.644444 1.33224
+0.65 1.33188
+0.655556 1.33151
+0.661111 1.33115
+0.666667 1.33079
+0.672222 1.33043
+0.677778 1.33007
+0.683333 1.32972
+0.688889 1.32936
+0.694444 1.32901
+0.7 1.32866
+0.705556 1.32831
+0.711111 1.32797
+0.716667 1.32762
+0.722222 1.32728
+0.727778 1.32693
+0.733333 1.32659
+0.738889 1.32625
+0.744444 1.32592
+0.75 1.32558
+0.755556 1.32525
+0.761111 1.32491
+0.766667 1.32458
+0.772222 1.32425
+0.777778 1.32392
+0.783333 1.3236
+0.788889 1.32327
+0.794444 1.32295
+0.8 1.32263
+0.805556 1.32231
+0.811111 1.32199
+0.816667 1.32167
+0.822222 1.32135
+0.827778 1.32104
+0.833333 1.32073
+0.838889 1.32042
+0.844444 1.32011
+0.85 1.3198
+0.855556 1.31949
+0.861111 1.31918
+0.866667 1.31888
+0.872222 1.31858
+0.877778 1.31828
+0.883333 1.31798
+0.888889 1.31768
+0.894444 1.31738
+0.9 1.31708
+0.905556 1.31679
+0.911111 1.3165
+0.916667 1.31621
+0.922222 1.31592
+0.927778 1.31563
+0.933333 1.31534
+0.938889 1.31505
+0.944444 1.31477
+0.95 1.31448
+0.955556 1.3142
+0.961111 1.31392
+0.966667 1.31364
+0.972222 1.31336
+0.977778 1.31309
+0.983333 1.31281
+0.988889 1.31254
+0.994444 1.31226
+1 1.31199
+1.00556 1.31172
+1.01111 1.31145
+1.01667 1.31119
+1.02222 1.31092
+1.02778 1.31065
+1.03333 1.31039
+1.03889 1.31013
+1.04444 1.30986
+1.05 1.3096
+1.05556 1.30934
+1.06111 1.30909
+1.06667 1.30883
+1.07222 1.30857
+1.07778 1.30832
+1.08333 1.30807
+1.08889 1.30781
+1.09444 1.30756
+1.1 1.30731
+1.10556 1.30707
+1.11111 1.30682
+1.11667 1.30657
+1.12222 1.30633
+1.12778 1.30608
+1.13333 1.30584
+1.13889 1.3056
+1.14444 1.30536
+1.15 1.30512
+1.15556 1.30488
+1.16111 1.30464
+1.16667 1.30441
+1.17222 1.30417
+1.17778 1.30394
+1.18333 1.30371
+1.18889 1.30347
+1.19444 1.30324
+1.2 1.30301
+1.20556 1.30278
+1.21111 1.30256
+1.21667 1.30233
+1.22222 1.30211
+1.22778 1.30188
+1.23333 1.30166
+1.23889 1.30144
+1.24444 1.30121
+1.25 1.30099
+1.25556 1.30078
+1.26111 1.30056
+1.26667 1.30034
+1.27222 1.30012
+1.27778 1.29991
+1.28333 1.29969
+1.28889 1.29948
+1.29444 1.29927
+1.3 1.29906
+1.30556 1.29885
+1.31111 1.29864
+1.31667 1.29843
+1.32222 1.29822
+1.32778 1.29802
+1.33333 1.29781
+1.33889 1.29761
+1.34444 1.2974
+1.35 1.2972
+1.35556 1.297
+1.36111 1.2968
+1.36667 1.2966
+1.37222 1.2964
+1.37778 1.2962
+1.38333 1.29601
+1.38889 1.29581
+1.39444 1.29561
+1.4 1.29542
+1.40556 1.29523
+1.41111 1.29503
+1.41667 1.29484
+1.42222 1.29465
+1.42778 1.29446
+1.43333 1.29427
+1.43889 1.29408
+1.44444 1.2939
+1.45 1.29371
+1.45556 1.29353
+1.46111 1.29334
+1.46667 1.29316
+1.47222 1.29297
+1.47778 1.29279
+1.48333 1.29261
+1.48889 1.29243
+1.49444 1.29225
+1.5 1.29207
+1.50556 1.29189
+1.51111 1.29172
+1.51667 1.29154
+1.52222 1.29136
+1.52778 1.29119
+1.53333 1.29102
+1.53889 1.29084
+1.54444 1.29067
+1.55 1.2905
+1.55556 1.29033
+1.56111 1.29016
+1.56667 1.28999
+1.57222 1.28982
+1.57778 1.28965
+1.58333 1.28948
+1.58889 1.28932
+1.59444 1.28915
+1.6 1.28899
+1.60556 1.28882
+1.61111 1.28866
+1.61667 1.2885
+1.62222 1.28834
+1.62778 1.28818
+1.63333 1.28802
+1.63889 1.28786
+1.64444 1.2877
+1.65 1.28754
+1.65556 1.28738
+1.66111 1.28722
+1.66667 1.28707
+1.67222 1.28691
+1.67778 1.28676
+1.68333 1.2866
+1.68889 1.28645
+1.69444 1.2863
+1.7 1.28615
+1.70556 1.286
+1.71111 1.28585
+1.71667 1.2857
+1.72222 1.28555
+1.72778 1.2854
+1.73333 1.28525
+1.73889 1.2851
+1.74444 1.28496
+1.75 1.28481
+1.75556 1.28467
+1.76111 1.28452
+1.76667 1.28438
+1.77222 1.28423
+1.77778 1.28409
+1.78333 1.28395
+1.78889 1.28381
+1.79444 1.28367
+1.8 1.28353
+1.80556 1.28339
+1.81111 1.28325
+1.81667 1.28311
+1.82222 1.28297
+1.82778 1.28284
+1.83333 1.2827
+1.83889 1.28257
+1.84444 1.28243
+1.85 1.2823
+1.85556 1.28216
+1.86111 1.28203
+1.86667 1.2819
+1.87222 1.28176
+1.87778 1.28163
+1.88333 1.2815
+1.88889 1.28137
+1.89444 1.28124
+1.9 1.28111
+1.90556 1.28098
+1.91111 1.28086
+1.91667 1.28073
+1.92222 1.2806
+1.92778 1.28047
+1.93333 1.28035
+1.93889 1.28022
+1.94444 1.2801
+1.95 1.27997
+1.95556 1.27985
+1.96111 1.27973
+1.96667 1.27961
+1.97222 1.27948
+1.97778 1.27936
+1.98333 1.27924
+1.98889 1.27912
+1.99444 1.279
+2 1.27888
+2.00556 1.27876
+2.01111 1.27864
+2.01667 1.27853
+2.02222 1.27841
+2.02778 1.27829
+2.03333 1.27818
+2.03889 1.27806
+2.04444 1.27795
+2.05 1.27783
+2.05556 1.27772
+2.06111 1.2776
+2.06667 1.27749
+2.07222 1.27738
+2.07778 1.27726
+2.08333 1.27715
+2.08889 1.27704
+2.09444 1.27693
+2.1 1.27682
+2.10556 1.27671
+2.11111 1.2766
+2.11667 1.27649
+2.12222 1.27638
+2.12778 1.27628
+2.13333 1.27617
+2.13889 1.27606
+2.14444 1.27595
+2.15 1.27585
+2.15556 1.27574
+2.16111 1.27564
+2.16667 1.27553
+2.17222 1.27543
+2.17778 1.27532
+2.18333 1.27522
+2.18889 1.27512
+2.19444 1.27502
+2.2 1.27491
+2.20556 1.27481
+2.21111 1.27471
+2.21667 1.27461
+2.22222 1.27451
+2.22778 1.27441
+2.23333 1.27431
+2.23889 1.27421
+2.24444 1.27411
+2.25 1.27401
+2.25556 1.27392
+2.26111 1.27382
+2.26667 1.27372
+2.27222 1.27363
+2.27778 1.27353
+2.28333 1.27343
+2.28889 1.27334
+2.29444 1.27324
+2.3 1.27315
+2.30556 1.27306
+2.31111 1.27296
+2.31667 1.27287
+2.32222 1.27277
+2.32778 1.27268
+2.33333 1.27259
+2.33889 1.2725
+2.34444 1.27241
+2.35 1.27232
+2.35556 1.27223
+2.36111 1.27214
+2.36667 1.27205
+2.37222 1.27196
+2.37778 1.27187
+2.38333 1.27178
+2.38889 1.27169
+2.39444 1.2716
+2.4 1.27151
+2.40556 1.27143
+2.41111 1.27134
+2.41667 1.27125
+2.42222 1.27117
+2.42778 1.27108
+2.43333 1.271
+2.43889 1.27091
+2.44444 1.27083
+2.45 1.27074
+2.45556 1.27066
+2.46111 1.27057
+2.46667 1.27049
+2.47222 1.27041
+2.47778 1.27032
+2.48333 1.27024
+2.48889 1.27016
+2.49444 1.27008
+2.5 1.27
+2.50556 1.26991
+2.51111 1.26983
+2.51667 1.26975
+2.52222 1.26967
+2.52778 1.26959
+2.53333 1.26951
+2.53889 1.26944
+2.54444 1.26936
+2.55 1.26928
+2.55556 1.2692
+2.56111 1.26912
+2.56667 1.26904
+2.57222 1.26897
+2.57778 1.26889
+2.58333 1.26881
+2.58889 1.26874
+2.59444 1.26866
+2.6 1.26859
+2.60556 1.26851
+2.61111 1.26844
+2.61667 1.26836
+2.62222 1.26829
+2.62778 1.26821
+2.63333 1.26814
+2.63889 1.26806
+2.64444 1.26799
+2.65 1.26792
+2.65556 1.26785
+2.66111 1.26777
+2.66667 1.2677
+2.67222 1.26763
+2.67778 1.26756
+2.68333 1.26749
+2.68889 1.26741
+2.69444 1.26734
+2.7 1.26727
+2.70556 1.2672
+2.71111 1.26713
+2.71667 1.26706
+2.72222 1.26699
+2.72778 1.26693
+2.73333 1.26686
+2.73889 1.26679
+2.74444 1.26672
+2.75 1.26665
+2.75556 1.26658
+2.76111 1.26652
+2.76667 1.26645
+2.77222 1.26638
+2.77778 1.26632
+2.78333 1.26625
+2.78889 1.26618
+2.79444 1.26612
+2.8 1.26605
+2.80556 1.26599
+2.81111 1.26592
+2.81667 1.26586
+2.82222 1.26579
+2.82778 1.26573
+2.83333 1.26566
+2.83889 1.2656
+2.84444 1.26553
+2.85 1.26547
+2.85556 1.26541
+2.86111 1.26534
+2.86667 1.26528
+2.87222 1.26522
+2.87778 1.26516
+2.88333 1.26509
+2.88889 1.26503
+2.89444 1.26497
+2.9 1.26491
+2.90556 1.26485
+2.91111 1.26479
+2.91667 1.26473
+2.92222 1.26467
+2.92778 1.26461
+2.93333 1.26455
+2.93889 1.26449
+2.94444 1.26443
+2.95 1.26437
+2.95556 1.26431
+2.96111 1.26425
+2.96667 1.26419
+2.97222 1.26413
+2.97778 1.26407
+2.98333 1.26401
+2.98889 1.26396
+2.99444 1.2639
+3 1.26384
+3.00556 1.26378
+3.01111 1.26373
+3.01667 1.26367
+3.02222 1.26361
+3.02778 1.26356
+3.03333 1.2635
+3.03889 1.26344
+3.04444 1.26339
+3.05 1.26333
+3.05556 1.26328
+3.06111 1.26322
+3.06667 1.26317
+3.07222 1.26311
+3.07778 1.26306
+3.08333 1.263
+3.08889 1.26295
+3.09444 1.26289
+3.1 1.26284
+3.10556 1.26279
+3.11111 1.26273
+3.11667 1.26268
+3.12222 1.26263
+3.12778 1.26257
+3.13333 1.26252
+3.13889 1.26247
+3.14444 1.26242
+3.15 1.26236
+3.15556 1.26231
+3.16111 1.26226
+3.16667 1.26221
+3.17222 1.26216
+3.17778 1.2621
+3.18333 1.26205
+3.18889 1.262
+3.19444 1.26195
+3.2 1.2619
+3.20556 1.26185
+3.21111 1.2618
+3.21667 1.26175
+3.22222 1.2617
+3.22778 1.26165
+3.23333 1.2616
+3.23889 1.26155
+3.24444 1.2615
+3.25 1.26145
+3.25556 1.2614
+3.26111 1.26135
+3.26667 1.26131
+3.27222 1.26126
+3.27778 1.26121
+3.28333 1.26116
+3.28889 1.26111
+3.29444 1.26106
+3.3 1.26102
+3.30556 1.26097
+3.31111 1.26092
+3.31667 1.26087
+3.32222 1.26083
+3.32778 1.26078
+3.33333 1.26073
+3.33889 1.26069
+3.34444 1.26064
+3.35 1.26059
+3.35556 1.26055
+3.36111 1.2605
+3.36667 1.26045
+3.37222 1.26041
+3.37778 1.26036
+3.38333 1.26032
+3.38889 1.26027
+3.39444 1.26023
+3.4 1.26018
+3.40556 1.26014
+3.41111 1.26009
+3.41667 1.26005
+3.42222 1.26
+3.42778 1.25996
+3.43333 1.25991
+3.43889 1.25987
+3.44444 1.25983
+3.45 1.25978
+3.45556 1.25974
+3.46111 1.25969
+3.46667 1.25965
+3.47222 1.25961
+3.47778 1.25956
+3.48333 1.25952
+3.48889 1.25948
+3.49444 1.25943
+3.5 1.25939
+3.50556 1.25935
+3.51111 1.25931
+3.51667 1.25926
+3.52222 1.25922
+3.52778 1.25918
+3.53333 1.25914
+3.53889 1.2591
+3.54444 1.25905
+3.55 1.25901
+3.55556 1.25897
+3.56111 1.25893
+3.56667 1.25889
+3.57222 1.25885
+3.57778 1.25881
+3.58333 1.25876
+3.58889 1.25872
+3.59444 1.25868
+3.6 1.25864
+3.60556 1.2586
+3.61111 1.25856
+3.61667 1.25852
+3.62222 1.25848
+3.62778 1.25844
+3.63333 1.2584
+3.63889 1.25836
+3.64444 1.25832
+3.65 1.25828
+3.65556 1.25824
+3.66111 1.2582
+3.66667 1.25816
+3.67222 1.25812
+3.67778 1.25808
+3.68333 1.25805
+3.68889 1.25801
+3.69444 1.25797
+3.7 1.25793
+3.70556 1.25789
+3.71111 1.25785
+3.71667 1.25781
+3.72222 1.25778
+3.72778 1.25774
+3.73333 1.2577
+3.73889 1.25766
+3.74444 1.25762
+3.75 1.25758
+3.75556 1.25755
+3.76111 1.25751
+3.76667 1.25747
+3.77222 1.25743
+3.77778 1.2574
+3.78333 1.25736
+3.78889 1.25732
+3.79444 1.25729
+3.8 1.25725
+3.80556 1.25721
+3.81111 1.25717
+3.81667 1.25714
+3.82222 1.2571
+3.82778 1.25706
+3.83333 1.25703
+3.83889 1.25699
+3.84444 1.25696
+3.85 1.25692
+3.85556 1.25688
+3.86111 1.25685
+3.86667 1.25681
+3.87222 1.25678
+3.87778 1.25674
+3.88333 1.2567
+3.88889 1.25667
+3.89444 1.25663
+3.9 1.2566
+3.90556 1.25656
+3.91111 1.25653
+3.91667 1.25649
+3.92222 1.25646
+3.92778 1.25642
+3.93333 1.25639
+3.93889 1.25635
+3.94444 1.25632
+3.95 1.25628
+3.95556 1.25625
+3.96111 1.25621
+3.96667 1.25618
+3.97222 1.25614
+3.97778 1.25611
+3.98333 1.25607
+3.98889 1.25604
+3.99444 1.25601
+4 1.25597
+4.00556 1.25594
+4.01111 1.2559
+4.01667 1.25587
+4.02222 1.25584
+4.02778 1.2558
+4.03333 1.25577
+4.03889 1.25573
+4.04444 1.2557
+4.05 1.25567
+4.05556 1.25563
+4.06111 1.2556
+4.06667 1.25557
+4.07222 1.25553
+4.07778 1.2555
+4.08333 1.25547
+4.08889 1.25543
+4.09444 1.2554
+4.1 1.25537
+4.10556 1.25533
+4.11111 1.2553
+4.11667 1.25527
+4.12222 1.25524
+4.12778 1.2552
+4.13333 1.25517
+4.13889 1.25514
+4.14444 1.25511
+4.15 1.25507
+4.15556 1.25504
+4.16111 1.25501
+4.16667 1.25498
+4.17222 1.25494
+4.17778 1.25491
+4.18333 1.25488
+4.18889 1.25485
+4.19444 1.25482
+4.2 1.25478
+4.20556 1.25475
+4.21111 1.25472
+4.21667 1.25469
+4.22222 1.25466
+4.22778 1.25463
+4.23333 1.25459
+4.23889 1.25456
+4.24444 1.25453
+4.25 1.2545
+4.25556 1.25447
+4.26111 1.25444
+4.26667 1.2544
+4.27222 1.25437
+4.27778 1.25434
+4.28333 1.25431
+4.28889 1.25428
+4.29444 1.25425
+4.3 1.25422
+4.30556 1.25419
+4.31111 1.25416
+4.31667 1.25413
+4.32222 1.25409
+4.32778 1.25406
+4.33333 1.25403
+4.33889 1.254
+4.34444 1.25397
+4.35 1.25394
+4.35556 1.25391
+4.36111 1.25388
+4.36667 1.25385
+4.37222 1.25382
+4.37778 1.25379
+4.38333 1.25376
+4.38889 1.25373
+4.39444 1.2537
+4.4 1.25367
+4.40556 1.25364
+4.41111 1.25361
+4.41667 1.25358
+4.42222 1.25355
+4.42778 1.25352
+4.43333 1.25349
+4.43889 1.25346
+4.44444 1.25343
+4.45 1.2534
+4.45556 1.25337
+4.46111 1.25334
+4.46667 1.25331
+4.47222 1.25328
+4.47778 1.25325
+4.48333 1.25322
+4.48889 1.25319
+4.49444 1.25316
+4.5 1.25313
+4.50556 1.2531
+4.51111 1.25307
+4.51667 1.25304
+4.52222 1.25301
+4.52778 1.25298
+4.53333 1.25295
+4.53889 1.25292
+4.54444 1.25289
+4.55 1.25286
+4.55556 1.25283
+4.56111 1.2528
+4.56667 1.25277
+4.57222 1.25274
+4.57778 1.25271
+4.58333 1.25269
+4.58889 1.25266
+4.59444 1.25263
+4.6 1.2526
+4.60556 1.25257
+4.61111 1.25254
+4.61667 1.25251
+4.62222 1.25248
+4.62778 1.25245
+4.63333 1.25242
+4.63889 1.25239
+4.64444 1.25237
+4.65 1.25234
+4.65556 1.25231
+4.66111 1.25228
+4.66667 1.25225
+4.67222 1.25222
+4.67778 1.25219
+4.68333 1.25216
+4.68889 1.25213
+4.69444 1.25211
+4.7 1.25208
+4.70556 1.25205
+4.71111 1.25202
+4.71667 1.25199
+4.72222 1.25196
+4.72778 1.25193
+4.73333 1.2519
+4.73889 1.25188
+4.74444 1.25185
+4.75 1.25182
+4.75556 1.25179
+4.76111 1.25176
+4.76667 1.25173
+4.77222 1.2517
+4.77778 1.25168
+4.78333 1.25165
+4.78889 1.25162
+4.79444 1.25159
+4.8 1.25156
+4.80556 1.25153
+4.81111 1.25151
+4.81667 1.25148
+4.82222 1.25145
+4.82778 1.25142
+4.83333 1.25139
+4.83889 1.25136
+4.84444 1.25134
+4.85 1.25131
+4.85556 1.25128
+4.86111 1.25125
+4.86667 1.25122
+4.87222 1.25119
+4.87778 1.25117
+4.88333 1.25114
+4.88889 1.25111
+4.89444 1.25108
+4.9 1.25105
+4.90556 1.25102
+4.91111 1.251
+4.91667 1.25097
+4.92222 1.25094
+4.92778 1.25091
+4.93333 1.25088
+4.93889 1.25085
+4.94444 1.25083
+4.95 1.2508
+4.95556 1.25077
+4.96111 1.25074
+4.96667 1.25071
+4.97222 1.25069
+4.97778 1.25066
+4.98333 1.25063
+4.98889 1.2506
+4.99444 1.25057
+5 1.25054
+5.00556 1.25052
+5.01111 1.25049
+5.01667 1.25046
+5.02222 1.25043
+5.02778 1.2504
+5.03333 1.25038
+5.03889 1.25035
+5.04444 1.25032
+5.05 1.25029
+5.05556 1.25026
+5.06111 1.25023
+5.06667 1.25021
+5.07222 1.25018
+5.07778 1.25015
+5.08333 1.25012
+5.08889 1.25009
+5.09444 1.25007
+5.1 1.25004
+5.10556 1.25001
+5.11111 1.24998
+5.11667 1.24995
+5.12222 1.24993
+5.12778 1.2499
+5.13333 1.24987
+5.13889 1.24984
+5.14444 1.24981
+5.15 1.24978
+5.15556 1.24976
+5.16111 1.24973
+5.16667 1.2497
+5.17222 1.24967
+5.17778 1.24964
+5.18333 1.24961
+5.18889 1.24959
+5.19444 1.24956
+5.2 1.24953
+5.20556 1.2495
+5.21111 1.24947
+5.21667 1.24945
+5.22222 1.24942
+5.22778 1.24939
+5.23333 1.24936
+5.23889 1.24933
+5.24444 1.2493
+5.25 1.24928
+5.25556 1.24925
+5.26111 1.24922
+5.26667 1.24919
+5.27222 1.24916
+5.27778 1.24913
+5.28333 1.24911
+5.28889 1.24908
+5.29444 1.24905
+5.3 1.24902
+5.30556 1.24899
+5.31111 1.24896
+5.31667 1.24894
+5.32222 1.24891
+5.32778 1.24888
+5.33333 1.24885
+5.33889 1.24882
+5.34444 1.24879
+5.35 1.24876
+5.35556 1.24874
+5.36111 1.24871
+5.36667 1.24868
+5.37222 1.24865
+5.37778 1.24862
+5.38333 1.24859
+5.38889 1.24856
+5.39444 1.24854
+5.4 1.24851
+5.40556 1.24848
+5.41111 1.24845
+5.41667 1.24842
+5.42222 1.24839
+5.42778 1.24836
+5.43333 1.24834
+5.43889 1.24831
+5.44444 1.24828
+5.45 1.24825
+5.45556 1.24822
+5.46111 1.24819
+5.46667 1.24816
+5.47222 1.24813
+5.47778 1.2481
+5.48333 1.24808
+5.48889 1.24805
+5.49444 1.24802
+5.5 1.24799
+5.50556 1.24796
+5.51111 1.24793
+5.51667 1.2479
+5.52222 1.24787
+5.52778 1.24784
+5.53333 1.24781
+5.53889 1.24779
+5.54444 1.24776
+5.55 1.24773
+5.55556 1.2477
+5.56111 1.24767
+5.56667 1.24764
+5.57222 1.24761
+5.57778 1.24758
+5.58333 1.24755
+5.58889 1.24752
+5.59444 1.24749
+5.6 1.24746
+5.60556 1.24743
+5.61111 1.2474
+5.61667 1.24737
+5.62222 1.24735
+5.62778 1.24732
+5.63333 1.24729
+5.63889 1.24726
+5.64444 1.24723
+5.65 1.2472
+5.65556 1.24717
+5.66111 1.24714
+5.66667 1.24711
+5.67222 1.24708
+5.67778 1.24705
+5.68333 1.24702
+5.68889 1.24699
+5.69444 1.24696
+5.7 1.24693
+5.70556 1.2469
+5.71111 1.24687
+5.71667 1.24684
+5.72222 1.24681
+5.72778 1.24678
+5.73333 1.24675
+5.73889 1.24672
+5.74444 1.24669
+5.75 1.24666
+5.75556 1.24663
+5.76111 1.2466
+5.76667 1.24657
+5.77222 1.24654
+5.77778 1.24651
+5.78333 1.24648
+5.78889 1.24645
+5.79444 1.24642
+5.8 1.24639
+5.80556 1.24636
+5.81111 1.24633
+5.81667 1.24629
+5.82222 1.24626
+5.82778 1.24623
+5.83333 1.2462
+5.83889 1.24617
+5.84444 1.24614
+5.85 1.24611
+5.85556 1.24608
+5.86111 1.24605
+5.86667 1.24602
+5.87222 1.24599
+5.87778 1.24596
+5.88333 1.24592
+5.88889 1.24589
+5.89444 1.24586
+5.9 1.24583
+5.90556 1.2458
+5.91111 1.24577
+5.91667 1.24574
+5.92222 1.24571
+5.92778 1.24568
+5.93333 1.24564
+5.93889 1.24561
+5.94444 1.24558
+5.95 1.24555
+5.95556 1.24552
+5.96111 1.24549
+5.96667 1.24545
+5.97222 1.24542
+5.97778 1.24539
+5.98333 1.24536
+5.98889 1.24533
+5.99444 1.2453
+6 1.24526
+6.00556 1.24523
+6.01111 1.2452
+6.01667 1.24517
+6.02222 1.24514
+6.02778 1.2451
+6.03333 1.24507
+6.03889 1.24504
+6.04444 1.24501
+6.05 1.24498
+6.05556 1.24494
+6.06111 1.24491
+6.06667 1.24488
+6.07222 1.24485
+6.07778 1.24481
+6.08333 1.24478
+6.08889 1.24475
+6.09444 1.24472
+6.1 1.24468
+6.10556 1.24465
+6.11111 1.24462
+6.11667 1.24458
+6.12222 1.24455
+6.12778 1.24452
+6.13333 1.24449
+6.13889 1.24445
+6.14444 1.24442
+6.15 1.24439
+6.15556 1.24435
+6.16111 1.24432
+6.16667 1.24429
+6.17222 1.24425
+6.17778 1.24422
+6.18333 1.24419
+6.18889 1.24415
+6.19444 1.24412
+6.2 1.24409
+6.20556 1.24405
+6.21111 1.24402
+6.21667 1.24398
+6.22222 1.24395
+6.22778 1.24392
+6.23333 1.24388
+6.23889 1.24385
+6.24444 1.24381
+6.25 1.24378
+6.25556 1.24375
+6.26111 1.24371
+6.26667 1.24368
+6.27222 1.24364
+6.27778 1.24361
+6.28333 1.24357
+6.28889 1.24354
+6.29444 1.2435
+6.3 1.24347
+6.30556 1.24344
+6.31111 1.2434
+6.31667 1.24337
+6.32222 1.24333
+6.32778 1.2433
+6.33333 1.24326
+6.33889 1.24323
+6.34444 1.24319
+6.35 1.24316
+6.35556 1.24312
+6.36111 1.24309
+6.36667 1.24305
+6.37222 1.24301
+6.37778 1.24298
+6.38333 1.24294
+6.38889 1.24291
+6.39444 1.24287
+6.4 1.24284
+6.40556 1.2428
+6.41111 1.24276
+6.41667 1.24273
+6.42222 1.24269
+6.42778 1.24266
+6.43333 1.24262
+6.43889 1.24258
+6.44444 1.24255
+6.45 1.24251
+6.45556 1.24247
+6.46111 1.24244
+6.46667 1.2424
+6.47222 1.24237
+6.47778 1.24233
+6.48333 1.24229
+6.48889 1.24226
+6.49444 1.24222
+6.5 1.24218
+6.50556 1.24214
+6.51111 1.24211
+6.51667 1.24207
+6.52222 1.24203
+6.52778 1.242
+6.53333 1.24196
+6.53889 1.24192
+6.54444 1.24188
+6.55 1.24185
+6.55556 1.24181
+6.56111 1.24177
+6.56667 1.24173
+6.57222 1.24169
+6.57778 1.24166
+6.58333 1.24162
+6.58889 1.24158
+6.59444 1.24154
+6.6 1.2415
+6.60556 1.24146
+6.61111 1.24143
+6.61667 1.24139
+6.62222 1.24135
+6.62778 1.24131
+6.63333 1.24127
+6.63889 1.24123
+6.64444 1.24119
+6.65 1.24116
+6.65556 1.24112
+6.66111 1.24108
+6.66667 1.24104
+6.67222 1.241
+6.67778 1.24096
+6.68333 1.24092
+6.68889 1.24088
+6.69444 1.24084
+6.7 1.2408
+6.70556 1.24076
+6.71111 1.24072
+6.71667 1.24068
+6.72222 1.24064
+6.72778 1.2406
+6.73333 1.24056
+6.73889 1.24052
+6.74444 1.24048
+6.75 1.24044
+6.75556 1.2404
+6.76111 1.24036
+6.76667 1.24032
+6.77222 1.24028
+6.77778 1.24024
+6.78333 1.24019
+6.78889 1.24015
+6.79444 1.24011
+6.8 1.24007
+6.80556 1.24003
+6.81111 1.23999
+6.81667 1.23995
+6.82222 1.2399
+6.82778 1.23986
+6.83333 1.23982
+6.83889 1.23978
+6.84444 1.23974
+6.85 1.23969
+6.85556 1.23965
+6.86111 1.23961
+6.86667 1.23957
+6.87222 1.23953
+6.87778 1.23948
+6.88333 1.23944
+6.88889 1.2394
+6.89444 1.23935
+6.9 1.23931
+6.90556 1.23927
+6.91111 1.23923
+6.91667 1.23918
+6.92222 1.23914
+6.92778 1.2391
+6.93333 1.23905
+6.93889 1.23901
+6.94444 1.23896
+6.95 1.23892
+6.95556 1.23888
+6.96111 1.23883
+6.96667 1.23879
+6.97222 1.23874
+6.97778 1.2387
+6.98333 1.23865
+6.98889 1.23861
+6.99444 1.23857
+7 1.23852
+7.00556 1.23848
+7.01111 1.23843
+7.01667 1.23839
+7.02222 1.23834
+7.02778 1.2383
+7.03333 1.23825
+7.03889 1.2382
+7.04444 1.23816
+7.05 1.23811
+7.05556 1.23807
+7.06111 1.23802
+7.06667 1.23797
+7.07222 1.23793
+7.07778 1.23788
+7.08333 1.23784
+7.08889 1.23779
+7.09444 1.23774
+7.1 1.2377
+7.10556 1.23765
+7.11111 1.2376
+7.11667 1.23755
+7.12222 1.23751
+7.12778 1.23746
+7.13333 1.23741
+7.13889 1.23736
+7.14444 1.23732
+7.15 1.23727
+7.15556 1.23722
+7.16111 1.23717
+7.16667 1.23712
+7.17222 1.23708
+7.17778 1.23703
+7.18333 1.23698
+7.18889 1.23693
+7.19444 1.23688
+7.2 1.23683
+7.20556 1.23678
+7.21111 1.23673
+7.21667 1.23669
+7.22222 1.23664
+7.22778 1.23659
+7.23333 1.23654
+7.23889 1.23649
+7.24444 1.23644
+7.25 1.23639
+7.25556 1.23634
+7.26111 1.23629
+7.26667 1.23624
+7.27222 1.23619
+7.27778 1.23613
+7.28333 1.23608
+7.28889 1.23603
+7.29444 1.23598
+7.3 1.23593
+7.30556 1.23588
+7.31111 1.23583
+7.31667 1.23578
+7.32222 1.23572
+7.32778 1.23567
+7.33333 1.23562
+7.33889 1.23557
+7.34444 1.23552
+7.35 1.23546
+7.35556 1.23541
+7.36111 1.23536
+7.36667 1.2353
+7.37222 1.23525
+7.37778 1.2352
+7.38333 1.23514
+7.38889 1.23509
+7.39444 1.23504
+7.4 1.23498
+7.40556 1.23493
+7.41111 1.23488
+7.41667 1.23482
+7.42222 1.23477
+7.42778 1.23471
+7.43333 1.23466
+7.43889 1.2346
+7.44444 1.23455
+7.45 1.23449
+7.45556 1.23444
+7.46111 1.23438
+7.46667 1.23433
+7.47222 1.23427
+7.47778 1.23422
+7.48333 1.23416
+7.48889 1.2341
+7.49444 1.23405
+7.5 1.23399
+7.50556 1.23393
+7.51111 1.23388
+7.51667 1.23382
+7.52222 1.23376
+7.52778 1.2337
+7.53333 1.23365
+7.53889 1.23359
+7.54444 1.23353
+7.55 1.23347
+7.55556 1.23342
+7.56111 1.23336
+7.56667 1.2333
+7.57222 1.23324
+7.57778 1.23318
+7.58333 1.23312
+7.58889 1.23306
+7.59444 1.233
+7.6 1.23294
+7.60556 1.23288
+7.61111 1.23282
+7.61667 1.23276
+7.62222 1.2327
+7.62778 1.23264
+7.63333 1.23258
+7.63889 1.23252
+7.64444 1.23246
+7.65 1.2324
+7.65556 1.23234
+7.66111 1.23228
+7.66667 1.23222
+7.67222 1.23215
+7.67778 1.23209
+7.68333 1.23203
+7.68889 1.23197
+7.69444 1.23191
+7.7 1.23184
+7.70556 1.23178
+7.71111 1.23172
+7.71667 1.23165
+7.72222 1.23159
+7.72778 1.23153
+7.73333 1.23146
+7.73889 1.2314
+7.74444 1.23133
+7.75 1.23127
+7.75556 1.2312
+7.76111 1.23114
+7.76667 1.23107
+7.77222 1.23101
+7.77778 1.23094
+7.78333 1.23088
+7.78889 1.23081
+7.79444 1.23075
+7.8 1.23068
+7.80556 1.23061
+7.81111 1.23055
+7.81667 1.23048
+7.82222 1.23041
+7.82778 1.23034
+7.83333 1.23028
+7.83889 1.23021
+7.84444 1.23014
+7.85 1.23007
+7.85556 1.23
+7.86111 1.22994
+7.86667 1.22987
+7.87222 1.2298
+7.87778 1.22973
+7.88333 1.22966
+7.88889 1.22959
+7.89444 1.22952
+7.9 1.22945
+7.90556 1.22938
+7.91111 1.22931
+7.91667 1.22924
+7.92222 1.22917
+7.92778 1.2291
+7.93333 1.22902
+7.93889 1.22895
+7.94444 1.22888
+7.95 1.22881
+7.95556 1.22874
+7.96111 1.22866
+7.96667 1.22859
+7.97222 1.22852
+7.97778 1.22844
+7.98333 1.22837
+7.98889 1.2283
+7.99444 1.22822
+8 1.22815
+8.00556 1.22807
+8.01111 1.228
+8.01667 1.22792
+8.02222 1.22785
+8.02778 1.22777
+8.03333 1.22769
+8.03889 1.22762
+8.04444 1.22754
+8.05 1.22747
+8.05556 1.22739
+8.06111 1.22731
+8.06667 1.22723
+8.07222 1.22716
+8.07778 1.22708
+8.08333 1.227
+8.08889 1.22692
+8.09444 1.22684
+8.1 1.22676
+8.10556 1.22668
+8.11111 1.2266
+8.11667 1.22652
+8.12222 1.22644
+8.12778 1.22636
+8.13333 1.22628
+8.13889 1.2262
+8.14444 1.22612
+8.15 1.22604
+8.15556 1.22596
+8.16111 1.22587
+8.16667 1.22579
+8.17222 1.22571
+8.17778 1.22563
+8.18333 1.22554
+8.18889 1.22546
+8.19444 1.22538
+8.2 1.22529
+8.20556 1.22521
+8.21111 1.22512
+8.21667 1.22504
+8.22222 1.22495
+8.22778 1.22487
+8.23333 1.22478
+8.23889 1.22469
+8.24444 1.22461
+8.25 1.22452
+8.25556 1.22443
+8.26111 1.22435
+8.26667 1.22426
+8.27222 1.22417
+8.27778 1.22408
+8.28333 1.22399
+8.28889 1.2239
+8.29444 1.22381
+8.3 1.22372
+8.30556 1.22363
+8.31111 1.22354
+8.31667 1.22345
+8.32222 1.22336
+8.32778 1.22327
+8.33333 1.22318
+8.33889 1.22308
+8.34444 1.22299
+8.35 1.2229
+8.35556 1.22281
+8.36111 1.22271
+8.36667 1.22262
+8.37222 1.22252
+8.37778 1.22243
+8.38333 1.22233
+8.38889 1.22224
+8.39444 1.22214
+8.4 1.22205
+8.40556 1.22195
+8.41111 1.22185
+8.41667 1.22176
+8.42222 1.22166
+8.42778 1.22156
+8.43333 1.22146
+8.43889 1.22136
+8.44444 1.22126
+8.45 1.22117
+8.45556 1.22107
+8.46111 1.22096
+8.46667 1.22086
+8.47222 1.22076
+8.47778 1.22066
+8.48333 1.22056
+8.48889 1.22046
+8.49444 1.22035
+8.5 1.22025
+8.50556 1.22015
+8.51111 1.22004
+8.51667 1.21994
+8.52222 1.21984
+8.52778 1.21973
+8.53333 1.21962
+8.53889 1.21952
+8.54444 1.21941
+8.55 1.21931
+8.55556 1.2192
+8.56111 1.21909
+8.56667 1.21898
+8.57222 1.21887
+8.57778 1.21876
+8.58333 1.21866
+8.58889 1.21855
+8.59444 1.21843
+8.6 1.21832
+8.60556 1.21821
+8.61111 1.2181
+8.61667 1.21799
+8.62222 1.21788
+8.62778 1.21776
+8.63333 1.21765
+8.63889 1.21754
+8.64444 1.21742
+8.65 1.21731
+8.65556 1.21719
+8.66111 1.21707
+8.66667 1.21696
+8.67222 1.21684
+8.67778 1.21672
+8.68333 1.21661
+8.68889 1.21649
+8.69444 1.21637
+8.7 1.21625
+8.70556 1.21613
+8.71111 1.21601
+8.71667 1.21589
+8.72222 1.21577
+8.72778 1.21564
+8.73333 1.21552
+8.73889 1.2154
+8.74444 1.21527
+8.75 1.21515
+8.75556 1.21502
+8.76111 1.2149
+8.76667 1.21477
+8.77222 1.21465
+8.77778 1.21452
+8.78333 1.21439
+8.78889 1.21426
+8.79444 1.21414
+8.8 1.21401
+8.80556 1.21388
+8.81111 1.21375
+8.81667 1.21362
+8.82222 1.21348
+8.82778 1.21335
+8.83333 1.21322
+8.83889 1.21309
+8.84444 1.21295
+8.85 1.21282
+8.85556 1.21268
+8.86111 1.21255
+8.86667 1.21241
+8.87222 1.21227
+8.87778 1.21213
+8.88333 1.212
+8.88889 1.21186
+8.89444 1.21172
+8.9 1.21158
+8.90556 1.21144
+8.91111 1.2113
+8.91667 1.21115
+8.92222 1.21101
+8.92778 1.21087
+8.93333 1.21072
+8.93889 1.21058
+8.94444 1.21043
+8.95 1.21029
+8.95556 1.21014
+8.96111 1.20999
+8.96667 1.20984
+8.97222 1.20969
+8.97778 1.20954
+8.98333 1.20939
+8.98889 1.20924
+8.99444 1.20909
+9 1.20894
+9.00556 1.20878
+9.01111 1.20863
+9.01667 1.20847
+9.02222 1.20832
+9.02778 1.20816
+9.03333 1.20801
+9.03889 1.20785
+9.04444 1.20769
+9.05 1.20753
+9.05556 1.20737
+9.06111 1.20721
+9.06667 1.20705
+9.07222 1.20688
+9.07778 1.20672
+9.08333 1.20655
+9.08889 1.20639
+9.09444 1.20622
+9.1 1.20606
+9.10556 1.20589
+9.11111 1.20572
+9.11667 1.20555
+9.12222 1.20538
+9.12778 1.20521
+9.13333 1.20504
+9.13889 1.20486
+9.14444 1.20469
+9.15 1.20451
+9.15556 1.20434
+9.16111 1.20416
+9.16667 1.20398
+9.17222 1.20381
+9.17778 1.20363
+9.18333 1.20345
+9.18889 1.20326
+9.19444 1.20308
+9.2 1.2029
+9.20556 1.20271
+9.21111 1.20253
+9.21667 1.20234
+9.22222 1.20216
+9.22778 1.20197
+9.23333 1.20178
+9.23889 1.20159
+9.24444 1.2014
+9.25 1.2012
+9.25556 1.20101
+9.26111 1.20082
+9.26667 1.20062
+9.27222 1.20042
+9.27778 1.20023
+9.28333 1.20003
+9.28889 1.19983
+9.29444 1.19963
+9.3 1.19942
+9.30556 1.19922
+9.31111 1.19902
+9.31667 1.19881
+9.32222 1.1986
+9.32778 1.1984
+9.33333 1.19819
+9.33889 1.19798
+9.34444 1.19777
+9.35 1.19755
+9.35556 1.19734
+9.36111 1.19712
+9.36667 1.19691
+9.37222 1.19669
+9.37778 1.19647
+9.38333 1.19625
+9.38889 1.19603
+9.39444 1.19581
+9.4 1.19558
+9.40556 1.19536
+9.41111 1.19513
+9.41667 1.1949
+9.42222 1.19467
+9.42778 1.19444
+9.43333 1.19421
+9.43889 1.19398
+9.44444 1.19374
+9.45 1.19351
+9.45556 1.19327
+9.46111 1.19303
+9.46667 1.19279
+9.47222 1.19255
+9.47778 1.1923
+9.48333 1.19206
+9.48889 1.19181
+9.49444 1.19156
+9.5 1.19131
+9.50556 1.19106
+9.51111 1.19081
+9.51667 1.19055
+9.52222 1.1903
+9.52778 1.19004
+9.53333 1.18978
+9.53889 1.18952
+9.54444 1.18926
+9.55 1.18899
+9.55556 1.18873
+9.56111 1.18846
+9.56667 1.18819
+9.57222 1.18792
+9.57778 1.18764
+9.58333 1.18737
+9.58889 1.18709
+9.59444 1.18681
+9.6 1.18653
+9.60556 1.18625
+9.61111 1.18597
+9.61667 1.18568
+9.62222 1.18539
+9.62778 1.18511
+9.63333 1.18481
+9.63889 1.18452
+9.64444 1.18422
+9.65 1.18393
+9.65556 1.18363
+9.66111 1.18333
+9.66667 1.18302
+9.67222 1.18272
+9.67778 1.18241
+9.68333 1.1821
+9.68889 1.18179
+9.69444 1.18147
+9.7 1.18115
+9.70556 1.18084
+9.71111 1.18052
+9.71667 1.18019
+9.72222 1.17987
+9.72778 1.17954
+9.73333 1.17921
+9.73889 1.17888
+9.74444 1.17854
+9.75 1.1782
+9.75556 1.17786
+9.76111 1.17752
+9.76667 1.17718
+9.77222 1.17683
+9.77778 1.17648
+9.78333 1.17613
+9.78889 1.17577
+9.79444 1.17541
+9.8 1.17505
+9.80556 1.17469
+9.81111 1.17432
+9.81667 1.17395
+9.82222 1.17358
+9.82778 1.17321
+9.83333 1.17283
+9.83889 1.17245
+9.84444 1.17207
+9.85 1.17168
+9.85556 1.17129
+9.86111 1.1709
+9.86667 1.17051
+9.87222 1.17011
+9.87778 1.16971
+9.88333 1.1693
+9.88889 1.16889
+9.89444 1.16848
+9.9 1.16807
+9.90556 1.16765
+9.91111 1.16723
+9.91667 1.16681
+9.92222 1.16638
+9.92778 1.16595
+9.93333 1.16551
+9.93889 1.16507
+9.94444 1.16463
+9.95 1.16419
+9.95556 1.16374
+9.96111 1.16328
+9.96667 1.16283
+9.97222 1.16237
+9.97778 1.1619
+9.98333 1.16143
+9.98889 1.16096
+9.99444 1.16048
+10 1.16
+10.0056 1.15952
+10.0111 1.15903
+10.0167 1.15853
+10.0222 1.15803
+10.0278 1.15753
+10.0333 1.15702
+10.0389 1.15651
+10.0444 1.156
+10.05 1.15548
+10.0556 1.15495
+10.0611 1.15442
+10.0667 1.15389
+10.0722 1.15335
+10.0778 1.1528
+10.0833 1.15225
+10.0889 1.1517
+10.0944 1.15114
+10.1 1.15057
+10.1056 1.15
+10.1111 1.14943
+10.1167 1.14884
+10.1222 1.14826
+10.1278 1.14766
+10.1333 1.14707
+10.1389 1.14646
+10.1444 1.14585
+10.15 1.14524
+10.1556 1.14461
+10.1611 1.14398
+10.1667 1.14335
+10.1722 1.14271
+10.1778 1.14206
+10.1833 1.14141
+10.1889 1.14075
+10.1944 1.14008
+10.2 1.13941
+10.2056 1.13873
+10.2111 1.13804
+10.2167 1.13734
+10.2222 1.13664
+10.2278 1.13593
+10.2333 1.13521
+10.2389 1.13449
+10.2444 1.13376
+10.25 1.13302
+10.2556 1.13227
+10.2611 1.13151
+10.2667 1.13075
+10.2722 1.12997
+10.2778 1.12919
+10.2833 1.1284
+10.2889 1.1276
+10.2944 1.1268
+10.3 1.12598
+10.3056 1.12515
+10.3111 1.12432
+10.3167 1.12347
+10.3222 1.12262
+10.3278 1.12175
+10.3333 1.12088
+10.3389 1.11999
+10.3444 1.11909
+10.35 1.11819
+10.3556 1.11727
+10.3611 1.11634
+10.3667 1.1154
+10.3722 1.11445
+10.3778 1.11349
+10.3833 1.11252
+10.3889 1.11153
+10.3944 1.11053
+10.4 1.10952
+10.4056 1.10849
+10.4111 1.10746
+10.4167 1.10641
+10.4222 1.10534
+10.4278 1.10427
+10.4333 1.10317
+10.4389 1.10207
+10.4444 1.10095
+10.45 1.09981
+10.4556 1.09866
+10.4611 1.0975
+10.4667 1.09631
+10.4722 1.09512
+10.4778 1.0939
+10.4833 1.09267
+10.4889 1.09142
+10.4944 1.09016
+10.5 1.08887
+10.5056 1.08757
+10.5111 1.08625
+10.5167 1.08491
+10.5222 1.08355
+10.5278 1.08217
+10.5333 1.08077
+10.5389 1.07935
+10.5444 1.07791
+10.55 1.07644
+10.5556 1.07496
+10.5611 1.07345
+10.5667 1.07192
+10.5722 1.07036
+10.5778 1.06878
+10.5833 1.06718
+10.5889 1.06555
+10.5944 1.06389
+10.6 1.0622
+10.6056 1.06049
+10.6111 1.05875
+10.6167 1.05699
+10.6222 1.05519
+10.6278 1.05336
+10.6333 1.0515
+10.6389 1.04961
+10.6444 1.04768
+10.65 1.04573
+10.6556 1.04373
+10.6611 1.04171
+10.6667 1.03964
+10.6722 1.03754
+10.6778 1.0354
+10.6833 1.03322
+10.6889 1.031
+e
+0 1.38896
+0.00555556 1.38678
+0.0111111 1.38498
+0.0166667 1.38346
+0.0222222 1.38208
+0.0277778 1.38078
+0.0333333 1.37953
+0.0388889 1.37831
+0.0444444 1.37711
+0.05 1.37593
+0.0555556 1.37476
+0.0611111 1.3736
+0.0666667 1.37245
+0.0722222 1.37132
+0.0777778 1.3702
+0.0833333 1.36908
+0.0888889 1.36798
+0.0944444 1.36689
+0.1 1.36581
+0.105556 1.36474
+0.111111 1.36367
+0.116667 1.36262
+0.122222 1.36158
+0.127778 1.36055
+0.133333 1.35953
+0.138889 1.35852
+0.144444 1.35752
+0.15 1.35653
+0.155556 1.35554
+0.161111 1.35457
+0.166667 1.35361
+0.172222 1.35265
+0.177778 1.35171
+0.183333 1.35077
+0.188889 1.34984
+0.194444 1.34892
+0.2 1.34801
+0.205556 1.34711
+0.211111 1.34622
+0.216667 1.34533
+0.222222 1.34446
+0.227778 1.34359
+0.233333 1.34273
+0.238889 1.34188
+0.244444 1.34103
+0.25 1.3402
+0.255556 1.33937
+0.261111 1.33855
+0.266667 1.33774
+0.272222 1.33693
+0.277778 1.33614
+0.283333 1.33535
+0.288889 1.33456
+0.294444 1.33379
+0.3 1.33302
+0.305556 1.33226
+0.311111 1.33151
+0.316667 1.33077
+0.322222 1.33003
+0.327778 1.3293
+0.333333 1.32857
+0.338889 1.32785
+0.344444 1.32714
+0.35 1.32644
+0.355556 1.32574
+0.361111 1.32505
+0.366667 1.32436
+0.372222 1.32369
+0.377778 1.32301
+0.383333 1.32235
+0.388889 1.32169
+0.394444 1.32104
+0.4 1.32039
+0.405556 1.31975
+0.411111 1.31911
+0.416667 1.31849
+0.422222 1.31786
+0.427778 1.31725
+0.433333 1.31663
+0.438889 1.31603
+0.444444 1.31543
+0.45 1.31484
+0.455556 1.31425
+0.461111 1.31366
+0.466667 1.31309
+0.472222 1.31251
+0.477778 1.31195
+0.483333 1.31138
+0.488889 1.31083
+0.494444 1.31028
+0.5 1.30973
+0.505556 1.30919
+0.511111 1.30865
+0.516667 1.30812
+0.522222 1.3076
+0.527778 1.30708
+0.533333 1.30656
+0.538889 1.30605
+0.544444 1.30554
+0.55 1.30504
+0.555556 1.30454
+0.561111 1.30405
+0.566667 1.30356
+0.572222 1.30308
+0.577778 1.3026
+0.583333 1.30212
+0.588889 1.30165
+0.594444 1.30119
+0.6 1.30073
+0.605556 1.30027
+0.611111 1.29982
+0.616667 1.29937
+0.622222 1.29892
+0.627778 1.29848
+0.633333 1.29805
+0.638889 1.29761
+0.644444 1.29718
+0.65 1.29676
+0.655556 1.29634
+0.661111 1.29592
+0.666667 1.29551
+0.672222 1.2951
+0.677778 1.29469
+0.683333 1.29429
+0.688889 1.29389
+0.694444 1.2935
+0.7 1.29311
+0.705556 1.29272
+0.711111 1.29234
+0.716667 1.29196
+0.722222 1.29158
+0.727778 1.29121
+0.733333 1.29084
+0.738889 1.29047
+0.744444 1.29011
+0.75 1.28975
+0.755556 1.28939
+0.761111 1.28904
+0.766667 1.28869
+0.772222 1.28834
+0.777778 1.288
+0.783333 1.28766
+0.788889 1.28732
+0.794444 1.28698
+0.8 1.28665
+0.805556 1.28632
+0.811111 1.286
+0.816667 1.28567
+0.822222 1.28535
+0.827778 1.28504
+0.833333 1.28472
+0.838889 1.28441
+0.844444 1.2841
+0.85 1.2838
+0.855556 1.28349
+0.861111 1.28319
+0.866667 1.2829
+0.872222 1.2826
+0.877778 1.28231
+0.883333 1.28202
+0.888889 1.28173
+0.894444 1.28145
+0.9 1.28117
+0.905556 1.28089
+0.911111 1.28061
+0.916667 1.28033
+0.922222 1.28006
+0.927778 1.27979
+0.933333 1.27952
+0.938889 1.27926
+0.944444 1.279
+0.95 1.27874
+0.955556 1.27848
+0.961111 1.27822
+0.966667 1.27797
+0.972222 1.27772
+0.977778 1.27747
+0.983333 1.27722
+0.988889 1.27698
+0.994444 1.27673
+1 1.27649
+1.00556 1.27625
+1.01111 1.27602
+1.01667 1.27578
+1.02222 1.27555
+1.02778 1.27532
+1.03333 1.27509
+1.03889 1.27486
+1.04444 1.27464
+1.05 1.27442
+1.05556 1.2742
+1.06111 1.27398
+1.06667 1.27376
+1.07222 1.27355
+1.07778 1.27333
+1.08333 1.27312
+1.08889 1.27291
+1.09444 1.2727
+1.1 1.2725
+1.10556 1.27229
+1.11111 1.27209
+1.11667 1.27189
+1.12222 1.27169
+1.12778 1.27149
+1.13333 1.2713
+1.13889 1.2711
+1.14444 1.27091
+1.15 1.27072
+1.15556 1.27053
+1.16111 1.27034
+1.16667 1.27016
+1.17222 1.26997
+1.17778 1.26979
+1.18333 1.26961
+1.18889 1.26942
+1.19444 1.26925
+1.2 1.26907
+1.20556 1.26889
+1.21111 1.26872
+1.21667 1.26855
+1.22222 1.26837
+1.22778 1.2682
+1.23333 1.26803
+1.23889 1.26787
+1.24444 1.2677
+1.25 1.26754
+1.25556 1.26737
+1.26111 1.26721
+1.26667 1.26705
+1.27222 1.26689
+1.27778 1.26673
+1.28333 1.26657
+1.28889 1.26642
+1.29444 1.26626
+1.3 1.26611
+1.30556 1.26596
+1.31111 1.26581
+1.31667 1.26566
+1.32222 1.26551
+1.32778 1.26536
+1.33333 1.26522
+1.33889 1.26507
+1.34444 1.26493
+1.35 1.26478
+1.35556 1.26464
+1.36111 1.2645
+1.36667 1.26436
+1.37222 1.26422
+1.37778 1.26409
+1.38333 1.26395
+1.38889 1.26381
+1.39444 1.26368
+1.4 1.26354
+1.40556 1.26341
+1.41111 1.26328
+1.41667 1.26315
+1.42222 1.26302
+1.42778 1.26289
+1.43333 1.26276
+1.43889 1.26264
+1.44444 1.26251
+1.45 1.26239
+1.45556 1.26226
+1.46111 1.26214
+1.46667 1.26202
+1.47222 1.2619
+1.47778 1.26178
+1.48333 1.26166
+1.48889 1.26154
+1.49444 1.26142
+1.5 1.2613
+1.50556 1.26119
+1.51111 1.26107
+1.51667 1.26096
+1.52222 1.26084
+1.52778 1.26073
+1.53333 1.26062
+1.53889 1.26051
+1.54444 1.2604
+1.55 1.26029
+1.55556 1.26018
+1.56111 1.26007
+1.56667 1.25996
+1.57222 1.25985
+1.57778 1.25975
+1.58333 1.25964
+1.58889 1.25954
+1.59444 1.25943
+1.6 1.25933
+1.60556 1.25923
+1.61111 1.25912
+1.61667 1.25902
+1.62222 1.25892
+1.62778 1.25882
+1.63333 1.25872
+1.63889 1.25862
+1.64444 1.25852
+1.65 1.25843
+1.65556 1.25833
+1.66111 1.25823
+1.66667 1.25814
+1.67222 1.25804
+1.67778 1.25795
+1.68333 1.25785
+1.68889 1.25776
+1.69444 1.25767
+1.7 1.25757
+1.70556 1.25748
+1.71111 1.25739
+1.71667 1.2573
+1.72222 1.25721
+1.72778 1.25712
+1.73333 1.25703
+1.73889 1.25694
+1.74444 1.25685
+1.75 1.25676
+1.75556 1.25668
+1.76111 1.25659
+1.76667 1.2565
+1.77222 1.25642
+1.77778 1.25633
+1.78333 1.25625
+1.78889 1.25616
+1.79444 1.25608
+1.8 1.256
+1.80556 1.25591
+1.81111 1.25583
+1.81667 1.25575
+1.82222 1.25567
+1.82778 1.25558
+1.83333 1.2555
+1.83889 1.25542
+1.84444 1.25534
+1.85 1.25526
+1.85556 1.25518
+1.86111 1.2551
+1.86667 1.25503
+1.87222 1.25495
+1.87778 1.25487
+1.88333 1.25479
+1.88889 1.25471
+1.89444 1.25464
+1.9 1.25456
+1.90556 1.25449
+1.91111 1.25441
+1.91667 1.25433
+1.92222 1.25426
+1.92778 1.25418
+1.93333 1.25411
+1.93889 1.25404
+1.94444 1.25396
+1.95 1.25389
+1.95556 1.25382
+1.96111 1.25374
+1.96667 1.25367
+1.97222 1.2536
+1.97778 1.25353
+1.98333 1.25345
+1.98889 1.25338
+1.99444 1.25331
+2 1.25324
+2.00556 1.25317
+2.01111 1.2531
+2.01667 1.25303
+2.02222 1.25296
+2.02778 1.25289
+2.03333 1.25282
+2.03889 1.25275
+2.04444 1.25268
+2.05 1.25262
+2.05556 1.25255
+2.06111 1.25248
+2.06667 1.25241
+2.07222 1.25234
+2.07778 1.25228
+2.08333 1.25221
+2.08889 1.25214
+2.09444 1.25208
+2.1 1.25201
+2.10556 1.25194
+2.11111 1.25188
+2.11667 1.25181
+2.12222 1.25175
+2.12778 1.25168
+2.13333 1.25162
+2.13889 1.25155
+2.14444 1.25149
+2.15 1.25142
+2.15556 1.25136
+2.16111 1.25129
+2.16667 1.25123
+2.17222 1.25116
+2.17778 1.2511
+2.18333 1.25103
+2.18889 1.25097
+2.19444 1.25091
+2.2 1.25084
+2.20556 1.25078
+2.21111 1.25072
+2.21667 1.25066
+2.22222 1.25059
+2.22778 1.25053
+2.23333 1.25047
+2.23889 1.2504
+2.24444 1.25034
+2.25 1.25028
+2.25556 1.25022
+2.26111 1.25016
+2.26667 1.25009
+2.27222 1.25003
+2.27778 1.24997
+2.28333 1.24991
+2.28889 1.24985
+2.29444 1.24979
+2.3 1.24973
+2.30556 1.24966
+2.31111 1.2496
+2.31667 1.24954
+2.32222 1.24948
+2.32778 1.24942
+2.33333 1.24936
+2.33889 1.2493
+2.34444 1.24924
+2.35 1.24918
+2.35556 1.24912
+2.36111 1.24906
+2.36667 1.249
+2.37222 1.24894
+2.37778 1.24888
+2.38333 1.24882
+2.38889 1.24876
+2.39444 1.2487
+2.4 1.24864
+2.40556 1.24858
+2.41111 1.24852
+2.41667 1.24846
+2.42222 1.2484
+2.42778 1.24834
+2.43333 1.24828
+2.43889 1.24822
+2.44444 1.24816
+2.45 1.2481
+2.45556 1.24804
+2.46111 1.24798
+2.46667 1.24792
+2.47222 1.24786
+2.47778 1.2478
+2.48333 1.24774
+2.48889 1.24768
+2.49444 1.24762
+2.5 1.24756
+2.50556 1.2475
+2.51111 1.24744
+2.51667 1.24738
+2.52222 1.24732
+2.52778 1.24726
+2.53333 1.2472
+2.53889 1.24714
+2.54444 1.24708
+2.55 1.24702
+2.55556 1.24697
+2.56111 1.24691
+2.56667 1.24685
+2.57222 1.24679
+2.57778 1.24673
+2.58333 1.24667
+2.58889 1.24661
+2.59444 1.24655
+2.6 1.24649
+2.60556 1.24643
+2.61111 1.24637
+2.61667 1.24631
+2.62222 1.24625
+2.62778 1.24619
+2.63333 1.24613
+2.63889 1.24607
+2.64444 1.24601
+2.65 1.24595
+2.65556 1.24588
+2.66111 1.24582
+2.66667 1.24576
+2.67222 1.2457
+2.67778 1.24564
+2.68333 1.24558
+2.68889 1.24552
+2.69444 1.24546
+2.7 1.2454
+2.70556 1.24534
+2.71111 1.24528
+2.71667 1.24522
+2.72222 1.24515
+2.72778 1.24509
+2.73333 1.24503
+2.73889 1.24497
+2.74444 1.24491
+2.75 1.24485
+2.75556 1.24478
+2.76111 1.24472
+2.76667 1.24466
+2.77222 1.2446
+2.77778 1.24454
+2.78333 1.24447
+2.78889 1.24441
+2.79444 1.24435
+2.8 1.24428
+2.80556 1.24422
+2.81111 1.24416
+2.81667 1.2441
+2.82222 1.24403
+2.82778 1.24397
+2.83333 1.24391
+2.83889 1.24384
+2.84444 1.24378
+2.85 1.24371
+2.85556 1.24365
+2.86111 1.24359
+2.86667 1.24352
+2.87222 1.24346
+2.87778 1.24339
+2.88333 1.24333
+2.88889 1.24326
+2.89444 1.2432
+2.9 1.24313
+2.90556 1.24307
+2.91111 1.243
+2.91667 1.24294
+2.92222 1.24287
+2.92778 1.2428
+2.93333 1.24274
+2.93889 1.24267
+2.94444 1.24261
+2.95 1.24254
+2.95556 1.24247
+2.96111 1.24241
+2.96667 1.24234
+2.97222 1.24227
+2.97778 1.2422
+2.98333 1.24214
+2.98889 1.24207
+2.99444 1.242
+3 1.24193
+3.00556 1.24186
+3.01111 1.24179
+3.01667 1.24172
+3.02222 1.24166
+3.02778 1.24159
+3.03333 1.24152
+3.03889 1.24145
+3.04444 1.24138
+3.05 1.24131
+3.05556 1.24124
+3.06111 1.24117
+3.06667 1.24109
+3.07222 1.24102
+3.07778 1.24095
+3.08333 1.24088
+3.08889 1.24081
+3.09444 1.24074
+3.1 1.24066
+3.10556 1.24059
+3.11111 1.24052
+3.11667 1.24045
+3.12222 1.24037
+3.12778 1.2403
+3.13333 1.24023
+3.13889 1.24015
+3.14444 1.24008
+3.15 1.24
+3.15556 1.23993
+3.16111 1.23985
+3.16667 1.23978
+3.17222 1.2397
+3.17778 1.23963
+3.18333 1.23955
+3.18889 1.23948
+3.19444 1.2394
+3.2 1.23932
+3.20556 1.23924
+3.21111 1.23917
+3.21667 1.23909
+3.22222 1.23901
+3.22778 1.23893
+3.23333 1.23885
+3.23889 1.23878
+3.24444 1.2387
+3.25 1.23862
+3.25556 1.23854
+3.26111 1.23846
+3.26667 1.23838
+3.27222 1.2383
+3.27778 1.23821
+3.28333 1.23813
+3.28889 1.23805
+3.29444 1.23797
+3.3 1.23789
+3.30556 1.2378
+3.31111 1.23772
+3.31667 1.23764
+3.32222 1.23755
+3.32778 1.23747
+3.33333 1.23739
+3.33889 1.2373
+3.34444 1.23722
+3.35 1.23713
+3.35556 1.23704
+3.36111 1.23696
+3.36667 1.23687
+3.37222 1.23678
+3.37778 1.2367
+3.38333 1.23661
+3.38889 1.23652
+3.39444 1.23643
+3.4 1.23634
+3.40556 1.23625
+3.41111 1.23616
+3.41667 1.23607
+3.42222 1.23598
+3.42778 1.23589
+3.43333 1.2358
+3.43889 1.23571
+3.44444 1.23562
+3.45 1.23552
+3.45556 1.23543
+3.46111 1.23534
+3.46667 1.23524
+3.47222 1.23515
+3.47778 1.23506
+3.48333 1.23496
+3.48889 1.23486
+3.49444 1.23477
+3.5 1.23467
+3.50556 1.23458
+3.51111 1.23448
+3.51667 1.23438
+3.52222 1.23428
+3.52778 1.23418
+3.53333 1.23408
+3.53889 1.23398
+3.54444 1.23388
+3.55 1.23378
+3.55556 1.23368
+3.56111 1.23358
+3.56667 1.23348
+3.57222 1.23337
+3.57778 1.23327
+3.58333 1.23317
+3.58889 1.23306
+3.59444 1.23296
+3.6 1.23285
+3.60556 1.23275
+3.61111 1.23264
+3.61667 1.23253
+3.62222 1.23242
+3.62778 1.23232
+3.63333 1.23221
+3.63889 1.2321
+3.64444 1.23199
+3.65 1.23188
+3.65556 1.23177
+3.66111 1.23165
+3.66667 1.23154
+3.67222 1.23143
+3.67778 1.23132
+3.68333 1.2312
+3.68889 1.23109
+3.69444 1.23097
+3.7 1.23085
+3.70556 1.23074
+3.71111 1.23062
+3.71667 1.2305
+3.72222 1.23038
+3.72778 1.23027
+3.73333 1.23015
+3.73889 1.23002
+3.74444 1.2299
+3.75 1.22978
+3.75556 1.22966
+3.76111 1.22954
+3.76667 1.22941
+3.77222 1.22929
+3.77778 1.22916
+3.78333 1.22904
+3.78889 1.22891
+3.79444 1.22878
+3.8 1.22865
+3.80556 1.22852
+3.81111 1.22839
+3.81667 1.22826
+3.82222 1.22813
+3.82778 1.228
+3.83333 1.22787
+3.83889 1.22773
+3.84444 1.2276
+3.85 1.22746
+3.85556 1.22733
+3.86111 1.22719
+3.86667 1.22705
+3.87222 1.22691
+3.87778 1.22677
+3.88333 1.22663
+3.88889 1.22649
+3.89444 1.22635
+3.9 1.22621
+3.90556 1.22606
+3.91111 1.22592
+3.91667 1.22577
+3.92222 1.22562
+3.92778 1.22548
+3.93333 1.22533
+3.93889 1.22518
+3.94444 1.22503
+3.95 1.22488
+3.95556 1.22472
+3.96111 1.22457
+3.96667 1.22442
+3.97222 1.22426
+3.97778 1.2241
+3.98333 1.22395
+3.98889 1.22379
+3.99444 1.22363
+4 1.22347
+4.00556 1.22331
+4.01111 1.22314
+4.01667 1.22298
+4.02222 1.22282
+4.02778 1.22265
+4.03333 1.22248
+4.03889 1.22231
+4.04444 1.22214
+4.05 1.22197
+4.05556 1.2218
+4.06111 1.22163
+4.06667 1.22145
+4.07222 1.22128
+4.07778 1.2211
+4.08333 1.22093
+4.08889 1.22075
+4.09444 1.22057
+4.1 1.22038
+4.10556 1.2202
+4.11111 1.22002
+4.11667 1.21983
+4.12222 1.21964
+4.12778 1.21946
+4.13333 1.21927
+4.13889 1.21907
+4.14444 1.21888
+4.15 1.21869
+4.15556 1.21849
+4.16111 1.2183
+4.16667 1.2181
+4.17222 1.2179
+4.17778 1.2177
+4.18333 1.21749
+4.18889 1.21729
+4.19444 1.21708
+4.2 1.21688
+4.20556 1.21667
+4.21111 1.21646
+4.21667 1.21625
+4.22222 1.21603
+4.22778 1.21582
+4.23333 1.2156
+4.23889 1.21538
+4.24444 1.21516
+4.25 1.21494
+4.25556 1.21471
+4.26111 1.21449
+4.26667 1.21426
+4.27222 1.21403
+4.27778 1.2138
+4.28333 1.21356
+4.28889 1.21333
+4.29444 1.21309
+4.3 1.21285
+4.30556 1.21261
+4.31111 1.21237
+4.31667 1.21212
+4.32222 1.21188
+4.32778 1.21163
+4.33333 1.21138
+4.33889 1.21112
+4.34444 1.21087
+4.35 1.21061
+4.35556 1.21035
+4.36111 1.21009
+4.36667 1.20982
+4.37222 1.20956
+4.37778 1.20929
+4.38333 1.20901
+4.38889 1.20874
+4.39444 1.20846
+4.4 1.20819
+4.40556 1.2079
+4.41111 1.20762
+4.41667 1.20733
+4.42222 1.20705
+4.42778 1.20675
+4.43333 1.20646
+4.43889 1.20616
+4.44444 1.20586
+4.45 1.20556
+4.45556 1.20525
+4.46111 1.20495
+4.46667 1.20464
+4.47222 1.20432
+4.47778 1.204
+4.48333 1.20368
+4.48889 1.20336
+4.49444 1.20304
+4.5 1.20271
+4.50556 1.20237
+4.51111 1.20204
+4.51667 1.2017
+4.52222 1.20136
+4.52778 1.20101
+4.53333 1.20066
+4.53889 1.20031
+4.54444 1.19995
+4.55 1.19959
+4.55556 1.19923
+4.56111 1.19886
+4.56667 1.19849
+4.57222 1.19811
+4.57778 1.19773
+4.58333 1.19735
+4.58889 1.19696
+4.59444 1.19657
+4.6 1.19618
+4.60556 1.19578
+4.61111 1.19538
+4.61667 1.19497
+4.62222 1.19455
+4.62778 1.19414
+4.63333 1.19372
+4.63889 1.19329
+4.64444 1.19286
+4.65 1.19242
+4.65556 1.19198
+4.66111 1.19154
+4.66667 1.19109
+4.67222 1.19063
+4.67778 1.19017
+4.68333 1.1897
+4.68889 1.18923
+4.69444 1.18875
+4.7 1.18827
+4.70556 1.18778
+4.71111 1.18729
+4.71667 1.18679
+4.72222 1.18628
+4.72778 1.18577
+4.73333 1.18525
+4.73889 1.18472
+4.74444 1.18419
+4.75 1.18365
+4.75556 1.18311
+4.76111 1.18256
+4.76667 1.182
+4.77222 1.18143
+4.77778 1.18086
+4.78333 1.18028
+4.78889 1.17969
+4.79444 1.17909
+4.8 1.17849
+4.80556 1.17788
+4.81111 1.17726
+4.81667 1.17663
+4.82222 1.17599
+4.82778 1.17535
+4.83333 1.17469
+4.83889 1.17403
+4.84444 1.17336
+4.85 1.17267
+4.85556 1.17198
+4.86111 1.17128
+4.86667 1.17057
+4.87222 1.16985
+4.87778 1.16911
+4.88333 1.16837
+4.88889 1.16762
+4.89444 1.16685
+4.9 1.16608
+4.90556 1.16529
+4.91111 1.16449
+4.91667 1.16368
+4.92222 1.16285
+4.92778 1.16201
+4.93333 1.16116
+4.93889 1.1603
+4.94444 1.15942
+4.95 1.15853
+4.95556 1.15762
+4.96111 1.1567
+4.96667 1.15576
+4.97222 1.15481
+4.97778 1.15384
+4.98333 1.15286
+4.98889 1.15186
+4.99444 1.15084
+5 1.14981
+5.00556 1.14875
+5.01111 1.14768
+5.01667 1.14659
+5.02222 1.14548
+5.02778 1.14435
+5.03333 1.1432
+5.03889 1.14203
+5.04444 1.14083
+5.05 1.13962
+5.05556 1.13838
+5.06111 1.13711
+5.06667 1.13583
+5.07222 1.13451
+5.07778 1.13317
+5.08333 1.13181
+5.08889 1.13042
+5.09444 1.129
+5.1 1.12755
+5.10556 1.12607
+5.11111 1.12456
+5.11667 1.12302
+5.12222 1.12144
+5.12778 1.11983
+5.13333 1.11819
+5.13889 1.11651
+5.14444 1.11479
+5.15 1.11303
+5.15556 1.11124
+5.16111 1.1094
+5.16667 1.10752
+5.17222 1.10559
+5.17778 1.10362
+5.18333 1.1016
+5.18889 1.09954
+5.19444 1.09742
+5.2 1.09525
+5.20556 1.09302
+5.21111 1.09073
+5.21667 1.08839
+5.22222 1.08598
+5.22778 1.08351
+5.23333 1.08097
+5.23889 1.07837
+5.24444 1.07569
+5.25 1.07293
+5.25556 1.0701
+5.26111 1.06718
+5.26667 1.06418
+5.27222 1.06108
+5.27778 1.0579
+5.28333 1.05461
+5.28889 1.05122
+5.29444 1.04773
+5.3 1.04412
+5.30556 1.04039
+5.31111 1.03653
+5.31667 1.03255
+5.32222 1.02843
+5.32778 1.02416
+e
+0 1.3856
+0.00555556 1.38016
+0.0111111 1.37573
+0.0166667 1.37201
+0.0222222 1.3687
+0.0277778 1.36564
+0.0333333 1.36273
+0.0388889 1.35993
+0.0444444 1.35722
+0.05 1.35459
+0.0555556 1.35203
+0.0611111 1.34953
+0.0666667 1.34708
+0.0722222 1.3447
+0.0777778 1.34237
+0.0833333 1.3401
+0.0888889 1.33789
+0.0944444 1.33572
+0.1 1.3336
+0.105556 1.33154
+0.111111 1.32952
+0.116667 1.32755
+0.122222 1.32563
+0.127778 1.32375
+0.133333 1.32191
+0.138889 1.32012
+0.144444 1.31837
+0.15 1.31666
+0.155556 1.31499
+0.161111 1.31336
+0.166667 1.31176
+0.172222 1.31021
+0.177778 1.30869
+0.183333 1.3072
+0.188889 1.30575
+0.194444 1.30433
+0.2 1.30295
+0.205556 1.30159
+0.211111 1.30027
+0.216667 1.29898
+0.222222 1.29772
+0.227778 1.29648
+0.233333 1.29528
+0.238889 1.2941
+0.244444 1.29295
+0.25 1.29182
+0.255556 1.29073
+0.261111 1.28965
+0.266667 1.2886
+0.272222 1.28757
+0.277778 1.28657
+0.283333 1.28559
+0.288889 1.28463
+0.294444 1.28369
+0.3 1.28278
+0.305556 1.28188
+0.311111 1.281
+0.316667 1.28015
+0.322222 1.27931
+0.327778 1.27849
+0.333333 1.27769
+0.338889 1.27691
+0.344444 1.27614
+0.35 1.27539
+0.355556 1.27466
+0.361111 1.27394
+0.366667 1.27324
+0.372222 1.27255
+0.377778 1.27188
+0.383333 1.27122
+0.388889 1.27057
+0.394444 1.26994
+0.4 1.26933
+0.405556 1.26872
+0.411111 1.26813
+0.416667 1.26755
+0.422222 1.26699
+0.427778 1.26643
+0.433333 1.26589
+0.438889 1.26535
+0.444444 1.26483
+0.45 1.26432
+0.455556 1.26382
+0.461111 1.26333
+0.466667 1.26285
+0.472222 1.26238
+0.477778 1.26192
+0.483333 1.26146
+0.488889 1.26102
+0.494444 1.26059
+0.5 1.26016
+0.505556 1.25974
+0.511111 1.25933
+0.516667 1.25893
+0.522222 1.25853
+0.527778 1.25814
+0.533333 1.25776
+0.538889 1.25739
+0.544444 1.25702
+0.55 1.25666
+0.555556 1.25631
+0.561111 1.25596
+0.566667 1.25562
+0.572222 1.25528
+0.577778 1.25495
+0.583333 1.25463
+0.588889 1.25431
+0.594444 1.254
+0.6 1.25369
+0.605556 1.25339
+0.611111 1.25309
+0.616667 1.25279
+0.622222 1.2525
+0.627778 1.25222
+0.633333 1.25194
+0.638889 1.25166
+0.644444 1.25139
+0.65 1.25113
+0.655556 1.25086
+0.661111 1.2506
+0.666667 1.25035
+0.672222 1.25009
+0.677778 1.24985
+0.683333 1.2496
+0.688889 1.24936
+0.694444 1.24912
+0.7 1.24888
+0.705556 1.24865
+0.711111 1.24842
+0.716667 1.24819
+0.722222 1.24797
+0.727778 1.24774
+0.733333 1.24752
+0.738889 1.24731
+0.744444 1.24709
+0.75 1.24688
+0.755556 1.24667
+0.761111 1.24646
+0.766667 1.24625
+0.772222 1.24605
+0.777778 1.24585
+0.783333 1.24565
+0.788889 1.24545
+0.794444 1.24525
+0.8 1.24505
+0.805556 1.24486
+0.811111 1.24467
+0.816667 1.24448
+0.822222 1.24429
+0.827778 1.2441
+0.833333 1.24391
+0.838889 1.24372
+0.844444 1.24354
+0.85 1.24336
+0.855556 1.24317
+0.861111 1.24299
+0.866667 1.24281
+0.872222 1.24263
+0.877778 1.24245
+0.883333 1.24227
+0.888889 1.2421
+0.894444 1.24192
+0.9 1.24174
+0.905556 1.24157
+0.911111 1.24139
+0.916667 1.24121
+0.922222 1.24104
+0.927778 1.24087
+0.933333 1.24069
+0.938889 1.24052
+0.944444 1.24034
+0.95 1.24017
+0.955556 1.24
+0.961111 1.23983
+0.966667 1.23965
+0.972222 1.23948
+0.977778 1.23931
+0.983333 1.23913
+0.988889 1.23896
+0.994444 1.23879
+1 1.23861
+1.00556 1.23844
+1.01111 1.23827
+1.01667 1.23809
+1.02222 1.23792
+1.02778 1.23774
+1.03333 1.23757
+1.03889 1.23739
+1.04444 1.23722
+1.05 1.23704
+1.05556 1.23686
+1.06111 1.23668
+1.06667 1.2365
+1.07222 1.23633
+1.07778 1.23615
+1.08333 1.23597
+1.08889 1.23578
+1.09444 1.2356
+1.1 1.23542
+1.10556 1.23523
+1.11111 1.23505
+1.11667 1.23486
+1.12222 1.23468
+1.12778 1.23449
+1.13333 1.2343
+1.13889 1.23411
+1.14444 1.23392
+1.15 1.23372
+1.15556 1.23353
+1.16111 1.23334
+1.16667 1.23314
+1.17222 1.23294
+1.17778 1.23274
+1.18333 1.23254
+1.18889 1.23234
+1.19444 1.23214
+1.2 1.23193
+1.20556 1.23172
+1.21111 1.23152
+1.21667 1.23131
+1.22222 1.23109
+1.22778 1.23088
+1.23333 1.23067
+1.23889 1.23045
+1.24444 1.23023
+1.25 1.23001
+1.25556 1.22979
+1.26111 1.22956
+1.26667 1.22933
+1.27222 1.22911
+1.27778 1.22887
+1.28333 1.22864
+1.28889 1.2284
+1.29444 1.22817
+1.3 1.22793
+1.30556 1.22768
+1.31111 1.22744
+1.31667 1.22719
+1.32222 1.22694
+1.32778 1.22669
+1.33333 1.22643
+1.33889 1.22617
+1.34444 1.22591
+1.35 1.22565
+1.35556 1.22538
+1.36111 1.22511
+1.36667 1.22484
+1.37222 1.22456
+1.37778 1.22428
+1.38333 1.224
+1.38889 1.22371
+1.39444 1.22342
+1.4 1.22313
+1.40556 1.22283
+1.41111 1.22253
+1.41667 1.22223
+1.42222 1.22192
+1.42778 1.22161
+1.43333 1.22129
+1.43889 1.22097
+1.44444 1.22065
+1.45 1.22032
+1.45556 1.21999
+1.46111 1.21965
+1.46667 1.21931
+1.47222 1.21896
+1.47778 1.21861
+1.48333 1.21826
+1.48889 1.2179
+1.49444 1.21753
+1.5 1.21716
+1.50556 1.21678
+1.51111 1.2164
+1.51667 1.21601
+1.52222 1.21562
+1.52778 1.21522
+1.53333 1.21482
+1.53889 1.21441
+1.54444 1.21399
+1.55 1.21357
+1.55556 1.21314
+1.56111 1.2127
+1.56667 1.21226
+1.57222 1.2118
+1.57778 1.21135
+1.58333 1.21088
+1.58889 1.21041
+1.59444 1.20993
+1.6 1.20944
+1.60556 1.20894
+1.61111 1.20844
+1.61667 1.20792
+1.62222 1.2074
+1.62778 1.20687
+1.63333 1.20633
+1.63889 1.20578
+1.64444 1.20521
+1.65 1.20464
+1.65556 1.20406
+1.66111 1.20347
+1.66667 1.20287
+1.67222 1.20225
+1.67778 1.20163
+1.68333 1.20099
+1.68889 1.20034
+1.69444 1.19967
+1.7 1.199
+1.70556 1.19831
+1.71111 1.1976
+1.71667 1.19688
+1.72222 1.19615
+1.72778 1.1954
+1.73333 1.19464
+1.73889 1.19386
+1.74444 1.19306
+1.75 1.19224
+1.75556 1.19141
+1.76111 1.19056
+1.76667 1.18969
+1.77222 1.1888
+1.77778 1.18789
+1.78333 1.18695
+1.78889 1.186
+1.79444 1.18502
+1.8 1.18402
+1.80556 1.18299
+1.81111 1.18194
+1.81667 1.18087
+1.82222 1.17976
+1.82778 1.17863
+1.83333 1.17746
+1.83889 1.17627
+1.84444 1.17504
+1.85 1.17378
+1.85556 1.17249
+1.86111 1.17116
+1.86667 1.16979
+1.87222 1.16838
+1.87778 1.16693
+1.88333 1.16544
+1.88889 1.1639
+1.89444 1.16232
+1.9 1.16069
+1.90556 1.159
+1.91111 1.15726
+1.91667 1.15547
+1.92222 1.15361
+1.92778 1.1517
+1.93333 1.14971
+1.93889 1.14766
+1.94444 1.14554
+1.95 1.14334
+1.95556 1.14105
+1.96111 1.13869
+1.96667 1.13623
+1.97222 1.13367
+1.97778 1.13102
+1.98333 1.12825
+1.98889 1.12538
+1.99444 1.12238
+2 1.11925
+2.00556 1.11598
+2.01111 1.11257
+2.01667 1.109
+2.02222 1.10525
+2.02778 1.10133
+2.03333 1.09722
+2.03889 1.09289
+2.04444 1.08834
+2.05 1.08355
+2.05556 1.07849
+2.06111 1.07315
+2.06667 1.06749
+2.07222 1.0615
+2.07778 1.05513
+2.08333 1.04836
+2.08889 1.04114
+2.09444 1.03343
+2.1 1.02518
+2.10556 1.01632
+2.11111 1.00679
+2.11667 0.996504
+2.12222 0.985375
+2.12778 0.973293
+2.13333 0.960129
+e
@@ -0,0 +1,170 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "802.15.4-ber.eps"
+set xlabel "SNR (dB)"
+set ylabel "Bit Error Rate (BER)"
+set xrange [-10:15]
+set yrange [1e-9:1]
+set log y
+set grid
+set style line 1 linewidth 5
+set style line 2 linewidth 5
+set style line 3 linewidth 5
+set style line 4 linewidth 5
+set style line 5 linewidth 5
+set style line 6 linewidth 5
+set style line 7 linewidth 5
+set style line 8 linewidth 5
+set style increment user
+plot "-"  title "802.15.4" with lines
+-10 0.322051
+-9.9 0.318007
+-9.8 0.313893
+-9.7 0.309708
+-9.6 0.305454
+-9.5 0.30113
+-9.4 0.296737
+-9.3 0.292277
+-9.2 0.28775
+-9.1 0.283157
+-9 0.278499
+-8.9 0.273778
+-8.8 0.268995
+-8.7 0.264153
+-8.6 0.259252
+-8.5 0.254296
+-8.4 0.249286
+-8.3 0.244225
+-8.2 0.239115
+-8.1 0.233959
+-8 0.228761
+-7.9 0.223524
+-7.8 0.21825
+-7.7 0.212945
+-7.6 0.20761
+-7.5 0.202252
+-7.4 0.196873
+-7.3 0.191478
+-7.2 0.186072
+-7.1 0.18066
+-7 0.175246
+-6.9 0.169836
+-6.8 0.164435
+-6.7 0.159048
+-6.6 0.15368
+-6.5 0.148338
+-6.4 0.143027
+-6.3 0.137753
+-6.2 0.132522
+-6.1 0.127339
+-6 0.12221
+-5.9 0.117142
+-5.8 0.11214
+-5.7 0.10721
+-5.6 0.102357
+-5.5 0.0975878
+-5.4 0.0929069
+-5.3 0.0883198
+-5.2 0.0838317
+-5.1 0.0794475
+-5 0.0751716
+-4.9 0.0710084
+-4.8 0.0669621
+-4.7 0.0630362
+-4.6 0.0592342
+-4.5 0.0555591
+-4.4 0.0520134
+-4.3 0.0485994
+-4.2 0.045319
+-4.1 0.0421733
+-4 0.0391635
+-3.9 0.0362898
+-3.8 0.0335525
+-3.7 0.030951
+-3.6 0.0284845
+-3.5 0.0261516
+-3.4 0.0239508
+-3.3 0.0218798
+-3.2 0.0199361
+-3.1 0.0181168
+-3 0.0164186
+-2.9 0.0148381
+-2.8 0.0133713
+-2.7 0.0120141
+-2.6 0.0107621
+-2.5 0.00961084
+-2.4 0.00855559
+-2.3 0.00759151
+-2.2 0.0067137
+-2.1 0.00591719
+-2 0.005197
+-1.9 0.00454817
+-1.8 0.0039658
+-1.7 0.00344505
+-1.6 0.00298122
+-1.5 0.00256971
+-1.4 0.00220611
+-1.3 0.00188618
+-1.2 0.00160586
+-1.1 0.00136132
+-1 0.00114894
+-0.9 0.000965332
+-0.8 0.000807328
+-0.7 0.000672007
+-0.6 0.000556674
+-0.5 0.000458865
+-0.4 0.000376337
+-0.3 0.000307064
+-0.2 0.000249225
+-0.1 0.000201194
+-1.87905e-14 0.000161527
+0.1 0.000128953
+0.2 0.000102357
+0.3 8.0771e-05
+0.4 6.33556e-05
+0.5 4.93914e-05
+0.6 3.82646e-05
+0.7 2.94553e-05
+0.8 2.25264e-05
+0.9 1.71128e-05
+1 1.29119e-05
+1.1 9.67459e-06
+1.2 7.1976e-06
+1.3 5.31604e-06
+1.4 3.89733e-06
+1.5 2.83567e-06
+1.6 2.04731e-06
+1.7 1.46649e-06
+1.8 1.04201e-06
+1.9 7.34314e-07
+2 5.13139e-07
+2.1 3.55511e-07
+2.2 2.44149e-07
+2.3 1.66172e-07
+2.4 1.12067e-07
+2.5 7.48738e-08
+2.6 4.95476e-08
+2.7 3.24688e-08
+2.8 2.10653e-08
+2.9 1.35279e-08
+3 8.59719e-09
+3.1 5.40562e-09
+3.2 3.36198e-09
+3.3 2.06775e-09
+3.4 1.25732e-09
+3.5 7.5566e-10
+3.6 4.48773e-10
+3.7 2.63287e-10
+3.8 1.5255e-10
+3.9 8.72677e-11
+4 4.9275e-11
+4.1 2.74538e-11
+4.2 1.50885e-11
+4.3 8.17757e-12
+4.4 4.36917e-12
+4.5 2.30049e-12
+4.6 1.19327e-12
+4.7 6.09512e-13
+4.8 3.06533e-13
+4.9 1.51656e-13
+5 7.38298e-14
+e
@@ -0,0 +1,9 @@
+set terminal png
+set output "time-probe-example.png"
+set title "Emitter interarrivals vs. Time \n\nTrace Source Path: /Names/Emitter/Interval"
+set xlabel "Simulation time (Seconds)"
+set ylabel "Interarrival time (Seconds)"
+
+set key inside
+set datafile missing "-nan"
+plot "time-probe-example.dat" index 0 title "Emitter Interarrival Time" with linespoints
@@ -0,0 +1,3 @@
+#!/bin/sh
+
+gnuplot time-probe-example.plt
@@ -19,12 +19,29 @@
 
 #include "default-simulator-impl.h"
 
+#include "abort.h"
 #include "assert.h"
+#include "boolean.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
+#include "string.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#if (__GNUC__ >= 3)
+#include <cxxabi.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <dlfcn.h>
+#endif
 
 /**
  * \file
@@ -48,7 +65,21 @@ DefaultSimulatorImpl::GetTypeId()
     static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
                             .SetParent<SimulatorImpl>()
                             .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+                            .AddConstructor<DefaultSimulatorImpl>()
+                            .AddAttribute("EventProfile",
+                                          "Count the events and their wall time by TypeId and "
+                                          "method, and print them at Simulator::Destroy.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(
+                                              &DefaultSimulatorImpl::m_eventProfile),
+                                          MakeBooleanChecker())
+                            .AddAttribute("EventProfileFile",
+                                          "The file of the event profile, the standard output "
+                                          "if empty.",
+                                          StringValue(""),
+                                          MakeStringAccessor(
+                                              &DefaultSimulatorImpl::m_eventProfileFile),
+                                          MakeStringChecker());
     return tid;
 }
 
@@ -64,6 +95,7 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_eventCount = 0;
     m_eventsWithContextEmpty = true;
     m_mainThreadId = std::this_thread::get_id();
+    m_eventProfile = false;
 }
 
 DefaultSimulatorImpl::~DefaultSimulatorImpl()
@@ -100,6 +132,22 @@ DefaultSimulatorImpl::Destroy()
             ev->Invoke();
         }
     }
+
+    if (m_eventProfileEntries.empty())
+    {
+        return;
+    }
+    if (m_eventProfileFile.empty())
+    {
+        PrintEventProfile(std::cout);
+    }
+    else
+    {
+        std::ofstream os(m_eventProfileFile);
+        NS_ABORT_MSG_UNLESS(os.is_open(),
+                            "Unable to open the event profile file " << m_eventProfileFile);
+        PrintEventProfile(os);
+    }
 }
 
 void
@@ -141,12 +189,129 @@ DefaultSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    if (m_eventProfile)
+    {
+        InvokeProfiled(next.impl);
+    }
+    else
+    {
+        next.impl->Invoke();
+    }
     next.impl->Unref();
 
     ProcessEventsWithContext();
 }
 
+void
+DefaultSimulatorImpl::InvokeProfiled(EventImpl* event)
+{
+    // The object of a cancelled event may be gone: its site is unknown.
+    EventProfileKey key{0, nullptr, nullptr, {}};
+    if (!event->IsCancelled())
+    {
+        EventSite site = event->GetSite();
+        key = EventProfileKey{site.object ? site.object->GetInstanceTypeId().GetUid() : 0,
+                              site.type,
+                              site.function,
+                              site.method};
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    event->Invoke();
+    auto end = std::chrono::steady_clock::now();
+
+    EventProfileEntry& entry = m_eventProfileEntries[key];
+    entry.events++;
+    entry.wallNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+/**
+ * Get the name of a type or symbol.
+ *
+ * \param [in] mangled The mangled name.
+ * \returns The demangled name, or the mangled one if it cannot be demangled.
+ */
+static std::string
+DemangleEventSite(const char* mangled)
+{
+    std::string name = mangled;
+#if (__GNUC__ >= 3)
+    int status;
+    char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    if (status == 0)
+    {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif
+    return name;
+}
+
+void
+DefaultSimulatorImpl::PrintEventProfile(std::ostream& os) const
+{
+    std::vector<std::pair<EventProfileKey, EventProfileEntry>> entries(
+        m_eventProfileEntries.begin(),
+        m_eventProfileEntries.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.second.wallNs > b.second.wallNs;
+    });
+    uint64_t events = 0;
+    uint64_t wallNs = 0;
+    for (const auto& entry : entries)
+    {
+        events += entry.second.events;
+        wallNs += entry.second.wallNs;
+    }
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << "Event profile: " << events << " events, " << wallNs * 1e-9 << " s" << std::endl;
+    os << std::setw(12) << "events" << std::setw(8) << "%" << std::setw(12) << "wall (s)"
+       << std::setw(8) << "%" << std::setw(10) << "ns/event"
+       << "  TypeId  method" << std::endl;
+    // The methods of a TypeId with the same signature and no symbol are
+    // numbered, in the order of their wall time.
+    std::map<std::pair<uint16_t, const std::type_info*>, uint32_t> methods;
+    for (const auto& [key, entry] : entries)
+    {
+        const auto& [uid, type, function, bytes] = key;
+        std::string typeId = uid ? TypeId::GetRegistered(uid - 1).GetName() : "-";
+        std::string method = "(cancelled)";
+        bool named = false;
+#if defined(__unix__) || defined(__APPLE__)
+        // The symbol of the function or method, if exported by its library;
+        // not the closest symbol before an unexported one.
+        Dl_info info;
+        if (function && dladdr(function, &info) && info.dli_sname && info.dli_saddr == function)
+        {
+            method = DemangleEventSite(info.dli_sname);
+            named = true;
+        }
+#endif
+        if (type && !named)
+        {
+            method = DemangleEventSite(type->name());
+            if (bytes != decltype(bytes){})
+            {
+                uint32_t index = methods[{uid, type}]++;
+                if (index)
+                {
+                    method += " #" + std::to_string(index + 1);
+                }
+            }
+        }
+        os << std::setw(12) << entry.events << std::setw(8) << std::fixed << std::setprecision(2)
+           << 100.0 * entry.events / events << std::setw(12) << std::setprecision(6)
+           << entry.wallNs * 1e-9 << std::setw(8) << std::setprecision(2)
+           << (wallNs ? 100.0 * entry.wallNs / wallNs : 0) << std::setw(10) << std::setprecision(0)
+           << double(entry.wallNs) / entry.events << "  " << typeId << "  " << method
+           << std::endl;
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
 bool
 DefaultSimulatorImpl::IsFinished() const
 {
@@ -23,8 +23,13 @@
 #include "simulator-impl.h"
 
 #include <list>
+#include <map>
 #include <mutex>
+#include <ostream>
+#include <string>
 #include <thread>
+#include <tuple>
+#include <typeinfo>
 
 /**
  * \file
@@ -42,6 +47,15 @@ class Scheduler;
  * \ingroup simulator
  *
  * The default single process simulator implementation.
+ *
+ * With the EventProfile attribute, the executed events are attributed to
+ * the TypeId of the object they are bound to and to their method or
+ * function, see EventImpl::GetSite(), and the number of events and their
+ * wall time by TypeId and method are printed at Simulator::Destroy().
+ * Functions and methods are printed by name, if their library exports it,
+ * the methods being resolved with the Itanium C++ ABI of GCC and Clang;
+ * otherwise by signature, numbered when a TypeId has several methods of the
+ * same signature.
  */
 class DefaultSimulatorImpl : public SimulatorImpl
 {
@@ -78,6 +92,15 @@ class DefaultSimulatorImpl : public SimulatorImpl
     uint32_t GetContext() const override;
     uint64_t GetEventCount() const override;
 
+    /**
+     * Print the event profile: the number of events and their wall time by
+     * TypeId and method, from the most expensive. Empty without the
+     * EventProfile attribute.
+     *
+     * \param [in] os The output stream.
+     */
+    void PrintEventProfile(std::ostream& os) const;
+
   private:
     void DoDispose() override;
 
@@ -85,6 +108,11 @@ class DefaultSimulatorImpl : public SimulatorImpl
     void ProcessOneEvent();
     /** Move events from a different context into the main event queue. */
     void ProcessEventsWithContext();
+    /**
+     * Invoke an event and add it to the event profile.
+     * \param [in] event The event.
+     */
+    void InvokeProfiled(EventImpl* event);
 
     /** Wrap an event with its execution context. */
     struct EventWithContext
@@ -136,6 +164,30 @@ class DefaultSimulatorImpl : public SimulatorImpl
 
     /** Main execution thread. */
     std::thread::id m_mainThreadId;
+
+    /**
+     * An event profile bucket: the TypeId uid of the object, or 0, then the
+     * type, function and pointer to member function bytes of the EventSite.
+     */
+    typedef std::tuple<uint16_t,
+                       const std::type_info*,
+                       const void*,
+                       decltype(EventSite::method)>
+        EventProfileKey;
+
+    /** The events of a bucket of the event profile. */
+    struct EventProfileEntry
+    {
+        uint64_t events{0}; //!< The number of events
+        uint64_t wallNs{0}; //!< The wall time of the events, in nanoseconds
+    };
+
+    /** Whether to profile the events. */
+    bool m_eventProfile;
+    /** The file of the event profile printed at Destroy, the standard output if empty. */
+    std::string m_eventProfileFile;
+    /** The event profile. */
+    std::map<EventProfileKey, EventProfileEntry> m_eventProfileEntries;
 };
 
 } // namespace ns3
@@ -19,8 +19,11 @@
 
 #include "event-impl.h"
 
+#include "assert.h"
 #include "log.h"
 
+#include <cstring>
+
 /**
  * \file
  * \ingroup events
@@ -67,4 +70,51 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+EventSite
+EventImpl::GetSite() const
+{
+    EventSite site;
+    site.type = &typeid(*this);
+    return site;
+}
+
+void
+EventSite::SetMethod(const void* method, std::size_t size, const void* object)
+{
+    NS_ASSERT_MSG(size <= this->method.size(), "Pointer to member function too large");
+    std::memcpy(this->method.data(), method, size);
+#if defined(__GNUC__) && !defined(_MSC_VER)
+    // Itanium C++ ABI: the address of the function, or 1 + the vtable offset
+    // of a virtual method, then the adjustment of this. On ARM, the vtable
+    // offset is not incremented and the adjustment, doubled, carries the
+    // virtual flag.
+    uintptr_t ptr;
+    intptr_t adj;
+    if (size != sizeof(ptr) + sizeof(adj))
+    {
+        return;
+    }
+    std::memcpy(&ptr, method, sizeof(ptr));
+    std::memcpy(&adj, static_cast<const char*>(method) + sizeof(ptr), sizeof(adj));
+#if defined(__arm__) || defined(__aarch64__)
+    bool isVirtual = adj & 1;
+    uintptr_t offset = ptr;
+    adj >>= 1;
+#else
+    bool isVirtual = ptr & 1;
+    uintptr_t offset = ptr - 1;
+#endif
+    if (!isVirtual)
+    {
+        function = reinterpret_cast<const void*>(ptr);
+    }
+    else if (object)
+    {
+        const char* self = static_cast<const char*>(object) + adj;
+        const char* vtable = *reinterpret_cast<const char* const*>(self);
+        function = *reinterpret_cast<const void* const*>(vtable + offset);
+    }
+#endif
+}
+
 } // namespace ns3
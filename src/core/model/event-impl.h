@@ -21,7 +21,10 @@
 
 #include "simple-ref-count.h"
 
+#include <array>
+#include <cstddef>
 #include <stdint.h>
+#include <typeinfo>
 
 /**
  * \file
@@ -32,6 +35,40 @@
 namespace ns3
 {
 
+class ObjectBase;
+
+/**
+ * \ingroup events
+ * \brief The function of an event and the object it is bound to.
+ *
+ * Identifies what an event runs, to attribute the events to the models in
+ * the event profile of DefaultSimulatorImpl. The object is only valid until
+ * the event is invoked or cancelled.
+ */
+struct EventSite
+{
+    const ObjectBase* object{nullptr};   //!< The object of a method, if an ObjectBase
+    const std::type_info* type{nullptr}; //!< The type of the function, method or lambda
+    const void* function{nullptr};       //!< The address of the function or method, if known
+    /**
+     * The bytes of a pointer to member function, which tell apart the methods
+     * of the same type when their address is unknown.
+     */
+    std::array<unsigned char, 4 * sizeof(void*)> method{};
+
+    /**
+     * Set the method from a pointer to member function. Its bytes are
+     * copied, and the address of the method is resolved with the Itanium
+     * C++ ABI, the one of GCC and Clang; through the vtable of the object
+     * for a virtual method.
+     *
+     * \param [in] method The pointer to member function
+     * \param [in] size The size of the pointer to member function
+     * \param [in] object The object, as the class of the method, or nullptr
+     */
+    void SetMethod(const void* method, std::size_t size, const void* object);
+};
+
 /**
  * \ingroup events
  * \brief A simulation event.
@@ -66,6 +103,16 @@ class EventImpl : public SimpleRefCount<EventImpl>
      * Checked by the simulation engine before calling Invoke().
      */
     bool IsCancelled();
+    /**
+     * Get the function of the event and the object it is bound to. Only
+     * called by the simulation engine before calling Invoke(), when the
+     * object of a method is still alive.
+     *
+     * The default site is the type of the subclass.
+     *
+     * \returns The site of the event.
+     */
+    virtual EventSite GetSite() const;
 
   protected:
     /**
@@ -24,6 +24,8 @@
 #include <functional>
 #include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
 
 /**
  * \file
@@ -35,6 +37,7 @@ namespace ns3
 {
 
 class EventImpl;
+class ObjectBase;
 
 /**
  * \ingroup events
@@ -137,6 +140,97 @@ struct EventMemberImplObjTraits<T*>
     }
 };
 
+/**
+ * \ingroup events
+ * Helper for the MakeEvent functions which take a class method.
+ *
+ * Whether the object argument is a pointer, raw or smart.
+ *
+ * \tparam T \explicit The type of the object argument.
+ */
+template <typename T, typename = void>
+struct IsEventObjPointer : std::false_type
+{
+};
+
+/**
+ * \ingroup events
+ * Helper for the MakeEvent functions which take a class method.
+ *
+ * The specialization for the types with a dereference operator.
+ *
+ * \tparam T \explicit The type of the object argument.
+ */
+template <typename T>
+struct IsEventObjPointer<T, std::void_t<decltype(*std::declval<const T&>())>> : std::true_type
+{
+};
+
+/**
+ * \ingroup events
+ * Helper for the MakeEvent functions which take a class method.
+ *
+ * The class of a pointer to member.
+ *
+ * \tparam MEM \explicit The type of the pointer to member.
+ */
+template <typename MEM>
+struct EventMemberClass
+{
+};
+
+/**
+ * \ingroup events
+ * Helper for the MakeEvent functions which take a class method.
+ *
+ * The specialization for the pointers to member, functions included.
+ *
+ * \tparam R \deduced The type of the member.
+ * \tparam C \deduced The class of the member.
+ */
+template <typename R, typename C>
+struct EventMemberClass<R C::*>
+{
+    using type = C; //!< The class of the member
+};
+
+/**
+ * \ingroup events
+ * Helper for the MakeEvent functions which take a class method: get the
+ * site of the event.
+ *
+ * \tparam MEM \deduced The class method function signature.
+ * \tparam OBJ \deduced The class type holding the method.
+ * \param [in] mem_ptr Class method member function pointer.
+ * \param [in] obj Class instance.
+ * \returns The site of the event.
+ */
+template <typename MEM, typename OBJ>
+EventSite
+GetEventMemberSite(const MEM& mem_ptr, const OBJ& obj)
+{
+    static_assert(sizeof(MEM) <= sizeof(EventSite::method), "Pointer to member too large");
+    EventSite site;
+    site.type = &typeid(MEM);
+    // The object, as the class of the method, resolves the virtual methods.
+    const void* self = nullptr;
+    if constexpr (IsEventObjPointer<OBJ>::value)
+    {
+        using T = std::remove_cv_t<std::remove_reference_t<decltype(*obj)>>;
+        if constexpr (std::is_convertible_v<T*, const ObjectBase*>)
+        {
+            site.object = &*obj;
+        }
+        using C = typename EventMemberClass<MEM>::type;
+        if constexpr (std::is_convertible_v<T*, const C*>)
+        {
+            self = static_cast<const C*>(&*obj);
+        }
+    }
+    site.SetMethod(&mem_ptr, sizeof(mem_ptr), self);
+    return site;
+}
+
 } // namespace internal
 
 template <typename MEM, typename OBJ, typename... Ts>
@@ -149,8 +243,15 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
         EventMemberImpl() = delete;
 
         EventMemberImpl(OBJ obj, MEM function, Ts... args)
-            : m_function(std::bind(function, obj, args...))
+            : m_obj(obj),
+              m_function(function),
+              m_arguments(args...)
+        {
+        }
+
+        EventSite GetSite() const override
         {
+            return internal::GetEventMemberSite(m_function, m_obj);
         }
 
       protected:
@@ -161,10 +262,14 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
       private:
         void Notify() override
         {
-            m_function();
+            // The arguments are passed as lvalues, as std::bind does.
+            std::apply([this](auto&... args) { std::invoke(m_function, m_obj, args...); },
+                       m_arguments);
         }
 
-        std::function<void()> m_function;
+        OBJ m_obj;
+        MEM m_function;
+        std::tuple<std::remove_reference_t<Ts>...> m_arguments;
     }* ev = new EventMemberImpl(obj, mem_ptr, args...);
 
     return ev;
@@ -183,6 +288,14 @@ MakeEvent(void (*f)(Us...), Ts... args)
         {
         }
 
+        EventSite GetSite() const override
+        {
+            EventSite site;
+            site.type = &typeid(m_function);
+            site.function = reinterpret_cast<const void*>(m_function);
+            return site;
+        }
+
       protected:
         ~EventFunctionImpl() override
         {
@@ -213,6 +326,13 @@ MakeEvent(T function)
         {
         }
 
+        EventSite GetSite() const override
+        {
+            EventSite site;
+            site.type = &typeid(T);
+            return site;
+        }
+
         ~EventImplFunctional() override
         {
         }
@@ -0,0 +1,678 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "abort.h"
+#include "assert.h"
+#include "boolean.h"
+#include "log.h"
+#include "simulator.h"
+#include "uinteger.h"
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+namespace
+{
+
+/**
+ * \ingroup simulator
+ * The logical process running on the current thread, nullptr outside the
+ * windows.
+ */
+thread_local void* g_currentLp = nullptr;
+
+} // unnamed namespace
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("LogicalProcesses",
+                          "The number of logical processes.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::m_lpCount),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("Lookahead",
+                          "The minimum delay of the events scheduled for another logical process.",
+                          TimeValue(Time(0)),
+                          MakeTimeAccessor(&MultithreadedSimulatorImpl::m_lookahead),
+                          MakeTimeChecker())
+            .AddAttribute("Threaded",
+                          "Whether each logical process runs on its own thread, or all of them "
+                          "run each window in turn on the thread calling Simulator::Run().",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&MultithreadedSimulatorImpl::m_threaded),
+                          MakeBooleanChecker());
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+    m_lpCount = 1;
+    m_threaded = true;
+    m_contextLpsChanged = false;
+    m_running = false;
+    m_exchanging = false;
+    m_stop = false;
+    m_stopTs = std::numeric_limits<uint64_t>::max();
+    m_currentTs = 0;
+    m_windowEnd = 0;
+    m_windowCount = 0;
+    m_windowNumber = 0;
+    m_busy = 0;
+    m_exit = false;
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::NotifyConstructionCompleted()
+{
+    NS_LOG_FUNCTION(this);
+    for (uint32_t i = 0; i < m_lpCount; i++)
+    {
+        auto lp = std::make_unique<LogicalProcess>();
+        lp->index = i;
+        lp->uid = 0;
+        lp->currentUid = EventId::UID::INVALID;
+        lp->currentTs = 0;
+        lp->currentContext = Simulator::NO_CONTEXT;
+        lp->eventCount = 0;
+        lp->stop = false;
+        m_lps.push_back(std::move(lp));
+    }
+    SimulatorImpl::NotifyConstructionCompleted();
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& lp : m_lps)
+    {
+        for (Scheduler::Event& ev : lp->inbox)
+        {
+            ev.impl->Unref();
+        }
+        lp->inbox.clear();
+        if (lp->events)
+        {
+            while (!lp->events->IsEmpty())
+            {
+                Scheduler::Event next = lp->events->RemoveNext();
+                next.impl->Unref();
+            }
+        }
+    }
+    m_lps.clear();
+    m_exchange = MakeNullCallback<void>();
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    m_schedulerFactory = schedulerFactory;
+    for (auto& lp : m_lps)
+    {
+        Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler>();
+        if (lp->events)
+        {
+            while (!lp->events->IsEmpty())
+            {
+                scheduler->Insert(lp->events->RemoveNext());
+            }
+        }
+        lp->events = scheduler;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetLogicalProcess(uint32_t context, uint32_t lp)
+{
+    NS_LOG_FUNCTION(this << context << lp);
+    NS_ASSERT_MSG(!m_running, "Logical processes cannot be mapped while the simulation runs");
+    NS_ASSERT_MSG(lp < m_lpCount, "Logical process " << lp << " out of range");
+    NS_ASSERT_MSG(context != Simulator::NO_CONTEXT, "Events without context run on process 0");
+    if (context >= m_contextLps.size())
+    {
+        m_contextLps.resize(context + 1, 0);
+    }
+    m_contextLps[context] = lp;
+    m_contextLpsChanged = true;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetLogicalProcess(uint32_t context) const
+{
+    return context < m_contextLps.size() ? m_contextLps[context] : 0;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetWindowCount() const
+{
+    return m_windowCount;
+}
+
+void
+MultithreadedSimulatorImpl::SetExchangeCallback(Callback<void> exchange)
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!m_running, "The exchange callback cannot be set while the simulation runs");
+    m_exchange = exchange;
+}
+
+MultithreadedSimulatorImpl::LogicalProcess*
+MultithreadedSimulatorImpl::GetCurrent() const
+{
+    return static_cast<LogicalProcess*>(g_currentLp);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    // Keeps the packet uids, allocated per thread, unique.
+    LogicalProcess* current = GetCurrent();
+    return current ? current->index : 0;
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    for (const auto& lp : m_lps)
+    {
+        if (!lp->events->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+EventId
+MultithreadedSimulatorImpl::Insert(uint64_t ts, uint32_t context, EventImpl* event)
+{
+    LogicalProcess* current = GetCurrent();
+    NS_ASSERT_MSG(!m_running || current || m_exchanging,
+                  "Thread-unsafe invocation of the simulator");
+    LogicalProcess* target = m_lps[GetLogicalProcess(context)].get();
+
+    // The uids of the events scheduled by a logical process interleave with
+    // the others, so that they do not depend on the thread timings.
+    LogicalProcess* source = current ? current : target;
+    uint64_t uid = EventId::UID::VALID + uint64_t(source->uid) * m_lpCount + source->index;
+    NS_ABORT_MSG_IF(uid > std::numeric_limits<uint32_t>::max(), "Event uid overflow");
+    source->uid++;
+
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = context;
+    ev.key.m_uid = static_cast<uint32_t>(uid);
+    if (current == nullptr || current == target)
+    {
+        target->events->Insert(ev);
+    }
+    else
+    {
+        NS_ASSERT_MSG(ts >= m_windowEnd,
+                      "Event for logical process " << target->index << " scheduled at " << ts
+                                                   << ", before the lookahead");
+        std::unique_lock lock{target->inboxMutex};
+        target->inbox.push_back(ev);
+    }
+    return EventId(event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::MoveEvents()
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<Scheduler::Event> events;
+    for (auto& lp : m_lps)
+    {
+        while (!lp->events->IsEmpty())
+        {
+            events.push_back(lp->events->RemoveNext());
+        }
+    }
+    for (const Scheduler::Event& ev : events)
+    {
+        m_lps[GetLogicalProcess(ev.key.m_context)]->events->Insert(ev);
+    }
+    m_contextLpsChanged = false;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessInboxes()
+{
+    for (auto& lp : m_lps)
+    {
+        std::unique_lock lock{lp->inboxMutex};
+        for (const Scheduler::Event& ev : lp->inbox)
+        {
+            lp->events->Insert(ev);
+        }
+        lp->inbox.clear();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow(LogicalProcess* lp)
+{
+    g_currentLp = lp;
+    while (!lp->stop && !lp->events->IsEmpty())
+    {
+        uint64_t ts = lp->events->PeekNext().key.m_ts;
+        // The stop of another logical process ends the window at its time.
+        if (ts >= m_windowEnd || ts > m_stopTs)
+        {
+            break;
+        }
+        Scheduler::Event next = lp->events->RemoveNext();
+
+        PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
+
+        NS_ASSERT(next.key.m_ts >= lp->currentTs);
+        lp->eventCount++;
+
+        lp->currentTs = next.key.m_ts;
+        lp->currentContext = next.key.m_context;
+        lp->currentUid = next.key.m_uid;
+        // The next events scheduled at the same time must follow this one.
+        uint32_t counter = (next.key.m_uid - EventId::UID::VALID) / m_lpCount + 1;
+        lp->uid = std::max(lp->uid, counter);
+        next.impl->Invoke();
+        next.impl->Unref();
+    }
+    g_currentLp = nullptr;
+}
+
+void
+MultithreadedSimulatorImpl::RunThread(LogicalProcess* lp)
+{
+    uint64_t window = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock{m_windowMutex};
+            m_windowStart.wait(lock, [&] { return m_exit || m_windowNumber != window; });
+            if (m_exit)
+            {
+                return;
+            }
+            window = m_windowNumber;
+        }
+        ProcessWindow(lp);
+        {
+            std::unique_lock lock{m_windowMutex};
+            if (--m_busy == 0)
+            {
+                m_windowDone.notify_one();
+            }
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_exchange.IsNull())
+    {
+        m_exchange();
+    }
+    NS_ASSERT_MSG(m_lpCount == 1 || m_lookahead.IsStrictlyPositive(),
+                  "The lookahead must be positive with several logical processes");
+#ifndef NS3_MTP
+    if (m_lpCount > 1 && m_threaded)
+    {
+        NS_LOG_WARN("Several threads without the NS3_MTP build option: the reference counts "
+                    "and the packet free lists are not thread-safe");
+    }
+#endif
+
+    if (m_contextLpsChanged)
+    {
+        MoveEvents();
+    }
+    for (auto& lp : m_lps)
+    {
+        lp->currentTs = std::max(lp->currentTs, m_currentTs);
+        lp->stop = false;
+    }
+    m_stop = false;
+    m_stopTs = std::numeric_limits<uint64_t>::max();
+    m_running = true;
+    m_exit = false;
+    m_windowNumber = 0;
+    for (uint32_t i = 1; m_threaded && i < m_lpCount; i++)
+    {
+        m_threads.emplace_back(&MultithreadedSimulatorImpl::RunThread, this, m_lps[i].get());
+    }
+
+    while (true)
+    {
+        ProcessInboxes();
+        uint64_t next = std::numeric_limits<uint64_t>::max();
+        bool empty = true;
+        for (auto& lp : m_lps)
+        {
+            if (!lp->events->IsEmpty())
+            {
+                next = std::min(next, lp->events->PeekNext().key.m_ts);
+                empty = false;
+            }
+        }
+        if (m_stop || empty)
+        {
+            break;
+        }
+
+        uint64_t lookahead = m_lpCount == 1 ? std::numeric_limits<uint64_t>::max()
+                                            : m_lookahead.GetTimeStep();
+        m_windowEnd = next + std::min(lookahead, std::numeric_limits<uint64_t>::max() - next);
+        {
+            std::unique_lock lock{m_stopTimesMutex};
+            // The stops before the window ran, or were cancelled.
+            m_stopTimes.erase(m_stopTimes.begin(), m_stopTimes.lower_bound(next));
+            if (!m_stopTimes.empty())
+            {
+                m_windowEnd = std::min(m_windowEnd, *m_stopTimes.begin() + 1);
+            }
+        }
+        m_windowCount++;
+        {
+            std::unique_lock lock{m_windowMutex};
+            m_busy = m_threaded ? m_lpCount - 1 : 0;
+            m_windowNumber++;
+        }
+        m_windowStart.notify_all();
+        ProcessWindow(m_lps[0].get());
+        for (uint32_t i = 1; !m_threaded && i < m_lpCount; i++)
+        {
+            ProcessWindow(m_lps[i].get());
+        }
+        {
+            std::unique_lock lock{m_windowMutex};
+            m_windowDone.wait(lock, [&] { return m_busy == 0; });
+        }
+        if (!m_exchange.IsNull())
+        {
+            m_exchanging = true;
+            m_exchange();
+            m_exchanging = false;
+        }
+    }
+
+    {
+        std::unique_lock lock{m_windowMutex};
+        m_exit = true;
+    }
+    m_windowStart.notify_all();
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+    m_threads.clear();
+
+    for (auto& lp : m_lps)
+    {
+        m_currentTs = std::max(m_currentTs, lp->currentTs);
+    }
+    m_running = false;
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    LogicalProcess* current = GetCurrent();
+    uint64_t ts = current ? current->currentTs : m_currentTs;
+    // The other logical processes run their events up to the same time.
+    uint64_t stopTs = m_stopTs;
+    while (ts < stopTs && !m_stopTs.compare_exchange_weak(stopTs, ts))
+    {
+    }
+    m_stop = true;
+    if (current)
+    {
+        current->stop = true;
+    }
+}
+
+EventId
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    EventId id = Simulator::Schedule(delay, &Simulator::Stop);
+    std::unique_lock lock{m_stopTimesMutex};
+    m_stopTimes.insert(id.GetTs());
+    return id;
+}
+
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep() << event);
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+    Time tAbsolute = delay + Now();
+    return Insert(tAbsolute.GetTimeStep(), GetContext(), event);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    NS_LOG_FUNCTION(this << context << delay.GetTimeStep() << event);
+    Time tAbsolute = delay + Now();
+    Insert(tAbsolute.GetTimeStep(), context, event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    EventId id(Ptr<EventImpl>(event, false), Now().GetTimeStep(), 0xffffffff, 2);
+    std::unique_lock lock{m_destroyEventsMutex};
+    m_destroyEvents.push_back(id);
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    LogicalProcess* current = GetCurrent();
+    return TimeStep(current ? current->currentTs : m_currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    else
+    {
+        return TimeStep(id.GetTs()) - Now();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        // destroy events.
+        std::unique_lock lock{m_destroyEventsMutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                m_destroyEvents.erase(i);
+                break;
+            }
+        }
+        return;
+    }
+    if (IsExpired(id))
+    {
+        return;
+    }
+    LogicalProcess* current = GetCurrent();
+    LogicalProcess* target = m_lps[GetLogicalProcess(id.GetContext())].get();
+    if (current && current != target)
+    {
+        // The queue of another logical process is not thread-safe, and the
+        // event may still be in its inbox.
+        id.PeekEventImpl()->Cancel();
+        return;
+    }
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    target->events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        // destroy events.
+        std::unique_lock lock{m_destroyEventsMutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+    {
+        return true;
+    }
+    LogicalProcess* current = GetCurrent();
+    const LogicalProcess* target = m_lps[GetLogicalProcess(id.GetContext())].get();
+    if (current && current != target)
+    {
+        // The events of another logical process that can be known by this one
+        // run after the current window.
+        return id.GetTs() < m_windowEnd;
+    }
+    return id.GetTs() < target->currentTs ||
+           (id.GetTs() == target->currentTs && id.GetUid() <= target->currentUid);
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    LogicalProcess* current = GetCurrent();
+    return current ? current->currentContext : Simulator::NO_CONTEXT;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t count = 0;
+    for (const auto& lp : m_lps)
+    {
+        count += lp->eventCount;
+    }
+    return count;
+}
+
+} // namespace ns3
@@ -0,0 +1,285 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "callback.h"
+#include "nstime.h"
+#include "object-factory.h"
+#include "scheduler.h"
+#include "simulator-impl.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup simulator
+ *
+ * A conservative parallel simulator implementation, running its logical
+ * processes on shared-memory threads.
+ *
+ * Each execution context, i.e. each node, is mapped to a logical process
+ * with SetLogicalProcess(); the contexts not mapped, including the events
+ * scheduled without context, run on logical process 0. Each logical process
+ * has its own event queue and runs on its own thread, logical process 0
+ * running on the thread calling Simulator::Run(). If the Threaded attribute
+ * is false, the logical processes run each window in turn on that thread.
+ *
+ * The logical processes are synchronized with time windows, as with the
+ * granted time window algorithm of DistributedSimulatorImpl: if T is the
+ * time of the earliest pending event, every logical process runs its events
+ * before T plus the lookahead, then the threads wait for each other and
+ * exchange the events scheduled for another logical process. The events
+ * scheduled for another logical process must thus be scheduled with a delay
+ * of at least the lookahead, which is asserted.
+ *
+ * The events of a logical process run in the same order as with a single
+ * thread, and the events with the same timestamp run in the order of their
+ * scheduling by their logical process, so the simulation is deterministic.
+ *
+ * Simulator::Stop() stops the simulation at the time of the event calling
+ * it: its logical process runs no other event, and the other logical
+ * processes run their events up to that time, included. The windows end
+ * after the stops scheduled with Simulator::Stop(delay) before they start,
+ * so that no logical process runs past them; the other stops may come after
+ * some logical processes ran events of the window past their time.
+ *
+ * The objects used by several threads must be thread-safe. The NS3_MTP
+ * build option only makes the reference counts, the packet buffers, tags and
+ * metadata thread-safe: any other object shared by the logical processes
+ * must be synchronized by its owner. The logical processes must also not
+ * read the state of each other, which could be anywhere in the window.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    /**
+     * Map an execution context to a logical process. Must not be called
+     * while the simulation runs.
+     *
+     * \param [in] context The execution context, i.e. the node id.
+     * \param [in] lp The logical process, lower than the LogicalProcesses attribute.
+     */
+    void SetLogicalProcess(uint32_t context, uint32_t lp);
+
+    /**
+     * Get the logical process of an execution context.
+     *
+     * \param [in] context The execution context.
+     * \return The logical process.
+     */
+    uint32_t GetLogicalProcess(uint32_t context) const;
+
+    /**
+     * \return The number of time windows run.
+     */
+    uint64_t GetWindowCount() const;
+
+    /**
+     * Set the callback exchanging the messages of the logical processes,
+     * e.g. the packets of a ParallelCommunicationInterface.
+     *
+     * The callback is invoked on the thread of Simulator::Run(), once before
+     * the first window, while the contexts can still be mapped, then between
+     * the windows, while the logical processes wait. It may schedule events
+     * for any logical process with Simulator::ScheduleWithContext(), no
+     * earlier than the end of the last window.
+     *
+     * \param [in] exchange The callback.
+     */
+    void SetExchangeCallback(Callback<void> exchange);
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    EventId Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+  protected:
+    void NotifyConstructionCompleted() override;
+
+  private:
+    void DoDispose() override;
+
+    /** A logical process. */
+    struct LogicalProcess
+    {
+        /** The logical process index. */
+        uint32_t index;
+        /** The event priority queue. */
+        Ptr<Scheduler> events;
+        /** Next event counter, the unique ids interleave the logical processes. */
+        uint32_t uid;
+        /** Unique id of the current event. */
+        uint32_t currentUid;
+        /** Timestamp of the current event. */
+        uint64_t currentTs;
+        /** Execution context of the current event. */
+        uint32_t currentContext;
+        /** The event count. */
+        uint64_t eventCount;
+        /** Flag calling for the end of the simulation, from this logical process. */
+        bool stop;
+        /** Mutex to control access to the events from other logical processes. */
+        std::mutex inboxMutex;
+        /** The events scheduled by other logical processes, during the current window. */
+        std::vector<Scheduler::Event> inbox;
+    };
+
+    /**
+     * Insert an event in the queue of its logical process.
+     *
+     * \param [in] ts The event timestamp.
+     * \param [in] context The event context.
+     * \param [in] event The event implementation.
+     * \return The event id.
+     */
+    EventId Insert(uint64_t ts, uint32_t context, EventImpl* event);
+
+    /**
+     * \return The logical process running on the current thread, or nullptr.
+     */
+    LogicalProcess* GetCurrent() const;
+
+    /**
+     * Move the events to the logical process of their context, after a
+     * change of the mapping.
+     */
+    void MoveEvents();
+
+    /**
+     * Move the events scheduled by other logical processes to the event
+     * queues.
+     */
+    void ProcessInboxes();
+
+    /**
+     * Run the events of a logical process in the current window.
+     *
+     * \param [in] lp The logical process.
+     */
+    void ProcessWindow(LogicalProcess* lp);
+
+    /**
+     * Run the windows of a logical process, on its own thread.
+     *
+     * \param [in] lp The logical process.
+     */
+    void RunThread(LogicalProcess* lp);
+
+    /** The scheduler factory of the logical processes. */
+    ObjectFactory m_schedulerFactory;
+    /** The number of logical processes. */
+    uint32_t m_lpCount;
+    /** Flag \c true if each logical process runs on its own thread. */
+    bool m_threaded;
+    /** The lookahead between the logical processes. */
+    Time m_lookahead;
+    /** The logical processes. */
+    std::vector<std::unique_ptr<LogicalProcess>> m_lps;
+    /** The logical process of each context, 0 if not mapped. */
+    std::vector<uint32_t> m_contextLps;
+    /** Flag \c true if the contexts were mapped since the events were moved. */
+    bool m_contextLpsChanged;
+
+    /** Container type for the events to run at Simulator::Destroy() */
+    typedef std::list<EventId> DestroyEvents;
+    /** The container of events to run at Destroy. */
+    DestroyEvents m_destroyEvents;
+    /** Mutex to control access to the destroy events. */
+    mutable std::mutex m_destroyEventsMutex;
+
+    /** Flag \c true while the simulation runs. */
+    bool m_running;
+    /** The callback exchanging the messages of the logical processes. */
+    Callback<void> m_exchange;
+    /** Flag \c true while the exchange callback runs. */
+    bool m_exchanging;
+    /** Flag calling for the end of the simulation. */
+    std::atomic<bool> m_stop;
+    /** Timestamp of the stop, after which the logical processes run no event. */
+    std::atomic<uint64_t> m_stopTs;
+    /** The timestamps of the stops scheduled with Stop(const Time&). */
+    std::multiset<uint64_t> m_stopTimes;
+    /** Mutex to control access to the scheduled stops. */
+    std::mutex m_stopTimesMutex;
+    /** Timestamp of the current time, outside the windows. */
+    uint64_t m_currentTs;
+    /** Timestamp before which the events of the current window run. */
+    uint64_t m_windowEnd;
+    /** The number of windows run. */
+    uint64_t m_windowCount;
+
+    /** Mutex of the window synchronization. */
+    std::mutex m_windowMutex;
+    /** Notifies the threads of a new window, or of the end of the simulation. */
+    std::condition_variable m_windowStart;
+    /** Notifies the main thread of the end of the window. */
+    std::condition_variable m_windowDone;
+    /** Number of the current window, incremented when it starts. */
+    uint64_t m_windowNumber;
+    /** Number of logical processes still running the current window. */
+    uint32_t m_busy;
+    /** Flag \c true when the threads must exit. */
+    bool m_exit;
+    /** The threads of the logical processes but the first one, if threaded. */
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
@@ -0,0 +1,151 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PROFILE_COUNTER_H
+#define PROFILE_COUNTER_H
+
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#define NS3_PROFILE_COUNTER_RDTSC
+#endif
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::ProfileCounter declaration and NS_PROFILE_SCOPE macro definition.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup core
+ *
+ * The number of calls of a hot path and the cycles spent in them.
+ *
+ * The counters are only updated by NS_PROFILE_SCOPE in the builds with the
+ * NS3_PROFILE_COUNTERS option, and stay at 0 otherwise. The cycles are the
+ * time stamp counter of the processor on x86, nanoseconds elsewhere, and
+ * include the nested scopes. A scope costs two reads of the counter.
+ */
+struct ProfileCounter
+{
+    uint64_t calls{0};  //!< The number of calls
+    uint64_t cycles{0}; //!< The cycles spent in the calls
+
+    /**
+     * \return whether the build updates the counters
+     */
+    static constexpr bool IsEnabled()
+    {
+#ifdef NS3_PROFILE_COUNTERS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * \return the current cycle count
+     */
+    static uint64_t GetCycles()
+    {
+#ifdef NS3_PROFILE_COUNTER_RDTSC
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    /**
+     * Print the counter on a line: its name, the calls, the cycles and the
+     * cycles per call.
+     *
+     * \param os the output stream
+     * \param name the name of the counter
+     */
+    void Print(std::ostream& os, const char* name) const
+    {
+        os << name << " calls=" << calls << " cycles=" << cycles
+           << " cyclesPerCall=" << (calls ? cycles / calls : 0) << std::endl;
+    }
+
+    /** Set the counters to 0. */
+    void Reset()
+    {
+        calls = 0;
+        cycles = 0;
+    }
+};
+
+/**
+ * \ingroup core
+ *
+ * Adds a call and the cycles until its destruction to a ProfileCounter.
+ * Use through NS_PROFILE_SCOPE.
+ */
+class ProfileScope
+{
+  public:
+    /**
+     * Start the call.
+     *
+     * \param counter the counter
+     */
+    ProfileScope(ProfileCounter& counter)
+        : m_counter(counter),
+          m_start(ProfileCounter::GetCycles())
+    {
+    }
+
+    /** End the call. */
+    ~ProfileScope()
+    {
+        m_counter.calls++;
+        m_counter.cycles += ProfileCounter::GetCycles() - m_start;
+    }
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+  private:
+    ProfileCounter& m_counter; //!< The counter
+    uint64_t m_start;          //!< The cycles at the start of the call
+};
+
+} // namespace ns3
+
+/**
+ * \ingroup core
+ *
+ * Count the calls of the enclosing scope and their cycles in a
+ * ProfileCounter, in the builds with the NS3_PROFILE_COUNTERS option only.
+ *
+ * \param counter the ProfileCounter
+ */
+#ifdef NS3_PROFILE_COUNTERS
+#define NS_PROFILE_SCOPE(counter) ns3::ProfileScope ns3ProfileScope(counter)
+#else
+#define NS_PROFILE_SCOPE(counter)
+#endif
+
+#endif /* PROFILE_COUNTER_H */
@@ -0,0 +1,253 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "threaded-communication-interface.h"
+
+#include "abort.h"
+#include "assert.h"
+#include "log.h"
+#include "multithreaded-simulator-impl.h"
+#include "simulator.h"
+#include "uinteger.h"
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::ThreadedMessageQueue and ns3::ThreadedCommunicationInterface implementations.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ThreadedCommunicationInterface");
+
+NS_OBJECT_ENSURE_REGISTERED(ThreadedCommunicationInterface);
+
+ThreadedMessageQueue::ThreadedMessageQueue()
+{
+    m_head = new Block;
+    m_tail = m_head;
+}
+
+ThreadedMessageQueue::~ThreadedMessageQueue()
+{
+    Message message;
+    while (Pop(message))
+    {
+        message.event->Unref();
+    }
+    delete m_head;
+}
+
+void
+ThreadedMessageQueue::Push(const Message& message)
+{
+    uint32_t written = m_tail->written.load(std::memory_order_relaxed);
+    if (written == BLOCK_SIZE)
+    {
+        // The consumer frees the full block once it sees the next one.
+        auto block = new Block;
+        m_tail->next.store(block, std::memory_order_release);
+        m_tail = block;
+        written = 0;
+    }
+    m_tail->messages[written] = message;
+    m_tail->written.store(written + 1, std::memory_order_release);
+}
+
+bool
+ThreadedMessageQueue::Pop(Message& message)
+{
+    while (true)
+    {
+        if (m_head->read < m_head->written.load(std::memory_order_acquire))
+        {
+            message = m_head->messages[m_head->read++];
+            return true;
+        }
+        if (m_head->read < BLOCK_SIZE)
+        {
+            return false;
+        }
+        Block* next = m_head->next.load(std::memory_order_acquire);
+        if (!next)
+        {
+            return false;
+        }
+        delete m_head;
+        m_head = next;
+    }
+}
+
+TypeId
+ThreadedCommunicationInterface::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::ThreadedCommunicationInterface")
+                            .SetParent<Object>()
+                            .SetGroupName("Core")
+                            .AddConstructor<ThreadedCommunicationInterface>();
+    return tid;
+}
+
+ThreadedCommunicationInterface::ThreadedCommunicationInterface()
+    : m_size(1),
+      m_started(false),
+      m_exchanged(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+ThreadedCommunicationInterface::~ThreadedCommunicationInterface()
+{
+    NS_LOG_FUNCTION(this);
+    DeleteQueues();
+}
+
+void
+ThreadedCommunicationInterface::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    Disable();
+    m_start = MakeNullCallback<void>();
+    Object::DoDispose();
+}
+
+void
+ThreadedCommunicationInterface::Enable()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!m_simulator, "The interface is already enabled");
+
+    m_simulator = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    NS_ABORT_MSG_UNLESS(m_simulator,
+                        "The threaded communication interface needs the "
+                        "ns3::MultithreadedSimulatorImpl simulator implementation");
+
+    UintegerValue size;
+    m_simulator->GetAttribute("LogicalProcesses", size);
+    m_size = size.Get();
+    for (uint32_t i = 0; i < m_size * m_size; ++i)
+    {
+        m_queues.push_back(new ThreadedMessageQueue);
+    }
+    m_started = false;
+    m_exchanged = 0;
+    m_simulator->SetExchangeCallback(
+        MakeCallback(&ThreadedCommunicationInterface::Exchange, this));
+}
+
+void
+ThreadedCommunicationInterface::Disable()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_simulator)
+    {
+        m_simulator->SetExchangeCallback(MakeNullCallback<void>());
+        m_simulator = nullptr;
+    }
+    DeleteQueues();
+}
+
+bool
+ThreadedCommunicationInterface::IsEnabled() const
+{
+    return m_simulator != nullptr;
+}
+
+uint32_t
+ThreadedCommunicationInterface::GetSize() const
+{
+    return m_size;
+}
+
+uint64_t
+ThreadedCommunicationInterface::GetExchangedCount() const
+{
+    return m_exchanged;
+}
+
+void
+ThreadedCommunicationInterface::SetStartCallback(Callback<void> start)
+{
+    NS_LOG_FUNCTION(this);
+    m_start = start;
+}
+
+void
+ThreadedCommunicationInterface::Send(uint32_t context, const Time& delay, EventImpl* event)
+{
+    NS_LOG_FUNCTION(this << context << delay.GetTimeStep() << event);
+    NS_ASSERT_MSG(m_simulator, "The interface is not enabled");
+
+    uint32_t source = Simulator::GetSystemId();
+    uint32_t destination = m_simulator->GetLogicalProcess(context);
+    if (source == destination || !m_started)
+    {
+        // Before the run, the simulator moves the events to their logical
+        // process itself.
+        Simulator::ScheduleWithContext(context, delay, event);
+        return;
+    }
+    NS_ASSERT_MSG(delay >= m_lookahead,
+                  "Event for logical process " << destination << " sent with delay "
+                                               << delay.As(Time::US) << ", below the lookahead");
+    uint64_t ts = (Simulator::Now() + delay).GetTimeStep();
+    m_queues[source * m_size + destination]->Push({event, ts, context});
+}
+
+void
+ThreadedCommunicationInterface::Exchange()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_started)
+    {
+        if (!m_start.IsNull())
+        {
+            m_start();
+        }
+        TimeValue lookahead;
+        m_simulator->GetAttribute("Lookahead", lookahead);
+        m_lookahead = lookahead.Get();
+        m_started = true;
+    }
+
+    // The logical processes wait, so the queues are read in a fixed order,
+    // which keeps the simulation deterministic.
+    ThreadedMessageQueue::Message message;
+    for (ThreadedMessageQueue* queue : m_queues)
+    {
+        while (queue->Pop(message))
+        {
+            Simulator::ScheduleWithContext(message.context,
+                                           TimeStep(message.ts) - Simulator::Now(),
+                                           message.event);
+            m_exchanged++;
+        }
+    }
+}
+
+void
+ThreadedCommunicationInterface::DeleteQueues()
+{
+    for (ThreadedMessageQueue* queue : m_queues)
+    {
+        delete queue;
+    }
+    m_queues.clear();
+}
+
+} // namespace ns3
@@ -0,0 +1,226 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef THREADED_COMMUNICATION_INTERFACE_H
+#define THREADED_COMMUNICATION_INTERFACE_H
+
+#include "callback.h"
+#include "event-impl.h"
+#include "make-event.h"
+#include "nstime.h"
+#include "object.h"
+#include "ptr.h"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::ThreadedMessageQueue and ns3::ThreadedCommunicationInterface declarations.
+ */
+
+namespace ns3
+{
+
+class MultithreadedSimulatorImpl;
+
+/**
+ * \ingroup simulator
+ *
+ * Lock-free single-producer single-consumer queue of the events sent by a
+ * logical process to another one.
+ *
+ * The queue is an unbounded list of fixed-size blocks: the producer only
+ * writes the tail block and the consumer only reads the head block, so that
+ * neither waits for the other.
+ */
+class ThreadedMessageQueue
+{
+  public:
+    /** An event sent to another logical process. */
+    struct Message
+    {
+        EventImpl* event; //!< The event, of which the message holds a reference
+        uint64_t ts;      //!< The timestamp of the event
+        uint32_t context; //!< The context of the event
+    };
+
+    ThreadedMessageQueue();
+    ~ThreadedMessageQueue();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    ThreadedMessageQueue(const ThreadedMessageQueue&) = delete;
+    ThreadedMessageQueue& operator=(const ThreadedMessageQueue&) = delete;
+
+    /**
+     * Add a message, from the producer thread.
+     *
+     * \param [in] message The message.
+     */
+    void Push(const Message& message);
+    /**
+     * Remove the oldest message, from the consumer thread.
+     *
+     * \param [out] message The message.
+     * \return \c false if the queue is empty.
+     */
+    bool Pop(Message& message);
+
+  private:
+    /** Number of messages per block. */
+    static const uint32_t BLOCK_SIZE = 256;
+
+    /** A block of messages. */
+    struct Block
+    {
+        std::array<Message, BLOCK_SIZE> messages; //!< The messages
+        std::atomic<uint32_t> written{0};         //!< Number of messages written
+        uint32_t read{0};                         //!< Number of messages read
+        std::atomic<Block*> next{nullptr};        //!< The next block
+    };
+
+    Block* m_head; //!< The block read by the consumer
+    Block* m_tail; //!< The block written by the producer
+};
+
+/**
+ * \ingroup simulator
+ *
+ * Message passing between the logical processes of a
+ * MultithreadedSimulatorImpl, without MPI.
+ *
+ * The events sent by Send() to a context of another logical process go
+ * through a lock-free queue per pair of logical processes, instead of the
+ * locked inbox of the simulator. The queues are read in a fixed order
+ * between the windows, on the thread of Simulator::Run(), so that the
+ * simulation stays deterministic. The events sent to a context of the
+ * current logical process are scheduled directly.
+ *
+ * The events sent to another logical process must have a delay of at least
+ * the lookahead of the simulator, as read before the first window.
+ */
+class ThreadedCommunicationInterface : public Object
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    ThreadedCommunicationInterface();
+    ~ThreadedCommunicationInterface() override;
+
+    /**
+     * Attach to the simulator, which must be a MultithreadedSimulatorImpl,
+     * before Simulator::Run().
+     */
+    void Enable();
+    /** Detach from the simulator and drop the pending messages. */
+    void Disable();
+    /**
+     * \return \c true if the interface is attached to the simulator.
+     */
+    bool IsEnabled() const;
+    /**
+     * \return The number of logical processes.
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * Set the callback invoked before the first window, on the thread of
+     * Simulator::Run(), e.g. to map the contexts to the logical processes
+     * or to set the lookahead.
+     *
+     * \param [in] start The callback.
+     */
+    void SetStartCallback(Callback<void> start);
+
+    /**
+     * Send an event to a context, from the current logical process.
+     *
+     * \param [in] context The context of the event.
+     * \param [in] delay The delay of the event.
+     * \param [in] event The event, of which the interface takes the reference.
+     */
+    void Send(uint32_t context, const Time& delay, EventImpl* event);
+
+    /**
+     * Send an event to a context, from the current logical process.
+     *
+     * \tparam FUNC \deduced The type of the function or member function.
+     * \tparam Ts \deduced The types of the arguments.
+     * \param [in] context The context of the event.
+     * \param [in] delay The delay of the event.
+     * \param [in] f The function or member function to invoke.
+     * \param [in] args The arguments of the function.
+     */
+    template <typename FUNC, typename... Ts>
+    void Send(uint32_t context, const Time& delay, FUNC f, Ts&&... args);
+
+    /**
+     * \return The number of events that went through the queues.
+     */
+    uint64_t GetExchangedCount() const;
+
+  private:
+    void DoDispose() override;
+
+    /**
+     * Schedule the events sent to other logical processes, between the
+     * windows.
+     */
+    void Exchange();
+
+    /** Delete the queues and the events they hold. */
+    void DeleteQueues();
+
+    /** The simulator running the logical processes. */
+    Ptr<MultithreadedSimulatorImpl> m_simulator;
+    /** Number of logical processes. */
+    uint32_t m_size;
+    /** The lookahead of the simulator, read before the first window. */
+    Time m_lookahead;
+    /** Has the first window started. */
+    bool m_started;
+    /** The callback invoked before the first window. */
+    Callback<void> m_start;
+    /** The queue of each pair of logical processes, by source then destination. */
+    std::vector<ThreadedMessageQueue*> m_queues;
+    /** The number of events that went through the queues. */
+    uint64_t m_exchanged;
+};
+
+} // namespace ns3
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3
+{
+
+template <typename FUNC, typename... Ts>
+void
+ThreadedCommunicationInterface::Send(uint32_t context, const Time& delay, FUNC f, Ts&&... args)
+{
+    Send(context, delay, MakeEvent(f, std::forward<Ts>(args)...));
+}
+
+} // namespace ns3
+
+#endif /* THREADED_COMMUNICATION_INTERFACE_H */
@@ -0,0 +1,454 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/boolean.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/nstime.h"
+#include "ns3/object-factory.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/threaded-communication-interface.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \file
+ * \ingroup simulator-tests
+ * Multithreaded simulator test suite
+ */
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that the logical processes of the multithreaded simulator
+ * run the same events as the default simulator.
+ *
+ * Each context runs a chain of events, some of which schedule an event in
+ * another context, after the lookahead. The scenario also runs with a
+ * scheduled stop, which must end every logical process at its time.
+ */
+class MultithreadedSimulatorTestCase : public TestCase
+{
+  public:
+    MultithreadedSimulatorTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** An event run: timestamp, value, context, context from Simulator. */
+    typedef std::tuple<int64_t, uint32_t, uint32_t, uint32_t> Record;
+
+    /**
+     * Run the scenario.
+     *
+     * \param lps The number of logical processes, 0 for the default simulator.
+     * \param threaded Whether each logical process runs on its own thread.
+     * \param stop The time of the stop, zero for none.
+     * \return The events run by each context.
+     */
+    std::vector<std::vector<Record>> RunScenario(uint32_t lps,
+                                                 bool threaded,
+                                                 Time stop = Time(0));
+
+    /**
+     * An event of the chain of a context.
+     *
+     * \param context The context of the event.
+     * \param value The event value.
+     */
+    void Event(uint32_t context, uint32_t value);
+
+    /**
+     * An event received from another context.
+     *
+     * \param context The context of the event.
+     * \param value The event value.
+     */
+    void Receive(uint32_t context, uint32_t value);
+
+    /** Number of contexts. */
+    static const uint32_t CONTEXTS = 8;
+
+    /** The events run by each context. */
+    std::vector<std::vector<Record>> m_records;
+    /** Number of windows of the last multithreaded run. */
+    uint64_t m_windows;
+};
+
+MultithreadedSimulatorTestCase::MultithreadedSimulatorTestCase()
+    : TestCase("Check the multithreaded simulator against the default one")
+{
+}
+
+void
+MultithreadedSimulatorTestCase::Receive(uint32_t context, uint32_t value)
+{
+    // Each context is only accessed by its logical process.
+    m_records[context].emplace_back(Simulator::Now().GetMicroSeconds(),
+                                    value,
+                                    context,
+                                    Simulator::GetContext());
+}
+
+void
+MultithreadedSimulatorTestCase::Event(uint32_t context, uint32_t value)
+{
+    Receive(context, value);
+    if (Simulator::Now() > MilliSeconds(500))
+    {
+        return;
+    }
+    Simulator::Schedule(MicroSeconds(700 + 37 * context + value % 11),
+                        &MultithreadedSimulatorTestCase::Event,
+                        this,
+                        context,
+                        value * 7 + 1);
+    if (value % 3 == 0)
+    {
+        uint32_t other = (context + value) % CONTEXTS;
+        Simulator::ScheduleWithContext(other,
+                                       MilliSeconds(1) + MicroSeconds(value % 13),
+                                       &MultithreadedSimulatorTestCase::Receive,
+                                       this,
+                                       other,
+                                       value + context);
+    }
+}
+
+std::vector<std::vector<MultithreadedSimulatorTestCase::Record>>
+MultithreadedSimulatorTestCase::RunScenario(uint32_t lps, bool threaded, Time stop)
+{
+    if (lps == 0)
+    {
+        Simulator::SetImplementation(CreateObject<DefaultSimulatorImpl>());
+    }
+    else
+    {
+        Ptr<MultithreadedSimulatorImpl> impl = CreateObjectWithAttributes<
+            MultithreadedSimulatorImpl>("LogicalProcesses",
+                                        UintegerValue(lps),
+                                        "Lookahead",
+                                        TimeValue(MilliSeconds(1)),
+                                        "Threaded",
+                                        BooleanValue(threaded));
+        Simulator::SetImplementation(impl);
+        for (uint32_t context = 0; context < CONTEXTS; context++)
+        {
+            impl->SetLogicalProcess(context, context % lps);
+        }
+    }
+
+    m_records.assign(CONTEXTS, {});
+    for (uint32_t context = 0; context < CONTEXTS; context++)
+    {
+        Simulator::ScheduleWithContext(context,
+                                       MicroSeconds(context),
+                                       &MultithreadedSimulatorTestCase::Event,
+                                       this,
+                                       context,
+                                       context);
+    }
+    if (stop.IsStrictlyPositive())
+    {
+        Simulator::Stop(stop);
+    }
+    Simulator::Run();
+
+    auto impl = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    m_windows = impl ? impl->GetWindowCount() : 0;
+    Simulator::Destroy();
+    return m_records;
+}
+
+void
+MultithreadedSimulatorTestCase::DoRun()
+{
+    std::vector<std::vector<Record>> expected = RunScenario(0, true);
+    for (auto& records : expected)
+    {
+        std::sort(records.begin(), records.end());
+    }
+
+    for (uint32_t lps : {1, 2, 4})
+    {
+        std::vector<std::vector<Record>> records = RunScenario(lps, true);
+        if (lps > 1)
+        {
+            NS_TEST_ASSERT_MSG_GT(m_windows, 1, "The simulation was not split in windows");
+            // The same logical processes run the same events in the same order.
+            std::vector<std::vector<Record>> again = RunScenario(lps, true);
+            NS_TEST_ASSERT_MSG_EQ((records == again),
+                                  true,
+                                  "The run with " << lps << " logical processes is not repeatable");
+            // Even when they run in turn on a single thread.
+            again = RunScenario(lps, false);
+            NS_TEST_ASSERT_MSG_EQ((records == again),
+                                  true,
+                                  "The run with " << lps
+                                                  << " logical processes on one thread differs");
+        }
+        for (uint32_t context = 0; context < CONTEXTS; context++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(std::is_sorted(records[context].begin(),
+                                                 records[context].end(),
+                                                 [](const Record& a, const Record& b) {
+                                                     return std::get<0>(a) < std::get<0>(b);
+                                                 }),
+                                  true,
+                                  "Events run out of order");
+            for (const Record& record : records[context])
+            {
+                NS_TEST_ASSERT_MSG_EQ(std::get<3>(record),
+                                      context,
+                                      "Wrong context in event");
+            }
+            std::sort(records[context].begin(), records[context].end());
+            NS_TEST_ASSERT_MSG_EQ((records[context] == expected[context]),
+                                  true,
+                                  "Context " << context << " ran different events with " << lps
+                                             << " logical processes");
+        }
+    }
+
+    // Between two events, so that the order of the stop among the events of
+    // its time does not matter.
+    Time stop = MicroSeconds(250000) + NanoSeconds(500);
+    expected = RunScenario(0, true, stop);
+    for (auto& records : expected)
+    {
+        std::sort(records.begin(), records.end());
+    }
+    for (uint32_t lps : {2, 4})
+    {
+        for (bool threaded : {true, false})
+        {
+            std::vector<std::vector<Record>> records = RunScenario(lps, threaded, stop);
+            for (auto& contextRecords : records)
+            {
+                std::sort(contextRecords.begin(), contextRecords.end());
+            }
+            NS_TEST_ASSERT_MSG_EQ((records == expected),
+                                  true,
+                                  "The logical processes did not stop at the same time with "
+                                      << lps << " logical processes");
+        }
+    }
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that the events sent through the threaded communication
+ * interface reach the contexts of the other logical processes.
+ *
+ * Each context runs a chain of events, each of which sends an event to
+ * another context through the interface, after the lookahead.
+ */
+class ThreadedCommunicationInterfaceTestCase : public TestCase
+{
+  public:
+    ThreadedCommunicationInterfaceTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** An event received: timestamp, value, sender, context from Simulator. */
+    typedef std::tuple<int64_t, uint32_t, uint32_t, uint32_t> Record;
+
+    /**
+     * Run the scenario.
+     *
+     * \param lps The number of logical processes.
+     * \param threaded Whether each logical process runs on its own thread.
+     * \return The events received by each context.
+     */
+    std::vector<std::vector<Record>> RunScenario(uint32_t lps, bool threaded);
+
+    /**
+     * Map the contexts to the logical processes, before the first window.
+     *
+     * \param lps The number of logical processes.
+     */
+    void Map(uint32_t lps);
+
+    /**
+     * An event of the chain of a context, sending an event to another one.
+     *
+     * \param context The context of the event.
+     * \param value The event value.
+     */
+    void Send(uint32_t context, uint32_t value);
+
+    /**
+     * An event received from another context.
+     *
+     * \param context The context of the event.
+     * \param sender The context of the sender.
+     * \param value The event value.
+     */
+    void Receive(uint32_t context, uint32_t sender, uint32_t value);
+
+    /** Number of contexts. */
+    static const uint32_t CONTEXTS = 8;
+
+    /** The interface of the current run. */
+    Ptr<ThreadedCommunicationInterface> m_interface;
+    /** The events received by each context. */
+    std::vector<std::vector<Record>> m_records;
+    /** Number of events exchanged by the queues in the last run. */
+    uint64_t m_exchanged;
+};
+
+ThreadedCommunicationInterfaceTestCase::ThreadedCommunicationInterfaceTestCase()
+    : TestCase("Check the delivery of the threaded communication interface")
+{
+}
+
+void
+ThreadedCommunicationInterfaceTestCase::Map(uint32_t lps)
+{
+    auto impl = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    for (uint32_t context = 0; context < CONTEXTS; context++)
+    {
+        impl->SetLogicalProcess(context, context % lps);
+    }
+}
+
+void
+ThreadedCommunicationInterfaceTestCase::Receive(uint32_t context, uint32_t sender, uint32_t value)
+{
+    // Each context is only accessed by its logical process.
+    m_records[context].emplace_back(Simulator::Now().GetMicroSeconds(),
+                                    value,
+                                    sender,
+                                    Simulator::GetContext());
+}
+
+void
+ThreadedCommunicationInterfaceTestCase::Send(uint32_t context, uint32_t value)
+{
+    if (Simulator::Now() > MilliSeconds(200))
+    {
+        return;
+    }
+    uint32_t other = (context + 1 + value % 3) % CONTEXTS;
+    m_interface->Send(other,
+                      MilliSeconds(1) + MicroSeconds(value % 17),
+                      &ThreadedCommunicationInterfaceTestCase::Receive,
+                      this,
+                      other,
+                      context,
+                      value);
+    Simulator::Schedule(MicroSeconds(300 + 41 * context),
+                        &ThreadedCommunicationInterfaceTestCase::Send,
+                        this,
+                        context,
+                        value * 5 + 2);
+}
+
+std::vector<std::vector<ThreadedCommunicationInterfaceTestCase::Record>>
+ThreadedCommunicationInterfaceTestCase::RunScenario(uint32_t lps, bool threaded)
+{
+    Simulator::SetImplementation(
+        CreateObjectWithAttributes<MultithreadedSimulatorImpl>("LogicalProcesses",
+                                                               UintegerValue(lps),
+                                                               "Lookahead",
+                                                               TimeValue(MilliSeconds(1)),
+                                                               "Threaded",
+                                                               BooleanValue(threaded)));
+    m_interface = CreateObject<ThreadedCommunicationInterface>();
+    m_interface->Enable();
+    m_interface->SetStartCallback(
+        MakeCallback(&ThreadedCommunicationInterfaceTestCase::Map, this).Bind(lps));
+
+    m_records.assign(CONTEXTS, {});
+    for (uint32_t context = 0; context < CONTEXTS; context++)
+    {
+        Simulator::ScheduleWithContext(context,
+                                       MicroSeconds(context),
+                                       &ThreadedCommunicationInterfaceTestCase::Send,
+                                       this,
+                                       context,
+                                       context);
+    }
+    Simulator::Run();
+
+    m_exchanged = m_interface->GetExchangedCount();
+    Simulator::Destroy();
+    m_interface->Dispose();
+    m_interface = nullptr;
+    return m_records;
+}
+
+void
+ThreadedCommunicationInterfaceTestCase::DoRun()
+{
+    std::vector<std::vector<Record>> expected = RunScenario(1, true);
+    NS_TEST_ASSERT_MSG_EQ(m_exchanged, 0, "Events queued with a single logical process");
+    for (auto& records : expected)
+    {
+        NS_TEST_ASSERT_MSG_GT(records.size(), 0, "A context received no event");
+        std::sort(records.begin(), records.end());
+    }
+
+    for (uint32_t lps : {2, 4})
+    {
+        std::vector<std::vector<Record>> records = RunScenario(lps, false);
+        NS_TEST_ASSERT_MSG_GT(m_exchanged, 0, "No event went through the queues");
+        // The same events in the same order, with a thread per logical process.
+        std::vector<std::vector<Record>> again = RunScenario(lps, true);
+        NS_TEST_ASSERT_MSG_EQ((records == again),
+                              true,
+                              "The threaded run with " << lps << " logical processes differs");
+        for (uint32_t context = 0; context < CONTEXTS; context++)
+        {
+            for (const Record& record : records[context])
+            {
+                NS_TEST_ASSERT_MSG_EQ(std::get<3>(record),
+                                      context,
+                                      "Wrong context in event");
+            }
+            std::sort(records[context].begin(), records[context].end());
+            NS_TEST_ASSERT_MSG_EQ((records[context] == expected[context]),
+                                  true,
+                                  "Context " << context << " received different events with "
+                                             << lps << " logical processes");
+        }
+    }
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief The multithreaded simulator test suite.
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+  public:
+    MultithreadedSimulatorTestSuite()
+        : TestSuite("multithreaded-simulator", Type::UNIT)
+    {
+        AddTestCase(new MultithreadedSimulatorTestCase, TestCase::Duration::QUICK);
+        AddTestCase(new ThreadedCommunicationInterfaceTestCase, TestCase::Duration::QUICK);
+    }
+};
+
+static MultithreadedSimulatorTestSuite
+    g_multithreadedSimulatorTestSuite; //!< Static variable for test initialization
@@ -16,14 +16,19 @@
  *
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
+#include "ns3/boolean.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/default-simulator-impl.h"
 #include "ns3/heap-scheduler.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 
+#include <sstream>
+
 using namespace ns3;
 
 /**
@@ -707,6 +712,158 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief An object whose events are profiled.
+ */
+class SimulatorEventProfileObject : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /**
+     * Count an event.
+     * \param value Event parameter.
+     */
+    void Count(int value);
+
+    /**
+     * Ignore an event: a virtual method of the same signature as Count().
+     * \param value Event parameter.
+     */
+    virtual void Ignore(int value);
+
+    int m_count{0}; //!< The number of events.
+};
+
+TypeId
+SimulatorEventProfileObject::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::SimulatorEventProfileObject")
+                            .SetParent<Object>()
+                            .SetGroupName("Core")
+                            .HideFromDocumentation()
+                            .AddConstructor<SimulatorEventProfileObject>();
+    return tid;
+}
+
+void
+SimulatorEventProfileObject::Count(int /* value */)
+{
+    m_count++;
+}
+
+void
+SimulatorEventProfileObject::Ignore(int /* value */)
+{
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check the event profile of DefaultSimulatorImpl.
+ */
+class SimulatorEventProfileTestCase : public TestCase
+{
+  public:
+    SimulatorEventProfileTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Test Event.
+     */
+    void Event();
+};
+
+SimulatorEventProfileTestCase::SimulatorEventProfileTestCase()
+    : TestCase("Check the event profile of DefaultSimulatorImpl")
+{
+}
+
+void
+SimulatorEventProfileTestCase::Event()
+{
+}
+
+void
+SimulatorEventProfileTestCase::DoRun()
+{
+    Simulator::SetImplementation(
+        CreateObjectWithAttributes<DefaultSimulatorImpl>("EventProfile",
+                                                         BooleanValue(true),
+                                                         "EventProfileFile",
+                                                         StringValue(CreateTempDirFilename(
+                                                             "event-profile.txt"))));
+
+    Ptr<SimulatorEventProfileObject> object = CreateObject<SimulatorEventProfileObject>();
+    for (int i = 0; i < 3; i++)
+    {
+        Simulator::Schedule(MicroSeconds(i), &SimulatorEventProfileObject::Count, object, i);
+    }
+    Simulator::Schedule(MicroSeconds(1), &SimulatorEventProfileObject::Ignore, object, 0);
+    Simulator::Schedule(MicroSeconds(1), &SimulatorEventProfileTestCase::Event, this);
+    Simulator::Schedule(MicroSeconds(2), [] {});
+    EventId cancelled =
+        Simulator::Schedule(MicroSeconds(3), &SimulatorEventProfileTestCase::Event, this);
+    Simulator::Cancel(cancelled);
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(object->m_count, 3, "The events were not invoked");
+
+    auto simulator = DynamicCast<DefaultSimulatorImpl>(Simulator::GetImplementation());
+    NS_TEST_ASSERT_MSG_NE(simulator, nullptr, "Not a DefaultSimulatorImpl");
+    std::ostringstream oss;
+    simulator->PrintEventProfile(oss);
+    Simulator::Destroy();
+
+    // One line per bucket: the events, their share, the wall time, its
+    // share, the time per event, the TypeId and the method.
+    std::istringstream profile(oss.str());
+    std::string line;
+    std::getline(profile, line);
+    NS_TEST_EXPECT_MSG_EQ(line.find("Event profile: 7 events"), 0, "Wrong total: " << line);
+    std::getline(profile, line);
+    uint32_t buckets = 0;
+    uint64_t objectEvents = 0;
+    uint64_t cancelledEvents = 0;
+    uint32_t numbered = 0;
+    uint32_t named = 0;
+    while (std::getline(profile, line))
+    {
+        buckets++;
+        uint64_t events = std::stoull(line);
+        if (line.find("ns3::SimulatorEventProfileObject") != std::string::npos)
+        {
+            objectEvents += events;
+            numbered += line.find(" #2") != std::string::npos;
+            named += line.find("SimulatorEventProfileObject::Count(int)") != std::string::npos;
+            named += line.find("SimulatorEventProfileObject::Ignore(int)") != std::string::npos;
+        }
+        if (line.find("(cancelled)") != std::string::npos)
+        {
+            cancelledEvents += events;
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(buckets, 5, "Wrong number of buckets");
+    NS_TEST_EXPECT_MSG_EQ(objectEvents, 4, "The events were not attributed to the object");
+#if defined(__unix__) || defined(__APPLE__)
+    // The test library exports the methods, the virtual one included.
+    NS_TEST_EXPECT_MSG_EQ(named, 2, "The methods were not named");
+    NS_TEST_EXPECT_MSG_EQ(numbered, 0, "Named methods were numbered");
+#else
+    NS_TEST_EXPECT_MSG_EQ(numbered + named,
+                          1,
+                          "The methods of the same signature were not told apart");
+#endif
+    NS_TEST_EXPECT_MSG_EQ(cancelledEvents, 1, "The cancelled event was attributed");
+}
+
 /**
  * \ingroup simulator-tests
  *
@@ -730,6 +887,7 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        AddTestCase(new SimulatorEventProfileTestCase(), TestCase::Duration::QUICK);
     }
 };
 
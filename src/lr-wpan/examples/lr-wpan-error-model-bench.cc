@@ -0,0 +1,103 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Time LrWpanErrorModel::GetChunkSuccessRate with the exact BER formula and
+ * with the tabulated BER, over a sweep of SNR values and chunk sizes like
+ * the ones of LrWpanPhy::CheckInterference.
+ *
+ *   ./ns3 run "lr-wpan-error-model-bench --n=1000000 --tableSize=1024"
+ */
+
+#include <ns3/boolean.h>
+#include <ns3/command-line.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-error-model.h>
+#include <ns3/object-factory.h>
+#include <ns3/system-wall-clock-ms.h>
+#include <ns3/uinteger.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("LrWpanErrorModelBench");
+
+/**
+ * Call GetChunkSuccessRate over the SNR sweep and print the time per call.
+ *
+ * \param name the name of the method
+ * \param model the error model
+ * \param snrs the SNR values, as power ratios
+ * \param n the number of calls
+ */
+static void
+Bench(const std::string& name,
+      Ptr<LrWpanErrorModel> model,
+      const std::vector<double>& snrs,
+      uint32_t n)
+{
+    SystemWallClockMs clock;
+    double sum = 0;
+    clock.Start();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        // chunks of 1 to 127 bytes
+        sum += model->GetChunkSuccessRate(snrs[i % snrs.size()], 8 * (1 + i % 127));
+    }
+    int64_t ms = clock.End();
+
+    std::cout << name << ": " << (ms * 1e6 / n) << " ns per call (checksum " << sum << ")"
+              << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t n = 1000000;
+    uint32_t tableSize = 1024;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("n", "Number of calls of each method", n);
+    cmd.AddValue("tableSize", "Number of SNR steps of the BER table", tableSize);
+    cmd.Parse(argc, argv);
+
+    // -10 dB to 10 dB, the range where the chunk success rate is neither 0 nor 1
+    std::vector<double> snrs;
+    for (double snrDb = -10; snrDb <= 10; snrDb += 0.013)
+    {
+        snrs.push_back(std::pow(10.0, snrDb / 10.0));
+    }
+
+    Ptr<LrWpanErrorModel> exact = CreateObject<LrWpanErrorModel>();
+    SystemWallClockMs clock;
+    clock.Start();
+    Ptr<LrWpanErrorModel> tabulated =
+        CreateObjectWithAttributes<LrWpanErrorModel>("Tabulated",
+                                                     BooleanValue(true),
+                                                     "TableSize",
+                                                     UintegerValue(tableSize));
+    int64_t buildMs = clock.End();
+    std::cout << "Table of " << tableSize << " steps built in " << buildMs
+              << " ms, largest relative BER error " << tabulated->GetTableError() << std::endl;
+
+    Bench("exact", exact, snrs, n);
+    Bench("tabulated", tabulated, snrs, n);
+
+    return 0;
+}
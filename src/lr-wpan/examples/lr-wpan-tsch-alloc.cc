@@ -0,0 +1,144 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Count the heap allocations per TSCH timeslot of a star network, where every
+ * device sends a packet to the PAN coordinator at a fixed interval.
+ *
+ * The allocations are counted by replacing the global operator new of this
+ * program. The counts at the end of a warm-up period and at the end of the
+ * simulation are printed, and the allocations per timeslot are taken from
+ * their difference.
+ *
+ *   ./ns3 run "lr-wpan-tsch-alloc --nodes=10 --interval=0.5"
+ */
+
+#include <ns3/command-line.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/core-module.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/simulator.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("LrWpanTschAlloc");
+
+static uint64_t g_allocations = 0;       //!< Number of allocations of the program
+static uint64_t g_warmupAllocations = 0; //!< Number of allocations at the end of the warm-up
+
+void*
+operator new(std::size_t size)
+{
+    g_allocations++;
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * Record the number of allocations at the end of the warm-up.
+ */
+static void
+EndWarmup()
+{
+    g_warmupAllocations = g_allocations;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nodes = 10;
+    uint32_t emptySlots = 5;
+    uint32_t packetSize = 20;
+    double interval = 0.5;
+    double warmup = 2;
+    double duration = 20;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nodes", "Number of devices, including the PAN coordinator", nodes);
+    cmd.AddValue("emptySlots", "Number of timeslots without links in the slotframe", emptySlots);
+    cmd.AddValue("packetSize", "Size of the packets in bytes", packetSize);
+    cmd.AddValue("interval", "Interval between two packets of a device in seconds", interval);
+    cmd.AddValue("warmup", "Time before the allocations are counted in seconds", warmup);
+    cmd.AddValue("duration", "Time the allocations are counted in seconds", duration);
+    cmd.Parse(argc, argv);
+
+    NodeContainer nodeContainer;
+    nodeContainer.Create(nodes);
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = helper.Install(nodeContainer);
+    for (uint32_t i = 0; i < nodeContainer.GetN(); i++)
+    {
+        Ptr<ConstantPositionMobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(Vector(5 * i, 0, 0));
+        nodeContainer.Get(i)->AggregateObject(mob);
+    }
+    helper.AssociateToPan(devs, 0);
+    helper.ConfigureSlotframeAllToPan(devs, emptySlots, false, false);
+
+    double start = 1;
+    double end = start + warmup + duration;
+    helper.EnableTsch(devs, start, end - start);
+    for (uint32_t i = 1; i < devs.GetN(); i++)
+    {
+        helper.GenerateTraffic(devs.Get(i),
+                               devs.Get(0)->GetAddress(),
+                               packetSize,
+                               start + 0.001 * i,
+                               end - start,
+                               interval);
+    }
+
+    Simulator::Schedule(Seconds(start + warmup), &EndWarmup);
+    Simulator::Stop(Seconds(end));
+    Simulator::Run();
+    uint64_t endAllocations = g_allocations;
+    uint64_t allocations = endAllocations - g_warmupAllocations;
+
+    double timeslots = duration * 1e6 / 10000;
+    std::cout << "Devices: " << nodes << ", counted timeslots: " << timeslots << std::endl;
+    std::cout << "Heap allocations at the end of the warm-up: " << g_warmupAllocations
+              << std::endl;
+    std::cout << "Heap allocations at the end: " << endAllocations << std::endl;
+    std::cout << "Heap allocations counted: " << allocations << std::endl;
+    std::cout << "Heap allocations per timeslot: " << allocations / timeslots << std::endl;
+    std::cout << "Heap allocations per timeslot and device: " << allocations / timeslots / nodes
+              << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,430 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Benchmark the TSCH stack over a sweep of star networks: the number of
+ * nodes of each PAN, the slotframe size, the traffic interval, the number of
+ * PANs and the Q-learning hopping agent on or off. Each comma separated list
+ * is a dimension of the sweep, and each configuration of the sweep is a
+ * simulation, printed as a CSV line: the configuration, the events executed,
+ * the wall time of the setup and of the run, the events per wall second, the
+ * simulated seconds per wall second, the peak resident set size of the
+ * process and the acknowledged transmissions.
+ *
+ *   ./ns3 run "lr-wpan-tsch-benchmark --nodes=10,100,1000,5000 --agent=0,1"
+ *
+ * The peak resident set size is the one of the process since its start: to
+ * measure it for each configuration, run one configuration per process with
+ * --run, e.g. --run=3 for the fourth configuration of the sweep, and
+ * --header=0 to append the lines to a single file.
+ *
+ * A slotframe size of 0 gives each device its own timeslot, otherwise the
+ * devices share the timeslots after the advertising one in turn. The slot
+ * mode is "packet" for a timeslot event per device, "clock" for a slot clock
+ * per PAN or "engine" for a slot engine per PAN. With logical processes, the
+ * simulator is ns3::MultithreadedSimulatorImpl and each PAN runs on its own.
+ * The logical processes run on their own threads, which needs the NS3_MTP
+ * build option, or in turn on a single thread with --threaded=0.
+ */
+
+#include <ns3/command-line.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/core-module.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/multithreaded-simulator-impl.h>
+#include <ns3/simulator.h>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("LrWpanTschBenchmark");
+
+/** A configuration of the sweep. */
+struct BenchmarkConfig
+{
+    uint32_t nodes;         //!< Number of nodes of each PAN, including its coordinator
+    uint32_t slotframeSize; //!< Size of the slotframe, 0 for a timeslot per device
+    double interval;        //!< Interval between two packets of a device in seconds
+    uint32_t pans;          //!< Number of PANs
+    bool agent;             //!< Whether a Q-learning agent sets the hopping sequence of each PAN
+};
+
+/** The measures of a simulation. */
+struct BenchmarkResult
+{
+    uint64_t events;    //!< Number of events executed
+    double setupS;      //!< Wall time of the setup in seconds
+    double runS;        //!< Wall time of the run in seconds
+    uint64_t peakRssKb; //!< Peak resident set size of the process in KiB
+    uint64_t acks;      //!< Number of acknowledged transmissions
+};
+
+/**
+ * Parse a comma separated list.
+ *
+ * \param list the list
+ * \return the values
+ */
+template <typename T>
+static std::vector<T>
+ParseList(const std::string& list)
+{
+    std::vector<T> values;
+    std::istringstream iss(list);
+    std::string item;
+    while (std::getline(iss, item, ','))
+    {
+        std::istringstream value(item);
+        T v;
+        value >> v;
+        NS_ABORT_MSG_IF(value.fail(),
+                        "Invalid value \"" << item << "\" in list \"" << list << "\"");
+        values.push_back(v);
+    }
+    NS_ABORT_MSG_IF(values.empty(), "Empty list");
+    return values;
+}
+
+/**
+ * \return the peak resident set size of the process in KiB, 0 if unknown
+ */
+static uint64_t
+GetPeakRssKb()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // in bytes
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+/**
+ * \return the wall clock time in seconds
+ */
+static double
+GetWallTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * Count an acknowledged transmission.
+ *
+ * \param acks the counter of the PAN, so that the PANs may run on different
+ *             logical processes
+ * \param info the channel and hopping sequence index
+ */
+static void
+CountAck(uint64_t* acks, std::pair<uint8_t, uint32_t> info)
+{
+    (*acks)++;
+}
+
+/**
+ * Configure the slotframe of a PAN: the advertising link of the coordinator
+ * in timeslot 0, then a link to the coordinator for each device, in the
+ * following timeslots in turn. The links are shared when the devices
+ * outnumber the timeslots.
+ *
+ * \param helper the helper
+ * \param devs the devices of the PAN, the coordinator first
+ * \param size the size of the slotframe
+ */
+static void
+ConfigureSharedSlotframe(LrWpanTschHelper& helper, NetDeviceContainer devs, uint32_t size)
+{
+    NS_ABORT_MSG_IF(size < 2, "The slotframe has no timeslot besides the advertising one");
+    helper.AddSlotframe(devs, 0, size);
+
+    AddLinkParams params;
+    params.slotframeHandle = 0;
+    params.channelOffset = 0;
+    params.linkHandle = 0;
+    params.timeslot = 0;
+    helper.AddAdvLink(devs, 0, params);
+
+    bool shared = devs.GetN() - 1 > size - 1;
+    for (uint32_t i = 1; i < devs.GetN(); i++)
+    {
+        params.linkHandle = i;
+        params.timeslot = 1 + (i - 1) % (size - 1);
+        helper.AddLink(devs, i, 0, params, shared);
+    }
+}
+
+/**
+ * Run a configuration of the sweep.
+ *
+ * \param config the configuration
+ * \param slotMode "packet", "clock" or "engine"
+ * \param lps the number of logical processes, 0 for the default simulator
+ * \param threaded whether each logical process runs on its own thread
+ * \param packetSize the size of the packets in bytes
+ * \param simTime the simulated time in seconds
+ * \param culling whether to cull the receivers and cache the path loss
+ * \return the measures
+ */
+static BenchmarkResult
+RunConfig(const BenchmarkConfig& config,
+          const std::string& slotMode,
+          uint32_t lps,
+          bool threaded,
+          uint32_t packetSize,
+          double simTime,
+          bool culling)
+{
+    double start = GetWallTime();
+
+    if (lps > 0)
+    {
+        Simulator::SetImplementation(
+            CreateObjectWithAttributes<MultithreadedSimulatorImpl>("LogicalProcesses",
+                                                                   UintegerValue(lps),
+                                                                   "Threaded",
+                                                                   BooleanValue(threaded)));
+    }
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    LrWpanTschHelper helper;
+    std::vector<NetDeviceContainer> pans;
+    for (uint32_t pan = 0; pan < config.pans; pan++)
+    {
+        NodeContainer nodes;
+        nodes.Create(config.nodes);
+        NetDeviceContainer devs = helper.Install(nodes);
+        for (uint32_t i = 0; i < nodes.GetN(); i++)
+        {
+            // A disc of 30 m around the coordinator, the PANs 1 km apart.
+            double radius = 30 * std::sqrt(double(i) / nodes.GetN());
+            double angle = 2.399963 * i;
+            Ptr<ConstantPositionMobilityModel> mob =
+                CreateObject<ConstantPositionMobilityModel>();
+            mob->SetPosition(Vector(1000 * pan + radius * std::cos(angle),
+                                    radius * std::sin(angle),
+                                    0));
+            nodes.Get(i)->AggregateObject(mob);
+        }
+        helper.AssociateToPan(devs, pan);
+        if (config.slotframeSize == 0)
+        {
+            helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+        }
+        else
+        {
+            ConfigureSharedSlotframe(helper, devs, config.slotframeSize);
+        }
+        helper.AssignStreams(devs, 10 * pan);
+        pans.push_back(devs);
+    }
+
+    if (culling)
+    {
+        helper.EnablePathLossCache();
+        helper.EnableReceiverCulling(10);
+    }
+    if (lps > 0)
+    {
+        helper.AssignLogicalProcesses(pans);
+    }
+
+    std::vector<uint64_t> acks(config.pans, 0);
+    // The agents of a single logical process share a pool, which batches their updates.
+    Ptr<AgentPool> pool = config.agent && lps <= 1 ? CreateObject<AgentPool>() : nullptr;
+    std::vector<Ptr<Agent>> agents;
+    for (uint32_t pan = 0; pan < config.pans; pan++)
+    {
+        NetDeviceContainer devs = pans[pan];
+        for (uint32_t i = 0; i < devs.GetN(); i++)
+        {
+            devs.Get(i)->GetObject<LrWpanTschNetDevice>()->GetNMac()->TraceConnectWithoutContext(
+                "MacTxDataRxAck",
+                MakeBoundCallback(&CountAck, &acks[pan]));
+        }
+
+        if (slotMode == "clock")
+        {
+            helper.InstallSlotClock(devs);
+        }
+        else if (slotMode == "engine")
+        {
+            helper.InstallSlotEngine(devs)->AssignStreams(10 * pan);
+        }
+        else
+        {
+            NS_ABORT_MSG_UNLESS(slotMode == "packet", "Unknown slot mode \"" << slotMode << "\"");
+        }
+
+        if (config.agent)
+        {
+            Ptr<Agent> agent = CreateObject<Agent>(devs);
+            agent->SetQAgentParams({0.1, 0.95, 0.1, 0.8, 1, -1});
+            agent->panId = pan;
+            // Bound to the raw agent, which holds the devices.
+            devs.Get(0)->GetObject<LrWpanTschNetDevice>()->GetNMac()->TraceConnectWithoutContext(
+                "PassedOneHoppingSequenceTrace",
+                MakeCallback(&Agent::OnePeriodHoppingSequencePassed, PeekPointer(agent)));
+            if (pool)
+            {
+                pool->Add(agent);
+            }
+            agents.push_back(agent);
+        }
+
+        helper.EnableTsch(devs, 0, simTime);
+        for (uint32_t i = 1; i < devs.GetN(); i++)
+        {
+            helper.GenerateTraffic(devs.Get(i),
+                                   devs.Get(0)->GetAddress(),
+                                   packetSize,
+                                   1 + 0.001 * i,
+                                   simTime - 1,
+                                   config.interval);
+        }
+    }
+
+    Simulator::Stop(Seconds(simTime));
+    double run = GetWallTime();
+    Simulator::Run();
+    double end = GetWallTime();
+
+    BenchmarkResult result;
+    result.events = Simulator::GetEventCount();
+    result.setupS = run - start;
+    result.runS = end - run;
+    result.peakRssKb = GetPeakRssKb();
+    result.acks = 0;
+    for (uint64_t a : acks)
+    {
+        result.acks += a;
+    }
+
+    Simulator::Destroy();
+    return result;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string nodes = "10,100,1000";
+    std::string slotframeSizes = "0";
+    std::string intervals = "1";
+    std::string pans = "1";
+    std::string agents = "0,1";
+    std::string slotMode = "packet";
+    uint32_t lps = 0;
+    bool threaded = true;
+    uint32_t packetSize = 20;
+    double simTime = 10;
+    bool culling = true;
+    int32_t run = -1;
+    bool header = true;
+    std::string output;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nodes", "Numbers of nodes of each PAN, including its coordinator", nodes);
+    cmd.AddValue("slotframeSize",
+                 "Sizes of the slotframe, 0 for a timeslot per device",
+                 slotframeSizes);
+    cmd.AddValue("interval", "Intervals between two packets of a device in seconds", intervals);
+    cmd.AddValue("pans", "Numbers of PANs", pans);
+    cmd.AddValue("agent", "Whether the Q-learning hopping agent is on, 0 or 1", agents);
+    cmd.AddValue("slotMode", "Timeslots of the devices: packet, clock or engine", slotMode);
+    cmd.AddValue("lps", "Number of logical processes, 0 for the default simulator", lps);
+    cmd.AddValue("threaded", "Run each logical process on its own thread", threaded);
+    cmd.AddValue("packetSize", "Size of the packets in bytes", packetSize);
+    cmd.AddValue("simTime", "Simulated time in seconds", simTime);
+    cmd.AddValue("culling", "Cull the receivers and cache the path loss", culling);
+    cmd.AddValue("run", "Index of the only configuration to run, -1 for all", run);
+    cmd.AddValue("header", "Print the CSV header line", header);
+    cmd.AddValue("output", "CSV file, the standard output if empty", output);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(simTime <= 1, "The traffic starts after 1 s");
+
+    std::vector<BenchmarkConfig> configs;
+    for (uint32_t n : ParseList<uint32_t>(nodes))
+    {
+        NS_ABORT_MSG_IF(n < 2, "A PAN has at least 2 nodes");
+        for (uint32_t size : ParseList<uint32_t>(slotframeSizes))
+        {
+            for (double interval : ParseList<double>(intervals))
+            {
+                for (uint32_t p : ParseList<uint32_t>(pans))
+                {
+                    for (bool agent : ParseList<bool>(agents))
+                    {
+                        configs.push_back({n, size, interval, p, agent});
+                    }
+                }
+            }
+        }
+    }
+    NS_ABORT_MSG_IF(run >= int32_t(configs.size()),
+                    "The sweep has " << configs.size() << " configurations");
+
+    std::ofstream file;
+    if (!output.empty())
+    {
+        file.open(output, header ? std::ios::out : std::ios::app);
+        NS_ABORT_MSG_UNLESS(file.is_open(), "Unable to open file \"" << output << "\"");
+    }
+    std::ostream& os = output.empty() ? std::cout : file;
+
+    if (header)
+    {
+        os << "nodes,slotframeSize,interval,pans,agent,slotMode,lps,simTime,events,setupS,"
+              "wallS,eventsPerS,simSPerWallS,peakRssKb,acks"
+           << std::endl;
+    }
+    for (uint32_t i = 0; i < configs.size(); i++)
+    {
+        if (run >= 0 && i != uint32_t(run))
+        {
+            continue;
+        }
+        const BenchmarkConfig& config = configs[i];
+        BenchmarkResult result =
+            RunConfig(config, slotMode, lps, threaded, packetSize, simTime, culling);
+        os << config.nodes << "," << config.slotframeSize << "," << config.interval << ","
+           << config.pans << "," << config.agent << "," << slotMode << "," << lps << ","
+           << simTime << "," << result.events << "," << result.setupS << "," << result.runS
+           << "," << (result.runS > 0 ? result.events / result.runS : 0) << ","
+           << (result.runS > 0 ? simTime / result.runS : 0) << "," << result.peakRssKb << ","
+           << result.acks << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Scaling benchmark of the logical processes of a single box, without MPI.
+ *
+ * A row of TSCH PANs, 1 km apart, sending their traffic to their
+ * coordinator; the coordinators of neighbor PANs exchange backhaul messages
+ * with a fixed delay. The PANs are partitioned in contiguous blocks, one per
+ * logical process of MultithreadedSimulatorImpl, and the backhaul messages
+ * between blocks go through the ThreadedCommunicationInterface of the core
+ * module. The same network runs with 1, 2, 4, ... up to maxLps logical
+ * processes, and each run prints a CSV line.
+ *
+ *   ./ns3 run "lr-wpan-tsch-threaded-grid --pans=16 --nodesPerPan=10 --maxLps=4"
+ *
+ * The logical processes share the LR-WPAN channels: build with the NS3_MTP
+ * option to run them on several threads, or run them in turn on a single
+ * thread with --threaded=0. The lookahead is the propagation delay between
+ * the blocks, see LrWpanTschHelper::AssignLogicalProcesses.
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/core-module.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/multithreaded-simulator-impl.h>
+#include <ns3/threaded-communication-interface.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("LrWpanTschThreadedGrid");
+
+/** Acknowledged TSCH transmissions, by logical process. */
+static std::vector<uint64_t> g_acks;
+/** Backhaul messages received, by logical process. */
+static std::vector<uint64_t> g_backhaulRx;
+/** The node of the coordinator of each PAN. */
+static std::vector<uint32_t> g_coordinators;
+/** The logical process of each PAN. */
+static std::vector<uint32_t> g_panLps;
+
+/**
+ * Count an acknowledged TSCH transmission.
+ *
+ * \param lp the logical process of the MAC
+ * \param info the timeslot and packet size
+ */
+static void
+TxDataRxAck(uint32_t lp, std::pair<uint8_t, uint32_t> info)
+{
+    g_acks[lp]++;
+}
+
+/**
+ * Count a backhaul message received by a coordinator.
+ *
+ * \param lp the logical process of the coordinator
+ */
+static void
+BackhaulRx(uint32_t lp)
+{
+    g_backhaulRx[lp]++;
+}
+
+/**
+ * Send a backhaul message from a coordinator to the coordinators of the
+ * neighbor PANs, periodically.
+ *
+ * \param comm the threaded communication interface
+ * \param pan the PAN of the coordinator
+ * \param delay the delay of the backhaul
+ * \param interval the interval between the messages
+ * \param stop the time of the last message
+ */
+static void
+SendBackhaul(Ptr<ThreadedCommunicationInterface> comm,
+             uint32_t pan,
+             Time delay,
+             Time interval,
+             Time stop)
+{
+    // The neighbor before the first PAN wraps around, out of the row.
+    for (uint32_t neighbor : {pan - 1, pan + 1})
+    {
+        if (neighbor < g_coordinators.size())
+        {
+            comm->Send(g_coordinators[neighbor], delay, &BackhaulRx, g_panLps[neighbor]);
+        }
+    }
+    if (Simulator::Now() + interval <= stop)
+    {
+        Simulator::Schedule(interval, &SendBackhaul, comm, pan, delay, interval, stop);
+    }
+}
+
+/**
+ * Build and run the network with some logical processes.
+ *
+ * \param lps the number of logical processes
+ * \param pans the number of PANs
+ * \param nodesPerPan the number of nodes of each PAN
+ * \param duration the simulated time
+ * \param interval the packet interval of each node
+ * \param threaded whether each logical process runs on its own thread
+ */
+static void
+Run(uint32_t lps,
+    uint32_t pans,
+    uint32_t nodesPerPan,
+    double duration,
+    double interval,
+    bool threaded)
+{
+    Simulator::SetImplementation(
+        CreateObjectWithAttributes<MultithreadedSimulatorImpl>("LogicalProcesses",
+                                                               UintegerValue(lps),
+                                                               "Threaded",
+                                                               BooleanValue(threaded)));
+    Ptr<ThreadedCommunicationInterface> comm = CreateObject<ThreadedCommunicationInterface>();
+    comm->Enable();
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    g_acks.assign(lps, 0);
+    g_backhaulRx.assign(lps, 0);
+    g_coordinators.clear();
+    g_panLps.clear();
+
+    LrWpanTschHelper helper;
+    std::vector<NetDeviceContainer> blocks(lps);
+    std::vector<NetDeviceContainer> panDevices;
+    for (uint32_t pan = 0; pan < pans; pan++)
+    {
+        uint32_t lp = pan * lps / pans;
+        NodeContainer nodes;
+        nodes.Create(nodesPerPan);
+        NetDeviceContainer devs = helper.Install(nodes);
+        for (uint32_t i = 0; i < nodes.GetN(); i++)
+        {
+            Ptr<ConstantPositionMobilityModel> mob =
+                CreateObject<ConstantPositionMobilityModel>();
+            mob->SetPosition(Vector(1000.0 * pan + 10.0 * i, 0, 0));
+            nodes.Get(i)->AggregateObject(mob);
+            devs.Get(i)->GetObject<LrWpanTschNetDevice>()->GetNMac()->TraceConnectWithoutContext(
+                "MacTxDataRxAck",
+                MakeBoundCallback(&TxDataRxAck, lp));
+        }
+        helper.AssociateToPan(devs, pan);
+        // The neighbor PANs use slotframes of different sizes.
+        helper.ConfigureSlotframeAllToPan(devs, pan % 3, false, false);
+        helper.AssignStreams(devs, 10 * pan);
+        blocks[lp].Add(devs);
+        panDevices.push_back(devs);
+        g_coordinators.push_back(nodes.Get(0)->GetId());
+        g_panLps.push_back(lp);
+    }
+
+    // The PANs only hear each other through the log distance model.
+    helper.EnablePathLossCache();
+    helper.EnableReceiverCulling(10);
+    // The backhaul delay is far above the radio lookahead between the blocks.
+    Time lookahead = helper.AssignLogicalProcesses(blocks);
+
+    Time stop = Seconds(duration);
+    for (uint32_t pan = 0; pan < pans; pan++)
+    {
+        Simulator::ScheduleWithContext(g_coordinators[pan],
+                                       Seconds(1),
+                                       &SendBackhaul,
+                                       comm,
+                                       pan,
+                                       MilliSeconds(1),
+                                       Seconds(interval),
+                                       stop);
+    }
+    for (const NetDeviceContainer& devs : panDevices)
+    {
+        helper.EnableTsch(devs, 0, duration + 1);
+        for (uint32_t i = 1; i < devs.GetN(); i++)
+        {
+            helper.GenerateTraffic(devs.Get(i),
+                                   devs.Get(0)->GetAddress(),
+                                   20,
+                                   1,
+                                   duration - 2,
+                                   interval);
+        }
+    }
+
+    Simulator::Stop(stop);
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Run();
+    double wall = clock.End() / 1000.0;
+
+    auto simulator = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    uint64_t events = Simulator::GetEventCount();
+    uint64_t windows = simulator->GetWindowCount();
+    uint64_t exchanged = comm->GetExchangedCount();
+    uint64_t acks = 0;
+    uint64_t backhaulRx = 0;
+    for (uint32_t lp = 0; lp < lps; lp++)
+    {
+        acks += g_acks[lp];
+        backhaulRx += g_backhaulRx[lp];
+    }
+    Simulator::Destroy();
+    comm->Dispose();
+
+    std::cout << lps << "," << pans * nodesPerPan << ","
+              << (lps > 1 ? lookahead.GetNanoSeconds() : 0) << "," << events << "," << windows
+              << "," << wall << "," << (wall > 0 ? events / wall : 0) << ","
+              << (wall > 0 ? duration / wall : 0) << "," << acks << "," << backhaulRx << ","
+              << exchanged << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t pans = 8;
+    uint32_t nodesPerPan = 5;
+    uint32_t maxLps = 4;
+    double duration = 10;
+    double interval = 0.1;
+    bool threaded = true;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("pans", "Number of PANs", pans);
+    cmd.AddValue("nodesPerPan", "Number of nodes of each PAN, coordinator included", nodesPerPan);
+    cmd.AddValue("maxLps", "Largest number of logical processes", maxLps);
+    cmd.AddValue("duration", "Simulated time, in seconds", duration);
+    cmd.AddValue("interval", "Packet interval of each node, in seconds", interval);
+    cmd.AddValue("threaded", "Run each logical process on its own thread", threaded);
+    cmd.Parse(argc, argv);
+
+    std::cout << "lps,nodes,radioLookaheadNs,events,windows,wallSeconds,eventsPerSecond,"
+                 "simSecondsPerWallSecond,acks,backhaulRx,exchanged"
+              << std::endl;
+    for (uint32_t lps = 1; lps <= std::min(maxLps, pans); lps *= 2)
+    {
+        Run(lps, pans, nodesPerPan, duration, interval, threaded);
+    }
+
+    return 0;
+}
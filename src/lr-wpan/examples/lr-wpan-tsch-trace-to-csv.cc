@@ -0,0 +1,68 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Convert a binary TSCH trace file, written by TschTraceWriter through
+ * LrWpanTschHelper::EnableEnergyAll, to CSV: one line per MAC timeslot
+ * event, with the node id, ASN, event name, packet size and channel.
+ *
+ *   ./ns3 run "lr-wpan-tsch-trace-to-csv --input=tsch.bin --output=tsch.csv"
+ *
+ * Without --output, the CSV goes to the standard output.
+ */
+
+#include <ns3/abort.h>
+#include <ns3/command-line.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-tsch-trace-file.h>
+
+#include <fstream>
+#include <iostream>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("LrWpanTschTraceToCsv");
+
+int
+main(int argc, char* argv[])
+{
+    std::string input;
+    std::string output;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("input", "Binary TSCH trace file", input);
+    cmd.AddValue("output", "CSV file, the standard output if empty", output);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(input.empty(), "No input file, use --input");
+
+    TschTraceReader reader(input);
+    uint64_t count;
+    if (output.empty())
+    {
+        count = reader.WriteCsv(std::cout);
+    }
+    else
+    {
+        std::ofstream os(output);
+        NS_ABORT_MSG_UNLESS(os.is_open(), "Unable to open file \"" << output << "\"");
+        count = reader.WriteCsv(os);
+    }
+    std::cerr << count << " records converted from " << (reader.IsCompressed() ? "compressed " : "")
+              << "file " << input << std::endl;
+
+    return 0;
+}
@@ -28,15 +28,22 @@
 #include "lr-wpan-energy-source-helper.h"
 #include "lr-wpan-radio-energy-model-helper.h"
 
+#include <ns3/abort.h>
+#include <ns3/boolean.h>
 #include <ns3/energy-module.h>
 #include <ns3/friis-spectrum-propagation-loss.h>
 #include <ns3/log.h>
 #include <ns3/lr-wpan-error-model.h>
 #include <ns3/lr-wpan-tsch-net-device.h>
 #include <ns3/mobility-model.h>
+#include <ns3/multithreaded-simulator-impl.h>
+#include <ns3/propagation-delay-model.h>
 #include <ns3/single-model-spectrum-channel.h>
+#include <ns3/uinteger.h>
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 NS_LOG_COMPONENT_DEFINE("LrWpanTschHelper");
 
@@ -94,6 +101,26 @@ EnergyTraceWithContext(Ptr<OutputStreamWrapper> stream, std::string context, uin
     }
 }
 
+static void
+BinaryEnergyTrace(Ptr<TschTraceWriter> writer,
+                  LrWpanTschMac* mac,
+                  uint32_t nodeid,
+                  TschTraceEvent event,
+                  uint32_t psize)
+{
+    writer->Write(nodeid, mac->GetCurrentAsn(), event, psize, mac->GetCurrentChannel());
+}
+
+static void
+BinaryEnergyTraceTxDataRxAck(Ptr<TschTraceWriter> writer,
+                             LrWpanTschMac* mac,
+                             uint32_t nodeid,
+                             std::pair<uint8_t, uint32_t> info)
+{
+    // The trace carries the channel and the hopping sequence index, not the size.
+    writer->Write(nodeid, mac->GetCurrentAsn(), TSCH_TRACE_TX_DATA_RX_ACK, 0, info.first);
+}
+
  static void
  ConsumedEnergyTracing(Ptr<OutputStreamWrapper> stream_dev,
                        std::string context_dev,
@@ -784,6 +811,63 @@ LrWpanTschHelper::EnableEnergy(Ptr<OutputStreamWrapper> stream, Ptr<NetDevice> d
     EnableAsciiInternal(stream, std::string(), dev, false);
 }
 
+void
+LrWpanTschHelper::EnableEnergyAll(Ptr<TschTraceWriter> writer)
+{
+    NodeContainer n = NodeContainer::GetGlobal();
+
+    for (NodeContainer::Iterator i = n.Begin(); i != n.End(); ++i)
+    {
+        Ptr<Node> node = *i;
+        for (uint32_t j = 0; j < node->GetNDevices(); ++j)
+        {
+            EnableEnergyInternal(writer, node->GetDevice(j));
+        }
+    }
+}
+
+void
+LrWpanTschHelper::EnableEnergy(Ptr<TschTraceWriter> writer, Ptr<NetDevice> dev)
+{
+    EnableEnergyInternal(writer, dev);
+}
+
+void
+LrWpanTschHelper::EnableEnergyInternal(Ptr<TschTraceWriter> writer, Ptr<NetDevice> nd)
+{
+    Ptr<LrWpanTschNetDevice> device = nd->GetObject<LrWpanTschNetDevice>();
+    if (!device)
+    {
+        NS_LOG_INFO("LrWpanTschHelper::EnableEnergyInternal(): Device "
+                    << device << " not of type ns3::LrWpanTschNetDevice");
+        return;
+    }
+
+    // The sinks have no string context: the node id is bound, the ASN and
+    // channel are read from the MAC.
+    uint32_t nodeid = nd->GetNode()->GetId();
+    Ptr<LrWpanTschMac> mac = device->GetNMac();
+    const std::pair<const char*, TschTraceEvent> traces[] = {
+        {"MacTxData", TSCH_TRACE_TX_DATA},
+        {"MacRxData", TSCH_TRACE_RX_DATA},
+        {"MacRxDataTxAck", TSCH_TRACE_RX_DATA_TX_ACK},
+        {"MacSleep", TSCH_TRACE_SLEEP},
+        {"MacIdle", TSCH_TRACE_IDLE},
+        {"MacChannelBusy", TSCH_TRACE_CHANNEL_BUSY},
+        {"MacWaitAck", TSCH_TRACE_WAIT_ACK},
+        {"MacEmptyBuffer", TSCH_TRACE_EMPTY_BUFFER},
+    };
+    for (const auto& trace : traces)
+    {
+        mac->TraceConnectWithoutContext(
+            trace.first,
+            MakeBoundCallback(&BinaryEnergyTrace, writer, PeekPointer(mac), nodeid, trace.second));
+    }
+    mac->TraceConnectWithoutContext(
+        "MacTxDataRxAck",
+        MakeBoundCallback(&BinaryEnergyTraceTxDataRxAck, writer, PeekPointer(mac), nodeid));
+}
+
 void
 LrWpanTschHelper::EnableEnergyInternal(Ptr<OutputStreamWrapper> stream,
                                        std::string prefix,
@@ -1311,17 +1395,148 @@ LrWpanTschHelper::EnableTsch(NetDeviceContainer devs, double start, double durat
     modeRequestoff.TSCHMode = MlmeTschMode_OFF;
     */
 
+    // The timeslots run in the context of their node.
+    for (u_int32_t i = 0; i < devs.GetN(); i++)
+    {
+        uint32_t context = devs.Get(i)->GetNode()->GetId();
+        Simulator::ScheduleWithContext(context,
+                                       Seconds(start),
+                                       &LrWpanTschNetDevice::SetTschMode,
+                                       devs.Get(i)->GetObject<LrWpanTschNetDevice>(),
+                                       true);
+        Simulator::ScheduleWithContext(context,
+                                       Seconds(start + duration),
+                                       &LrWpanTschNetDevice::SetTschMode,
+                                       devs.Get(i)->GetObject<LrWpanTschNetDevice>(),
+                                       false);
+    }
+}
+
+Ptr<TschSlotClock>
+LrWpanTschHelper::InstallSlotClock(NetDeviceContainer devs)
+{
+    Ptr<TschSlotClock> clock = CreateObject<TschSlotClock>();
     for (u_int32_t i = 0; i < devs.GetN(); i++)
     {
-        Simulator::Schedule(Seconds(start),
-                            &LrWpanTschNetDevice::SetTschMode,
-                            devs.Get(i)->GetObject<LrWpanTschNetDevice>(),
-                            true);
-        Simulator::Schedule(Seconds(start + duration),
-                            &LrWpanTschNetDevice::SetTschMode,
-                            devs.Get(i)->GetObject<LrWpanTschNetDevice>(),
-                            false);
+        devs.Get(i)->GetObject<LrWpanTschNetDevice>()->GetNMac()->SetSlotClock(clock);
+    }
+    return clock;
+}
+
+Ptr<TschSlotEngine>
+LrWpanTschHelper::InstallSlotEngine(NetDeviceContainer devs, bool validate)
+{
+    Ptr<TschSlotEngine> engine =
+        CreateObjectWithAttributes<TschSlotEngine>("Validate", BooleanValue(validate));
+    for (u_int32_t i = 0; i < devs.GetN(); i++)
+    {
+        devs.Get(i)->GetObject<LrWpanTschNetDevice>()->GetNMac()->SetSlotClock(engine);
+    }
+    return engine;
+}
+
+Ptr<LrWpanTransmitFilter>
+LrWpanTschHelper::EnableReceiverCulling(double noiseFloorMargin)
+{
+    // The filter only reads path losses from a cache, shared with the channels.
+    if (!DynamicCast<CachedPropagationLossModel>(LrWpanPhy::GetChannelPropagationLossModel()))
+    {
+        EnablePathLossCache();
+    }
+    Ptr<LrWpanTransmitFilter> filter = CreateObject<LrWpanTransmitFilter>();
+    filter->SetAttribute("NoiseFloorMargin", DoubleValue(noiseFloorMargin));
+    LrWpanPhy::AddChannelTransmitFilter(filter);
+    return filter;
+}
+
+Ptr<CachedPropagationLossModel>
+LrWpanTschHelper::EnablePathLossCache()
+{
+    Ptr<CachedPropagationLossModel> cache = CreateObject<CachedPropagationLossModel>();
+    cache->SetModel(CreateObject<LogDistancePropagationLossModel>());
+    LrWpanPhy::SetChannelPropagationLossModel(cache);
+    return cache;
+}
+
+Time
+LrWpanTschHelper::AssignLogicalProcesses(const std::vector<NetDeviceContainer>& pans)
+{
+    Ptr<MultithreadedSimulatorImpl> simulator =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    NS_ASSERT_MSG(simulator, "The simulator implementation is not ns3::MultithreadedSimulatorImpl");
+    UintegerValue lps;
+    simulator->GetAttribute("LogicalProcesses", lps);
+    BooleanValue threaded;
+    simulator->GetAttribute("Threaded", threaded);
+
+    // The channel pool of LrWpanPhy is shared by all the PANs.
+    bool shared = std::min<size_t>(pans.size(), lps.Get()) > 1;
+#ifndef NS3_MTP
+    NS_ABORT_MSG_IF(shared && threaded.Get(),
+                    "Several threads share the channels of the PANs: build with the NS3_MTP "
+                    "option, or set the Threaded attribute of the simulator to false");
+#endif
+
+    for (u_int32_t i = 0; i < pans.size(); i++)
+    {
+        for (u_int32_t j = 0; j < pans[i].GetN(); j++)
+        {
+            simulator->SetLogicalProcess(pans[i].Get(j)->GetNode()->GetId(), i % lps.Get());
+            if (shared)
+            {
+                Ptr<LrWpanPhy> phy = pans[i].Get(j)->GetObject<LrWpanTschNetDevice>()->GetPhy();
+                phy->AttachToAllChannels(i % lps.Get());
+            }
+        }
+    }
+
+    // Without a filter, each signal would start a reception on every PHY,
+    // to be dropped by the PHYs tuned to another channel.
+    bool filtered = false;
+    for (Ptr<const SpectrumTransmitFilter> filter = LrWpanPhy::GetChannelTransmitFilter(); filter;
+         filter = filter->GetNext())
+    {
+        filtered = filtered || DynamicCast<const LrWpanTransmitFilter>(filter);
+    }
+    if (shared && !filtered)
+    {
+        // Only filter by channel, even with a path loss cache.
+        Ptr<LrWpanTransmitFilter> filter = CreateObject<LrWpanTransmitFilter>();
+        filter->SetAttribute("NoiseFloorMargin", DoubleValue(std::numeric_limits<double>::max()));
+        LrWpanPhy::AddChannelTransmitFilter(filter);
+    }
+
+    // The PANs only interact through the channel, after the propagation delay.
+    Time lookahead = Time::Max();
+    for (u_int32_t i = 0; i < pans.size(); i++)
+    {
+        for (u_int32_t k = i + 1; k < pans.size(); k++)
+        {
+            if (i % lps.Get() == k % lps.Get())
+            {
+                continue;
+            }
+            for (auto a = pans[i].Begin(); a != pans[i].End(); a++)
+            {
+                Ptr<PropagationDelayModel> delayModel = (*a)
+                                                            ->GetObject<LrWpanTschNetDevice>()
+                                                            ->GetPhy()
+                                                            ->GetChannel()
+                                                            ->GetPropagationDelayModel();
+                NS_ASSERT_MSG(delayModel, "The PANs need a propagation delay");
+                Ptr<MobilityModel> mobility = (*a)->GetNode()->GetObject<MobilityModel>();
+                for (auto b = pans[k].Begin(); b != pans[k].End(); b++)
+                {
+                    Ptr<MobilityModel> other = (*b)->GetNode()->GetObject<MobilityModel>();
+                    NS_ASSERT_MSG(mobility && other, "The PAN nodes need a mobility model");
+                    lookahead = std::min(lookahead, delayModel->GetDelay(mobility, other));
+                }
+            }
+        }
     }
+    NS_ASSERT_MSG(lookahead.IsStrictlyPositive(), "The PANs of different processes are colocated");
+    simulator->SetAttribute("Lookahead", TimeValue(lookahead));
+    return lookahead;
 }
 
 void
@@ -1333,14 +1548,15 @@ LrWpanTschHelper::GenerateTraffic(Ptr<NetDevice> dev,
                                   double interval)
 {
     double end = start + duration;
-    Simulator::Schedule(Seconds(start),
-                        &LrWpanTschHelper::SendPacket,
-                        this,
-                        dev,
-                        dst,
-                        packet_size,
-                        interval,
-                        end);
+    Simulator::ScheduleWithContext(dev->GetNode()->GetId(),
+                                   Seconds(start),
+                                   &LrWpanTschHelper::SendPacket,
+                                   this,
+                                   dev,
+                                   dst,
+                                   packet_size,
+                                   interval,
+                                   end);
 }
 
 void
@@ -1398,6 +1614,28 @@ LrWpanTschHelper::PrintHoppingLists(NetDeviceContainer devs, int interval)
     );
 }
 
+void
+LrWpanTschHelper::PrintProfile(NetDeviceContainer devs, std::ostream& os)
+{
+    if (!ProfileCounter::IsEnabled())
+    {
+        os << "Profiling counters disabled, configure with --enable-profile-counters"
+           << std::endl;
+    }
+    for (auto i = devs.Begin(); i != devs.End(); i++)
+    {
+        Ptr<LrWpanTschNetDevice> device = (*i)->GetObject<LrWpanTschNetDevice>();
+        if (!device)
+        {
+            continue;
+        }
+        os << "node " << device->GetNode()->GetId() << std::endl;
+        device->GetNMac()->PrintProfile(os);
+        device->GetPhy()->PrintProfile(os);
+    }
+    LrWpanPhy::PrintChannelProfile(os);
+}
+
 
 } // namespace lrwpan
 } // namespace ns3
@@ -31,7 +31,12 @@
 #include <ns3/lr-wpan-radio-energy-model.h>
 #include <ns3/lr-wpan-tsch-mac.h>
 #include <ns3/lr-wpan-tsch-net-device.h>
+#include <ns3/lr-wpan-tsch-slot-clock.h>
+#include <ns3/lr-wpan-tsch-slot-engine.h>
+#include <ns3/lr-wpan-tsch-trace-file.h>
+#include <ns3/lr-wpan-transmit-filter.h>
 #include <ns3/node-container.h>
+#include <ns3/propagation-loss-model.h>
 #include <ns3/random-variable-stream.h>
 #include <ns3/spectrum-channel.h>
 #include <ns3/trace-helper.h>
@@ -235,6 +240,72 @@ class LrWpanTschHelper : public PcapHelperForDevice, public AsciiTraceHelperForD
      */
     void EnableTsch(NetDeviceContainer devs, double start, double duration);
 
+    /**
+     * @brief InstallSlotClock: share one timeslot clock between the devices
+     * of a PAN, instead of scheduling one timeslot event per device
+     * @param devs
+     * @return the slot clock
+     */
+    Ptr<TschSlotClock> InstallSlotClock(NetDeviceContainer devs);
+
+    /**
+     * @brief InstallSlotEngine: share one slot engine between the devices of
+     * a PAN, deciding each timeslot in a single step instead of running the
+     * PHYs, or validating the timeslots run by the PHYs
+     * @param devs
+     * @param validate whether to validate the packet-level timeslots
+     * @return the slot engine
+     */
+    Ptr<TschSlotEngine> InstallSlotEngine(NetDeviceContainer devs, bool validate = false);
+
+    /**
+     * @brief EnableReceiverCulling: stop delivering the signals to the PHYs
+     * tuned to another channel or too far below their noise floor.
+     * Must be called after all the devices are installed. Enables the path
+     * loss cache, unless the channels already use one
+     * @param noiseFloorMargin margin below the noise floor, in dB
+     * @return the transmit filter, counting the culled signals
+     */
+    Ptr<LrWpanTransmitFilter> EnableReceiverCulling(double noiseFloorMargin);
+
+    /**
+     * @brief EnablePathLossCache: share one log distance propagation loss
+     * model between the channels, caching the loss of each pair of devices.
+     * Must be called after all the devices are installed, and the devices
+     * must not move but through course changes
+     * @return the cache, counting its hits and misses
+     */
+    Ptr<CachedPropagationLossModel> EnablePathLossCache();
+
+    /**
+     * @brief AssignLogicalProcesses: run each PAN on its own logical process
+     * of the multithreaded simulator, and set its lookahead to the shortest
+     * propagation delay between the devices of different PANs. The simulator
+     * implementation must be ns3::MultithreadedSimulatorImpl, the PANs being
+     * assigned in turn to its logical processes. The devices must not move,
+     * and must all be created.
+     *
+     * The PANs share the channels, so with several logical processes, the
+     * PHYs are attached to all the channels, see
+     * LrWpanPhy::AttachToAllChannels. The threads of the logical processes
+     * need the NS3_MTP build option, without which the simulator must run
+     * them in turn, its Threaded attribute being false. The PANs must not
+     * share a slot clock.
+     *
+     * The speedup is limited. The lookahead is only the propagation delay,
+     * about 3.3 us per km, so that each window holds few events and ends
+     * with a barrier. A LrWpanTransmitFilter, added to the channels when none is, keeps the
+     * signals of other channels away from the PHYs of the same logical
+     * process, but the PHYs of the other logical processes still receive
+     * the signals of every channel, their state being unknown to the
+     * transmitter. Call EnableReceiverCulling before, to configure that
+     * filter. Each channel still holds all the PHYs and runs the filter for
+     * each of them, which outweighs the gain of the threads on few cores.
+     * @param pans the devices of each PAN
+     * @return the lookahead
+     */
+    Time AssignLogicalProcesses(const std::vector<NetDeviceContainer>& pans);
+
     /**
      * @brief EnableEnergyAll: tracing energy for all devices of each node based on MAC timeslot
      * type
@@ -250,6 +321,21 @@ class LrWpanTschHelper : public PcapHelperForDevice, public AsciiTraceHelperForD
      */
     void EnableEnergy(Ptr<OutputStreamWrapper> stream, Ptr<NetDevice> dev);
 
+    /**
+     * @brief EnableEnergyAll: tracing the MAC timeslot events of all devices to a binary
+     * columnar file, with the node id, ASN, event, packet size and channel of each event
+     * @param writer: the binary trace file
+     */
+    void EnableEnergyAll(Ptr<TschTraceWriter> writer);
+
+    /**
+     * @brief EnableEnergy: tracing the MAC timeslot events of a certain device to a binary
+     * columnar file
+     * @param writer: the binary trace file
+     * @param dev
+     */
+    void EnableEnergy(Ptr<TschTraceWriter> writer, Ptr<NetDevice> dev);
+
     /**
      * @brief EnableEnergyAllPhy: tracing energy for all devices of each node based on
      different
@@ -327,6 +413,14 @@ class LrWpanTschHelper : public PcapHelperForDevice, public AsciiTraceHelperForD
 
     static void PrintHoppingLists(NetDeviceContainer devs, int interval);
 
+    /**
+     * @brief Print the profiling counters of the MAC and PHY of the devices, then of the
+     * spectrum channels, updated in the builds with the NS3_PROFILE_COUNTERS option
+     * @param devs the LrWpanTschNetDevices
+     * @param os the output stream
+     */
+    static void PrintProfile(NetDeviceContainer devs, std::ostream& os);
+
 
   private:
     // Disable implicit constructors
@@ -379,6 +473,14 @@ class LrWpanTschHelper : public PcapHelperForDevice, public AsciiTraceHelperForD
                               Ptr<NetDevice> nd,
                               bool explicitFilename);
 
+    /**
+     * @brief EnableEnergyInternal: tracing the MAC timeslot events of a certain node to a
+     * binary file
+     * \param writer The binary trace file.
+     * \param nd Net device for which you want to enable tracing.
+     */
+    void EnableEnergyInternal(Ptr<TschTraceWriter> writer, Ptr<NetDevice> nd);
+
     uint8_t m_channelIdx; // channel model
     int m_slotframehandle;          // slotframe handle
     u_int32_t m_numchannel;         // number of TSCH channels, default 16
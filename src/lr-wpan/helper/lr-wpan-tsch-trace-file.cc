@@ -0,0 +1,416 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lr-wpan-tsch-trace-file.h"
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+
+#include <cstring>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanTschTraceFile");
+
+const char TschTraceWriter::MAGIC[8] = {'T', 'S', 'C', 'H', 'T', 'R', 'C', '1'};
+
+/**
+ * Append an unsigned integer, little-endian.
+ *
+ * \param buffer the buffer
+ * \param value the value
+ * \param bytes the width of the value
+ */
+static void
+PutFixed(std::vector<uint8_t>& buffer, uint64_t value, uint32_t bytes)
+{
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+/**
+ * Append an unsigned integer as a varint, 7 bits per byte.
+ *
+ * \param buffer the buffer
+ * \param value the value
+ */
+static void
+PutVarint(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+ * Encode the difference of two values, so that small negative differences
+ * take few varint bytes.
+ *
+ * \param value the value
+ * \param previous the previous value
+ * \return the zigzag-encoded difference
+ */
+static uint64_t
+ZigZag(uint64_t value, uint64_t previous)
+{
+    auto delta = static_cast<int64_t>(value - previous);
+    return (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+}
+
+/**
+ * Decode a difference encoded by ZigZag().
+ *
+ * \param encoded the encoded difference
+ * \param previous the previous value
+ * \return the value
+ */
+static uint64_t
+UnZigZag(uint64_t encoded, uint64_t previous)
+{
+    return previous + ((encoded >> 1) ^ (~(encoded & 1) + 1));
+}
+
+/**
+ * Decode the fields of a block.
+ */
+class TschTraceBlockDecoder
+{
+  public:
+    /**
+     * \param buffer the encoded block
+     */
+    TschTraceBlockDecoder(const std::vector<uint8_t>& buffer)
+        : m_buffer(buffer),
+          m_pos(0)
+    {
+    }
+
+    /**
+     * \param bytes the width of the value
+     * \return the little-endian unsigned integer
+     */
+    uint64_t GetFixed(uint32_t bytes)
+    {
+        NS_ABORT_MSG_IF(m_pos + bytes > m_buffer.size(), "Truncated TSCH trace block");
+        uint64_t value = 0;
+        for (uint32_t i = 0; i < bytes; i++)
+        {
+            value |= static_cast<uint64_t>(m_buffer[m_pos++]) << (8 * i);
+        }
+        return value;
+    }
+
+    /**
+     * \return the varint
+     */
+    uint64_t GetVarint()
+    {
+        uint64_t value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7)
+        {
+            NS_ABORT_MSG_IF(m_pos >= m_buffer.size(), "Truncated TSCH trace block");
+            uint8_t byte = m_buffer[m_pos++];
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+            {
+                return value;
+            }
+        }
+        NS_ABORT_MSG("Malformed varint in TSCH trace block");
+        return value;
+    }
+
+    /**
+     * \return whether the whole block was decoded
+     */
+    bool IsDone() const
+    {
+        return m_pos == m_buffer.size();
+    }
+
+  private:
+    const std::vector<uint8_t>& m_buffer; //!< The encoded block
+    std::size_t m_pos;                    //!< The next byte
+};
+
+const char*
+GetTschTraceEventName(uint8_t event)
+{
+    static const char* names[TSCH_TRACE_EVENT_COUNT] = {"MacTxData",
+                                                        "MacRxData",
+                                                        "MacTxDataRxAck",
+                                                        "MacRxDataTxAck",
+                                                        "MacSleep",
+                                                        "MacIdle",
+                                                        "MacChannelBusy",
+                                                        "MacWaitAck",
+                                                        "MacEmptyBuffer"};
+    return event < TSCH_TRACE_EVENT_COUNT ? names[event] : "Unknown";
+}
+
+TschTraceWriter::TschTraceWriter(const std::string& filename, bool compressed, uint32_t blockSize)
+    : m_compressed(compressed),
+      m_blockSize(blockSize),
+      m_count(0)
+{
+    NS_LOG_FUNCTION(this << filename << compressed << blockSize);
+    NS_ASSERT_MSG(blockSize > 0, "Empty blocks");
+
+    m_file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_UNLESS(m_file.is_open(),
+                        "TschTraceWriter: Unable to open file \"" << filename << "\"");
+    m_file.write(MAGIC, sizeof(MAGIC));
+    PutFixed(m_buffer, m_compressed ? FLAG_COMPRESSED : 0, 4);
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+    m_buffer.clear();
+
+    m_nodes.reserve(m_blockSize);
+    m_asns.reserve(m_blockSize);
+    m_events.reserve(m_blockSize);
+    m_sizes.reserve(m_blockSize);
+    m_channels.reserve(m_blockSize);
+}
+
+TschTraceWriter::~TschTraceWriter()
+{
+    NS_LOG_FUNCTION(this);
+    Flush();
+}
+
+void
+TschTraceWriter::Write(uint32_t node,
+                       uint64_t asn,
+                       TschTraceEvent event,
+                       uint32_t size,
+                       uint8_t channel)
+{
+    NS_ASSERT_MSG(size <= UINT16_MAX, "Packet size " << size << " too large for the trace");
+
+    m_nodes.push_back(node);
+    m_asns.push_back(asn);
+    m_events.push_back(event);
+    m_sizes.push_back(static_cast<uint16_t>(size));
+    m_channels.push_back(channel);
+    m_count++;
+    if (m_nodes.size() == m_blockSize)
+    {
+        Flush();
+    }
+}
+
+void
+TschTraceWriter::Flush()
+{
+    NS_LOG_FUNCTION(this << m_nodes.size());
+
+    uint32_t n = m_nodes.size();
+    if (n == 0)
+    {
+        m_file.flush();
+        return;
+    }
+
+    // Room for the block header, filled in once the columns are encoded.
+    m_buffer.assign(8, 0);
+    if (m_compressed)
+    {
+        uint64_t previous = 0;
+        for (uint32_t node : m_nodes)
+        {
+            PutVarint(m_buffer, ZigZag(node, previous));
+            previous = node;
+        }
+        previous = 0;
+        for (uint64_t asn : m_asns)
+        {
+            PutVarint(m_buffer, ZigZag(asn, previous));
+            previous = asn;
+        }
+        m_buffer.insert(m_buffer.end(), m_events.begin(), m_events.end());
+        for (uint16_t size : m_sizes)
+        {
+            PutVarint(m_buffer, size);
+        }
+    }
+    else
+    {
+        m_buffer.reserve(8 + 16 * n);
+        for (uint32_t node : m_nodes)
+        {
+            PutFixed(m_buffer, node, 4);
+        }
+        for (uint64_t asn : m_asns)
+        {
+            PutFixed(m_buffer, asn, 8);
+        }
+        m_buffer.insert(m_buffer.end(), m_events.begin(), m_events.end());
+        for (uint16_t size : m_sizes)
+        {
+            PutFixed(m_buffer, size, 2);
+        }
+    }
+    m_buffer.insert(m_buffer.end(), m_channels.begin(), m_channels.end());
+
+    uint32_t bytes = m_buffer.size() - 8;
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        m_buffer[i] = static_cast<uint8_t>(n >> (8 * i));
+        m_buffer[4 + i] = static_cast<uint8_t>(bytes >> (8 * i));
+    }
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+    m_file.flush();
+
+    m_nodes.clear();
+    m_asns.clear();
+    m_events.clear();
+    m_sizes.clear();
+    m_channels.clear();
+}
+
+uint64_t
+TschTraceWriter::GetRecordCount() const
+{
+    return m_count;
+}
+
+TschTraceReader::TschTraceReader(const std::string& filename)
+    : m_compressed(false),
+      m_next(0)
+{
+    NS_LOG_FUNCTION(this << filename);
+
+    m_file.open(filename, std::ios::in | std::ios::binary);
+    NS_ABORT_MSG_UNLESS(m_file.is_open(),
+                        "TschTraceReader: Unable to open file \"" << filename << "\"");
+
+    char magic[sizeof(TschTraceWriter::MAGIC)];
+    m_buffer.resize(4);
+    m_file.read(magic, sizeof(magic));
+    m_file.read(reinterpret_cast<char*>(m_buffer.data()), 4);
+    NS_ABORT_MSG_UNLESS(m_file &&
+                            std::memcmp(magic, TschTraceWriter::MAGIC, sizeof(magic)) == 0,
+                        "\"" << filename << "\" is not a TSCH trace file");
+    m_compressed = TschTraceBlockDecoder(m_buffer).GetFixed(4) & TschTraceWriter::FLAG_COMPRESSED;
+}
+
+bool
+TschTraceReader::IsCompressed() const
+{
+    return m_compressed;
+}
+
+bool
+TschTraceReader::ReadBlock()
+{
+    m_buffer.resize(8);
+    m_file.read(reinterpret_cast<char*>(m_buffer.data()), 8);
+    if (m_file.gcount() == 0)
+    {
+        return false;
+    }
+    NS_ABORT_MSG_UNLESS(m_file.gcount() == 8, "Truncated TSCH trace block header");
+    TschTraceBlockDecoder header(m_buffer);
+    auto n = static_cast<uint32_t>(header.GetFixed(4));
+    auto bytes = static_cast<uint32_t>(header.GetFixed(4));
+
+    m_buffer.resize(bytes);
+    m_file.read(reinterpret_cast<char*>(m_buffer.data()), bytes);
+    NS_ABORT_MSG_UNLESS(m_file.gcount() == bytes, "Truncated TSCH trace block");
+
+    TschTraceBlockDecoder decoder(m_buffer);
+    m_block.resize(n);
+    m_next = 0;
+    uint64_t previous = 0;
+    for (TschTraceRecord& record : m_block)
+    {
+        if (m_compressed)
+        {
+            previous = UnZigZag(decoder.GetVarint(), previous);
+            record.node = static_cast<uint32_t>(previous);
+        }
+        else
+        {
+            record.node = static_cast<uint32_t>(decoder.GetFixed(4));
+        }
+    }
+    previous = 0;
+    for (TschTraceRecord& record : m_block)
+    {
+        if (m_compressed)
+        {
+            previous = UnZigZag(decoder.GetVarint(), previous);
+            record.asn = previous;
+        }
+        else
+        {
+            record.asn = decoder.GetFixed(8);
+        }
+    }
+    for (TschTraceRecord& record : m_block)
+    {
+        record.event = static_cast<uint8_t>(decoder.GetFixed(1));
+    }
+    for (TschTraceRecord& record : m_block)
+    {
+        record.size =
+            static_cast<uint32_t>(m_compressed ? decoder.GetVarint() : decoder.GetFixed(2));
+    }
+    for (TschTraceRecord& record : m_block)
+    {
+        record.channel = static_cast<uint8_t>(decoder.GetFixed(1));
+    }
+    NS_ABORT_MSG_UNLESS(decoder.IsDone(), "Trailing bytes in TSCH trace block");
+    return true;
+}
+
+bool
+TschTraceReader::Read(TschTraceRecord& record)
+{
+    while (m_next == m_block.size())
+    {
+        if (!ReadBlock())
+        {
+            return false;
+        }
+    }
+    record = m_block[m_next++];
+    return true;
+}
+
+uint64_t
+TschTraceReader::WriteCsv(std::ostream& os)
+{
+    uint64_t count = 0;
+    TschTraceRecord record;
+    os << "node,asn,event,size,channel\n";
+    while (Read(record))
+    {
+        os << record.node << "," << record.asn << "," << GetTschTraceEventName(record.event)
+           << "," << record.size << "," << unsigned(record.channel) << "\n";
+        count++;
+    }
+    return count;
+}
+
+} // namespace lrwpan
+} // namespace ns3
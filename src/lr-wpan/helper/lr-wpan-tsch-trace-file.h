@@ -0,0 +1,207 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LR_WPAN_TSCH_TRACE_FILE_H
+#define LR_WPAN_TSCH_TRACE_FILE_H
+
+#include <ns3/simple-ref-count.h>
+
+#include <fstream>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * The TSCH MAC timeslot events recorded in a binary trace file, one per
+ * MAC trace source.
+ */
+enum TschTraceEvent : uint8_t
+{
+    TSCH_TRACE_TX_DATA = 0,        //!< MacTxData
+    TSCH_TRACE_RX_DATA = 1,        //!< MacRxData
+    TSCH_TRACE_TX_DATA_RX_ACK = 2, //!< MacTxDataRxAck
+    TSCH_TRACE_RX_DATA_TX_ACK = 3, //!< MacRxDataTxAck
+    TSCH_TRACE_SLEEP = 4,          //!< MacSleep
+    TSCH_TRACE_IDLE = 5,           //!< MacIdle
+    TSCH_TRACE_CHANNEL_BUSY = 6,   //!< MacChannelBusy
+    TSCH_TRACE_WAIT_ACK = 7,       //!< MacWaitAck
+    TSCH_TRACE_EMPTY_BUFFER = 8,   //!< MacEmptyBuffer
+    TSCH_TRACE_EVENT_COUNT = 9     //!< Number of events
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * Get the name of a binary trace event, as the name of its trace source.
+ *
+ * \param event the event
+ * \return the name, or "Unknown"
+ */
+const char* GetTschTraceEventName(uint8_t event);
+
+/**
+ * \ingroup lr-wpan
+ *
+ * A timeslot event of a binary trace file.
+ */
+struct TschTraceRecord
+{
+    uint32_t node;   //!< The node id
+    uint64_t asn;    //!< The ASN of the timeslot
+    uint8_t event;   //!< The event, a TschTraceEvent
+    uint32_t size;   //!< The packet size, 0 if none
+    uint8_t channel; //!< The channel of the timeslot
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Writes the TSCH MAC timeslot events to a binary columnar file.
+ *
+ * An alternative to the ASCII energy traces of LrWpanTschHelper, whose
+ * formatting and string contexts dominate long runs. The records are
+ * buffered by column and written in blocks of up to blockSize records:
+ *
+ * - file header: the magic "TSCHTRC1", then the uint32 flags;
+ * - block: the uint32 record count and the uint32 byte count of the
+ *   columns, then the columns node, ASN, event, size and channel.
+ *
+ * Uncompressed, the columns have fixed widths: uint32, uint64, uint8,
+ * uint16 and uint8, little-endian, 16 bytes per record. With the
+ * compressed flag, the node, ASN and size columns are delta-encoded
+ * varints, which usually take 2 to 4 bytes per record.
+ *
+ * The writer is not thread-safe: with MultithreadedSimulatorImpl, use a
+ * writer per logical process.
+ */
+class TschTraceWriter : public SimpleRefCount<TschTraceWriter>
+{
+  public:
+    /** The magic number at the start of the file. */
+    static const char MAGIC[8];
+    /** The file header flag of compressed blocks. */
+    static const uint32_t FLAG_COMPRESSED = 1;
+
+    /**
+     * Open the file.
+     *
+     * \param filename the file name
+     * \param compressed whether to compress the blocks
+     * \param blockSize the number of records per block
+     */
+    TschTraceWriter(const std::string& filename,
+                    bool compressed = false,
+                    uint32_t blockSize = 65536);
+    /** Flush the records and close the file. */
+    ~TschTraceWriter();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    TschTraceWriter(const TschTraceWriter&) = delete;
+    TschTraceWriter& operator=(const TschTraceWriter&) = delete;
+
+    /**
+     * Add a record, written with the block.
+     *
+     * \param node the node id
+     * \param asn the ASN of the timeslot
+     * \param event the event
+     * \param size the packet size, lower than 65536
+     * \param channel the channel of the timeslot
+     */
+    void Write(uint32_t node, uint64_t asn, TschTraceEvent event, uint32_t size, uint8_t channel);
+
+    /** Write the buffered records as a block. */
+    void Flush();
+
+    /**
+     * \return the number of records written, including the buffered ones
+     */
+    uint64_t GetRecordCount() const;
+
+  private:
+    std::ofstream m_file;            //!< The file
+    bool m_compressed;               //!< Whether to compress the blocks
+    uint32_t m_blockSize;            //!< The number of records per block
+    uint64_t m_count;                //!< The number of records written
+    std::vector<uint32_t> m_nodes;   //!< The node column of the block
+    std::vector<uint64_t> m_asns;    //!< The ASN column of the block
+    std::vector<uint8_t> m_events;   //!< The event column of the block
+    std::vector<uint16_t> m_sizes;   //!< The size column of the block
+    std::vector<uint8_t> m_channels; //!< The channel column of the block
+    std::vector<uint8_t> m_buffer;   //!< The encoded block
+};
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Reads the binary files of TschTraceWriter.
+ */
+class TschTraceReader
+{
+  public:
+    /**
+     * Open the file. Aborts if it is not a TSCH trace file.
+     *
+     * \param filename the file name
+     */
+    TschTraceReader(const std::string& filename);
+
+    /**
+     * Read the next record.
+     *
+     * \param [out] record the record
+     * \return false at the end of the file
+     */
+    bool Read(TschTraceRecord& record);
+
+    /**
+     * \return whether the blocks are compressed
+     */
+    bool IsCompressed() const;
+
+    /**
+     * Convert the remaining records to CSV, with a header line.
+     *
+     * \param os the output stream
+     * \return the number of records converted
+     */
+    uint64_t WriteCsv(std::ostream& os);
+
+  private:
+    /**
+     * Read and decode the next block.
+     *
+     * \return false at the end of the file
+     */
+    bool ReadBlock();
+
+    std::ifstream m_file;                 //!< The file
+    bool m_compressed;                    //!< Whether the blocks are compressed
+    std::vector<TschTraceRecord> m_block; //!< The records of the current block
+    std::size_t m_next;                   //!< The next record of the current block
+    std::vector<uint8_t> m_buffer;        //!< The encoded block
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_TSCH_TRACE_FILE_H */
@@ -18,8 +18,13 @@
  */
 #include "lr-wpan-error-model.h"
 
+#include <ns3/abort.h>
+#include <ns3/boolean.h>
+#include <ns3/double.h>
 #include <ns3/log.h>
+#include <ns3/uinteger.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace ns3
@@ -30,17 +35,48 @@ namespace lrwpan
 NS_LOG_COMPONENT_DEFINE("LrWpanErrorModel");
 NS_OBJECT_ENSURE_REGISTERED(LrWpanErrorModel);
 
+/**
+ * Largest SNR of the BER table, as a power ratio. Above it, the BER is
+ * extrapolated with its asymptote 4 exp(-10 SNR), within a relative error
+ * of 1e-11.
+ */
+static const double TABLE_MAX_SNR = 8.0;
+
 TypeId
 LrWpanErrorModel::GetTypeId()
 {
     static TypeId tid = TypeId("ns3::LrWpanErrorModel")
                             .SetParent<Object>()
                             .SetGroupName("LrWpan")
-                            .AddConstructor<LrWpanErrorModel>();
+                            .AddConstructor<LrWpanErrorModel>()
+                            .AddAttribute("Tabulated",
+                                          "Whether the BER is interpolated in a table built at "
+                                          "construction, instead of computed exactly.",
+                                          TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(&LrWpanErrorModel::m_tabulated),
+                                          MakeBooleanChecker())
+                            .AddAttribute("TableSize",
+                                          "The number of SNR steps of the BER table.",
+                                          TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                                          UintegerValue(1024),
+                                          MakeUintegerAccessor(&LrWpanErrorModel::m_tableSize),
+                                          MakeUintegerChecker<uint32_t>(1))
+                            .AddAttribute("MaxTableError",
+                                          "The largest relative BER error allowed for the table.",
+                                          TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                                          DoubleValue(1e-3),
+                                          MakeDoubleAccessor(&LrWpanErrorModel::m_maxTableError),
+                                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
 LrWpanErrorModel::LrWpanErrorModel()
+    : m_tabulated(false),
+      m_tableSize(1024),
+      m_maxTableError(1e-3),
+      m_tableError(0),
+      m_snrStep(0)
 {
     m_binomialCoefficients[0] = 1;
     m_binomialCoefficients[1] = -16;
@@ -61,8 +97,53 @@ LrWpanErrorModel::LrWpanErrorModel()
     m_binomialCoefficients[16] = 1;
 }
 
+void
+LrWpanErrorModel::NotifyConstructionCompleted()
+{
+    if (m_tabulated)
+    {
+        BuildTable();
+    }
+    Object::NotifyConstructionCompleted();
+}
+
+void
+LrWpanErrorModel::BuildTable() const
+{
+    NS_LOG_FUNCTION(this << m_tableSize);
+    m_snrStep = TABLE_MAX_SNR / m_tableSize;
+    m_logBer.resize(m_tableSize + 1);
+    for (uint32_t i = 0; i <= m_tableSize; i++)
+    {
+        m_logBer[i] = std::log(GetExactBer(i * m_snrStep));
+    }
+
+    // The interpolation error is the largest between the table points.
+    m_tableError = 0;
+    for (uint32_t i = 0; i < m_tableSize; i++)
+    {
+        for (double offset : {0.25, 0.5, 0.75})
+        {
+            double snr = (i + offset) * m_snrStep;
+            double exact = GetExactBer(snr);
+            m_tableError =
+                std::max(m_tableError, std::abs(GetTabulatedBer(snr) - exact) / exact);
+        }
+    }
+    NS_LOG_DEBUG("Largest relative BER error of the table: " << m_tableError);
+    NS_ABORT_MSG_IF(m_tableError > m_maxTableError,
+                    "The BER table error " << m_tableError << " exceeds " << m_maxTableError
+                                           << ", increase TableSize");
+}
+
 double
-LrWpanErrorModel::GetChunkSuccessRate(double snr, uint32_t nbits) const
+LrWpanErrorModel::GetTableError() const
+{
+    return m_tableError;
+}
+
+double
+LrWpanErrorModel::GetExactBer(double snr) const
 {
     double ber = 0.0;
 
@@ -73,9 +154,43 @@ LrWpanErrorModel::GetChunkSuccessRate(double snr, uint32_t nbits) const
 
     ber = ber * 8.0 / 15.0 / 16.0;
 
-    ber = std::min(ber, 1.0);
-    double retval = pow(1.0 - ber, nbits);
+    return std::min(ber, 1.0);
+}
+
+double
+LrWpanErrorModel::GetTabulatedBer(double snr) const
+{
+    double position = std::max(snr, 0.0) / m_snrStep;
+    if (position >= m_tableSize)
+    {
+        return std::exp(m_logBer[m_tableSize] - 10.0 * (snr - TABLE_MAX_SNR));
+    }
+    auto i = static_cast<uint32_t>(position);
+    double fraction = position - i;
+    return std::exp(m_logBer[i] + fraction * (m_logBer[i + 1] - m_logBer[i]));
+}
+
+double
+LrWpanErrorModel::GetChunkSuccessRate(double snr, uint32_t nbits) const
+{
+    if (m_tabulated)
+    {
+        return std::exp(nbits * std::log1p(-GetTabulatedBer(snr)));
+    }
+
+    double retval = pow(1.0 - GetExactBer(snr), nbits);
     return retval;
 }
+
+double
+LrWpanErrorModel::GetLogBitSuccessRate(double snr) const
+{
+    if (m_logBer.empty())
+    {
+        BuildTable();
+    }
+    return std::log1p(-GetTabulatedBer(snr));
+}
+
 } // namespace lrwpan
 } // namespace ns3
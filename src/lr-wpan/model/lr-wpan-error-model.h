@@ -21,6 +21,8 @@
 
 #include <ns3/object.h>
 
+#include <vector>
+
 namespace ns3
 {
 namespace lrwpan
@@ -32,6 +34,12 @@ namespace lrwpan
  * Model the error rate for IEEE 802.15.4 2.4 GHz AWGN channel for OQPSK
  * the model description can be found in IEEE Std 802.15.4-2006, section
  * E.4.1.7
+ *
+ * If the Tabulated attribute is true, the BER is interpolated in a table of
+ * its logarithm, built at construction over TableSize SNR steps, and the
+ * chunk success rate is computed from log1p(-BER). The largest relative
+ * BER error of the table, measured against the exact formula between the
+ * table points, must not exceed MaxTableError.
  */
 class LrWpanErrorModel : public Object
 {
@@ -54,11 +62,61 @@ class LrWpanErrorModel : public Object
      */
     double GetChunkSuccessRate(double snr, uint32_t nbits) const;
 
+    /**
+     * Return the logarithm of the bit success rate for given SNR,
+     * interpolated in the BER table. The success rate of a chunk of n bits
+     * is exp(n * GetLogBitSuccessRate(snr)). The table is built on first
+     * use if the BER is not tabulated.
+     *
+     * \param snr SNR expressed as a power ratio (i.e. not in dB)
+     * \return log(1 - BER)
+     */
+    double GetLogBitSuccessRate(double snr) const;
+
+    /**
+     * Get the largest relative BER error of the table, against the exact
+     * formula.
+     *
+     * \return the relative error, zero if the table is not built
+     */
+    double GetTableError() const;
+
+  protected:
+    void NotifyConstructionCompleted() override;
+
   private:
+    /**
+     * Compute the BER with the exact formula.
+     *
+     * \param snr SNR expressed as a power ratio (i.e. not in dB)
+     * \return the bit error rate
+     */
+    double GetExactBer(double snr) const;
+
+    /**
+     * Interpolate the BER in the table.
+     *
+     * \param snr SNR expressed as a power ratio (i.e. not in dB)
+     * \return the bit error rate
+     */
+    double GetTabulatedBer(double snr) const;
+
+    /**
+     * Build the table of the BER and measure its error.
+     */
+    void BuildTable() const;
+
     /**
      * Array of precalculated binomial coefficients.
      */
     double m_binomialCoefficients[17];
+
+    bool m_tabulated;                     //!< Whether the BER is interpolated in m_logBer
+    uint32_t m_tableSize;                 //!< Number of SNR steps of the table
+    double m_maxTableError;               //!< Largest relative BER error allowed for the table
+    mutable double m_tableError;          //!< Largest relative BER error of the table
+    mutable double m_snrStep;             //!< SNR step of the table, as a power ratio
+    mutable std::vector<double> m_logBer; //!< Logarithm of the BER at each SNR step
 };
 } // namespace lrwpan
 } // namespace ns3
@@ -19,6 +19,8 @@
  */
 #include "lr-wpan-interference-helper.h"
 
+#include "lr-wpan-spectrum-value-helper.h"
+
 #include <ns3/log.h>
 #include <ns3/spectrum-model.h>
 #include <ns3/spectrum-value.h>
@@ -30,11 +32,18 @@ namespace lrwpan
 
 NS_LOG_COMPONENT_DEFINE("LrWpanInterferenceHelper");
 
+/**
+ * Number of removed signals after which the in-band powers are summed again.
+ */
+static const uint32_t RESYNC_REMOVALS = 1000;
+
 LrWpanInterferenceHelper::LrWpanInterferenceHelper(Ptr<const SpectrumModel> spectrumModel)
     : m_spectrumModel(spectrumModel),
+      m_removals(0),
       m_dirty(false)
 {
     m_signal = Create<SpectrumValue>(m_spectrumModel);
+    m_inBandPower.fill(0.0);
 }
 
 LrWpanInterferenceHelper::~LrWpanInterferenceHelper()
@@ -53,10 +62,21 @@ LrWpanInterferenceHelper::AddSignal(Ptr<const SpectrumValue> signal)
 
     if (signal->GetSpectrumModel() == m_spectrumModel)
     {
-        result = m_signals.insert(signal).second;
-        if (result && !m_dirty)
+        auto it = m_signals.try_emplace(PeekPointer(signal));
+        result = it.second;
+        if (result)
         {
-            *m_signal += *signal;
+            Signal& added = it.first->second;
+            added.psd = signal;
+            for (uint32_t i = 0; i < added.power.size(); i++)
+            {
+                added.power[i] = LrWpanSpectrumValueHelper::TotalAvgPower(signal, 11 + i);
+                m_inBandPower[i] += added.power[i];
+            }
+            if (!m_dirty)
+            {
+                *m_signal += *signal;
+            }
         }
     }
     return result;
@@ -71,10 +91,21 @@ LrWpanInterferenceHelper::RemoveSignal(Ptr<const SpectrumValue> signal)
 
     if (signal->GetSpectrumModel() == m_spectrumModel)
     {
-        result = (m_signals.erase(signal) == 1);
+        auto it = m_signals.find(PeekPointer(signal));
+        result = (it != m_signals.end());
         if (result)
         {
+            for (uint32_t i = 0; i < m_inBandPower.size(); i++)
+            {
+                m_inBandPower[i] -= it->second.power[i];
+            }
+            m_signals.erase(it);
             m_dirty = true;
+
+            if (m_signals.empty() || ++m_removals == RESYNC_REMOVALS)
+            {
+                ResyncInBandPower();
+            }
         }
     }
     return result;
@@ -87,6 +118,7 @@ LrWpanInterferenceHelper::ClearSignals()
 
     m_signals.clear();
     m_dirty = true;
+    ResyncInBandPower();
 }
 
 Ptr<SpectrumValue>
@@ -100,7 +132,7 @@ LrWpanInterferenceHelper::GetSignalPsd() const
         m_signal = Create<SpectrumValue>(m_spectrumModel);
         for (auto it = m_signals.begin(); it != m_signals.end(); ++it)
         {
-            *m_signal += *(*it);
+            *m_signal += *(it->second.psd);
         }
         m_dirty = false;
     }
@@ -108,5 +140,30 @@ LrWpanInterferenceHelper::GetSignalPsd() const
     return m_signal->Copy();
 }
 
+double
+LrWpanInterferenceHelper::GetInBandPower(uint32_t channel) const
+{
+    NS_LOG_FUNCTION(this << channel);
+    NS_ASSERT_MSG((channel >= 11 && channel <= 26), "Invalid channel numbers");
+
+    return m_inBandPower[channel - 11];
+}
+
+void
+LrWpanInterferenceHelper::ResyncInBandPower()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_inBandPower.fill(0.0);
+    for (auto it = m_signals.begin(); it != m_signals.end(); ++it)
+    {
+        for (uint32_t i = 0; i < m_inBandPower.size(); i++)
+        {
+            m_inBandPower[i] += it->second.power[i];
+        }
+    }
+    m_removals = 0;
+}
+
 } // namespace lrwpan
 } // namespace ns3
@@ -23,7 +23,8 @@
 #include <ns3/ptr.h>
 #include <ns3/simple-ref-count.h>
 
-#include <set>
+#include <array>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -38,6 +39,12 @@ namespace lrwpan
  * \ingroup lr-wpan
  *
  * \brief This class provides helper functions for LrWpan interference handling.
+ *
+ * Besides the accumulated signals, the helper keeps the total power of the
+ * signals in each of the 16 channels, updated when a signal is added or
+ * removed, so that the in-band power is read without summing the PSDs. The
+ * totals are summed again from the signals every few removals, to bound the
+ * rounding errors of the subtractions.
  */
 class LrWpanInterferenceHelper : public SimpleRefCount<LrWpanInterferenceHelper>
 {
@@ -83,6 +90,14 @@ class LrWpanInterferenceHelper : public SimpleRefCount<LrWpanInterferenceHelper>
      */
     Ptr<SpectrumValue> GetSignalPsd() const;
 
+    /**
+     * Get the total power of all accumulated signals in a channel.
+     *
+     * \param channel the channel number per IEEE802.15.4
+     * \return the power in W
+     */
+    double GetInBandPower(uint32_t channel) const;
+
     /**
      * Get the SpectrumModel used by the helper.
      *
@@ -101,15 +116,45 @@ class LrWpanInterferenceHelper : public SimpleRefCount<LrWpanInterferenceHelper>
      * \returns
      */
     LrWpanInterferenceHelper& operator=(const LrWpanInterferenceHelper&);
+
+    /**
+     * The power of a signal in each channel.
+     */
+    typedef std::array<double, 16> ChannelPowers;
+
+    /**
+     * An accumulated signal.
+     */
+    struct Signal
+    {
+        Ptr<const SpectrumValue> psd; //!< The PSD of the signal
+        ChannelPowers power;          //!< The power of the signal in each channel
+    };
+
+    /**
+     * Sum the power of the accumulated signals in each channel again.
+     */
+    void ResyncInBandPower();
+
     /**
      * The helpers SpectrumModel.
      */
     Ptr<const SpectrumModel> m_spectrumModel;
 
     /**
-     * The set of accumulated signals.
+     * The accumulated signals, indexed by their PSD.
+     */
+    std::unordered_map<const SpectrumValue*, Signal> m_signals;
+
+    /**
+     * The total power of the accumulated signals in each channel.
+     */
+    ChannelPowers m_inBandPower;
+
+    /**
+     * The number of signals removed since the in-band powers were last summed.
      */
-    std::set<Ptr<const SpectrumValue>> m_signals;
+    uint32_t m_removals;
 
     /**
      * The precomputed sum of all accumulated signals.
@@ -37,6 +37,8 @@ LrWpanMacHeader::LrWpanMacHeader()
     SetNoAckReq();            // No Ack Frame will be expected from recipient
     SetNoPanIdComp();         // No PAN Id Compression since no addresses
     SetFrmCtrlRes(0);         // Initialize the 3 reserved bits to 0
+    SetNoSeqNumSup();         // The sequence number is present
+    SetNoIEField();           // No IE List
     SetDstAddrMode(NOADDR);   // Assume there will be no src and dst address
     SetSrcAddrMode(NOADDR);
     SetFrameVer(1); // Indicates an IEEE 802.15.4 frame
@@ -51,6 +53,8 @@ LrWpanMacHeader::LrWpanMacHeader(LrWpanMacType wpanMacType, uint8_t seqNum)
     SetNoAckReq();          // No Ack Frame will be expected from recipient
     SetNoPanIdComp();       // No PAN Id Compression since no addresses
     SetFrmCtrlRes(0);       // Initialize the 3 reserved bits to 0
+    SetNoSeqNumSup();       // The sequence number is present
+    SetNoIEField();         // No IE List
     SetDstAddrMode(NOADDR); // Assume there will be no src and dst address
     SetSrcAddrMode(NOADDR);
     SetFrameVer(1); // Indicates an IEEE 802.15.4 frame
@@ -289,10 +293,23 @@ LrWpanMacHeader::SetFrameControl(uint16_t frameControl)
     m_fctrlFrmPending = (frameControl >> 4) & (0x01);   // Bit 4
     m_fctrlAckReq = (frameControl >> 5) & (0x01);       // Bit 5
     m_fctrlPanIdComp = (frameControl >> 6) & (0x01);    // Bit 6
-    m_fctrlReserved = (frameControl >> 7) & (0x07);     // Bit 7-9
     m_fctrlDstAddrMode = (frameControl >> 10) & (0x03); // Bit 10-11
     m_fctrlFrmVer = (frameControl >> 12) & (0x03);      // Bit 12-13
     m_fctrlSrcAddrMode = (frameControl >> 14) & (0x03); // Bit 14-15
+
+    // 802.15.4e
+    if (m_fctrlFrmVer == 2)
+    {
+        m_fctrlReserved = (frameControl >> 7) & (0x01);          // Bit 7
+        m_fctrlSeqNumSuppression = (frameControl >> 8) & (0x01); // Bit 8
+        m_fctrlIEListPresent = (frameControl >> 9) & (0x01);     // Bit 9
+    }
+    else
+    {
+        m_fctrlReserved = (frameControl >> 7) & (0x07); // Bit 7-9
+        m_fctrlSeqNumSuppression = 0;
+        m_fctrlIEListPresent = 0;
+    }
 }
 
 void
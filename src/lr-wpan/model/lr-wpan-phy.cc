@@ -29,6 +29,7 @@
 
 #include <ns3/abort.h>
 #include <ns3/antenna-model.h>
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/error-model.h>
 #include <ns3/log.h>
@@ -38,11 +39,14 @@
 #include <ns3/packet-burst.h>
 #include <ns3/packet.h>
 #include <ns3/pointer.h>
+#include <ns3/propagation-delay-model.h>
 #include <ns3/random-variable-stream.h>
 #include <ns3/simulator.h>
 #include <ns3/spectrum-channel.h>
 #include <ns3/spectrum-value.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 namespace lrwpan
@@ -150,6 +154,7 @@ operator<<(std::ostream& os, const TracedValue<PhyEnumeration>& state)
 };
 
 Ptr<SingleModelSpectrumChannel> LrWpanPhy::ChannelPool[CHANNEL_COUNT];
+LrWpanPhy::PhyCount LrWpanPhy::ChannelPhyCount[CHANNEL_COUNT];
 
 
 TypeId
@@ -168,6 +173,14 @@ LrWpanPhy::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&LrWpanPhy::m_postReceptionErrorModel),
                           MakePointerChecker<ErrorModel>())
+            .AddAttribute("AnalyticalRx",
+                          "Whether the reception of a frame is decided once, from the "
+                          "powers of the signals in the current channel and the BER table "
+                          "of the error model, instead of from the accumulated PSD at each "
+                          "interference change.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LrWpanPhy::m_analyticalRx),
+                          MakeBooleanChecker())
             .AddTraceSource("TrxStateValue",
                             "The state of the transceiver",
                             MakeTraceSourceAccessor(&LrWpanPhy::m_trxState),
@@ -217,7 +230,11 @@ LrWpanPhy::GetTypeId()
 }
 
 LrWpanPhy::LrWpanPhy()
-    : m_edRequest(),
+    : m_analyticalRx(false),
+      m_rxPowerSum(0),
+      m_noisePower(0),
+      m_rxLogSuccess(0),
+      m_edRequest(),
       m_setTRXState()
 {
     m_trxState = IEEE_802_15_4_PHY_TRX_OFF;
@@ -227,15 +244,7 @@ LrWpanPhy::LrWpanPhy()
     m_phyPIBAttributes.phyTransmitPower = 0;
     m_phyPIBAttributes.phyCCAMode = 1;
 
-    SetPhyOption(IEEE_802_15_4_2_4GHZ_OQPSK);
-
-    m_random = CreateObject<UniformRandomVariable>();
-    m_random->SetAttribute("Min", DoubleValue(0.0));
-    m_random->SetAttribute("Max", DoubleValue(1.0));
-
-    m_isRxCanceled = false;
-    ChangeTrxState(IEEE_802_15_4_PHY_TRX_OFF);
-
+    // Before the PSDs are created, which depend on the spectrum channel.
     for (int i = 0; i < CHANNEL_COUNT; i++)
     {
         ChannelPool[i] = CreateObject<SingleModelSpectrumChannel>();
@@ -245,8 +254,21 @@ LrWpanPhy::LrWpanPhy()
             CreateObject<ConstantSpeedPropagationDelayModel>();
         ChannelPool[i]->AddPropagationLossModel(propModel);
         ChannelPool[i]->SetPropagationDelayModel(delayModel);
+        ChannelPhyCount[i] = 0;
     }
     m_channel = 11 - 11;
+    m_allChannels = false;
+    m_logicalProcess = 0;
+    m_previousChannel = m_channel;
+
+    SetPhyOption(IEEE_802_15_4_2_4GHZ_OQPSK);
+
+    m_random = CreateObject<UniformRandomVariable>();
+    m_random->SetAttribute("Min", DoubleValue(0.0));
+    m_random->SetAttribute("Max", DoubleValue(1.0));
+
+    m_isRxCanceled = false;
+    ChangeTrxState(IEEE_802_15_4_PHY_TRX_OFF);
 }
 
 LrWpanPhy::~LrWpanPhy()
@@ -292,9 +314,11 @@ LrWpanPhy::DoDispose()
     m_device = nullptr;
     // m_channel = nullptr;
     m_antenna = nullptr;
+    m_countedChannel = nullptr;
     m_txPsd = nullptr;
     m_noise = nullptr;
     m_signal = nullptr;
+    m_rxPowers.clear();
     m_errorModel = nullptr;
     m_currentRxPacket.first = nullptr;
     m_currentTxPacket.first = nullptr;
@@ -358,19 +382,110 @@ LrWpanPhy::SetChannel(uint8_t channel)
     NS_LOG_FUNCTION(this << channel);
     NS_ASSERT_MSG(channel >= 11 && channel <= 26, "channel >= 11 && channel <= 26");
 
-    ChannelPool[m_channel]->RemoveRx(this);
     channel -= 11;
+    if (!m_allChannels)
+    {
+        ChannelPool[m_channel]->RemoveRx(this);
+        if (m_countedChannel == ChannelPool[m_channel])
+        {
+            ChannelPhyCount[m_channel]--;
+        }
+        ChannelPool[channel]->AddRx(this);
+        ChannelPhyCount[channel]++;
+        m_countedChannel = ChannelPool[channel];
+    }
+    m_previousChannel = m_channel;
+    m_channelSwitchTime = Simulator::Now();
     m_channel = channel;
-    ChannelPool[m_channel]->AddRx(this);
 }
 
 Ptr<SpectrumChannel>
-LrWpanPhy::GetChannel()
+LrWpanPhy::GetChannel() const
 {
     NS_LOG_FUNCTION(this);
     return ChannelPool[m_channel];
 }
 
+void
+LrWpanPhy::AttachToAllChannels(uint32_t logicalProcess)
+{
+    NS_LOG_FUNCTION(this << logicalProcess);
+    if (m_countedChannel == ChannelPool[m_channel])
+    {
+        ChannelPhyCount[m_channel]--;
+    }
+    m_countedChannel = nullptr;
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+        ChannelPool[i]->AddRx(this);
+        ChannelPhyCount[i]++;
+    }
+    m_allChannels = true;
+    m_logicalProcess = logicalProcess;
+}
+
+bool
+LrWpanPhy::IsAttachedToAllChannels() const
+{
+    return m_allChannels;
+}
+
+uint32_t
+LrWpanPhy::GetLogicalProcess() const
+{
+    return m_logicalProcess;
+}
+
+void
+LrWpanPhy::AddChannelTransmitFilter(Ptr<SpectrumTransmitFilter> filter)
+{
+    NS_LOG_FUNCTION(filter);
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+        ChannelPool[i]->AddSpectrumTransmitFilter(filter);
+    }
+}
+
+Ptr<const SpectrumTransmitFilter>
+LrWpanPhy::GetChannelTransmitFilter()
+{
+    return ChannelPool[0]->GetSpectrumTransmitFilter();
+}
+
+void
+LrWpanPhy::SetChannelPropagationLossModel(Ptr<PropagationLossModel> model)
+{
+    NS_LOG_FUNCTION(model);
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+        ChannelPool[i]->SetAttribute("PropagationLossModel", PointerValue(model));
+    }
+}
+
+Ptr<PropagationLossModel>
+LrWpanPhy::GetChannelPropagationLossModel()
+{
+    return ChannelPool[0]->GetPropagationLossModel();
+}
+
+void
+LrWpanPhy::PrintChannelProfile(std::ostream& os)
+{
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+        os << "channel " << i + 11 << " ";
+        ChannelPool[i]->PrintProfile(os);
+    }
+}
+
+void
+LrWpanPhy::PrintProfile(std::ostream& os) const
+{
+    m_startRxProfile.Print(os, "StartRx");
+    m_endRxProfile.Print(os, "EndRx");
+    m_checkInterferenceProfile.Print(os, "CheckInterference");
+}
+
 Ptr<const SpectrumModel>
 LrWpanPhy::GetRxSpectrumModel() const
 {
@@ -402,14 +517,20 @@ void
 LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
 {
     NS_LOG_FUNCTION(this << spectrumRxParams);
+    NS_PROFILE_SCOPE(m_startRxProfile);
+
+    if (m_allChannels && !IsSentOnChannel(spectrumRxParams))
+    {
+        NS_LOG_LOGIC("Signal sent out of the channel of the PHY");
+        return;
+    }
 
     if (!m_edRequest.IsExpired())
     {
         // Update the average receive power during ED.
         Time now = Simulator::Now();
         m_edPower.averagePower +=
-            LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
-                                                     m_phyPIBAttributes.phyCurrentChannel) *
+            GetRxPower() *
             (now - m_edPower.lastUpdate).GetTimeStep() / m_edPower.measurementLength.GetTimeStep();
         m_edPower.lastUpdate = now;
     }
@@ -420,14 +541,12 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
     if (!lrWpanRxParams)
     {
         CheckInterference();
-        m_signal->AddSignal(spectrumRxParams->psd);
+        AddRxSignal(spectrumRxParams->psd);
 
         // Update peak power if CCA is in progress.
         if (!m_ccaRequest.IsExpired())
         {
-            double power =
-                LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
-                                                         m_phyPIBAttributes.phyCurrentChannel);
+            double power = GetRxPower();
             if (m_ccaPeakPower < power)
             {
                 m_ccaPeakPower = power;
@@ -466,15 +585,8 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
                                       m_phyPIBAttributes.phyCurrentChannel)) +
                                  30
                           << "dBm");
-        m_signal->AddSignal(lrWpanRxParams->psd);
-        Ptr<SpectrumValue> interferenceAndNoise = m_signal->GetSignalPsd();
-        *interferenceAndNoise -= *lrWpanRxParams->psd;
-        *interferenceAndNoise += *m_noise;
-        double sinr =
-            LrWpanSpectrumValueHelper::TotalAvgPower(lrWpanRxParams->psd,
-                                                     m_phyPIBAttributes.phyCurrentChannel) /
-            LrWpanSpectrumValueHelper::TotalAvgPower(interferenceAndNoise,
-                                                     m_phyPIBAttributes.phyCurrentChannel);
+        AddRxSignal(lrWpanRxParams->psd);
+        double sinr = GetSinr(lrWpanRxParams->psd);
 
         // Std. 802.15.4-2006, appendix E, Figure E.2
         // At SNR < -5 the BER is less than 10e-1.
@@ -486,6 +598,7 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
             m_phyRxBeginTrace(p);
 
             m_rxLastUpdate = Simulator::Now();
+            m_rxLogSuccess = 0;
         }
         else
         {
@@ -506,7 +619,7 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
         // Add the incoming packet to the current interference after we have
         // checked for successful reception of the current packet for the time
         // before the additional interference.
-        m_signal->AddSignal(lrWpanRxParams->psd);
+        AddRxSignal(lrWpanRxParams->psd);
         m_currentRxPacket.second = true;
     }
     else
@@ -516,15 +629,13 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
         m_phyRxDropTrace(p);
 
         // Add the signal power to the interference, anyway.
-        m_signal->AddSignal(lrWpanRxParams->psd);
+        AddRxSignal(lrWpanRxParams->psd);
     }
 
     // Update peak power if CCA is in progress.
     if (!m_ccaRequest.IsExpired())
     {
-        double power =
-            LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
-                                                     m_phyPIBAttributes.phyCurrentChannel);
+        double power = GetRxPower();
         if (m_ccaPeakPower < power)
         {
             m_ccaPeakPower = power;
@@ -540,6 +651,7 @@ LrWpanPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
 void
 LrWpanPhy::CheckInterference()
 {
+    NS_PROFILE_SCOPE(m_checkInterferenceProfile);
     // Calculate whether packet was lost.
     LrWpanSpectrumValueHelper psdHelper;
     Ptr<LrWpanSpectrumSignalParameters> currentRxParams = m_currentRxPacket.first;
@@ -555,29 +667,30 @@ LrWpanPhy::CheckInterference()
             // How many bits did we receive since the last calculation?
             double t = (Simulator::Now() - m_rxLastUpdate).ToDouble(Time::MS);
             uint32_t chunkSize = ceil(t * (GetDataOrSymbolRate(true) / 1000));
-            Ptr<SpectrumValue> interferenceAndNoise = m_signal->GetSignalPsd();
-            *interferenceAndNoise -= *currentRxParams->psd;
-            *interferenceAndNoise += *m_noise;
-            double sinr =
-                LrWpanSpectrumValueHelper::TotalAvgPower(currentRxParams->psd,
-                                                         m_phyPIBAttributes.phyCurrentChannel) /
-                LrWpanSpectrumValueHelper::TotalAvgPower(interferenceAndNoise,
-                                                         m_phyPIBAttributes.phyCurrentChannel);
-            double per = 1.0 - m_errorModel->GetChunkSuccessRate(sinr, chunkSize);
+            double sinr = GetSinr(currentRxParams->psd);
+            if (m_analyticalRx)
+            {
+                // The frame is only drawn at the end of its reception.
+                m_rxLogSuccess += chunkSize * m_errorModel->GetLogBitSuccessRate(sinr);
+            }
+            else
+            {
+                double per = 1.0 - m_errorModel->GetChunkSuccessRate(sinr, chunkSize);
 
-            // The LQI is the total packet success rate scaled to 0-255.
-            // If not already set, initialize to 255.
-            LrWpanLqiTag tag(std::numeric_limits<uint8_t>::max());
-            currentPacket->PeekPacketTag(tag);
-            uint8_t lqi = tag.Get();
-            tag.Set(lqi - (per * lqi));
-            currentPacket->ReplacePacketTag(tag);
+                // The LQI is the total packet success rate scaled to 0-255.
+                // If not already set, initialize to 255.
+                LrWpanLqiTag tag(std::numeric_limits<uint8_t>::max());
+                currentPacket->PeekPacketTag(tag);
+                uint8_t lqi = tag.Get();
+                tag.Set(lqi - (per * lqi));
+                currentPacket->ReplacePacketTag(tag);
 
-            if (m_random->GetValue() < per)
-            {
-                NS_LOG_DEBUG("packet will destroyed.");
-                // The packet was destroyed, drop the packet after reception.
-                m_currentRxPacket.second = true;
+                if (m_random->GetValue() < per)
+                {
+                    NS_LOG_DEBUG("packet will destroyed.");
+                    // The packet was destroyed, drop the packet after reception.
+                    m_currentRxPacket.second = true;
+                }
             }
         }
         else
@@ -588,10 +701,113 @@ LrWpanPhy::CheckInterference()
     m_rxLastUpdate = Simulator::Now();
 }
 
+bool
+LrWpanPhy::IsSentOnChannel(Ptr<const SpectrumSignalParameters> params) const
+{
+    Time sent = Simulator::Now();
+    Ptr<PropagationDelayModel> delayModel = ChannelPool[m_channel]->GetPropagationDelayModel();
+    Ptr<MobilityModel> txMobility = params->txPhy->GetMobility();
+    if (delayModel && txMobility && m_mobility)
+    {
+        sent -= delayModel->GetDelay(txMobility, m_mobility);
+    }
+    uint8_t channel = sent < m_channelSwitchTime ? m_previousChannel : m_channel;
+    return LrWpanSpectrumValueHelper::TotalAvgPower(params->psd, channel + 11) > 0;
+}
+
+bool
+LrWpanPhy::IsCompactPsdChannel(uint8_t channel)
+{
+    return ChannelPool[channel]->GetNDevices() == ChannelPhyCount[channel];
+}
+
+double
+LrWpanPhy::GetSinr(Ptr<const SpectrumValue> psd) const
+{
+    if (m_analyticalRx)
+    {
+        double signal = 0;
+        for (const auto& rxPower : m_rxPowers)
+        {
+            if (rxPower.first == psd)
+            {
+                signal = rxPower.second;
+                break;
+            }
+        }
+        return signal / (std::max(m_rxPowerSum - signal, 0.0) + m_noisePower);
+    }
+
+    uint8_t channel = m_phyPIBAttributes.phyCurrentChannel;
+
+    // A signal sent before a channel switch of this PHY has no power in the
+    // current channel.
+    double signal = LrWpanSpectrumValueHelper::TotalAvgPower(psd, channel);
+    double interference = m_signal->GetInBandPower(channel) - signal;
+    double noise = LrWpanSpectrumValueHelper::TotalAvgPower(m_noise, channel);
+    return signal / (std::max(interference, 0.0) + noise);
+}
+
+void
+LrWpanPhy::AddRxSignal(Ptr<const SpectrumValue> psd)
+{
+    if (!m_analyticalRx)
+    {
+        m_signal->AddSignal(psd);
+        return;
+    }
+
+    // Like the interference helper, ignore the signals of another spectrum model.
+    if (psd->GetSpectrumModel() == m_noise->GetSpectrumModel())
+    {
+        double power =
+            LrWpanSpectrumValueHelper::TotalAvgPower(psd, m_phyPIBAttributes.phyCurrentChannel);
+        m_rxPowers.emplace_back(psd, power);
+        m_rxPowerSum += power;
+    }
+}
+
+void
+LrWpanPhy::RemoveRxSignal(Ptr<const SpectrumValue> psd)
+{
+    if (!m_analyticalRx)
+    {
+        m_signal->RemoveSignal(psd);
+        return;
+    }
+
+    for (auto it = m_rxPowers.begin(); it != m_rxPowers.end(); ++it)
+    {
+        if (it->first == psd)
+        {
+            m_rxPowerSum -= it->second;
+            *it = m_rxPowers.back();
+            m_rxPowers.pop_back();
+            break;
+        }
+    }
+    if (m_rxPowers.empty())
+    {
+        // Do not let the rounding errors accumulate.
+        m_rxPowerSum = 0;
+    }
+}
+
+double
+LrWpanPhy::GetRxPower() const
+{
+    if (m_analyticalRx)
+    {
+        return m_rxPowerSum;
+    }
+    return m_signal->GetInBandPower(m_phyPIBAttributes.phyCurrentChannel);
+}
+
 void
 LrWpanPhy::EndRx(Ptr<SpectrumSignalParameters> par)
 {
     NS_LOG_FUNCTION(this);
+    NS_PROFILE_SCOPE(m_endRxProfile);
 
     Ptr<LrWpanSpectrumSignalParameters> params = DynamicCast<LrWpanSpectrumSignalParameters>(par);
 
@@ -600,8 +816,7 @@ LrWpanPhy::EndRx(Ptr<SpectrumSignalParameters> par)
         // Update the average receive power during ED.
         Time now = Simulator::Now();
         m_edPower.averagePower +=
-            LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
-                                                     m_phyPIBAttributes.phyCurrentChannel) *
+            GetRxPower() *
             (now - m_edPower.lastUpdate).GetTimeStep() / m_edPower.measurementLength.GetTimeStep();
         m_edPower.lastUpdate = now;
     }
@@ -613,7 +828,7 @@ LrWpanPhy::EndRx(Ptr<SpectrumSignalParameters> par)
     }
 
     // Update the interference.
-    m_signal->RemoveSignal(par->psd);
+    RemoveRxSignal(par->psd);
 
     if (!params)
     {
@@ -628,6 +843,23 @@ LrWpanPhy::EndRx(Ptr<SpectrumSignalParameters> par)
         Ptr<Packet> currentPacket = currentRxParams->packetBurst->GetPackets().front();
         NS_ASSERT(currentPacket);
 
+        if (m_analyticalRx && m_errorModel)
+        {
+            double success = std::exp(m_rxLogSuccess);
+
+            // The LQI is the total packet success rate scaled to 0-255.
+            LrWpanLqiTag tag(std::numeric_limits<uint8_t>::max());
+            currentPacket->PeekPacketTag(tag);
+            tag.Set(tag.Get() * success);
+            currentPacket->ReplacePacketTag(tag);
+
+            if (!m_currentRxPacket.second && m_random->GetValue() < 1.0 - success)
+            {
+                NS_LOG_DEBUG("packet destroyed.");
+                m_currentRxPacket.second = true;
+            }
+        }
+
         if (m_postReceptionErrorModel &&
             m_postReceptionErrorModel->IsCorrupt(currentPacket->Copy()))
         {
@@ -1370,6 +1602,7 @@ LrWpanPhy::PlmeSetAttributeRequest(PhyPibAttributeIdentifier id, Ptr<PhyPibAttri
         {
             m_phyPIBAttributes.phyTransmitPower = attribute->phyTransmitPower;
             LrWpanSpectrumValueHelper psdHelper;
+            psdHelper.SetCompactPsd(IsCompactPsdChannel(m_channel));
             m_txPsd = psdHelper.CreateTxPowerSpectralDensity(
                 GetNominalTxPowerFromPib(m_phyPIBAttributes.phyTransmitPower),
                 m_phyPIBAttributes.phyCurrentChannel);
@@ -1487,8 +1720,7 @@ LrWpanPhy::EndEd()
     NS_LOG_FUNCTION(this);
 
     m_edPower.averagePower +=
-        LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
-                                                 m_phyPIBAttributes.phyCurrentChannel) *
+        GetRxPower() *
         (Simulator::Now() - m_edPower.lastUpdate).GetTimeStep() /
         m_edPower.measurementLength.GetTimeStep();
 
@@ -1524,8 +1756,7 @@ LrWpanPhy::EndCca()
     PhyEnumeration sensedChannelState = IEEE_802_15_4_PHY_UNSPECIFIED;
 
     // Update peak power.
-    double power = LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
-                                                            m_phyPIBAttributes.phyCurrentChannel);
+    double power = GetRxPower();
     if (m_ccaPeakPower < power)
     {
         m_ccaPeakPower = power;
@@ -1860,6 +2091,7 @@ LrWpanPhy::SetRxSensitivity(double dbmSensitivity)
     double maxRxSensitivityW = DbmToW(-106.58);
 
     LrWpanSpectrumValueHelper psdHelper;
+    psdHelper.SetCompactPsd(IsCompactPsdChannel(m_channel));
     m_txPsd = psdHelper.CreateTxPowerSpectralDensity(
         GetNominalTxPowerFromPib(m_phyPIBAttributes.phyTransmitPower),
         m_phyPIBAttributes.phyCurrentChannel);
@@ -1869,6 +2101,10 @@ LrWpanPhy::SetRxSensitivity(double dbmSensitivity)
     m_noise = psdHelper.CreateNoisePowerSpectralDensity(m_phyPIBAttributes.phyCurrentChannel);
 
     m_signal = Create<LrWpanInterferenceHelper>(m_noise->GetSpectrumModel());
+    m_rxPowers.clear();
+    m_rxPowerSum = 0;
+    m_noisePower =
+        LrWpanSpectrumValueHelper::TotalAvgPower(m_noise, m_phyPIBAttributes.phyCurrentChannel);
     // Change receiver sensitivity from dBm to Watts
     m_rxSensitivity = DbmToW(dbmSensitivity);
 }
@@ -1881,6 +2117,18 @@ LrWpanPhy::GetRxSensitivity()
     return WToDbm(m_rxSensitivity);
 }
 
+int8_t
+LrWpanPhy::GetNominalTxPower()
+{
+    return GetNominalTxPowerFromPib(m_phyPIBAttributes.phyTransmitPower);
+}
+
+double
+LrWpanPhy::GetNoisePower() const
+{
+    return m_noisePower;
+}
+
 PhyOption
 LrWpanPhy::GetMyPhyOption()
 {
@@ -1904,10 +2152,12 @@ LrWpanPhy::SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd)
     NS_LOG_INFO("\t computed noise_psd: " << *noisePsd);
     NS_ASSERT(noisePsd);
     m_noise = noisePsd;
+    m_noisePower =
+        LrWpanSpectrumValueHelper::TotalAvgPower(m_noise, m_phyPIBAttributes.phyCurrentChannel);
 }
 
 Ptr<const SpectrumValue>
-LrWpanPhy::GetNoisePowerSpectralDensity()
+LrWpanPhy::GetNoisePowerSpectralDensity() const
 {
     NS_LOG_FUNCTION(this);
     return m_noise;
@@ -1928,6 +2178,20 @@ LrWpanPhy::GetErrorModel() const
     return m_errorModel;
 }
 
+double
+LrWpanPhy::GetFrameSuccessRate(Ptr<const Packet> p, double sinr)
+{
+    if (!m_errorModel)
+    {
+        return 1.0;
+    }
+
+    // The bits counted by CheckInterference over the whole reception.
+    double t = CalculateTxTime(p).ToDouble(Time::MS);
+    uint32_t bits = ceil(t * (GetDataOrSymbolRate(true) / 1000));
+    return m_errorModel->GetChunkSuccessRate(sinr, bits);
+}
+
 uint64_t
 LrWpanPhy::GetPhySHRDuration() const
 {
@@ -1950,9 +2214,7 @@ LrWpanPhy::GetPhySymbolsPerOctet() const
 double
 LrWpanPhy::GetCurrentSignalPsd()
 {
-    double powerWatts =
-        LrWpanSpectrumValueHelper::TotalAvgPower(m_signal->GetSignalPsd(),
-                                                 m_phyPIBAttributes.phyCurrentChannel);
+    double powerWatts = GetRxPower();
     return WToDbm(powerWatts);
 }
 
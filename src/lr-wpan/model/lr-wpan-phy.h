@@ -25,11 +25,17 @@
 #include "lr-wpan-interference-helper.h"
 
 #include <ns3/event-id.h>
+#include <ns3/profile-counter.h>
 #include <ns3/spectrum-phy.h>
 #include <ns3/traced-callback.h>
 #include <ns3/traced-value.h>
 
 #include <iostream>
+#include <vector>
+
+#ifdef NS3_MTP
+#include <atomic>
+#endif
 
 #define CHANNEL_COUNT 16 // 11~26
 
@@ -40,9 +46,11 @@ class Packet;
 class SpectrumValue;
 class MobilityModel;
 class SpectrumChannel;
+class SpectrumTransmitFilter;
 class SpectrumModel;
 class AntennaModel;
 class NetDevice;
+class PropagationLossModel;
 class UniformRandomVariable;
 class ErrorModel;
 
@@ -280,6 +288,20 @@ class LrWpanPhy : public SpectrumPhy
 {
   static Ptr<SingleModelSpectrumChannel> ChannelPool[CHANNEL_COUNT];
 
+#ifdef NS3_MTP
+  /// A number of PHYs, updated by the logical processes of the multithreaded simulator
+  typedef std::atomic<uint32_t> PhyCount;
+#else
+  /// A number of PHYs
+  typedef uint32_t PhyCount;
+#endif
+
+  /**
+   * The number of LrWpanPhy instances attached to the spectrum channel of
+   * each channel, to tell whether other PHYs share it.
+   */
+  static PhyCount ChannelPhyCount[CHANNEL_COUNT];
+
   public:
     /**
      * Get the type ID.
@@ -305,7 +327,84 @@ class LrWpanPhy : public SpectrumPhy
      *
      * \return the channel
      */
-    Ptr<SpectrumChannel> GetChannel();
+    Ptr<SpectrumChannel> GetChannel() const;
+
+    /**
+     * Attach this PHY to the spectrum channels of all the channels for the
+     * rest of the simulation: SetChannel then only changes the channel of
+     * the PHY, and StartRx drops the signals sent out of the channel the PHY
+     * was on. The PHYs run by several logical processes of the
+     * multithreaded simulator must be attached this way, so that the
+     * receivers of a signal do not depend on the progress of the other
+     * logical processes. Like the transmit filters, it must be done after
+     * all the PHYs are created.
+     *
+     * Each signal is then sent to every PHY: a LrWpanTransmitFilter on the
+     * channels keeps the PHYs of the logical process of the transmitter out
+     * of the signals of other channels, but the PHYs of the other logical
+     * processes receive them all.
+     *
+     * \param logicalProcess the logical process running the PHY
+     */
+    void AttachToAllChannels(uint32_t logicalProcess);
+
+    /**
+     * \return true if the PHY is attached to all the channels, see AttachToAllChannels
+     */
+    bool IsAttachedToAllChannels() const;
+
+    /**
+     * \return the logical process running the PHY, see AttachToAllChannels
+     */
+    uint32_t GetLogicalProcess() const;
+
+    /**
+     * Add a transmit filter to the spectrum channels of all the channels.
+     * The spectrum channels are created again with each PHY, so the filter
+     * must be added after all the PHYs are created.
+     *
+     * \param filter the transmit filter
+     */
+    static void AddChannelTransmitFilter(Ptr<SpectrumTransmitFilter> filter);
+
+    /**
+     * \return the first transmit filter of the spectrum channels, see
+     * AddChannelTransmitFilter
+     */
+    static Ptr<const SpectrumTransmitFilter> GetChannelTransmitFilter();
+
+    /**
+     * Set the propagation loss model of the spectrum channels of all the
+     * channels, replacing their own. Like the transmit filters, it must be
+     * set after all the PHYs are created.
+     *
+     * \param model the propagation loss model
+     */
+    static void SetChannelPropagationLossModel(Ptr<PropagationLossModel> model);
+
+    /**
+     * Get the propagation loss model of the spectrum channels of all the
+     * channels.
+     *
+     * \return the propagation loss model of the first channel
+     */
+    static Ptr<PropagationLossModel> GetChannelPropagationLossModel();
+
+    /**
+     * Print the profiling counters of StartTx of the spectrum channels of
+     * all the channels, see ProfileCounter.
+     *
+     * \param os the output stream
+     */
+    static void PrintChannelProfile(std::ostream& os);
+
+    /**
+     * Print the profiling counters of StartRx, EndRx and CheckInterference,
+     * updated in the builds with the NS3_PROFILE_COUNTERS option.
+     *
+     * \param os the output stream
+     */
+    void PrintProfile(std::ostream& os) const;
     void SetDevice(Ptr<NetDevice> d) override;
     Ptr<NetDevice> GetDevice() const override;
 
@@ -338,7 +437,7 @@ class LrWpanPhy : public SpectrumPhy
      *
      * @return the Noise Power Spectral Density
      */
-    Ptr<const SpectrumValue> GetNoisePowerSpectralDensity();
+    Ptr<const SpectrumValue> GetNoisePowerSpectralDensity() const;
 
     /**
      * Set the modulation option used by this PHY.
@@ -368,6 +467,22 @@ class LrWpanPhy : public SpectrumPhy
      */
     double GetRxSensitivity();
 
+    /**
+     * Get the nominal transmit power of the device, from the PIB attribute
+     * phyTransmitPower.
+     *
+     * \return The nominal transmit power in dBm.
+     */
+    int8_t GetNominalTxPower();
+
+    /**
+     * Get the noise power in the current channel, including the noise factor
+     * of the receiver sensitivity.
+     *
+     * \return The noise power in W.
+     */
+    double GetNoisePower() const;
+
     /**
      * Notify the SpectrumPhy instance of an incoming waveform.
      *
@@ -520,6 +635,17 @@ class LrWpanPhy : public SpectrumPhy
      */
     Ptr<LrWpanErrorModel> GetErrorModel() const;
 
+    /**
+     * Get the probability that a frame received with a constant SINR is
+     * received without error, as decided by the error model for the bits
+     * of its whole PPDU.
+     *
+     * \param p the frame
+     * \param sinr the signal to interference plus noise ratio
+     * \return the frame success rate, one if there is no error model
+     */
+    double GetFrameSuccessRate(Ptr<const Packet> p, double sinr);
+
     /**
      * Attach a receive ErrorModel to the LrWpanPhy.
      *
@@ -620,6 +746,58 @@ class LrWpanPhy : public SpectrumPhy
      */
     void CheckInterference();
 
+    /**
+     * Check if a signal was sent on the channel the PHY was on, for a PHY
+     * attached to all the channels. The signal left the transmitter one
+     * propagation delay ago.
+     *
+     * \param params the parameters of the received signal
+     * \return true if the signal has power in the channel of the PHY at that time
+     */
+    bool IsSentOnChannel(Ptr<const SpectrumSignalParameters> params) const;
+
+    /**
+     * Check if the PSDs of a channel can be created over the 5 bands of the
+     * channel only, i.e. if no other PHY than LrWpanPhy instances is attached
+     * to its spectrum channel. The other PHYs must thus be attached before
+     * the LrWpanPhy instances select the channel, and before the first
+     * transmission on it.
+     *
+     * \param channel the index of the channel in the pool
+     * \return true if the PSDs of the channel can be compact
+     */
+    static bool IsCompactPsdChannel(uint8_t channel);
+
+    /**
+     * Get the SINR of a received signal in the current channel, the other
+     * accumulated signals being the interference.
+     *
+     * \param psd the PSD of the received signal
+     * \return the SINR (not in dB)
+     */
+    double GetSinr(Ptr<const SpectrumValue> psd) const;
+
+    /**
+     * Add a signal to the accumulated signals.
+     *
+     * \param psd the PSD of the signal
+     */
+    void AddRxSignal(Ptr<const SpectrumValue> psd);
+
+    /**
+     * Remove a signal from the accumulated signals.
+     *
+     * \param psd the PSD of the signal
+     */
+    void RemoveRxSignal(Ptr<const SpectrumValue> psd);
+
+    /**
+     * Get the power of the accumulated signals in the current channel.
+     *
+     * \return the power in W
+     */
+    double GetRxPower() const;
+
     /**
      * Finish the reception of a frame. This is called at the end of a frame
      * reception, applying possibly pending PHY state changes and firing the
@@ -820,6 +998,34 @@ class LrWpanPhy : public SpectrumPhy
      */
     uint8_t m_channel;
 
+    /**
+     * Whether the transceiver is attached to the spectrum channels of all
+     * the channels, see AttachToAllChannels.
+     */
+    bool m_allChannels;
+
+    /**
+     * The logical process running the transceiver, if attached to all the
+     * channels.
+     */
+    uint32_t m_logicalProcess;
+
+    /**
+     * The spectrum channel of the pool the transceiver is counted in by
+     * ChannelPhyCount, if any.
+     */
+    Ptr<SpectrumChannel> m_countedChannel;
+
+    /**
+     * The channel of the transceiver before its last channel switch.
+     */
+    uint8_t m_previousChannel;
+
+    /**
+     * The time of the last channel switch.
+     */
+    Time m_channelSwitchTime;
+
     /**
      * The antenna used by the transceiver.
      */
@@ -932,6 +1138,36 @@ class LrWpanPhy : public SpectrumPhy
      */
     Ptr<LrWpanInterferenceHelper> m_signal;
 
+    /**
+     * Whether the reception of a frame is decided once at its end, from the
+     * scalar powers of the signals in the current channel, instead of at
+     * each interference change from the accumulated PSD. In this mode
+     * m_signal is not used.
+     */
+    bool m_analyticalRx;
+
+    /**
+     * The power in the current channel of each accumulated signal, in
+     * analytical reception mode.
+     */
+    std::vector<std::pair<Ptr<const SpectrumValue>, double>> m_rxPowers;
+
+    /**
+     * The sum of m_rxPowers.
+     */
+    double m_rxPowerSum;
+
+    /**
+     * The noise power in the current channel.
+     */
+    double m_noisePower;
+
+    /**
+     * The logarithm of the success rate of the frame currently received up
+     * to m_rxLastUpdate, in analytical reception mode.
+     */
+    double m_rxLogSuccess;
+
     /**
      * Timestamp of the last calculation of the PER of a packet currently received.
      */
@@ -979,6 +1215,10 @@ class LrWpanPhy : public SpectrumPhy
     Ptr<UniformRandomVariable> m_random;
 
     Ptr<ErrorModel> m_postReceptionErrorModel; //!< Error model for receive packet events
+
+    ProfileCounter m_startRxProfile;           //!< Profiling counter of StartRx
+    ProfileCounter m_endRxProfile;             //!< Profiling counter of EndRx
+    ProfileCounter m_checkInterferenceProfile; //!< Profiling counter of CheckInterference
 };
 
 } // namespace lrwpan
@@ -33,6 +33,8 @@ NS_LOG_COMPONENT_DEFINE("LrWpanSpectrumValueHelper");
 Ptr<SpectrumModel>
     g_LrWpanSpectrumModel; //!< Global object used to initialize the LrWpan Spectrum Model
 
+Ptr<SpectrumModel> g_LrWpanChannelSpectrumModels[16]; //!< The 5 bands of each LrWpan channel
+
 /**
  * \ingroup lr-wpan
  * \brief Helper class used to automatically initialize the LrWpan Spectrum Model objects
@@ -56,6 +58,13 @@ class LrWpanSpectrumModelInitializer
             bands.push_back(bi);
         }
         g_LrWpanSpectrumModel = Create<SpectrumModel>(bands);
+
+        // The same bands, restricted to the 5 bands of each channel
+        for (int channel = 0; channel < 16; channel++)
+        {
+            Bands channelBands(bands.begin() + 3 + 5 * channel, bands.begin() + 8 + 5 * channel);
+            g_LrWpanChannelSpectrumModels[channel] = Create<SpectrumModel>(channelBands);
+        }
     }
 
 } g_LrWpanSpectrumModelInitializerInstance; //!< Global object used to initialize the LrWpan
@@ -65,6 +74,7 @@ LrWpanSpectrumValueHelper::LrWpanSpectrumValueHelper()
 {
     NS_LOG_FUNCTION(this);
     m_noiseFactor = 1.0;
+    m_compactPsd = false;
 }
 
 LrWpanSpectrumValueHelper::~LrWpanSpectrumValueHelper()
@@ -76,7 +86,9 @@ Ptr<SpectrumValue>
 LrWpanSpectrumValueHelper::CreateTxPowerSpectralDensity(double txPower, uint32_t channel)
 {
     NS_LOG_FUNCTION(this);
-    Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(g_LrWpanSpectrumModel);
+    NS_ASSERT_MSG((channel >= 11 && channel <= 26), "Invalid channel numbers");
+    Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(GetSpectrumModel(channel, m_compactPsd));
+    uint32_t center = GetCenterBand(txPsd, channel);
 
     // txPower is expressed in dBm. We must convert it into natural unit (W).
     txPower = pow(10., (txPower - 30) / 10);
@@ -88,15 +100,11 @@ LrWpanSpectrumValueHelper::CreateTxPowerSpectralDensity(double txPower, uint32_t
     // The two outer side bands contain roughly 0.5%.
     double txPowerDensity = txPower / 2.0e6;
 
-    NS_ASSERT_MSG((channel >= 11 && channel <= 26), "Invalid channel numbers");
-
-    // The channel assignment is in section 6.1.2.1
-    // Channel 11 centered at 2.405 GHz, 12 at 2.410 GHz, ... 26 at 2.480 GHz
-    (*txPsd)[2405 + 5 * (channel - 11) - 2400 - 2] = txPowerDensity * 0.005;
-    (*txPsd)[2405 + 5 * (channel - 11) - 2400 - 1] = txPowerDensity * 0.495;
-    (*txPsd)[2405 + 5 * (channel - 11) - 2400] = txPowerDensity; // center
-    (*txPsd)[2405 + 5 * (channel - 11) - 2400 + 1] = txPowerDensity * 0.495;
-    (*txPsd)[2405 + 5 * (channel - 11) - 2400 + 2] = txPowerDensity * 0.005;
+    (*txPsd)[center - 2] = txPowerDensity * 0.005;
+    (*txPsd)[center - 1] = txPowerDensity * 0.495;
+    (*txPsd)[center] = txPowerDensity; // center
+    (*txPsd)[center + 1] = txPowerDensity * 0.495;
+    (*txPsd)[center + 2] = txPowerDensity * 0.005;
 
     // If more power is allocated to more subbands in future revisions of
     // this model, make sure to renormalize so that the integral of the
@@ -109,7 +117,9 @@ Ptr<SpectrumValue>
 LrWpanSpectrumValueHelper::CreateNoisePowerSpectralDensity(uint32_t channel)
 {
     NS_LOG_FUNCTION(this);
-    Ptr<SpectrumValue> noisePsd = Create<SpectrumValue>(g_LrWpanSpectrumModel);
+    NS_ASSERT_MSG((channel >= 11 && channel <= 26), "Invalid channel numbers");
+    Ptr<SpectrumValue> noisePsd = Create<SpectrumValue>(GetSpectrumModel(channel, m_compactPsd));
+    uint32_t center = GetCenterBand(noisePsd, channel);
 
     static const double BOLTZMANN = 1.3803e-23;
     // Nt  is the power of thermal noise in W
@@ -117,13 +127,10 @@ LrWpanSpectrumValueHelper::CreateNoisePowerSpectralDensity(uint32_t channel)
     // noise Floor (W) which accounts for thermal noise and non-idealities of the receiver
     double noisePowerDensity = m_noiseFactor * Nt;
 
-    NS_ASSERT_MSG((channel >= 11 && channel <= 26), "Invalid channel numbers");
-
-    (*noisePsd)[2405 + 5 * (channel - 11) - 2400 - 2] = noisePowerDensity;
-    (*noisePsd)[2405 + 5 * (channel - 11) - 2400 - 1] = noisePowerDensity;
-    (*noisePsd)[2405 + 5 * (channel - 11) - 2400] = noisePowerDensity;
-    (*noisePsd)[2405 + 5 * (channel - 11) - 2400 + 1] = noisePowerDensity;
-    (*noisePsd)[2405 + 5 * (channel - 11) - 2400 + 2] = noisePowerDensity;
+    for (uint32_t band = center - 2; band <= center + 2; band++)
+    {
+        (*noisePsd)[band] = noisePowerDensity;
+    }
 
     return noisePsd;
 }
@@ -134,25 +141,65 @@ LrWpanSpectrumValueHelper::SetNoiseFactor(double f)
     m_noiseFactor = f;
 }
 
+void
+LrWpanSpectrumValueHelper::SetCompactPsd(bool compact)
+{
+    m_compactPsd = compact;
+}
+
 double
 LrWpanSpectrumValueHelper::TotalAvgPower(Ptr<const SpectrumValue> psd, uint32_t channel)
 {
     NS_LOG_FUNCTION(psd);
     double totalAvgPower = 0.0;
 
-    NS_ASSERT(psd->GetSpectrumModel() == g_LrWpanSpectrumModel);
+    Ptr<const SpectrumModel> model = psd->GetSpectrumModel();
+    if (model != g_LrWpanSpectrumModel)
+    {
+        NS_ASSERT_MSG(model->GetNumBands() == 5, "Not a LrWpan spectrum model");
+        if (model != g_LrWpanChannelSpectrumModels[channel - 11])
+        {
+            // The bands of two different channels do not overlap.
+            return 0.0;
+        }
+    }
+    uint32_t center = GetCenterBand(psd, channel);
 
     // numerically integrate to get area under psd using 1 MHz resolution
 
-    totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 - 2];
-    totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 - 1];
-    totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400];
-    totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 + 1];
-    totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 + 2];
+    totalAvgPower += (*psd)[center - 2];
+    totalAvgPower += (*psd)[center - 1];
+    totalAvgPower += (*psd)[center];
+    totalAvgPower += (*psd)[center + 1];
+    totalAvgPower += (*psd)[center + 2];
     totalAvgPower *= 1.0e6;
 
     return totalAvgPower;
 }
 
+Ptr<const SpectrumModel>
+LrWpanSpectrumValueHelper::GetSpectrumModel(uint32_t channel, bool compact)
+{
+    NS_ASSERT_MSG((channel >= 11 && channel <= 26), "Invalid channel numbers");
+
+    if (compact)
+    {
+        return g_LrWpanChannelSpectrumModels[channel - 11];
+    }
+    return g_LrWpanSpectrumModel;
+}
+
+uint32_t
+LrWpanSpectrumValueHelper::GetCenterBand(Ptr<const SpectrumValue> psd, uint32_t channel)
+{
+    if (psd->GetSpectrumModel() == g_LrWpanSpectrumModel)
+    {
+        // The channel assignment is in section 6.1.2.1
+        // Channel 11 centered at 2.405 GHz, 12 at 2.410 GHz, ... 26 at 2.480 GHz
+        return 2405 + 5 * (channel - 11) - 2400;
+    }
+    return 2;
+}
+
 } // namespace lrwpan
 } // namespace ns3
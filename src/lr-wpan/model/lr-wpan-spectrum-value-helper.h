@@ -24,6 +24,7 @@
 namespace ns3
 {
 
+class SpectrumModel;
 class SpectrumValue;
 
 namespace lrwpan
@@ -33,6 +34,12 @@ namespace lrwpan
  * \ingroup lr-wpan
  *
  * \brief This class defines all functions to create spectrum model for LrWpan
+ *
+ * The PSDs are created over the whole 2.4 GHz band, so that they can be
+ * mixed with the signals of other technologies. Compact PSDs are created
+ * over the 5 bands of their channel only, each channel having its own
+ * SpectrumModel: LrWpanPhy uses them on the channels no other PHY is
+ * attached to.
  */
 class LrWpanSpectrumValueHelper
 {
@@ -61,6 +68,12 @@ class LrWpanSpectrumValueHelper
      */
     void SetNoiseFactor(double f);
 
+    /**
+     * Set whether the PSDs are created over the 5 bands of their channel only.
+     * \param compact true for compact PSDs, false for the whole 2.4 GHz band
+     */
+    void SetCompactPsd(bool compact);
+
     /**
      * \brief total average power of the signal is the integral of the PSD using
      * the limits of the given channel
@@ -70,13 +83,34 @@ class LrWpanSpectrumValueHelper
      */
     static double TotalAvgPower(Ptr<const SpectrumValue> psd, uint32_t channel);
 
+    /**
+     * \brief Get the SpectrumModel of the PSDs created for a channel.
+     * \param channel the channel number per IEEE802.15.4
+     * \param compact whether the PSDs are compact
+     * \return the 5 bands of the channel if compact, else the whole 2.4 GHz band
+     */
+    static Ptr<const SpectrumModel> GetSpectrumModel(uint32_t channel, bool compact);
+
   private:
+    /**
+     * \brief Get the index of the center band of a channel in a PSD.
+     * \param psd spectral density
+     * \param channel the channel number per IEEE802.15.4
+     * \return the index of the center band
+     */
+    static uint32_t GetCenterBand(Ptr<const SpectrumValue> psd, uint32_t channel);
+
     /**
      * A scaling factor for the noise power.
      * It specifies how much additional noise the device
      * contribute to the thermal noise (floor noise).
      */
     double m_noiseFactor;
+
+    /**
+     * Whether the PSDs are created over the 5 bands of their channel only.
+     */
+    bool m_compactPsd;
 };
 
 } // namespace lrwpan
@@ -0,0 +1,161 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lr-wpan-transmit-filter.h"
+
+#include "lr-wpan-phy.h"
+#include "lr-wpan-spectrum-signal-parameters.h"
+#include "lr-wpan-spectrum-value-helper.h"
+
+#include <ns3/antenna-model.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/mobility-model.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/spectrum-channel.h>
+
+#include <cmath>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("LrWpanTransmitFilter");
+
+NS_OBJECT_ENSURE_REGISTERED(LrWpanTransmitFilter);
+
+TypeId
+LrWpanTransmitFilter::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::LrWpanTransmitFilter")
+            .SetParent<SpectrumTransmitFilter>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<LrWpanTransmitFilter>()
+            .AddAttribute("NoiseFloorMargin",
+                          "The signals whose receive power is more than this margin (dB) "
+                          "below the noise floor of the receiver are not delivered.",
+                          DoubleValue(10.0),
+                          MakeDoubleAccessor(&LrWpanTransmitFilter::m_noiseFloorMargin),
+                          MakeDoubleChecker<double>());
+    return tid;
+}
+
+LrWpanTransmitFilter::LrWpanTransmitFilter()
+    : m_delivered(0),
+      m_outOfChannel(0),
+      m_belowNoiseFloor(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint64_t
+LrWpanTransmitFilter::GetDeliveredCount() const
+{
+    return m_delivered;
+}
+
+uint64_t
+LrWpanTransmitFilter::GetOutOfChannelCount() const
+{
+    return m_outOfChannel;
+}
+
+uint64_t
+LrWpanTransmitFilter::GetBelowNoiseFloorCount() const
+{
+    return m_belowNoiseFloor;
+}
+
+bool
+LrWpanTransmitFilter::DoFilter(Ptr<const SpectrumSignalParameters> params,
+                               Ptr<const SpectrumPhy> receiverPhy)
+{
+    NS_LOG_FUNCTION(this << params << receiverPhy);
+
+    if (!DynamicCast<const LrWpanSpectrumSignalParameters>(params))
+    {
+        NS_LOG_DEBUG("Received a non LrWpan signal: do not filter");
+        return false;
+    }
+    Ptr<const LrWpanPhy> phy = DynamicCast<const LrWpanPhy>(receiverPhy);
+    if (!phy)
+    {
+        NS_LOG_DEBUG("Sending a LrWpan signal to a non LrWpan device: do not filter");
+        return false;
+    }
+
+    Ptr<const LrWpanPhy> txPhy = DynamicCast<const LrWpanPhy>(params->txPhy);
+    Ptr<const LrWpanPhy> noisePhy = phy;
+    if (phy->IsAttachedToAllChannels() && txPhy &&
+        phy->GetLogicalProcess() != txPhy->GetLogicalProcess())
+    {
+        // The transmitter runs on this logical process, not the receiver.
+        noisePhy = txPhy;
+    }
+
+    uint8_t channel = noisePhy->GetCurrentChannelNum();
+    double txPower = LrWpanSpectrumValueHelper::TotalAvgPower(params->psd, channel);
+    if (txPower <= 0)
+    {
+        NS_LOG_DEBUG("No power in the channel " << (uint32_t)channel << " of the receiver");
+        m_outOfChannel++;
+        return true;
+    }
+
+    // Only a cached loss is read here: the channel then finds it in the
+    // cache, instead of computing the loss of the pair a second time.
+    Ptr<CachedPropagationLossModel> loss = DynamicCast<CachedPropagationLossModel>(
+        noisePhy->GetChannel()->GetPropagationLossModel());
+    Ptr<MobilityModel> txMobility = params->txPhy->GetMobility();
+    Ptr<MobilityModel> rxMobility = phy->GetMobility();
+    if (loss && txMobility && rxMobility)
+    {
+        double gainDb = loss->CalcRxPower(0, txMobility, rxMobility);
+        if (params->txAntenna)
+        {
+            Angles txAngles(rxMobility->GetPosition(), txMobility->GetPosition());
+            gainDb += params->txAntenna->GetGainDb(txAngles);
+        }
+        Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel>(phy->GetAntenna());
+        if (rxAntenna)
+        {
+            Angles rxAngles(txMobility->GetPosition(), rxMobility->GetPosition());
+            gainDb += rxAntenna->GetGainDb(rxAngles);
+        }
+        double noise =
+            LrWpanSpectrumValueHelper::TotalAvgPower(noisePhy->GetNoisePowerSpectralDensity(),
+                                                     channel);
+        if (txPower * std::pow(10.0, (gainDb + m_noiseFloorMargin) / 10.0) < noise)
+        {
+            NS_LOG_DEBUG("Receive power more than " << m_noiseFloorMargin
+                                                    << " dB below the noise floor");
+            m_belowNoiseFloor++;
+            return true;
+        }
+    }
+
+    m_delivered++;
+    return false;
+}
+
+int64_t
+LrWpanTransmitFilter::DoAssignStreams(int64_t stream)
+{
+    return 0;
+}
+
+} // namespace lrwpan
+} // namespace ns3
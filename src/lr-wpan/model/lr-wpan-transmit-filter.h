@@ -0,0 +1,107 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LR_WPAN_TRANSMIT_FILTER_H
+#define LR_WPAN_TRANSMIT_FILTER_H
+
+#include <ns3/spectrum-transmit-filter.h>
+
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Transmit filter dropping the LrWpan signals a receiver cannot notice.
+ *
+ * A LrWpan signal is not delivered to a LrWpanPhy if it has no power in the
+ * current channel of the PHY, or if its receive power is more than
+ * NoiseFloorMargin below the noise floor of the PHY. The receive power is
+ * estimated from the antenna gains and the propagation loss the spectrum
+ * channel of the receiver applies, which must be a
+ * CachedPropagationLossModel: the loss of a pair is then computed once, and
+ * read from the cache by both the filter and the channel. With another
+ * propagation loss model, the signals are only filtered by channel. The
+ * spectrum propagation loss model of the channel, if any, is ignored.
+ *
+ * A dropped signal is neither added to the interference of the receiver,
+ * nor reported by its PhyRxDrop trace, and it does not make the frame being
+ * received by the PHY collide.
+ *
+ * The state of a PHY attached to all the channels by another logical
+ * process of the multithreaded simulator may change while the signal is
+ * sent: the PHY then checks the channel of the signal itself, and the noise
+ * of the transmitter in its channel stands for the noise of the receiver.
+ * The PHYs of the logical process of the transmitter are filtered as usual.
+ */
+class LrWpanTransmitFilter : public SpectrumTransmitFilter
+{
+  public:
+    LrWpanTransmitFilter();
+
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    /**
+     * \return the number of signals delivered to a LrWpanPhy
+     */
+    uint64_t GetDeliveredCount() const;
+
+    /**
+     * \return the number of signals dropped because they have no power in
+     * the channel of the receiver
+     */
+    uint64_t GetOutOfChannelCount() const;
+
+    /**
+     * \return the number of signals dropped because they are below the
+     * noise floor margin of the receiver
+     */
+    uint64_t GetBelowNoiseFloorCount() const;
+
+  protected:
+    int64_t DoAssignStreams(int64_t stream) override;
+
+  private:
+    bool DoFilter(Ptr<const SpectrumSignalParameters> params,
+                  Ptr<const SpectrumPhy> receiverPhy) override;
+
+    double m_noiseFloorMargin; //!< Margin below the noise floor, in dB
+
+#ifdef NS3_MTP
+    /// A counter, shared by the logical processes of the multithreaded simulator
+    typedef std::atomic<uint64_t> Counter;
+#else
+    /// A counter
+    typedef uint64_t Counter;
+#endif
+
+    Counter m_delivered;       //!< Number of delivered signals
+    Counter m_outOfChannel;    //!< Number of signals out of the receiver channel
+    Counter m_belowNoiseFloor; //!< Number of signals below the noise floor margin
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_TRANSMIT_FILTER_H */
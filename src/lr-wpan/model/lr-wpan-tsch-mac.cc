@@ -33,7 +33,10 @@
 #include "lr-wpan-mac-header.h"
 #include "lr-wpan-mac-pl-headers.h"
 #include "lr-wpan-mac-trailer.h"
+#include "lr-wpan-tsch-slot-clock.h"
+#include "lr-wpan-tsch-slot-engine.h"
 
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/node.h>
@@ -42,6 +45,8 @@
 #include <ns3/simulator.h>
 #include <ns3/uinteger.h>
 
+#include <limits>
+
 NS_LOG_COMPONENT_DEFINE("LrWpanTschMac");
 
 #undef NS_LOG_APPEND_CONTEXT
@@ -63,6 +68,54 @@ LrWpanTschMac::GetTypeId()
             .SetParent<LrWpanMacBase>()
             .SetGroupName("LrWpan")
             .AddConstructor<LrWpanTschMac>()
+            .AddAttribute("SkipIdleSlots",
+                          "Schedule the ASN clock only for the timeslots with a link and the "
+                          "start of each hopping sequence period, instead of every timeslot. "
+                          "The MacSleep trace of the skipped timeslots is fired in batch "
+                          "at the next processed timeslot.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LrWpanTschMac::m_skipIdleSlots),
+                          MakeBooleanChecker())
+            .AddAttribute("MicroTasks",
+                          "Run the zero-delay MAC transitions of an event of the MAC at the "
+                          "end of that event, instead of in a scheduler event each.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&LrWpanTschMac::m_microTasksEnabled),
+                          MakeBooleanChecker())
+            .AddAttribute("MaxTxQueueSizePerNeighbor",
+                          "The maximum number of packets queued for one neighbor. Packets "
+                          "beyond it are dropped, firing the MacTxDrop trace.",
+                          UintegerValue(std::numeric_limits<uint32_t>::max()),
+                          MakeUintegerAccessor(&LrWpanTschMac::m_maxTxQueueSizePerNeighbor),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("TxQueueElementAllocations",
+                          "The number of transmit queue elements allocated from the heap. "
+                          "Queue elements are reused once their packet leaves the queue.",
+                          TypeId::ATTR_GET,
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&LrWpanTschMac::m_txQueueElementAllocations),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("TxQueueElementRequests",
+                          "The number of transmit queue elements used, either allocated or "
+                          "reused.",
+                          TypeId::ATTR_GET,
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&LrWpanTschMac::m_txQueueElementRequests),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("TxLinkQueueAllocations",
+                          "The number of per-neighbor transmit queues allocated. Queues are "
+                          "reused once they are empty.",
+                          TypeId::ATTR_GET,
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&LrWpanTschMac::m_txLinkQueueAllocations),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("AvoidedSchedulerEvents",
+                          "The number of zero-delay scheduler events avoided by running the "
+                          "deferred MAC tasks at the end of the current event.",
+                          TypeId::ATTR_GET,
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&LrWpanTschMac::m_avoidedEvents),
+                          MakeUintegerChecker<uint64_t>())
             .AddTraceSource("MacTxEnqueue",
                             "Trace source indicating a packet has been "
                             "enqueued in the transaction queue",
@@ -204,6 +257,10 @@ LrWpanTschMac::LrWpanTschMac()
     m_macMaxFrameRetries = 3;
     m_txPkt = 0;
     m_txLinkSequence = 0;
+    m_maxTxQueueSizePerNeighbor = std::numeric_limits<uint32_t>::max();
+    m_txQueueElementAllocations = 0;
+    m_txQueueElementRequests = 0;
+    m_txLinkQueueAllocations = 0;
 
     Ptr<UniformRandomVariable> uniformVar = CreateObject<UniformRandomVariable>();
     uniformVar->SetAttribute("Min", DoubleValue(0.0));
@@ -212,10 +269,23 @@ LrWpanTschMac::LrWpanTschMac()
 
     m_macCCAEnabled = true;
     m_macHoppingEnabled = true;
+    m_waitingLink = false;
     m_sharedLink = false;
     m_emptySlot = true;
     m_newSlot = true;
+    m_skipIdleSlots = false;
+    m_nextAsn = 0;
+    m_nextAsnPending = false;
+    m_clockedAsnAdvanced = false;
+    m_microTasksEnabled = true;
+    m_microTaskDepth = 0;
+    m_microTaskEventPending = false;
+    m_deferredMacState = 0;
+    m_deferredMacStateId = 0;
+    m_avoidedEvents = 0;
     m_random = CreateObject<UniformRandomVariable>();
+    m_channelAttributes = Create<PhyPibAttributes>();
+    m_channelSwitchPending = false;
 
     ResetMacTschPibAttributes();
     ResetMacTimeslotTemplate();
@@ -244,17 +314,18 @@ LrWpanTschMac::DoDispose()
     m_txPkt = 0;
     m_txLinkSequence = 0;
 
-    for (uint32_t i = 0; i < m_txQueueAllLink.size(); i++)
-    {
-        for (uint32_t j = 0; j < m_txQueueAllLink[i]->txQueuePerLink.size(); j++)
-        {
-            m_txQueueAllLink[i]->txQueuePerLink[j]->txQPkt = 0;
-            delete m_txQueueAllLink[i]->txQueuePerLink[j];
-        }
-        m_txQueueAllLink[i]->txQueuePerLink.clear();
-        delete m_txQueueAllLink[i];
-    }
-    m_txQueueAllLink.clear();
+    m_txLinkQueues.clear();
+    m_txQueueElementPool.clear();
+    m_txQueueElementFreeList.clear();
+    m_txLinkQueueIndex.clear();
+    m_txLinkQueueFreeHandles.clear();
+
+    CancelIncAsn();
+    m_slotClock = nullptr;
+    m_slotEngine = nullptr;
+    m_microTasks.clear();
+    m_channelSwitchPending = false;
+    m_channelAttributes = nullptr;
 
     m_phy = 0;
     m_mcpsDataIndicationCallback = MakeNullCallback<void, McpsDataIndicationParams, Ptr<Packet>>();
@@ -302,7 +373,7 @@ LrWpanTschMac::McpsDataRequest(McpsDataRequestParams params, Ptr<Packet> p)
     NS_LOG_FUNCTION(this << p);
 
     McpsDataConfirmParams confirmParams;
-    confirmParams.m_macASN = m_macTschPIBAttributes.m_macASN;
+    confirmParams.m_macASN = GetCurrentAsn();
     confirmParams.m_msduHandle = params.m_msduHandle;
 
     // TODO: We need a drop trace for the case that the packet is too large or the request
@@ -472,58 +543,101 @@ LrWpanTschMac::McpsDataRequest(McpsDataRequestParams params, Ptr<Packet> p)
     }
     p->AddTrailer(macTrailer);
 
+    Mac16Address dstAddr = macHdr.GetShortDstAddr();
+
+    uint32_t handle;
+    bool queued = FindTxLinkQueue(dstAddr, handle);
+    uint32_t queueSize = queued ? m_txLinkQueues[handle].txQueuePerLink.size() : 0;
+    if (queueSize >= m_maxTxQueueSizePerNeighbor)
+    {
+        NS_LOG_DEBUG("TX Queue of " << dstAddr << " with size " << queueSize
+                                    << " is full, dropping packet");
+        if (!m_mcpsDataConfirmCallback.IsNull())
+        {
+            confirmParams.m_status = MacStatus::TRANSACTION_OVERFLOW;
+            m_mcpsDataConfirmCallback(confirmParams);
+        }
+        m_macTxDropTrace(p);
+        return;
+    }
+    if (!queued)
+    {
+        handle = AllocateTxLinkQueue(dstAddr);
+    }
+
     m_macTxEnqueueTrace(p);
 
-    TxQueueRequestElement* txQElement = new TxQueueRequestElement;
+    TxQueueRequestElement* txQElement = AllocTxQueueElement();
     txQElement->txQMsduHandle = params.m_msduHandle;
     txQElement->txQPkt = p;
     txQElement->txRequestNB = 0;
     txQElement->txRequestCW = 0;
 
-    Mac16Address dstAddr = macHdr.GetShortDstAddr();
+    m_txLinkQueues[handle].txQueuePerLink.push_back(txQElement);
+    NS_LOG_DEBUG("Enqueuing packet with SeqNum = " << (int)macHdr.GetSeqNum()
+                                                   << " in link queue with handle = " << handle);
+}
 
-    bool flag_findLinkQueue = false;
-    if (m_txQueueAllLink.size() == 0)
-    {
-        flag_findLinkQueue = false;
-    }
-    else
+LrWpanTschMac::TxQueueRequestElement*
+LrWpanTschMac::AllocTxQueueElement()
+{
+    m_txQueueElementRequests++;
+    if (m_txQueueElementFreeList.empty())
     {
-        for (uint32_t i = 0; i < m_txQueueAllLink.size(); i++)
-        {
-            if (m_txQueueAllLink[i]->txDstAddr == dstAddr)
-            {
-                m_txQueueAllLink[i]->txQueuePerLink.push_back(txQElement);
-                NS_LOG_DEBUG("Enqueuing packet with SeqNum = "
-                             << (int)macHdr.GetSeqNum()
-                             << " in existed link queue with link sequence = " << i);
-                flag_findLinkQueue = true;
-                break;
-            }
-        }
+        m_txQueueElementAllocations++;
+        m_txQueueElementPool.emplace_back();
+        return &m_txQueueElementPool.back();
     }
-    if (!flag_findLinkQueue)
-        SetTxLinkQueue(txQElement, dstAddr, macHdr.GetSeqNum());
+
+    TxQueueRequestElement* txQElement = m_txQueueElementFreeList.back();
+    m_txQueueElementFreeList.pop_back();
+    return txQElement;
 }
 
 void
-LrWpanTschMac::SetTxLinkQueue(TxQueueRequestElement* newRequestElement,
-                              Mac16Address newDstAddr,
-                              uint8_t newSeqNum)
+LrWpanTschMac::FreeTxQueueElement(TxQueueRequestElement* txQElement)
 {
-    NS_LOG_FUNCTION(this);
+    txQElement->txQPkt = nullptr;
+    m_txQueueElementFreeList.push_back(txQElement);
+}
 
-    TxQueueLinkElement* txQueueLinkElement = new TxQueueLinkElement;
+bool
+LrWpanTschMac::FindTxLinkQueue(Mac16Address dstAddr, uint32_t& handle) const
+{
+    auto it = m_txLinkQueueIndex.find(dstAddr);
+    if (it == m_txLinkQueueIndex.end())
+    {
+        return false;
+    }
+    handle = it->second;
+    return true;
+}
 
-    txQueueLinkElement->txQueuePerLink.push_back(newRequestElement);
+uint32_t
+LrWpanTschMac::AllocateTxLinkQueue(Mac16Address dstAddr)
+{
+    NS_LOG_FUNCTION(this << dstAddr);
 
-    NS_LOG_DEBUG("Enqueuing packet with SeqNum = "
-                 << (int)newSeqNum << " in queue with link sequence = " << m_txQueueAllLink.size());
+    uint32_t handle;
+    if (m_txLinkQueueFreeHandles.empty())
+    {
+        handle = m_txLinkQueues.size();
+        m_txLinkQueues.emplace_back();
+        m_txLinkQueueAllocations++;
+    }
+    else
+    {
+        handle = m_txLinkQueueFreeHandles.back();
+        m_txLinkQueueFreeHandles.pop_back();
+    }
 
-    txQueueLinkElement->txDstAddr = newDstAddr;
-    txQueueLinkElement->txLinkBE = m_macTschPIBAttributes.macMinBE;
+    TxQueueLinkElement& txQueueLinkElement = m_txLinkQueues[handle];
+    txQueueLinkElement.txDstAddr = dstAddr;
+    txQueueLinkElement.txLinkBE = m_macTschPIBAttributes.macMinBE;
+    m_txLinkQueueIndex[dstAddr] = handle;
 
-    m_txQueueAllLink.push_back(txQueueLinkElement);
+    NS_LOG_DEBUG("New queue for " << dstAddr << " with link handle = " << handle);
+    return handle;
 }
 
 /*void
@@ -566,6 +680,7 @@ void
 LrWpanTschMac::SetMacTimeSlotStartCallback(MacTimeSlotStartCallback c)
 {
     m_macTimeSlotStartCallback = c;
+    RescheduleNextAsn();
 }
 
 /*
@@ -578,6 +693,7 @@ SetMlmeKeepAliveConfirmCallback (MlmeKeepAliveConfirmCallback c)
 void
 LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
 {
+    NS_PROFILE_SCOPE(m_pdDataIndicationProfile);
     NS_ASSERT(m_macState == TSCH_MAC_ACK_PENDING || m_macState == TSCH_MAC_ACK_PENDING_END ||
               m_macState == TSCH_MAC_RX || m_macState == TSCH_PKT_WAIT_END);
 
@@ -593,7 +709,8 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
     // then shortDstAddr =shortMacAddr or broadcastAddr, and if beacon frame then srcPanId =
     // m_macPanId if only srcAddr field in Data or Command frame,accept frame if srcPanId=m_macPanId
 
-    Ptr<Packet> originalPkt = p->Copy(); // because we will strip headers
+    // The frame is only peeked at, the MSDU is copied out when it is passed up.
+    Ptr<Packet> originalPkt = p;
 
     m_promiscSnifferTrace(originalPkt);
 
@@ -601,14 +718,18 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
     // XXX no rejection tracing (to macRxDropTrace) being performed below
 
     LrWpanMacTrailer receivedMacTrailer;
-    p->RemoveTrailer(receivedMacTrailer);
+    p->PeekTrailer(receivedMacTrailer);
+    bool fcsOk = true;
     if (Node::ChecksumEnabled())
     {
         receivedMacTrailer.EnableFcs(true);
+        Ptr<Packet> frame = p->Copy();
+        frame->RemoveTrailer(receivedMacTrailer);
+        fcsOk = receivedMacTrailer.CheckFcs(frame);
     }
 
     // level 1 filtering
-    if (!receivedMacTrailer.CheckFcs(p))
+    if (!fcsOk)
     {
         m_macRxDropTrace(originalPkt);
         NS_LOG_DEBUG("FCS check fail");
@@ -616,33 +737,11 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
     else
     {
         LrWpanMacHeader receivedMacHdr;
-        p->RemoveHeader(receivedMacHdr);
+        p->PeekHeader(receivedMacHdr);
+        uint32_t msduSize = p->GetSize() - receivedMacHdr.GetSerializedSize() -
+                            receivedMacTrailer.GetSerializedSize();
 
-        McpsDataIndicationParams params;
-        params.m_macASN = m_macTschPIBAttributes.m_macASN;
-        if (receivedMacHdr.IsSeqNumSup())
-        {
-            params.m_dsn = 0;
-        }
-        else
-        {
-            params.m_dsn = receivedMacHdr.GetSeqNum();
-        }
-        params.m_mpduLinkQuality = lqi;
-        params.m_srcPanId = receivedMacHdr.GetSrcPanId();
-        params.m_srcAddrMode = receivedMacHdr.GetSrcAddrMode();
-        // TODO: Add field for EXT_ADDR source address.
-        if (params.m_srcAddrMode == SHORT_ADDR)
-        {
-            params.m_srcAddr = receivedMacHdr.GetShortSrcAddr();
-        }
-        params.m_dstPanId = receivedMacHdr.GetDstPanId();
-        params.m_dstAddrMode = receivedMacHdr.GetDstAddrMode();
-        // TODO: Add field for EXT_ADDR destination address.
-        if (params.m_dstAddrMode == SHORT_ADDR)
-        {
-            params.m_dstAddr = receivedMacHdr.GetShortDstAddr();
-        }
+        McpsDataIndicationParams params = GetIndicationParams(receivedMacHdr, lqi);
 
         NS_LOG_DEBUG("Packet from " << params.m_srcAddr << " to " << params.m_dstAddr
                                     << " with seqnum = " << (int)receivedMacHdr.GetSeqNum());
@@ -653,7 +752,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
             if (!m_mcpsDataIndicationCallback.IsNull())
             {
                 NS_LOG_DEBUG("promiscuous mode, forwarding up");
-                m_mcpsDataIndicationCallback(params, p);
+                m_mcpsDataIndicationCallback(params, GetMsdu(p, receivedMacHdr));
             }
             else
             {
@@ -663,48 +762,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
         else
         {
             // level 3 frame filtering
-            acceptFrame = (receivedMacHdr.GetType() != LrWpanMacHeader::LRWPAN_MAC_RESERVED);
-            if (acceptFrame)
-            {
-                acceptFrame = (receivedMacHdr.GetFrameVer() == 2);
-            }
-
-            if (acceptFrame && receivedMacHdr.GetFrameVer() == 2 &&
-                ((receivedMacHdr.GetDstAddrMode() == 0 && receivedMacHdr.GetSrcAddrMode() == 0 &&
-                  receivedMacHdr.IsPanIdComp()) ||
-                 (receivedMacHdr.GetDstAddrMode() > 0 && receivedMacHdr.GetSrcAddrMode() == 0 &&
-                  !receivedMacHdr.IsPanIdComp()) ||
-                 (receivedMacHdr.GetDstAddrMode() > 0 && receivedMacHdr.GetSrcAddrMode() > 0 &&
-                  !receivedMacHdr.IsPanIdComp())))
-            {
-                acceptFrame = receivedMacHdr.GetDstPanId() == m_macPanId ||
-                              receivedMacHdr.GetDstPanId() == 0xffff;
-            }
-
-            if (acceptFrame && (receivedMacHdr.GetDstAddrMode() == 2))
-            {
-                acceptFrame = receivedMacHdr.GetShortDstAddr() == m_shortAddress ||
-                              receivedMacHdr.GetShortDstAddr() ==
-                                  Mac16Address("ff:ff"); // check for broadcast addrs
-            }
-
-            if (acceptFrame && (receivedMacHdr.GetDstAddrMode() == 3))
-            {
-                acceptFrame = (receivedMacHdr.GetExtDstAddr() == m_selfExt);
-            }
-
-            if (acceptFrame && (receivedMacHdr.GetType() == LrWpanMacHeader::LRWPAN_MAC_BEACON))
-            {
-                if (m_macPanId == 0xffff)
-                {
-                    acceptFrame = true;
-                }
-                else
-                {
-                    acceptFrame = receivedMacHdr.GetSrcPanId() == m_macPanId;
-                    NS_LOG_DEBUG(acceptFrame << "-5");
-                }
-            }
+            acceptFrame = AcceptFrame(receivedMacHdr);
 
             if (acceptFrame)
             {
@@ -721,20 +779,18 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                         m_macTschPIBAttributes.m_macASN % def_MacChannelHopping.m_macHoppingSequenceLength
                     });
 
-                    m_setMacState.Cancel();
-                    m_setMacState = Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState,
-                                                           this,
-                                                           TSCH_MAC_IDLE);
+                    DeferCancelableIdleState();
                     if (receivedMacHdr.IsSeqNumSup() ||
                         (receivedMacHdr.GetSeqNum() == macHdr.GetSeqNum()))
                     {
+                        NotifyTxOutcome(true);
                         m_macTxOkTrace(m_txPkt);
                         // If it is an ACK with the expected sequence number, finish the
                         // transmission and notify the upper layer.
                         if (!m_mcpsDataConfirmCallback.IsNull())
                         {
                             TxQueueRequestElement* txQElement =
-                                m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front();
+                                m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front();
                             McpsDataConfirmParams confirmParams;
                             confirmParams.m_macASN = m_macTschPIBAttributes.m_macASN;
                             confirmParams.m_msduHandle = txQElement->txQMsduHandle;
@@ -750,6 +806,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                     else
                     {
                         NS_LOG_DEBUG("ACK received with wrong seq num" << m_selfExt);
+                        NotifyTxOutcome(false);
                         HandleTxFailure();
                     }
 
@@ -759,9 +816,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                     }
                     else
                     {
-                        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState,
-                                               this,
-                                               TSCH_MAC_IDLE);
+                        DeferMacState(TSCH_MAC_IDLE);
                     }
                 }
                 else if (receivedMacHdr.IsData() && !m_mcpsDataIndicationCallback.IsNull() &&
@@ -769,7 +824,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                 {
                     // If it is a data frame, push it up the stack.
                     NS_LOG_DEBUG("Packet successfully received from " << params.m_srcAddr);
-                    m_mcpsDataIndicationCallback(params, p);
+                    m_mcpsDataIndicationCallback(params, GetMsdu(p, receivedMacHdr));
                     m_latestPacketSize = originalPkt->GetSize();
                     // TODO: check the src MAC address
                     if (receivedMacHdr.IsAckReq())
@@ -781,9 +836,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                                             receivedMacHdr.GetSeqNum(),
                                             receivedMacHdr.IsSeqNumSup());
                         m_lrWpanMacStatePending = TSCH_MAC_SENDING;
-                        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState,
-                                               this,
-                                               TSCH_MAC_IDLE);
+                        DeferMacState(TSCH_MAC_IDLE);
                     }
                     else
                     {
@@ -796,9 +849,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                     }
                     else
                     {
-                        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState,
-                                               this,
-                                               TSCH_MAC_IDLE);
+                        DeferMacState(TSCH_MAC_IDLE);
                     }
                 }
                 else
@@ -807,7 +858,7 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
                     NS_LOG_DEBUG("Packet not expected pkt type = " << receivedMacHdr.GetType());
                     if (receivedMacHdr.IsData())
                     {
-                        m_macRxDataTrace(p->GetSize());
+                        m_macRxDataTrace(msduSize);
                     }
                 }
             }
@@ -820,13 +871,113 @@ LrWpanTschMac::PdDataIndication(uint32_t psduLength, Ptr<Packet> p, uint8_t lqi)
     }
 }
 
+McpsDataIndicationParams
+LrWpanTschMac::GetIndicationParams(const LrWpanMacHeader& hdr, uint8_t lqi) const
+{
+    McpsDataIndicationParams params;
+    params.m_macASN = m_macTschPIBAttributes.m_macASN;
+    if (hdr.IsSeqNumSup())
+    {
+        params.m_dsn = 0;
+    }
+    else
+    {
+        params.m_dsn = hdr.GetSeqNum();
+    }
+    params.m_mpduLinkQuality = lqi;
+    params.m_srcPanId = hdr.GetSrcPanId();
+    params.m_srcAddrMode = hdr.GetSrcAddrMode();
+    // TODO: Add field for EXT_ADDR source address.
+    if (params.m_srcAddrMode == SHORT_ADDR)
+    {
+        params.m_srcAddr = hdr.GetShortSrcAddr();
+    }
+    params.m_dstPanId = hdr.GetDstPanId();
+    params.m_dstAddrMode = hdr.GetDstAddrMode();
+    // TODO: Add field for EXT_ADDR destination address.
+    if (params.m_dstAddrMode == SHORT_ADDR)
+    {
+        params.m_dstAddr = hdr.GetShortDstAddr();
+    }
+
+    return params;
+}
+
+bool
+LrWpanTschMac::AcceptFrame(const LrWpanMacHeader& hdr) const
+{
+    bool acceptFrame = (hdr.GetType() != LrWpanMacHeader::LRWPAN_MAC_RESERVED);
+    if (acceptFrame)
+    {
+        acceptFrame = (hdr.GetFrameVer() == 2);
+    }
+
+    if (acceptFrame && hdr.GetFrameVer() == 2 &&
+        ((hdr.GetDstAddrMode() == 0 && hdr.GetSrcAddrMode() == 0 && hdr.IsPanIdComp()) ||
+         (hdr.GetDstAddrMode() > 0 && hdr.GetSrcAddrMode() == 0 && !hdr.IsPanIdComp()) ||
+         (hdr.GetDstAddrMode() > 0 && hdr.GetSrcAddrMode() > 0 && !hdr.IsPanIdComp())))
+    {
+        acceptFrame = hdr.GetDstPanId() == m_macPanId || hdr.GetDstPanId() == 0xffff;
+    }
+
+    if (acceptFrame && (hdr.GetDstAddrMode() == 2))
+    {
+        acceptFrame = hdr.GetShortDstAddr() == m_shortAddress ||
+                      hdr.GetShortDstAddr() == Mac16Address("ff:ff"); // check for broadcast addrs
+    }
+
+    if (acceptFrame && (hdr.GetDstAddrMode() == 3))
+    {
+        acceptFrame = (hdr.GetExtDstAddr() == m_selfExt);
+    }
+
+    if (acceptFrame && (hdr.GetType() == LrWpanMacHeader::LRWPAN_MAC_BEACON))
+    {
+        if (m_macPanId == 0xffff)
+        {
+            acceptFrame = true;
+        }
+        else
+        {
+            acceptFrame = hdr.GetSrcPanId() == m_macPanId;
+            NS_LOG_DEBUG(acceptFrame << "-5");
+        }
+    }
+
+    return acceptFrame;
+}
+
+Ptr<Packet>
+LrWpanTschMac::GetMsdu(Ptr<const Packet> frame, const LrWpanMacHeader& macHdr) const
+{
+    LrWpanMacTrailer macTrailer;
+    uint32_t headerSize = macHdr.GetSerializedSize();
+    return frame->CreateFragment(headerSize,
+                                 frame->GetSize() - headerSize - macTrailer.GetSerializedSize());
+}
+
 void
 LrWpanTschMac::SendAck(uint8_t seqno, bool seqnumsup)
 {
     NS_LOG_FUNCTION(this);
+    MicroTaskScope scope(this);
 
     NS_ASSERT(m_macState == TSCH_MAC_IDLE);
 
+    // Enqueue the ACK packet for further processing
+    // when the transmitter is activated.
+
+    m_txPkt = CreateAck(seqno, seqnumsup);
+
+    NS_LOG_DEBUG("Sending ack with size = " << m_txPkt->GetSize() << " "
+                                            << m_txPkt->GetSerializedSize());
+    // Switch transceiver to TX mode. Proceed sending the Ack on confirm.
+    SetLrWpanMacState(TSCH_MAC_SENDING);
+}
+
+Ptr<Packet>
+LrWpanTschMac::CreateAck(uint8_t seqno, bool seqnumsup) const
+{
     // Generate a corresponding ACK Frame.
     LrWpanMacHeader macHdr;
 
@@ -867,16 +1018,7 @@ LrWpanTschMac::SendAck(uint8_t seqno, bool seqnumsup)
         macTrailer.SetFcs(ackPacket);
     }
     ackPacket->AddTrailer(macTrailer);
-
-    // Enqueue the ACK packet for further processing
-    // when the transmitter is activated.
-
-    m_txPkt = ackPacket;
-
-    NS_LOG_DEBUG("Sending ack with size = " << m_txPkt->GetSize() << " "
-                                            << m_txPkt->GetSerializedSize());
-    // Switch transceiver to TX mode. Proceed sending the Ack on confirm.
-    SetLrWpanMacState(TSCH_MAC_SENDING);
+    return ackPacket;
 }
 
 void
@@ -884,13 +1026,12 @@ LrWpanTschMac::RemoveTxQueueElement()
 {
     NS_LOG_FUNCTION(this);
 
-    TxQueueRequestElement* txQElement = m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front();
+    TxQueueRequestElement* txQElement = m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front();
     Ptr<const Packet> p = txQElement->txQPkt;
     // m_numCsmacaRetry += m_csmaCa->GetNB () + 1;
 
-    Ptr<Packet> pkt = p->Copy();
     LrWpanMacHeader hdr;
-    pkt->RemoveHeader(hdr);
+    p->PeekHeader(hdr);
     if (hdr.GetShortDstAddr() != Mac16Address("ff:ff"))
     {
         if (txQElement->txRequestNB == m_macMaxFrameRetries)
@@ -907,15 +1048,16 @@ LrWpanTschMac::RemoveTxQueueElement()
         }
     }
 
-    txQElement->txQPkt = 0;
-    delete txQElement;
+    FreeTxQueueElement(txQElement);
 
-    m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.pop_front();
+    TxQueueLinkElement& txQueueLinkElement = m_txLinkQueues[m_txLinkSequence];
+    txQueueLinkElement.txQueuePerLink.pop_front();
 
-    if (m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.size() == 0)
+    if (txQueueLinkElement.txQueuePerLink.empty())
     {
-        m_txQueueAllLink.erase(m_txQueueAllLink.begin() + m_txLinkSequence);
-        NS_LOG_DEBUG("Delete queue with link position = " << m_txLinkSequence);
+        m_txLinkQueueIndex.erase(txQueueLinkElement.txDstAddr);
+        m_txLinkQueueFreeHandles.push_back(m_txLinkSequence);
+        NS_LOG_DEBUG("Release queue with link handle = " << m_txLinkSequence);
     }
     m_txLinkSequence = 0;
     m_txPkt = 0;
@@ -928,7 +1070,7 @@ LrWpanTschMac::PdDataConfirm(PhyEnumeration status)
 {
     NS_ASSERT(m_macState == TSCH_MAC_SENDING);
 
-    NS_LOG_FUNCTION(this << status << m_txQueueAllLink.size());
+    NS_LOG_FUNCTION(this << status << m_txLinkQueueIndex.size());
 
     LrWpanMacHeader macHdr;
     m_txPkt->PeekHeader(macHdr);
@@ -949,6 +1091,7 @@ LrWpanTschMac::PdDataConfirm(PhyEnumeration status)
             }
             else
             {
+                NotifyTxOutcome(true);
                 m_macTxOkTrace(m_txPkt);
                 m_macTxDataTrace(m_latestPacketSize);
                 // remove the copy of the packet that was just sent
@@ -956,9 +1099,9 @@ LrWpanTschMac::PdDataConfirm(PhyEnumeration status)
                 {
                     McpsDataConfirmParams confirmParams;
                     confirmParams.m_macASN = m_macTschPIBAttributes.m_macASN;
-                    NS_ASSERT_MSG(m_txQueueAllLink.size() > 0, "TxQsize = 0");
+                    NS_ASSERT_MSG(m_txLinkQueueIndex.size() > 0, "TxQsize = 0");
                     TxQueueRequestElement* txQElement =
-                        m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front();
+                        m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front();
                     confirmParams.m_msduHandle = txQElement->txQMsduHandle;
                     confirmParams.m_status = MacStatus::SUCCESS;
                     m_mcpsDataConfirmCallback(confirmParams);
@@ -984,9 +1127,9 @@ LrWpanTschMac::PdDataConfirm(PhyEnumeration status)
                 m_macRxDataTrace(m_latestPacketSize);
             }
             m_latestPacketSize = m_txPkt->GetSize();
-            NS_ASSERT_MSG(m_txQueueAllLink.size() > 0, "TxQsize = 0");
+            NS_ASSERT_MSG(m_txLinkQueueIndex.size() > 0, "TxQsize = 0");
             TxQueueRequestElement* txQElement =
-                m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front();
+                m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front();
             m_macTxDropTrace(txQElement->txQPkt);
             if (!m_mcpsDataConfirmCallback.IsNull())
             {
@@ -1018,8 +1161,7 @@ LrWpanTschMac::PdDataConfirm(PhyEnumeration status)
         NS_FATAL_ERROR("Transmission attempt failed with PHY status " << status);
     }
 
-    m_setMacState.Cancel();
-    m_setMacState = Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_IDLE);
+    DeferCancelableIdleState();
 }
 
 void
@@ -1062,7 +1204,7 @@ LrWpanTschMac::PlmeSetTRXStateConfirm(PhyEnumeration status)
     NS_LOG_FUNCTION(this << status);
 
     if (status == IEEE_802_15_4_PHY_FORCE_TRX_OFF)
-        m_setMacState.Cancel();
+        CancelDeferredMacState();
 
     else if (m_macState == TSCH_MAC_SENDING &&
              (status == IEEE_802_15_4_PHY_TX_ON || status == IEEE_802_15_4_PHY_SUCCESS ||
@@ -1127,6 +1269,7 @@ LrWpanTschMac::PlmeSetTRXStateConfirm(PhyEnumeration status)
             // didnt receive any packet
             m_macWaitAckTrace(m_latestPacketSize);
             NS_LOG_DEBUG("No ack received.");
+            NotifyTxOutcome(false);
             HandleTxFailure();
             ChangeMacState(TSCH_MAC_IDLE);
         }
@@ -1212,7 +1355,7 @@ LrWpanTschMac::SetLrWpanMacState(TschMacState macState)
         // cannot find a clear channel, drop the current packet.
         NS_LOG_DEBUG(this << " cannot find clear channel");
         confirmParams.m_msduHandle =
-            m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front()->txQMsduHandle;
+            m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txQMsduHandle;
         confirmParams.m_status = MacStatus::CHANNEL_ACCESS_FAILURE;
         if (!m_mcpsDataConfirmCallback.IsNull())
         {
@@ -1314,6 +1457,27 @@ LrWpanTschMac::SetMacMaxFrameRetries(uint8_t retries)
     m_macMaxFrameRetries = retries;
 }
 
+uint8_t
+LrWpanTschMac::GetCurrentChannel() const
+{
+    return m_currentChannel;
+}
+
+bool
+LrWpanTschMac::IsHoppingSequenceEndPending() const
+{
+    return m_nextAsnPending && m_nextAsnTime == Simulator::Now() && m_nextAsn != 0 &&
+           m_nextAsn % def_MacChannelHopping.m_macHoppingSequenceLength == 0;
+}
+
+void
+LrWpanTschMac::PrintProfile(std::ostream& os) const
+{
+    m_scheduleTimeslotProfile.Print(os, "ScheduleTimeslot");
+    m_findTxPacketProfile.Print(os, "FindTxPacketInEmptySlot");
+    m_pdDataIndicationProfile.Print(os, "PdDataIndication");
+}
+
 /*
 TSCH method
 */
@@ -1338,6 +1502,12 @@ LrWpanTschMac::MlmeSetSlotframeRequest(MlmeSetSlotframeRequestParams params)
             entry.slotframeHandle = params.slotframeHandle;
             entry.size = params.size;
             m_macSlotframeTable.push_back(entry);
+
+            TschLinkBuckets& buckets = m_macLinkTable[params.slotframeHandle];
+            if (buckets.size() < params.size)
+            {
+                buckets.resize(params.size);
+            }
             confirmParams.Status = MlmeSetSlotframeConfirmStatus_SUCCESS;
         }
 
@@ -1381,6 +1551,12 @@ LrWpanTschMac::MlmeSetSlotframeRequest(MlmeSetSlotframeRequestParams params)
                 foundsf = true;
                 confirmParams.Status = MlmeSetSlotframeConfirmStatus_SUCCESS;
                 i->size = params.size;
+
+                TschLinkBuckets& buckets = m_macLinkTable[params.slotframeHandle];
+                if (buckets.size() < params.size)
+                {
+                    buckets.resize(params.size);
+                }
             }
         }
 
@@ -1394,6 +1570,8 @@ LrWpanTschMac::MlmeSetSlotframeRequest(MlmeSetSlotframeRequestParams params)
         break;
     }
 
+    RescheduleNextAsn();
+
     if ((!m_mlmeSetSlotframeConfirmCallback.IsNull()))
     {
         m_mlmeSetSlotframeConfirmCallback(confirmParams);
@@ -1412,21 +1590,16 @@ LrWpanTschMac::MlmeSetLinkRequest(MlmeSetLinkRequestParams params)
     confirmParams.linkHandle = params.linkHandle;
     confirmParams.slotframeHandle = params.slotframeHandle;
     MacPibLinkAttributes entry;
-    bool foundlink = false;
-    // std::list<MacPibLinkAttributes>::iterator it;
+    uint16_t timeslot;
+    uint32_t index;
 
     switch (params.Operation)
     {
     case MlmeSetLinkRequestOperation_ADD_LINK:
-        /*for (it = m_macLinkTable.begin();it != m_macLinkTable.end();it++) {
-          if (it->slotframeHandle == params.slotframeHandle) {
-
-            //Check if link already exists
-            if (it->macLinkHandle == params.linkHandle) {
-              confirmParams.Status = MlmeSetLinkConfirmStatus_INVALID_PARAMETER; //invalid
-              break;
-            }
-          }
+        /*if (FindLinkEntry(params.slotframeHandle, params.linkHandle, timeslot, index)) {
+          //Check if link already exists
+          confirmParams.Status = MlmeSetLinkConfirmStatus_INVALID_PARAMETER; //invalid
+          break;
         }*/
 
         entry.macLinkHandle = params.linkHandle;
@@ -1443,79 +1616,80 @@ LrWpanTschMac::MlmeSetLinkRequest(MlmeSetLinkRequestParams params)
         entry.macTxID = params.TxID;
         entry.macRxID = params.RxID;
 
-        m_macLinkTable.push_back(entry);
+        AddLinkEntry(entry);
+        AddChannelTableRow(entry.macChannelOffset);
         confirmParams.Status = MlmeSetLinkConfirmStatus_SUCCESS;
         break;
 
     case MlmeSetLinkRequestOperation_DELETE_LINK:
-        for (std::list<MacPibLinkAttributes>::iterator i = m_macLinkTable.begin();
-             i != m_macLinkTable.end();
-             i++)
+        if (FindLinkEntry(params.slotframeHandle, params.linkHandle, timeslot, index))
         {
-            if (i->slotframeHandle == params.slotframeHandle &&
-                i->macLinkHandle == params.linkHandle)
+            confirmParams.Status = MlmeSetLinkConfirmStatus_SUCCESS;
+            if (currentLink.active && currentLink.slotframeHandle == params.slotframeHandle &&
+                currentLink.linkHandle == params.linkHandle)
             {
-                foundlink = true;
-                confirmParams.Status = MlmeSetLinkConfirmStatus_SUCCESS;
-                if (currentLink.active && currentLink.slotframeHandle == params.slotframeHandle &&
-                    currentLink.linkHandle == params.linkHandle)
-                {
-                    NS_ASSERT_MSG(false, "DELETE ACTIVE LINK!!");
-                    m_waitingLink = true;
-                    m_waitingLinkParams = params;
-                }
-                else
-                {
-                    m_waitingLink = false;
-                    m_macLinkTable.erase(i);
-                }
-                break;
+                NS_ASSERT_MSG(false, "DELETE ACTIVE LINK!!");
+                m_waitingLink = true;
+                m_waitingLinkParams = params;
+            }
+            else
+            {
+                m_waitingLink = false;
+                std::vector<MacPibLinkAttributes>& bucket =
+                    m_macLinkTable[params.slotframeHandle][timeslot];
+                bucket.erase(bucket.begin() + index);
+                BuildChannelTable();
             }
         }
-
-        if (!foundlink)
+        else
         {
             confirmParams.Status = MlmeSetLinkConfirmStatus_UNKNOWN_LINK;
         }
         break;
     case MlmeSetLinkRequestOperation_MODIFY_LINK:
-        for (std::list<MacPibLinkAttributes>::iterator i = m_macLinkTable.begin();
-             i != m_macLinkTable.end();
-             i++)
+        if (FindLinkEntry(params.slotframeHandle, params.linkHandle, timeslot, index))
         {
-            if (i->slotframeHandle == params.slotframeHandle &&
-                i->macLinkHandle == params.linkHandle)
+            confirmParams.Status = MlmeSetLinkConfirmStatus_SUCCESS;
+            if (currentLink.active && currentLink.slotframeHandle == params.slotframeHandle &&
+                currentLink.linkHandle == params.linkHandle)
             {
-                foundlink = true;
-                confirmParams.Status = MlmeSetLinkConfirmStatus_SUCCESS;
-                if (currentLink.active && currentLink.slotframeHandle == params.slotframeHandle &&
-                    currentLink.linkHandle == params.linkHandle)
+                m_waitingLink = true;
+                m_waitingLinkParams = params;
+            }
+            else
+            {
+                NS_LOG_DEBUG("TSCH modifying link");
+                m_waitingLink = false;
+                std::vector<MacPibLinkAttributes>& bucket =
+                    m_macLinkTable[params.slotframeHandle][timeslot];
+                entry = bucket[index];
+                entry.macLinkOptions =
+                    params.linkOptions; // b0 = Transmit, b1 = Receive, b2 = Shared, b3=
+                                        // Timekeeping, b4–b7 reserved.
+                entry.macLinkType = params.linkType;
+                entry.macNodeAddr =
+                    params.nodeAddr; // not using Mac16_Address, 0xffff means the link can be
+                                     // used for frames destined for the broadcast address
+                entry.macTimeslot = params.Timeslot;           // refer to 5.1.1.5
+                entry.macChannelOffset = params.ChannelOffset; // refer to 5.1.1.5.3
+                // entry.macLinkFadingBias = params.linkFadingBias;
+                entry.macTxID = params.TxID;
+                entry.macRxID = params.RxID;
+
+                if (entry.macTimeslot == timeslot)
                 {
-                    m_waitingLink = true;
-                    m_waitingLinkParams = params;
+                    bucket[index] = entry;
                 }
                 else
                 {
-                    NS_LOG_DEBUG("TSCH modifying link");
-                    m_waitingLink = false;
-                    i->macLinkOptions =
-                        params.linkOptions; // b0 = Transmit, b1 = Receive, b2 = Shared, b3=
-                                            // Timekeeping, b4–b7 reserved.
-                    i->macLinkType = params.linkType;
-                    i->macNodeAddr =
-                        params.nodeAddr; // not using Mac16_Address, 0xffff means the link can be
-                                         // used for frames destined for the broadcast address
-                    i->macTimeslot = params.Timeslot;           // refer to 5.1.1.5
-                    i->macChannelOffset = params.ChannelOffset; // refer to 5.1.1.5.3
-                    // i->macLinkFadingBias = params.linkFadingBias;
-                    i->macTxID = params.TxID;
-                    i->macRxID = params.RxID;
+                    // The link moves to another timeslot bucket.
+                    bucket.erase(bucket.begin() + index);
+                    AddLinkEntry(entry);
                 }
-                break;
+                BuildChannelTable();
             }
         }
-
-        if (!foundlink)
+        else
         {
             confirmParams.Status = MlmeSetLinkConfirmStatus_UNKNOWN_LINK;
         }
@@ -1524,6 +1698,8 @@ LrWpanTschMac::MlmeSetLinkRequest(MlmeSetLinkRequestParams params)
         break;
     }
 
+    RescheduleNextAsn();
+
     if ((!m_mlmeSetLinkConfirmCallback.IsNull()) && !m_waitingLink)
     {
         m_mlmeSetLinkConfirmCallback(confirmParams);
@@ -1534,6 +1710,56 @@ LrWpanTschMac::MlmeSetLinkRequest(MlmeSetLinkRequestParams params)
     }
 }
 
+void
+LrWpanTschMac::AddLinkEntry(const MacPibLinkAttributes& link)
+{
+    TschLinkBuckets& buckets = m_macLinkTable[link.slotframeHandle];
+    if (buckets.size() <= link.macTimeslot)
+    {
+        buckets.resize(link.macTimeslot + 1);
+    }
+    buckets[link.macTimeslot].push_back(link);
+}
+
+bool
+LrWpanTschMac::FindLinkEntry(uint8_t slotframeHandle,
+                             uint16_t linkHandle,
+                             uint16_t& timeslot,
+                             uint32_t& index)
+{
+    std::map<uint8_t, TschLinkBuckets>::iterator sf = m_macLinkTable.find(slotframeHandle);
+    if (sf == m_macLinkTable.end())
+    {
+        return false;
+    }
+
+    for (uint32_t ts = 0; ts < sf->second.size(); ts++)
+    {
+        for (uint32_t i = 0; i < sf->second[ts].size(); i++)
+        {
+            if (sf->second[ts][i].macLinkHandle == linkHandle)
+            {
+                timeslot = ts;
+                index = i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+const MacPibLinkAttributes*
+LrWpanTschMac::GetTimeslotLink(uint8_t slotframeHandle, uint16_t timeslot) const
+{
+    std::map<uint8_t, TschLinkBuckets>::const_iterator sf = m_macLinkTable.find(slotframeHandle);
+    if (sf == m_macLinkTable.end() || timeslot >= sf->second.size() ||
+        sf->second[timeslot].empty())
+    {
+        return nullptr;
+    }
+    return &sf->second[timeslot].front();
+}
+
 void
 LrWpanTschMac::MlmeTschModeRequest(MlmeTschModeRequestParams params)
 {
@@ -1553,7 +1779,22 @@ LrWpanTschMac::MlmeTschModeRequest(MlmeTschModeRequestParams params)
         m_waitingLink = false;
         SetLrWpanMacState(TSCH_MAC_IDLE);
         // schedule asn incrementation
-        Simulator::ScheduleNow(&LrWpanTschMac::IncAsn, this);
+        m_nextAsn = m_macTschPIBAttributes.m_macASN + 1;
+        m_asnStartTime = Simulator::Now();
+        if (Simulator::GetContext() == Simulator::NO_CONTEXT && m_phy->GetDevice())
+        {
+            // Started before the simulation, e.g. by the helper: the timeslots
+            // run in the context of the node, as its other events.
+            Simulator::ScheduleWithContext(m_phy->GetDevice()->GetNode()->GetId(),
+                                           Time(0),
+                                           &LrWpanTschMac::ScheduleIncAsn,
+                                           this,
+                                           Simulator::Now());
+        }
+        else
+        {
+            ScheduleIncAsn(Simulator::Now());
+        }
 
         confirmParams.Status = LrWpanMlmeTschModeConfirmStatus_SUCCESS; // success
         break;
@@ -1579,8 +1820,19 @@ void
 LrWpanTschMac::IncAsn()
 {
     NS_LOG_FUNCTION(this);
+    MicroTaskScope scope(this);
+    AdvanceAsn();
+    StartSlot();
+}
+
+void
+LrWpanTschMac::AdvanceAsn()
+{
+    m_nextAsnPending = false;
+    FlushSkippedSlots();
     m_newSlot = 1;
     m_macTschPIBAttributes.m_macASN++;
+    m_asnStartTime = Simulator::Now();
 
     // are we passed one period of hopping sequences?
     if (
@@ -1604,9 +1856,12 @@ LrWpanTschMac::IncAsn()
     {
         m_macTimeSlotStartCallback(m_macTschPIBAttributes.m_macASN);
     }
-    Simulator::Schedule(MicroSeconds(def_MacTimeslotTemplate.m_macTsTimeslotLength),
-                        &LrWpanTschMac::IncAsn,
-                        this);
+}
+
+void
+LrWpanTschMac::StartSlot()
+{
+    ScheduleNextAsn();
     currentLink.active = false;
 
     if (m_macState == TSCH_MAC_ACK_PENDING_END)
@@ -1614,9 +1869,10 @@ LrWpanTschMac::IncAsn()
         // In last timeslot an ACK was expected, the PHY received something(BUSY_RX)
         // but it didn't succeed
         NS_LOG_DEBUG("A packet was received, but not the ack");
-        m_macRxDataTxAckTrace(m_latestPacketSize);
+        m_macWaitAckTrace(m_latestPacketSize);
+        NotifyTxOutcome(false);
         HandleTxFailure();
-        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_IDLE);
+        DeferMacState(TSCH_MAC_IDLE);
     }
 
     if (m_macState == TSCH_PKT_WAIT_END)
@@ -1624,22 +1880,38 @@ LrWpanTschMac::IncAsn()
         // In last timeslot an packet was expected but wasn't received
         NS_LOG_DEBUG("A packet was received, but not the expected one");
         m_macRxDataTrace(m_latestPacketSize);
-        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_IDLE);
+        DeferMacState(TSCH_MAC_IDLE);
     }
 
     if (m_waitingLink)
     {
-        Simulator::ScheduleNow(&LrWpanTschMac::MlmeSetLinkRequest, this, m_waitingLinkParams);
+        MlmeSetLinkRequestParams params = m_waitingLinkParams;
+        Defer([this, params]() { MlmeSetLinkRequest(params); });
     }
 
     for (std::list<MacPibSlotframeAttributes>::iterator it = m_macSlotframeTable.begin();
          it != m_macSlotframeTable.end();
          it++)
     {
-        Simulator::ScheduleNow(&LrWpanTschMac::ScheduleTimeslot,
-                               this,
-                               it->slotframeHandle,
-                               it->size);
+        uint8_t handle = it->slotframeHandle;
+        uint16_t size = it->size;
+        if (IsSlotAbstract())
+        {
+            // No PHY involved: the slot engine decides once all the MACs
+            // added their access.
+            Defer([this, handle, size]() { ScheduleTimeslot(handle, size); });
+            continue;
+        }
+        if (m_slotClock)
+        {
+            // Already in an event of the node, after the hooks of all the
+            // MACs of the clock.
+            ScheduleTimeslot(handle, size);
+            continue;
+        }
+        // An event rather than a micro-task: the timeslots of the MACs
+        // start after all of them incremented their ASN.
+        Simulator::ScheduleNow(&LrWpanTschMac::ScheduleTimeslot, this, handle, size);
 
         // Simulator::Schedule(Seconds(m_beaconDelay),
         //                     &LrWpanTschMac::ScheduleTimeslot,
@@ -1649,6 +1921,65 @@ LrWpanTschMac::IncAsn()
     }
 }
 
+bool
+LrWpanTschMac::HasSlotStartHooks() const
+{
+    return !m_macTimeSlotStartCallback.IsNull() ||
+           (m_nextAsn != 0 && m_nextAsn % def_MacChannelHopping.m_macHoppingSequenceLength == 0 &&
+            !m_PassedOneHoppingSequenceTrace.IsEmpty());
+}
+
+void
+LrWpanTschMac::AdvanceClockedAsn()
+{
+    NS_LOG_FUNCTION(this);
+    MicroTaskScope scope(this);
+    // The MAC may have cancelled its timeslot since it was dispatched.
+    if (m_nextAsnPending && m_nextAsnTime == Simulator::Now())
+    {
+        AdvanceAsn();
+        m_clockedAsnAdvanced = true;
+    }
+}
+
+void
+LrWpanTschMac::StartClockedSlot()
+{
+    NS_LOG_FUNCTION(this);
+    MicroTaskScope scope(this);
+    if (!m_clockedAsnAdvanced)
+    {
+        if (!m_nextAsnPending || m_nextAsnTime != Simulator::Now())
+        {
+            return;
+        }
+        AdvanceAsn();
+    }
+    m_clockedAsnAdvanced = false;
+    StartSlot();
+}
+
+void
+LrWpanTschMac::SetSlotClock(Ptr<TschSlotClock> clock)
+{
+    NS_LOG_FUNCTION(this << clock);
+    bool pending = m_nextAsnPending;
+    CancelIncAsn();
+    m_slotClock = clock;
+    m_slotEngine = DynamicCast<TschSlotEngine>(clock);
+    if (pending)
+    {
+        ScheduleIncAsn(m_nextAsnTime);
+    }
+    RescheduleNextAsn();
+}
+
+Ptr<TschSlotClock>
+LrWpanTschMac::GetSlotClock() const
+{
+    return m_slotClock;
+}
+
 void
 LrWpanTschMac::SetMacCCAEnabled(bool cca)
 {
@@ -1664,133 +1995,127 @@ LrWpanTschMac::GetMacCCAEnables()
 void
 LrWpanTschMac::ScheduleTimeslot(uint8_t handle, uint16_t size)
 {
+    NS_PROFILE_SCOPE(m_scheduleTimeslotProfile);
+    MicroTaskScope scope(this);
     uint16_t ts = m_macTschPIBAttributes.m_macASN % size;
     bool myts = false;
     m_currentReceivedPower = 0;
     NS_LOG_DEBUG("Timeslot " << m_macTschPIBAttributes.m_macASN << " ts = " << (int)ts
-                             << " Queue size = " << m_txQueueAllLink.size());
+                             << " Queue size = " << m_txLinkQueueIndex.size());
 
-    for (std::list<MacPibLinkAttributes>::iterator it = m_macLinkTable.begin();
-         it != m_macLinkTable.end();
-         it++)
+    const MacPibLinkAttributes* link = GetTimeslotLink(handle, ts);
+    if (link != nullptr)
     {
-        if (it->slotframeHandle == handle && it->macTimeslot == ts)
+        myts = true;
+        currentLink.slotframeHandle = handle;
+        currentLink.linkHandle = link->macLinkHandle;
+        currentLink.active = true;
+
+        NS_LOG_DEBUG("Link found at timeslot " << (int)ts);
+        if (m_macHoppingEnabled)
         {
-            myts = true;
-            currentLink.slotframeHandle = handle;
-            currentLink.linkHandle = it->macLinkHandle;
-            currentLink.active = true;
+            // Get next channel
+            m_currentChannel = GetSlotChannel(link->macChannelOffset);
+
+            m_macTxID = link->macTxID;
+            m_macRxID = link->macRxID;
 
-            NS_LOG_DEBUG("Link found at timeslot " << (int)ts);
-            if (m_macHoppingEnabled)
+            // Change channel
+            NS_LOG_DEBUG("TSCH Changing to channel " << (int)m_currentChannel);
+            //                if (link->macLinkFadingBias != NULL) # TODO: Check if it is
+            //                necessary in the new phy
+            //                {
+            //                    phyattr->phyLinkFadingBias =
+            //                    link->macLinkFadingBias[m_currentChannel - 11];
+            //                }
+            //                else
+            //                {
+            //                    phyattr->phyLinkFadingBias = 1;
+            //                }
+            //                NS_LOG_DEBUG(this << "setting for channel " <<
+            //                (int)m_currentChannel
+            //                                  << " fading bias: " <<
+            //                                  phyattr->phyLinkFadingBias);
+            //                m_currentFadingBias = 10 * log10(phyattr->phyLinkFadingBias);
+            if (!IsSlotAbstract())
             {
-                // Get next channel
-                m_currentChannel =
-                    def_MacChannelHopping
-                        .m_macHoppingSequenceList[(m_macTschPIBAttributes.m_macASN +
-                                                   it->macChannelOffset) %
-                                                  def_MacChannelHopping.m_macHoppingSequenceLength];
-
-                m_macTxID = it->macTxID;
-                m_macRxID = it->macRxID;
-
-                // Change channel
-                NS_LOG_DEBUG("TSCH Changing to channel " << (int)m_currentChannel);
-                Ptr<PhyPibAttributes> phyAttr = Create<PhyPibAttributes>();
-                // PhyPibAttributes* phyattr = new PhyPibAttributes();
-                phyAttr->phyCurrentChannel = m_currentChannel;
-                //                if (it->macLinkFadingBias != NULL) # TODO: Check if it is
-                //                necessary in the new phy
-                //                {
-                //                    phyattr->phyLinkFadingBias =
-                //                    it->macLinkFadingBias[m_currentChannel - 11];
-                //                }
-                //                else
-                //                {
-                //                    phyattr->phyLinkFadingBias = 1;
-                //                }
-                //                NS_LOG_DEBUG(this << "setting for channel " <<
-                //                (int)m_currentChannel
-                //                                  << " fading bias: " <<
-                //                                  phyattr->phyLinkFadingBias);
-                //                m_currentFadingBias = 10 * log10(phyattr->phyLinkFadingBias);
-                Simulator::ScheduleNow(&LrWpanPhy::PlmeSetAttributeRequest,
-                                       m_phy,
-                                       phyCurrentChannel,
-                                       phyAttr);
+                SwitchChannel(m_currentChannel);
             }
+        }
 
-            if (it->macLinkOptions[0])
+        if (link->macLinkOptions[0])
+        {
+            // transmit
+            if (link->macLinkOptions[2])
             {
-                // transmit
-                if (it->macLinkOptions[2])
-                {
-                    m_sharedLink = true;
-                    NS_LOG_DEBUG("Be careful! Shared Link is Coming!");
-                }
-                else
-                {
-                    m_sharedLink = false;
-                }
-                // if there is packets to be send and it is to the same addr as the link
-                NS_LOG_DEBUG("Queue contained link size = " << m_txQueueAllLink.size());
+                m_sharedLink = true;
+                NS_LOG_DEBUG("Be careful! Shared Link is Coming!");
+            }
+            else
+            {
+                m_sharedLink = false;
+            }
+            // if there is packets to be send and it is to the same addr as the link
+            NS_LOG_DEBUG("Queue contained link size = " << m_txLinkQueueIndex.size());
 
-                m_emptySlot = true;
-                m_txPkt = FindTxPacketInEmptySlot(it->macNodeAddr);
+            m_emptySlot = true;
+            m_txPkt = FindTxPacketInEmptySlot(link->macNodeAddr);
+
+            if (!m_emptySlot)
+            {
+                LrWpanMacHeader macHdr;
+                m_txPkt->PeekHeader(macHdr);
+                NS_LOG_DEBUG("Start timeslot transmiting procedure, seqnum = "
+                             << (int)macHdr.GetSeqNum());
 
-                if (!m_emptySlot)
+                if (m_slotEngine)
                 {
-                    LrWpanMacHeader macHdr;
-                    m_txPkt->PeekHeader(macHdr);
-                    NS_LOG_DEBUG("Start timeslot transmiting procedure, seqnum = "
-                                 << (int)macHdr.GetSeqNum());
+                    m_slotEngine->AddAccess(this, m_currentChannel, m_txPkt);
+                }
 
-                    if (m_macCCAEnabled)
-                    {
-                        Time time2wait = MicroSeconds(def_MacTimeslotTemplate.m_macTsCCAOffset);
-                        Simulator::Schedule(time2wait,
-                                            &LrWpanTschMac::SetLrWpanMacState,
-                                            this,
-                                            TSCH_MAC_CCA);
-                        m_lrWpanMacStatePending = TSCH_MAC_CCA;
-                        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState,
-                                               this,
-                                               TSCH_MAC_IDLE);
-                    }
-                    else
-                    {
-                        Time time2wait = MicroSeconds(def_MacTimeslotTemplate.m_macTsTxOffset);
-                        Simulator::Schedule(time2wait,
-                                            &LrWpanTschMac::SetLrWpanMacState,
-                                            this,
-                                            TSCH_MAC_SENDING);
-                        m_lrWpanMacStatePending = TSCH_MAC_SENDING;
-                        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState,
-                                               this,
-                                               TSCH_MAC_IDLE);
-                    }
-                    break;
+                if (IsSlotAbstract())
+                {
+                    // The slot engine decides the outcome of the timeslot, the frame is
+                    // sent now, without CCA.
+                    m_promiscSnifferTrace(m_txPkt);
+                    m_snifferTrace(m_txPkt);
+                    m_macTxTrace(m_txPkt);
+                    m_lastTransmission = Now();
+                    m_latestPacketSize = m_txPkt->GetSize();
+                }
+                else if (m_macCCAEnabled)
+                {
+                    Time time2wait = MicroSeconds(def_MacTimeslotTemplate.m_macTsCCAOffset);
+                    Simulator::Schedule(time2wait,
+                                        &LrWpanTschMac::SetLrWpanMacStateEvent,
+                                        this,
+                                        TSCH_MAC_CCA);
+                    m_lrWpanMacStatePending = TSCH_MAC_CCA;
+                    DeferMacState(TSCH_MAC_IDLE);
                 }
                 else
                 {
-                    NS_LOG_DEBUG("Not sending, empty queue");
-                    m_macRxEmptyBufferTrace(0);
-                    // m_macSleepTrace (0);
+                    Time time2wait = MicroSeconds(def_MacTimeslotTemplate.m_macTsTxOffset);
+                    Simulator::Schedule(time2wait,
+                                        &LrWpanTschMac::SetLrWpanMacStateEvent,
+                                        this,
+                                        TSCH_MAC_SENDING);
+                    m_lrWpanMacStatePending = TSCH_MAC_SENDING;
+                    DeferMacState(TSCH_MAC_IDLE);
                 }
             }
-            else if (it->macLinkOptions[1])
+            else
             {
-                // receive
-                NS_LOG_DEBUG("Start timeslot receiving procedure");
-                Time time2wait = MicroSeconds(def_MacTimeslotTemplate.m_macTsRxOffset);
-                Simulator::Schedule(time2wait,
-                                    &LrWpanTschMac::SetLrWpanMacState,
-                                    this,
-                                    TSCH_MAC_RX);
-                m_lrWpanMacStatePending = TSCH_MAC_RX;
-                Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_IDLE);
+                NS_LOG_DEBUG("Not sending, empty queue");
+                m_macRxEmptyBufferTrace(0);
+                // m_macSleepTrace (0);
             }
-            break;
+        }
+        else if (link->macLinkOptions[1])
+        {
+            // receive
+            NS_LOG_DEBUG("Start timeslot receiving procedure");
+            StartTimeslotRx();
         }
     }
 
@@ -1800,49 +2125,145 @@ LrWpanTschMac::ScheduleTimeslot(uint8_t handle, uint16_t size)
         if (m_macHoppingEnabled)
         {
             // Get next channel
-            m_currentChannel =
-                def_MacChannelHopping
-                    .m_macHoppingSequenceList[(m_macTschPIBAttributes.m_macASN + 0) %
-                                              def_MacChannelHopping.m_macHoppingSequenceLength];
+            m_currentChannel = GetSlotChannel(0);
 
             m_macTxID = 0;
             m_macRxID = 0;
 
             // Change channel
             NS_LOG_DEBUG("TSCH Changing to channel " << (int)m_currentChannel);
-            PhyPibAttributes* phyattr = new PhyPibAttributes();
-            phyattr->phyCurrentChannel = m_currentChannel;
-
-            Simulator::ScheduleNow(&LrWpanPhy::PlmeSetAttributeRequest,
-                                   m_phy,
-                                   phyCurrentChannel,
-                                   phyattr);
+            if (!IsSlotAbstract())
+            {
+                SwitchChannel(m_currentChannel);
+            }
         }
 
         // receive
         NS_LOG_DEBUG("Start timeslot receiving procedure");
-        Time time2wait = MicroSeconds(def_MacTimeslotTemplate.m_macTsRxOffset);
-        Simulator::Schedule(time2wait, &LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_RX);
-        m_lrWpanMacStatePending = TSCH_MAC_RX;
-        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_IDLE);
+        StartTimeslotRx();
     }
     else if (!myts)
     {
         NS_LOG_DEBUG("No link in this timeslot, turning off the radio");
-        Simulator::ScheduleNow(&LrWpanPhy::PlmeSetTRXStateRequest,
-                               m_phy,
-                               IEEE_802_15_4_PHY_TRX_OFF);
+        if (!IsSlotAbstract())
+        {
+            Defer([this]() { m_phy->PlmeSetTRXStateRequest(IEEE_802_15_4_PHY_TRX_OFF); });
+        }
 
         m_macSleepTrace(0);
     }
 }
 
+void
+LrWpanTschMac::StartTimeslotRx()
+{
+    if (m_slotEngine)
+    {
+        m_slotEngine->AddAccess(this, m_currentChannel, nullptr);
+    }
+
+    if (!IsSlotAbstract())
+    {
+        Time time2wait = MicroSeconds(def_MacTimeslotTemplate.m_macTsRxOffset);
+        Simulator::Schedule(time2wait,
+                            &LrWpanTschMac::SetLrWpanMacStateEvent,
+                            this,
+                            TSCH_MAC_RX);
+        m_lrWpanMacStatePending = TSCH_MAC_RX;
+        DeferMacState(TSCH_MAC_IDLE);
+    }
+}
+
+LrWpanTschMac::MicroTaskScope::MicroTaskScope(LrWpanTschMac* mac)
+    : m_mac(mac)
+{
+    m_mac->m_microTaskDepth++;
+}
+
+LrWpanTschMac::MicroTaskScope::~MicroTaskScope()
+{
+    if (--m_mac->m_microTaskDepth == 0)
+    {
+        m_mac->RunMicroTasks();
+    }
+}
+
+void
+LrWpanTschMac::Defer(std::function<void()> task)
+{
+    if (!m_microTasksEnabled)
+    {
+        Simulator::ScheduleNow(std::move(task));
+        return;
+    }
+
+    m_microTasks.push_back(std::move(task));
+    if (m_microTaskDepth > 0 || m_microTaskEventPending)
+    {
+        m_avoidedEvents++;
+        return;
+    }
+
+    // Not in an event of the MAC, e.g. in a PHY callback: the tasks must run
+    // after the caller returns, as the events they replace.
+    m_microTaskEventPending = true;
+    Simulator::ScheduleNow(&LrWpanTschMac::RunMicroTasks, this);
+}
+
+void
+LrWpanTschMac::DeferMacState(TschMacState macState)
+{
+    Defer([this, macState]() { SetLrWpanMacState(macState); });
+}
+
+void
+LrWpanTschMac::DeferCancelableIdleState()
+{
+    uint64_t id = ++m_deferredMacStateId;
+    m_deferredMacState = id;
+    Defer([this, id]() {
+        if (m_deferredMacState == id)
+        {
+            m_deferredMacState = 0;
+            SetLrWpanMacState(TSCH_MAC_IDLE);
+        }
+    });
+}
+
+void
+LrWpanTschMac::CancelDeferredMacState()
+{
+    m_deferredMacState = 0;
+}
+
+void
+LrWpanTschMac::RunMicroTasks()
+{
+    m_microTaskEventPending = false;
+    m_microTaskDepth++;
+    while (!m_microTasks.empty())
+    {
+        std::function<void()> task = std::move(m_microTasks.front());
+        m_microTasks.pop_front();
+        task();
+    }
+    m_microTaskDepth--;
+}
+
+void
+LrWpanTschMac::SetLrWpanMacStateEvent(TschMacState macState)
+{
+    MicroTaskScope scope(this);
+    SetLrWpanMacState(macState);
+}
+
 void
 LrWpanTschMac::WaitAck()
 {
     NS_LOG_FUNCTION(this);
+    MicroTaskScope scope(this);
 
-    Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_ACK_PENDING);
+    DeferMacState(TSCH_MAC_ACK_PENDING);
     Simulator::Schedule(MicroSeconds(def_MacTimeslotTemplate.m_macTsAckWait),
                         &LrWpanTschMac::AckWaitDone,
                         this);
@@ -1855,9 +2276,11 @@ LrWpanTschMac::WaitAck()
 void
 LrWpanTschMac::AckWaitDone()
 {
+    MicroTaskScope scope(this);
+
     if (m_macState == TSCH_MAC_ACK_PENDING)
     {
-        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_MAC_ACK_PENDING_END);
+        DeferMacState(TSCH_MAC_ACK_PENDING_END);
     }
     else if (m_macState == TSCH_MAC_IDLE)
     {
@@ -1872,9 +2295,11 @@ LrWpanTschMac::AckWaitDone()
 void
 LrWpanTschMac::RxWaitDone()
 {
+    MicroTaskScope scope(this);
+
     if (m_macState == TSCH_MAC_RX)
     {
-        Simulator::ScheduleNow(&LrWpanTschMac::SetLrWpanMacState, this, TSCH_PKT_WAIT_END);
+        DeferMacState(TSCH_PKT_WAIT_END);
     }
     else if (m_macState == TSCH_MAC_IDLE)
     {
@@ -1886,6 +2311,298 @@ LrWpanTschMac::RxWaitDone()
     }
 }
 
+void
+LrWpanTschMac::ScheduleNextAsn()
+{
+    uint64_t asn = m_macTschPIBAttributes.m_macASN;
+    m_nextAsn = asn + 1;
+    if (SkipsIdleSlots() && CanSkipIdleSlots() && !IsActiveAsn(asn))
+    {
+        // The current timeslot is idle, so the radio is off until the next active one.
+        m_nextAsn = GetNextActiveAsn(asn + 1);
+    }
+
+    Time slotLength = MicroSeconds(def_MacTimeslotTemplate.m_macTsTimeslotLength);
+    ScheduleIncAsn(Simulator::Now() + slotLength * static_cast<int64_t>(m_nextAsn - asn));
+}
+
+void
+LrWpanTschMac::ScheduleIncAsn(Time slotStart)
+{
+    m_nextAsnTime = slotStart;
+    m_nextAsnPending = true;
+    if (m_slotClock)
+    {
+        m_slotClock->Subscribe(this, slotStart);
+    }
+    else
+    {
+        m_incAsnEvent =
+            Simulator::Schedule(slotStart - Simulator::Now(), &LrWpanTschMac::IncAsn, this);
+    }
+}
+
+void
+LrWpanTschMac::CancelIncAsn()
+{
+    if (!m_nextAsnPending)
+    {
+        return;
+    }
+
+    if (m_slotClock)
+    {
+        m_slotClock->Unsubscribe(this, m_nextAsnTime);
+    }
+    else
+    {
+        m_incAsnEvent.Cancel();
+    }
+    m_nextAsnPending = false;
+}
+
+bool
+LrWpanTschMac::IsSlotAbstract() const
+{
+    return m_slotEngine && !m_slotEngine->IsValidating();
+}
+
+void
+LrWpanTschMac::NotifyTxOutcome(bool success)
+{
+    if (m_slotEngine)
+    {
+        m_slotEngine->NotifyTxOutcome(this, success);
+    }
+}
+
+void
+LrWpanTschMac::EndAbstractTx(Ptr<Packet> ack)
+{
+    NS_LOG_FUNCTION(this << ack);
+    MicroTaskScope scope(this);
+
+    LrWpanMacHeader macHdr;
+    m_txPkt->PeekHeader(macHdr);
+    if (macHdr.IsAckReq() && !ack)
+    {
+        NS_LOG_DEBUG("No ack received.");
+        m_macWaitAckTrace(m_latestPacketSize);
+        HandleTxFailure();
+        return;
+    }
+
+    if (ack)
+    {
+        m_promiscSnifferTrace(ack);
+        m_macPromiscRxTrace(ack);
+        m_macRxTrace(ack);
+        m_macTxDataRxAckTrace(
+            {m_currentChannel,
+             m_macTschPIBAttributes.m_macASN % def_MacChannelHopping.m_macHoppingSequenceLength});
+    }
+    m_macTxOkTrace(m_txPkt);
+    if (!ack)
+    {
+        m_macTxDataTrace(m_latestPacketSize);
+    }
+
+    if (!m_mcpsDataConfirmCallback.IsNull())
+    {
+        McpsDataConfirmParams confirmParams;
+        confirmParams.m_macASN = m_macTschPIBAttributes.m_macASN;
+        confirmParams.m_msduHandle =
+            m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txQMsduHandle;
+        confirmParams.m_status = MacStatus::SUCCESS;
+        ConfirmTx(confirmParams);
+    }
+    RemoveTxQueueElement();
+}
+
+Ptr<Packet>
+LrWpanTschMac::EndAbstractRx(Ptr<Packet> frame, bool arrived, uint8_t lqi)
+{
+    NS_LOG_FUNCTION(this << frame << arrived << (int)lqi);
+    MicroTaskScope scope(this);
+
+    if (!frame)
+    {
+        if (arrived)
+        {
+            // A packet was received, but not the expected one, see IncAsn.
+            m_macRxDataTrace(m_latestPacketSize);
+        }
+        else
+        {
+            m_macIdleTrace(0);
+        }
+        return nullptr;
+    }
+
+    m_promiscSnifferTrace(frame);
+    m_macPromiscRxTrace(frame);
+
+    LrWpanMacHeader macHdr;
+    frame->PeekHeader(macHdr);
+    if (m_macPromiscuousMode)
+    {
+        if (!m_mcpsDataIndicationCallback.IsNull())
+        {
+            IndicateAbstractRx(GetIndicationParams(macHdr, lqi), GetMsdu(frame, macHdr));
+        }
+        return nullptr;
+    }
+
+    if (!AcceptFrame(macHdr))
+    {
+        m_macRxDropTrace(frame);
+        return nullptr;
+    }
+
+    m_macRxTrace(frame);
+    if (!macHdr.IsData() || m_mcpsDataIndicationCallback.IsNull())
+    {
+        return nullptr;
+    }
+
+    IndicateAbstractRx(GetIndicationParams(macHdr, lqi), GetMsdu(frame, macHdr));
+    m_latestPacketSize = frame->GetSize();
+    if (!macHdr.IsAckReq())
+    {
+        m_macRxDataTrace(m_latestPacketSize);
+        return nullptr;
+    }
+
+    Ptr<Packet> ack = CreateAck(macHdr.GetSeqNum(), macHdr.IsSeqNumSup());
+    m_promiscSnifferTrace(ack);
+    m_snifferTrace(ack);
+    m_macTxTrace(ack);
+    m_lastTransmission = Now();
+    m_macRxDataTxAckTrace(m_latestPacketSize);
+    return ack;
+}
+
+void
+LrWpanTschMac::IndicateAbstractRx(const McpsDataIndicationParams& params, Ptr<Packet> msdu)
+{
+    // The slot engine runs in the context of any node, while the upper layers
+    // expect the context of the receiving node, as set by the spectrum channel.
+    Simulator::ScheduleWithContext(m_phy->GetDevice()->GetNode()->GetId(),
+                                   Time(0),
+                                   [this, params, msdu]() {
+                                       m_mcpsDataIndicationCallback(params, msdu);
+                                   });
+}
+
+void
+LrWpanTschMac::ConfirmTx(const McpsDataConfirmParams& params)
+{
+    if (!IsSlotAbstract())
+    {
+        m_mcpsDataConfirmCallback(params);
+        return;
+    }
+
+    // As for the indications, see IndicateAbstractRx.
+    Simulator::ScheduleWithContext(m_phy->GetDevice()->GetNode()->GetId(),
+                                   Time(0),
+                                   [this, params]() { m_mcpsDataConfirmCallback(params); });
+}
+
+bool
+LrWpanTschMac::SkipsIdleSlots() const
+{
+    return m_skipIdleSlots || m_slotClock;
+}
+
+void
+LrWpanTschMac::RescheduleNextAsn()
+{
+    if (!SkipsIdleSlots() || !m_nextAsnPending)
+    {
+        return;
+    }
+
+    uint64_t asn = m_macTschPIBAttributes.m_macASN;
+    int64_t slotLength = def_MacTimeslotTemplate.m_macTsTimeslotLength;
+
+    // First timeslot which has not started yet
+    int64_t elapsed = (Simulator::Now() - m_asnStartTime).GetMicroSeconds();
+    uint64_t first = asn + std::max<int64_t>(1, (elapsed + slotLength - 1) / slotLength);
+    uint64_t next = CanSkipIdleSlots() ? GetNextActiveAsn(first) : first;
+
+    if (next - asn < m_nextAsn - asn)
+    {
+        NS_LOG_DEBUG("Rescheduling ASN " << m_nextAsn << " to " << next);
+        CancelIncAsn();
+        m_nextAsn = next;
+        ScheduleIncAsn(m_asnStartTime + MicroSeconds(slotLength * (next - asn)));
+    }
+}
+
+void
+LrWpanTschMac::FlushSkippedSlots()
+{
+    // A skipped timeslot would only have turned off the radio, which is already off.
+    for (uint64_t asn = m_macTschPIBAttributes.m_macASN + 1; asn != m_nextAsn; asn++)
+    {
+        m_macTschPIBAttributes.m_macASN = asn;
+        for (std::size_t i = 0; i < m_macSlotframeTable.size(); i++)
+        {
+            m_macSleepTrace(0);
+        }
+    }
+}
+
+uint64_t
+LrWpanTschMac::GetCurrentAsn() const
+{
+    uint64_t asn = m_macTschPIBAttributes.m_macASN;
+    if (SkipsIdleSlots() && m_nextAsnPending)
+    {
+        // The timeslot in progress may be a skipped one.
+        int64_t elapsed = (Simulator::Now() - m_asnStartTime).GetMicroSeconds();
+        asn += elapsed / def_MacTimeslotTemplate.m_macTsTimeslotLength;
+        if (asn - m_macTschPIBAttributes.m_macASN >= m_nextAsn - m_macTschPIBAttributes.m_macASN)
+        {
+            asn = m_nextAsn - 1;
+        }
+    }
+    return asn;
+}
+
+bool
+LrWpanTschMac::IsActiveAsn(uint64_t asn) const
+{
+    for (const auto& slotframe : m_macSlotframeTable)
+    {
+        if (slotframe.size > 0 &&
+            GetTimeslotLink(slotframe.slotframeHandle, asn % slotframe.size) != nullptr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+LrWpanTschMac::CanSkipIdleSlots() const
+{
+    return !m_macPromiscuousMode && !m_waitingLink && m_macTimeSlotStartCallback.IsNull();
+}
+
+uint64_t
+LrWpanTschMac::GetNextActiveAsn(uint64_t asn) const
+{
+    // Never skip the start of a hopping sequence period, its trace may change the hopping
+    // sequence and it bounds the delay of the batched traces.
+    while (asn % def_MacChannelHopping.m_macHoppingSequenceLength != 0 && !IsActiveAsn(asn))
+    {
+        asn++;
+    }
+    return asn;
+}
+
 void
 LrWpanTschMac::ResetMacTschPibAttributes()
 {
@@ -1964,6 +2681,81 @@ LrWpanTschMac::SetDefaultHoppingSequence(uint16_t sequenceLength)
     chtmpl.m_hopDwellTime = 0;
 
     def_MacChannelHopping = chtmpl;
+    BuildChannelTable();
+}
+
+void
+LrWpanTschMac::BuildChannelTable()
+{
+    m_channelTable.clear();
+    // Offset 0 is used in promiscuous mode, in the timeslots without a link.
+    AddChannelTableRow(0);
+    for (std::map<uint8_t, TschLinkBuckets>::const_iterator sf = m_macLinkTable.begin();
+         sf != m_macLinkTable.end();
+         sf++)
+    {
+        for (const std::vector<MacPibLinkAttributes>& bucket : sf->second)
+        {
+            for (const MacPibLinkAttributes& link : bucket)
+            {
+                AddChannelTableRow(link.macChannelOffset);
+            }
+        }
+    }
+}
+
+void
+LrWpanTschMac::AddChannelTableRow(uint16_t channelOffset)
+{
+    if (m_channelTable.size() <= channelOffset)
+    {
+        m_channelTable.resize(channelOffset + 1);
+    }
+    std::vector<uint8_t>& row = m_channelTable[channelOffset];
+    uint16_t length = def_MacChannelHopping.m_macHoppingSequenceLength;
+    if (row.size() == length)
+    {
+        return;
+    }
+    row.resize(length);
+    for (uint16_t hop = 0; hop < length; hop++)
+    {
+        row[hop] = def_MacChannelHopping.m_macHoppingSequenceList[(hop + channelOffset) % length];
+    }
+}
+
+uint8_t
+LrWpanTschMac::GetSlotChannel(uint16_t channelOffset) const
+{
+    NS_ASSERT_MSG(channelOffset < m_channelTable.size() &&
+                      !m_channelTable[channelOffset].empty(),
+                  "No channel table row for channel offset " << channelOffset);
+    const std::vector<uint8_t>& row = m_channelTable[channelOffset];
+    return row[m_macTschPIBAttributes.m_macASN % row.size()];
+}
+
+void
+LrWpanTschMac::SwitchChannel(uint8_t channel)
+{
+    // The last channel requested from the PHY: the one of the pending switch,
+    // if any, or else the one the PHY is on.
+    uint8_t requested = m_channelSwitchPending ? m_channelAttributes->phyCurrentChannel
+                                               : m_phy->GetCurrentChannelNum();
+    if (requested == channel)
+    {
+        return;
+    }
+    m_channelAttributes->phyCurrentChannel = channel;
+    if (m_channelSwitchPending)
+    {
+        // The pending switch reads the attribute object when it runs.
+        return;
+    }
+    m_channelSwitchPending = true;
+    Defer([this]() {
+        m_channelSwitchPending = false;
+        m_phy->PlmeSetAttributeRequest(phyCurrentChannel, m_channelAttributes);
+    });
 }
 
 void
@@ -1993,6 +2785,7 @@ LrWpanTschMac::SetHoppingSequence(std::vector<uint8_t> sequence, uint8_t id)
     chtmpl.m_hopDwellTime = 0;
 
     def_MacChannelHopping = chtmpl;
+    BuildChannelTable();
 }
 
 void
@@ -2035,37 +2828,33 @@ Ptr<Packet>
 LrWpanTschMac::FindTxPacketInEmptySlot(Mac16Address dstAddr)
 {
     NS_LOG_FUNCTION(this);
-    Ptr<Packet> TxPacket = Create<Packet>(0);
+    NS_PROFILE_SCOPE(m_findTxPacketProfile);
+    Ptr<Packet> TxPacket;
     m_txLinkSequence = 0;
 
-    for (std::deque<TxQueueLinkElement*>::iterator i = m_txQueueAllLink.begin();
-         i != m_txQueueAllLink.end();
-         i++)
+    uint32_t handle;
+    if (FindTxLinkQueue(dstAddr, handle))
     {
-        if ((*i)->txDstAddr == dstAddr)
+        TxQueueRequestElement* txQElement = m_txLinkQueues[handle].txQueuePerLink.front();
+        if (m_sharedLink && (txQElement->txRequestCW != 0))
         {
-            if (m_sharedLink && ((*i)->txQueuePerLink.front()->txRequestCW != 0))
-            {
-                (*i)->txQueuePerLink.front()->txRequestCW =
-                    (*i)->txQueuePerLink.front()->txRequestCW - 1;
-                NS_LOG_DEBUG("Find but cannot transmit packet in queue with link position:"
-                             << m_txLinkSequence);
-            }
-            else
-            {
-                TxPacket = (*i)->txQueuePerLink.front()->txQPkt->Copy();
-                m_emptySlot = false;
-                break;
-            }
+            txQElement->txRequestCW = txQElement->txRequestCW - 1;
+            NS_LOG_DEBUG("Find but cannot transmit packet in queue with link handle:" << handle);
+        }
+        else
+        {
+            // Retries send the queued packet itself, the channel copies it for the receivers.
+            TxPacket = txQElement->txQPkt;
+            m_txLinkSequence = handle;
+            m_emptySlot = false;
         }
-        m_txLinkSequence++;
     }
 
     if (!m_emptySlot)
     {
-        NS_LOG_DEBUG("Find Tx packet in queue with link position = "
+        NS_LOG_DEBUG("Find Tx packet in queue with link handle = "
                      << m_txLinkSequence << " with queue size = "
-                     << m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.size());
+                     << m_txLinkQueues[m_txLinkSequence].txQueuePerLink.size());
     }
     else
     {
@@ -2082,28 +2871,28 @@ LrWpanTschMac::HandleTxFailure()
     if (m_sharedLink)
     {
         NS_LOG_DEBUG("Shared Link Failure!");
-        if (m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front()->txRequestNB > 0 &&
-            m_txQueueAllLink[m_txLinkSequence]->txLinkBE < m_macTschPIBAttributes.macMaxBE)
+        if (m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txRequestNB > 0 &&
+            m_txLinkQueues[m_txLinkSequence].txLinkBE < m_macTschPIBAttributes.macMaxBE)
         {
-            m_txQueueAllLink[m_txLinkSequence]->txLinkBE++;
+            m_txLinkQueues[m_txLinkSequence].txLinkBE++;
         }
 
-        uint8_t txBE = m_txQueueAllLink[m_txLinkSequence]->txLinkBE;
+        uint8_t txBE = m_txLinkQueues[m_txLinkSequence].txLinkBE;
         NS_LOG_DEBUG("Backoff exponent for this shared link is:" << (int)txBE);
 
         uint8_t upperBound = (uint8_t)pow(2, txBE) - 1;
-        m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front()->txRequestCW =
+        m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txRequestCW =
             (uint8_t)m_random->GetInteger(0, upperBound);
         NS_LOG_DEBUG(
             "Backoff timeslots for this request in the shared link is:"
-            << (int)m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front()->txRequestCW);
+            << (int)m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txRequestCW);
     }
 
-    m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front()->txRequestNB++;
+    m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txRequestNB++;
     NS_LOG_DEBUG("Increment Retries for the top packet in the queue with link position = "
                  << m_txLinkSequence);
 
-    if (m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front()->txRequestNB ==
+    if (m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txRequestNB ==
         m_macMaxFrameRetries)
     {
         NS_LOG_DEBUG("Maximum Retries reached, dropping TX packet.");
@@ -2112,9 +2901,9 @@ LrWpanTschMac::HandleTxFailure()
             McpsDataConfirmParams confirmParams;
             confirmParams.m_macASN = m_macTschPIBAttributes.m_macASN;
             confirmParams.m_msduHandle =
-                m_txQueueAllLink[m_txLinkSequence]->txQueuePerLink.front()->txQMsduHandle;
+                m_txLinkQueues[m_txLinkSequence].txQueuePerLink.front()->txQMsduHandle;
             confirmParams.m_status = MacStatus::NO_ACK;
-            m_mcpsDataConfirmCallback(confirmParams);
+            ConfirmTx(confirmParams);
         }
         RemoveTxQueueElement();
     }
@@ -2130,9 +2919,9 @@ LrWpanTschMac::PrintTxQueue(std::ostream& os) const
        << "    Destination    |" << "    Sequence Number    |" << "    Dst PAN id    |"
        << "    Frame type    |\n";
 
-    for (auto transaction : m_txQueueAllLink)
+    for (const auto& transaction : m_txLinkQueues)
     {
-        for (auto link : transaction->txQueuePerLink)
+        for (auto link : transaction.txQueuePerLink)
         {
             link->txQPkt->PeekHeader(peekedMacHdr);
 
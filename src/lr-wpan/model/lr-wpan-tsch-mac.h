@@ -32,12 +32,17 @@
 #include "lr-wpan-phy.h"
 
 #include <ns3/event-id.h>
+#include <ns3/profile-counter.h>
 #include <ns3/sequence-number.h>
 #include <ns3/traced-callback.h>
 #include <ns3/traced-value.h>
 #include <bitset>
 #include <deque>
+#include <functional>
+#include <map>
+#include <unordered_map>
 #include <memory>
+#include <vector>
 
 
 namespace ns3 {
@@ -46,6 +51,9 @@ class Packet;
 namespace lrwpan
 {
 
+class LrWpanMacHeader;
+class TschSlotClock;
+class TschSlotEngine;
 
 // class LrWpanCsmaCa; //not supported at the moment
 
@@ -360,6 +368,9 @@ typedef Callback<void, uint64_t> MacTimeSlotStartCallback;
  */
 class LrWpanTschMac : public LrWpanMac
 {
+    friend class TschSlotClock;
+    friend class TschSlotEngine;
+
   public:
     double m_beaconDelay = 0.0;
     /**
@@ -479,6 +490,20 @@ class LrWpanTschMac : public LrWpanMac
 
     void SetMacTimeSlotStartCallback(MacTimeSlotStartCallback c);
 
+    /**
+   * Share a timeslot clock with the other MACs of the PAN, instead of
+   * scheduling one IncAsn event per timeslot. The timeslots without links
+   * are skipped, as with the SkipIdleSlots attribute.
+   *
+   * \param clock the slot clock, or nullptr to use the MAC own events
+     */
+    void SetSlotClock(Ptr<TschSlotClock> clock);
+
+    /**
+   * \return the timeslot clock of the MAC, or nullptr if it has none
+     */
+    Ptr<TschSlotClock> GetSlotClock() const;
+
     // interfaces between MAC and PHY
     /**
    *  IEEE 802.15.4-2006 section 6.2.1.3
@@ -640,6 +665,38 @@ class LrWpanTschMac : public LrWpanMac
      */
     void SetMacMaxFrameRetries(uint8_t retries);
 
+    /**
+   * Get the ASN of the timeslot in progress. With SkipIdleSlots, the ASN
+   * attribute is only advanced when a timeslot is processed.
+   *
+   * \return the current ASN
+     */
+    uint64_t GetCurrentAsn() const;
+
+    /**
+   * Get the channel of the timeslot in progress.
+   *
+   * \return the current channel
+     */
+    uint8_t GetCurrentChannel() const;
+
+    /**
+   * Whether the ASN increment scheduled at the current time ends a hopping
+   * period, before the MAC fired its period end trace for it.
+   *
+   * \return true if the period end trace fires later in the current instant
+     */
+    bool IsHoppingSequenceEndPending() const;
+
+    /**
+   * Print the profiling counters of ScheduleTimeslot, FindTxPacketInEmptySlot
+   * and PdDataIndication, updated in the builds with the NS3_PROFILE_COUNTERS
+   * option.
+   *
+   * \param os the output stream
+     */
+    void PrintProfile(std::ostream& os) const;
+
     void GetPhylinkInformation(double m_receivedPower);
 
     /**
@@ -686,6 +743,17 @@ class LrWpanTschMac : public LrWpanMac
         uint8_t txLinkBE;
     };
 
+    /**
+   * Hash of a short address, to index the per-neighbor transmit queues.
+     */
+    struct Mac16AddressHash
+    {
+        std::size_t operator()(const Mac16Address& address) const
+        {
+            return address.ConvertToInt();
+        }
+    };
+
     /**
    * Send an acknowledgment packet for the given sequence number.
    *
@@ -693,6 +761,41 @@ class LrWpanTschMac : public LrWpanMac
      */
     void SendAck(uint8_t seqno, bool seqnumsup);
 
+    /**
+   * Get the MSDU of a received frame, without its MAC header and trailer.
+   *
+   * \param frame the received frame
+   * \param macHdr the MAC header of the frame
+   * \return a new packet with the MSDU
+     */
+    Ptr<Packet> GetMsdu(Ptr<const Packet> frame, const LrWpanMacHeader& macHdr) const;
+
+    /**
+   * Create the acknowledgment frame of a data frame.
+   *
+   * \param seqno the sequence number of the data frame
+   * \param seqnumsup whether the sequence number is suppressed
+   * \return the acknowledgment frame
+     */
+    Ptr<Packet> CreateAck(uint8_t seqno, bool seqnumsup) const;
+
+    /**
+   * Get the MCPS-DATA.indication parameters of a received frame.
+   *
+   * \param hdr the MAC header of the frame
+   * \param lqi the link quality of the frame
+   * \return the indication parameters
+     */
+    McpsDataIndicationParams GetIndicationParams(const LrWpanMacHeader& hdr, uint8_t lqi) const;
+
+    /**
+   * Level 3 filtering of a received frame, see sec 7.5.6.2 of Std802.15.4-2006.
+   *
+   * \param hdr the MAC header of the frame
+   * \return true if the frame is accepted
+     */
+    bool AcceptFrame(const LrWpanMacHeader& hdr) const;
+
     /**
    * Remove the tip of the transmission queue, including clean up related to the
    * last packet transmission.
@@ -897,14 +1000,89 @@ class LrWpanTschMac : public LrWpanMac
     Mac64Address m_selfExt;
 
     /**
-   * The transmit queue used by the MAC.
+   * The per-neighbor transmit queues used by the MAC, by handle. The queue
+   * of a neighbor keeps its handle until it is empty, then the handle and
+   * the queue element are reused for the next neighbor.
+     */
+    std::vector<TxQueueLinkElement> m_txLinkQueues;
+
+    /**
+   * Handles of the non-empty transmit queues, by destination address.
+     */
+    std::unordered_map<Mac16Address, uint32_t, Mac16AddressHash> m_txLinkQueueIndex;
+
+    /**
+   * Handles of the unused elements of m_txLinkQueues.
      */
-    std::deque<TxQueueLinkElement*> m_txQueueAllLink;
+    std::vector<uint32_t> m_txLinkQueueFreeHandles;
 
     /**
-   * Scheduler event for a deferred MAC state change.
+   * The maximum number of packets queued for one neighbor.
      */
-    EventId m_setMacState;
+    uint32_t m_maxTxQueueSizePerNeighbor;
+
+    /**
+   * Storage of the transmit queue elements. A deque keeps the address of
+   * the elements stable while it grows.
+     */
+    std::deque<TxQueueRequestElement> m_txQueueElementPool;
+
+    /**
+   * The transmit queue elements of m_txQueueElementPool not in use.
+     */
+    std::vector<TxQueueRequestElement*> m_txQueueElementFreeList;
+
+    /**
+   * Number of transmit queue elements allocated from the heap.
+     */
+    uint64_t m_txQueueElementAllocations;
+
+    /**
+   * Number of transmit queue elements used, either allocated or reused.
+     */
+    uint64_t m_txQueueElementRequests;
+
+    /**
+   * Number of per-neighbor transmit queues allocated.
+     */
+    uint64_t m_txLinkQueueAllocations;
+
+    /**
+   * Whether the deferred tasks run as micro-tasks, instead of in a
+   * zero-delay scheduler event each.
+     */
+    bool m_microTasksEnabled;
+
+    /**
+   * Tasks deferred to the end of the current event, in FIFO order.
+     */
+    std::deque<std::function<void()>> m_microTasks;
+
+    /**
+   * Number of nested MicroTaskScope objects alive.
+     */
+    uint32_t m_microTaskDepth;
+
+    /**
+   * Whether a scheduler event is pending to run the micro-tasks deferred
+   * outside of a MicroTaskScope.
+     */
+    bool m_microTaskEventPending;
+
+    /**
+   * Identifier of the pending cancelable MAC state change, 0 if none.
+     */
+    uint64_t m_deferredMacState;
+
+    /**
+   * Last identifier given to a cancelable MAC state change.
+     */
+    uint64_t m_deferredMacStateId;
+
+    /**
+   * Number of zero-delay scheduler events replaced by micro-tasks.
+     */
+    uint64_t m_avoidedEvents;
 
     /* TSCH methods */
     /**
@@ -947,12 +1125,306 @@ class LrWpanTschMac : public LrWpanMac
 
     void HandleTxFailure();
 
-    void SetTxLinkQueue(TxQueueRequestElement* newRequestElement,
-                        Mac16Address newDstAddr,
-                        uint8_t newSeqNum);
+    /**
+   * Start the receiving procedure of the current timeslot.
+     */
+    void StartTimeslotRx();
+
+    /**
+   * \return true if the timeslots are decided by a slot engine instead of
+   * the PHY
+     */
+    bool IsSlotAbstract() const;
+
+    /**
+   * Report the outcome of a transmission to the slot engine validating the
+   * timeslots, if any.
+   *
+   * \param success whether the transmission was acknowledged, or sent for a
+   * frame without acknowledgment request
+     */
+    void NotifyTxOutcome(bool success);
+
+    /**
+   * End the transmission of the current timeslot, as decided by the slot
+   * engine.
+   *
+   * \param ack the acknowledgment received, or nullptr if none
+     */
+    void EndAbstractTx(Ptr<Packet> ack);
+
+    /**
+   * End the reception of the current timeslot, as decided by the slot engine.
+   *
+   * \param frame the frame received, or nullptr if none
+   * \param arrived whether a frame was being received, even if lost
+   * \param lqi the link quality of the frame
+   * \return the acknowledgment to send, or nullptr if none
+     */
+    Ptr<Packet> EndAbstractRx(Ptr<Packet> frame, bool arrived, uint8_t lqi);
+
+    /**
+   * Deliver the MCPS-DATA.indication of a frame received in a timeslot
+   * decided by the slot engine.
+   *
+   * \param params the indication parameters
+   * \param msdu the MSDU of the frame
+     */
+    void IndicateAbstractRx(const McpsDataIndicationParams& params, Ptr<Packet> msdu);
+
+    /**
+   * Deliver the MCPS-DATA.confirm of a transmission, in the context of the
+   * node of the MAC when the timeslot was decided by the slot engine.
+   *
+   * \param params the confirm parameters
+     */
+    void ConfirmTx(const McpsDataConfirmParams& params);
+
+    /**
+   * Runs the micro-tasks deferred while it is alive when the outermost
+   * scope ends. It is created by the event handlers scheduled by the MAC
+   * itself, so that their micro-tasks run at the end of the event.
+     */
+    class MicroTaskScope
+    {
+      public:
+        /**
+       * Enter a scope.
+       *
+       * \param mac the MAC
+         */
+        MicroTaskScope(LrWpanTschMac* mac);
+        ~MicroTaskScope();
+
+      private:
+        LrWpanTschMac* m_mac; //!< The MAC
+    };
+
+    /**
+   * Defer a task to the end of the current event, after the tasks deferred
+   * before it. Outside of a MicroTaskScope, the tasks run in a single
+   * zero-delay scheduler event. Without the MicroTasks attribute, the task
+   * runs in a zero-delay scheduler event of its own.
+   *
+   * \param task the task
+     */
+    void Defer(std::function<void()> task);
+
+    /**
+   * Defer a MAC state change to the end of the current event.
+   *
+   * \param macState the new MAC state
+     */
+    void DeferMacState(TschMacState macState);
+
+    /**
+   * Defer a change to TSCH_MAC_IDLE to the end of the current event, which
+   * CancelDeferredMacState can cancel. It replaces a pending one.
+     */
+    void DeferCancelableIdleState();
+
+    /**
+   * Cancel the pending change deferred by DeferCancelableIdleState.
+     */
+    void CancelDeferredMacState();
+
+    /**
+   * Run the deferred micro-tasks, including those they defer.
+     */
+    void RunMicroTasks();
+
+    /**
+   * Event handler of a delayed MAC state change.
+   *
+   * \param macState the new MAC state
+     */
+    void SetLrWpanMacStateEvent(TschMacState macState);
+
+    /**
+   * Get an unused transmit queue element, reusing a released one if possible.
+   *
+   * \return the transmit queue element
+     */
+    TxQueueRequestElement* AllocTxQueueElement();
+
+    /**
+   * Release a transmit queue element for reuse.
+   *
+   * \param txQElement the transmit queue element
+     */
+    void FreeTxQueueElement(TxQueueRequestElement* txQElement);
+
+    /**
+   * Get the handle of the transmit queue of a neighbor.
+   *
+   * \param dstAddr the address of the neighbor
+   * \param handle returns the handle of the queue
+   * \return true if there are packets queued for the neighbor
+     */
+    bool FindTxLinkQueue(Mac16Address dstAddr, uint32_t& handle) const;
+
+    /**
+   * Set up an empty transmit queue for a neighbor without queued packets.
+   *
+   * \param dstAddr the address of the neighbor
+   * \return the handle of the new queue
+     */
+    uint32_t AllocateTxLinkQueue(Mac16Address dstAddr);
 
     Ptr<Packet> FindTxPacketInEmptySlot(Mac16Address dstAddr);
 
+    /**
+   * Add a link to the link table, in the bucket of its slotframe and timeslot.
+   *
+   * \param link the link to add
+     */
+    void AddLinkEntry(const MacPibLinkAttributes& link);
+
+    /**
+   * Find a link in the link table by its slotframe and link handle.
+   *
+   * \param slotframeHandle the slotframe handle of the link
+   * \param linkHandle the link handle
+   * \param timeslot returns the timeslot bucket holding the link
+   * \param index returns the position of the link in its bucket
+   * \return true if the link was found
+     */
+    bool FindLinkEntry(uint8_t slotframeHandle,
+                       uint16_t linkHandle,
+                       uint16_t& timeslot,
+                       uint32_t& index);
+
+    /**
+   * Get the link used in a timeslot of a slotframe.
+   *
+   * \param slotframeHandle the slotframe handle
+   * \param timeslot the timeslot within the slotframe
+   * \return the first link added for that timeslot, or nullptr if there is none
+     */
+    const MacPibLinkAttributes* GetTimeslotLink(uint8_t slotframeHandle, uint16_t timeslot) const;
+
+    /**
+   * Check if any slotframe has a link in the timeslot of a given ASN.
+   *
+   * \param asn the absolute slot number
+   * \return true if the MAC is involved in that timeslot
+     */
+    bool IsActiveAsn(uint64_t asn) const;
+
+    /**
+   * Check if idle timeslots can currently be skipped. Timeslots cannot be
+   * skipped in promiscuous mode, while a link request is waiting, or when a
+   * timeslot start callback is set, as all of them need every timeslot.
+   *
+   * \return true if idle timeslots can be skipped
+     */
+    bool CanSkipIdleSlots() const;
+
+    /**
+   * Get the first ASN, starting from a given one, that has to be processed
+   * when skipping idle timeslots: a timeslot with a link, or the start of a
+   * hopping sequence period.
+   *
+   * \param asn the first candidate ASN
+   * \return the ASN of the next timeslot to process
+     */
+    uint64_t GetNextActiveAsn(uint64_t asn) const;
+
+    /**
+   * Schedule the IncAsn event of the next timeslot to process.
+     */
+    void ScheduleNextAsn();
+
+    /**
+   * Schedule IncAsn at the start of a timeslot, with the slot clock if the
+   * MAC has one.
+   *
+   * \param slotStart the absolute start time of the timeslot
+     */
+    void ScheduleIncAsn(Time slotStart);
+
+    /**
+   * Cancel the pending IncAsn, if any.
+     */
+    void CancelIncAsn();
+
+    /**
+   * \return true if the timeslots without links are skipped
+     */
+    bool SkipsIdleSlots() const;
+
+    /**
+   * Reschedule the pending IncAsn event after a change of the slotframe or
+   * link tables, in case a skipped timeslot became active.
+     */
+    void RescheduleNextAsn();
+
+    /**
+   * Fire the per-timeslot traces of the idle timeslots skipped before the
+   * timeslot to process, and advance the ASN to the last skipped one.
+     */
+    void FlushSkippedSlots();
+
+    /**
+   * Advance the ASN to the timeslot of the pending IncAsn, and fire the
+   * hooks of the upper layers at the start of a timeslot: the hopping
+   * sequence period trace and the timeslot start callback.
+     */
+    void AdvanceAsn();
+
+    /**
+   * Start the timeslot of the current ASN: schedule the next IncAsn, end
+   * the transaction of the previous timeslot and schedule the timeslots of
+   * the slotframes.
+     */
+    void StartSlot();
+
+    /**
+   * \return true if AdvanceAsn fires hooks of the upper layers for the
+   * timeslot of the pending IncAsn
+     */
+    bool HasSlotStartHooks() const;
+
+    /**
+   * Advance the ASN for the slot clock, in the context of the node, when
+   * the timeslot start has hooks of the upper layers.
+     */
+    void AdvanceClockedAsn();
+
+    /**
+   * Start a timeslot dispatched by the slot clock, in the context of the
+   * node, advancing the ASN first if AdvanceClockedAsn did not.
+     */
+    void StartClockedSlot();
+
+    /**
+   * Rebuild the channel table for the channel offsets of the link table.
+     */
+    void BuildChannelTable();
+
+    /**
+   * Add the row of a channel offset to the channel table, if missing.
+   *
+   * \param channelOffset the channel offset
+     */
+    void AddChannelTableRow(uint16_t channelOffset);
+
+    /**
+   * Get the channel of the current timeslot for a channel offset.
+   *
+   * \param channelOffset the channel offset of the link
+   * \return the channel to use
+     */
+    uint8_t GetSlotChannel(uint16_t channelOffset) const;
+
+    /**
+   * Switch the PHY to a channel at the end of the current event, unless the
+   * last channel requested from the PHY is already this one.
+   *
+   * \param channel the channel
+     */
+    void SwitchChannel(uint8_t channel);
+
     /**
    * Pending packet size
      */
@@ -967,6 +1439,9 @@ class LrWpanTschMac : public LrWpanMac
 
     uint32_t m_macRxID;
 
+    /**
+   * Handle of the transmit queue of the packet being sent.
+     */
     uint32_t m_txLinkSequence;
 
     double m_currentReceivedPower;
@@ -986,6 +1461,52 @@ class LrWpanTschMac : public LrWpanMac
 
     bool m_newSlot;
 
+    /**
+   * Skip the timeslots without links instead of processing every timeslot.
+     */
+    bool m_skipIdleSlots;
+
+    /**
+   * Scheduler event of the next IncAsn.
+     */
+    EventId m_incAsnEvent;
+
+    /**
+   * ASN of the timeslot started by the next IncAsn.
+     */
+    uint64_t m_nextAsn;
+
+    /**
+   * Start time of the timeslot of the next IncAsn.
+     */
+    Time m_nextAsnTime;
+
+    /**
+   * Whether the next IncAsn is scheduled.
+     */
+    bool m_nextAsnPending;
+
+    /**
+   * Whether AdvanceClockedAsn advanced the ASN of the timeslot not started
+   * yet by StartClockedSlot.
+     */
+    bool m_clockedAsnAdvanced;
+
+    /**
+   * Timeslot clock shared with the other MACs of the PAN, if any.
+     */
+    Ptr<TschSlotClock> m_slotClock;
+
+    /**
+   * The slot clock, if it is a slot engine.
+     */
+    Ptr<TschSlotEngine> m_slotEngine;
+
+    /**
+   * Start time of the timeslot of the current ASN.
+     */
+    Time m_asnStartTime;
+
     /**
    * Timestamp of waiting time finishing for ACK or transmitted frame
      */
@@ -1003,6 +1524,23 @@ class LrWpanTschMac : public LrWpanMac
      */
     LrWpanMacChannelHopping def_MacChannelHopping;
 
+    /**
+   * Channel of every hop of the hopping sequence, indexed by the channel
+   * offset and the ASN modulo the sequence length. Only the rows of the
+   * channel offsets used by a link, and of offset 0, are filled.
+     */
+    std::vector<std::vector<uint8_t>> m_channelTable;
+
+    /**
+   * PHY attributes of the pending channel switch, reused by every switch.
+     */
+    Ptr<PhyPibAttributes> m_channelAttributes;
+
+    /**
+   * Whether a channel switch is deferred to the end of the current event.
+     */
+    bool m_channelSwitchPending;
+
     /**
    * Current TSCH Link
      */
@@ -1024,9 +1562,15 @@ class LrWpanTschMac : public LrWpanMac
     std::list<MacPibSlotframeAttributes> m_macSlotframeTable;
 
     /**
-   * List of TSCH link MAC PIB attributes
+   * TSCH links of one slotframe, bucketed by timeslot.
+   * Links sharing a timeslot are kept in insertion order.
      */
-    std::list<MacPibLinkAttributes> m_macLinkTable;
+    typedef std::vector<std::vector<MacPibLinkAttributes>> TschLinkBuckets;
+
+    /**
+   * TSCH link MAC PIB attributes, indexed by slotframe handle and timeslot
+     */
+    std::map<uint8_t, TschLinkBuckets> m_macLinkTable;
 
     /**
    * List of TSCH specified MAC PIB attributes
@@ -1104,6 +1648,10 @@ class LrWpanTschMac : public LrWpanMac
     TracedCallback<uint32_t> m_macRxEmptyBufferTrace;
 
     TracedCallback<uint32_t, uint32_t, uint8_t, double> m_macLinkInformation;
+
+    ProfileCounter m_scheduleTimeslotProfile; //!< Profiling counter of ScheduleTimeslot
+    ProfileCounter m_findTxPacketProfile;     //!< Profiling counter of FindTxPacketInEmptySlot
+    ProfileCounter m_pdDataIndicationProfile; //!< Profiling counter of PdDataIndication
 };
 
 } // namespace lrwpan
@@ -0,0 +1,191 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lr-wpan-tsch-slot-clock.h"
+
+#include "lr-wpan-phy.h"
+#include "lr-wpan-tsch-mac.h"
+
+#include <ns3/log.h>
+#include <ns3/net-device.h>
+#include <ns3/node.h>
+#include <ns3/simulator.h>
+
+#include <algorithm>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("TschSlotClock");
+
+NS_OBJECT_ENSURE_REGISTERED(TschSlotClock);
+
+TypeId
+TschSlotClock::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TschSlotClock")
+                            .SetParent<Object>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<TschSlotClock>();
+    return tid;
+}
+
+TschSlotClock::TschSlotClock()
+    : m_tickCount(0),
+      m_dispatchCount(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TschSlotClock::~TschSlotClock()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TschSlotClock::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_tickEvent.Cancel();
+    m_subscribers.clear();
+    Object::DoDispose();
+}
+
+void
+TschSlotClock::Subscribe(LrWpanTschMac* mac, Time slotStart)
+{
+    NS_LOG_FUNCTION(this << mac << slotStart);
+    NS_ASSERT(slotStart >= Simulator::Now());
+
+    m_subscribers[slotStart].push_back(mac);
+    if (!m_tickEvent.IsRunning() || slotStart < m_tickTime)
+    {
+        ScheduleTick();
+    }
+}
+
+void
+TschSlotClock::Unsubscribe(LrWpanTschMac* mac, Time slotStart)
+{
+    NS_LOG_FUNCTION(this << mac << slotStart);
+
+    auto it = m_subscribers.find(slotStart);
+    if (it == m_subscribers.end())
+    {
+        return;
+    }
+
+    std::vector<LrWpanTschMac*>& macs = it->second;
+    auto pos = std::find(macs.begin(), macs.end(), mac);
+    if (pos != macs.end())
+    {
+        macs.erase(pos);
+    }
+    if (macs.empty())
+    {
+        m_subscribers.erase(it);
+        if (slotStart == m_tickTime)
+        {
+            ScheduleTick();
+        }
+    }
+}
+
+uint64_t
+TschSlotClock::GetTickCount() const
+{
+    return m_tickCount;
+}
+
+uint64_t
+TschSlotClock::GetDispatchCount() const
+{
+    return m_dispatchCount;
+}
+
+void
+TschSlotClock::ScheduleTick()
+{
+    m_tickEvent.Cancel();
+    if (m_subscribers.empty())
+    {
+        return;
+    }
+
+    m_tickTime = m_subscribers.begin()->first;
+    m_tickEvent = Simulator::Schedule(m_tickTime - Simulator::Now(), &TschSlotClock::Tick, this);
+}
+
+uint32_t
+TschSlotClock::GetNodeContext(LrWpanTschMac* mac)
+{
+    Ptr<NetDevice> device = mac->GetPhy()->GetDevice();
+    return device ? device->GetNode()->GetId() : Simulator::GetContext();
+}
+
+void
+TschSlotClock::Dispatch(const std::vector<LrWpanTschMac*>& macs)
+{
+    std::vector<std::pair<LrWpanTschMac*, uint32_t>> started;
+    for (LrWpanTschMac* mac : macs)
+    {
+        // The MAC may have cancelled its timeslot since it subscribed.
+        if (mac->m_nextAsnPending && mac->m_nextAsnTime == Simulator::Now())
+        {
+            started.emplace_back(mac, GetNodeContext(mac));
+        }
+    }
+
+    // The hooks of the upper layers may act on the other MACs, e.g. change
+    // their hopping sequence, before any timeslot starts, as without clock.
+    for (const auto& [mac, context] : started)
+    {
+        if (mac->HasSlotStartHooks())
+        {
+            Simulator::ScheduleWithContext(context,
+                                           Time(0),
+                                           &LrWpanTschMac::AdvanceClockedAsn,
+                                           mac);
+        }
+    }
+    for (const auto& [mac, context] : started)
+    {
+        Simulator::ScheduleWithContext(context, Time(0), &LrWpanTschMac::StartClockedSlot, mac);
+    }
+}
+
+void
+TschSlotClock::Tick()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_subscribers.empty() && m_subscribers.begin()->first == Simulator::Now());
+
+    // The MACs subscribe again to their next timeslot while being dispatched.
+    std::vector<LrWpanTschMac*> macs = std::move(m_subscribers.begin()->second);
+    m_subscribers.erase(m_subscribers.begin());
+
+    m_tickCount++;
+    m_dispatchCount += macs.size();
+    Dispatch(macs);
+
+    if (!m_tickEvent.IsRunning())
+    {
+        ScheduleTick();
+    }
+}
+
+} // namespace lrwpan
+} // namespace ns3
@@ -0,0 +1,147 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LR_WPAN_TSCH_SLOT_CLOCK_H
+#define LR_WPAN_TSCH_SLOT_CLOCK_H
+
+#include <ns3/event-id.h>
+#include <ns3/nstime.h>
+#include <ns3/object.h>
+
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+class LrWpanTschMac;
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Timeslot clock shared by the synchronized TSCH MACs of a PAN.
+ *
+ * Instead of each MAC keeping the IncAsn event of its next timeslot in
+ * the scheduler, the MACs attached to a slot clock subscribe to the start
+ * time of the next timeslot they have to process. The clock schedules a
+ * single event per timeslot that has subscribers, which dispatches the
+ * timeslot to those MACs only: each MAC increments its ASN and starts its
+ * timeslot in an event in the context of its node, as its own IncAsn event
+ * would. The MACs with hooks of the upper layers at the start of the
+ * timeslot fire them in an earlier event, so that the hooks of all the MACs
+ * run before any timeslot starts. MACs without a link in a timeslot skip
+ * it, as with the SkipIdleSlots attribute of LrWpanTschMac.
+ */
+class TschSlotClock : public Object
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TschSlotClock();
+    ~TschSlotClock() override;
+
+    /**
+     * Subscribe a MAC to the timeslot starting at a given time.
+     *
+     * \param mac the MAC
+     * \param slotStart the absolute start time of the timeslot
+     */
+    void Subscribe(LrWpanTschMac* mac, Time slotStart);
+
+    /**
+     * Remove the subscription of a MAC to a timeslot.
+     *
+     * \param mac the MAC
+     * \param slotStart the absolute start time of the timeslot
+     */
+    void Unsubscribe(LrWpanTschMac* mac, Time slotStart);
+
+    /**
+     * \return the number of timeslot events executed by the clock
+     */
+    uint64_t GetTickCount() const;
+
+    /**
+     * \return the number of timeslot starts dispatched to the MACs
+     */
+    uint64_t GetDispatchCount() const;
+
+  protected:
+    void DoDispose() override;
+
+    /**
+     * Schedule the timeslot start of the MACs subscribed to the current
+     * time in the context of their node, skipping the MACs which cancelled
+     * their timeslot since they subscribed.
+     *
+     * \param macs the MACs, in subscription order
+     */
+    virtual void Dispatch(const std::vector<LrWpanTschMac*>& macs);
+
+    /**
+     * Get the context of the node of a MAC.
+     *
+     * \param mac the MAC
+     * \return the node id, or the current context for a MAC without node
+     */
+    static uint32_t GetNodeContext(LrWpanTschMac* mac);
+
+  private:
+    /**
+     * Dispatch the timeslot of all the MACs subscribed to the current time.
+     */
+    void Tick();
+
+    /**
+     * Schedule the event of the earliest timeslot with subscribers.
+     */
+    void ScheduleTick();
+
+    /**
+     * The subscribed MACs, by timeslot start time, in subscription order.
+     */
+    std::map<Time, std::vector<LrWpanTschMac*>> m_subscribers;
+
+    /**
+     * The event of the earliest timeslot with subscribers.
+     */
+    EventId m_tickEvent;
+
+    /**
+     * The start time of the timeslot of m_tickEvent.
+     */
+    Time m_tickTime;
+
+    /**
+     * Number of timeslot events executed.
+     */
+    uint64_t m_tickCount;
+
+    /**
+     * Number of timeslot starts dispatched.
+     */
+    uint64_t m_dispatchCount;
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_TSCH_SLOT_CLOCK_H */
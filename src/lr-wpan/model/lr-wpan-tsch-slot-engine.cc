@@ -0,0 +1,473 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lr-wpan-tsch-slot-engine.h"
+
+#include "lr-wpan-mac-header.h"
+#include "lr-wpan-phy.h"
+#include "lr-wpan-tsch-mac.h"
+
+#include <ns3/boolean.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/mobility-model.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-channel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("TschSlotEngine");
+
+NS_OBJECT_ENSURE_REGISTERED(TschSlotEngine);
+
+/**
+ * Probability below which a validated outcome is a mismatch.
+ */
+static const double MISMATCH_PROBABILITY = 1e-6;
+
+TypeId
+TschSlotEngine::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::TschSlotEngine")
+            .SetParent<TschSlotClock>()
+            .SetGroupName("LrWpan")
+            .AddConstructor<TschSlotEngine>()
+            .AddAttribute("Validate",
+                          "Leave the timeslots to the packet-level engine and compare "
+                          "their outcomes to the ones predicted by the slot engine.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&TschSlotEngine::m_validate),
+                          MakeBooleanChecker());
+    return tid;
+}
+
+TschSlotEngine::TschSlotEngine()
+    : m_validate(false),
+      m_transmissions(0),
+      m_successes(0),
+      m_expected(0),
+      m_mismatches(0)
+{
+    NS_LOG_FUNCTION(this);
+    m_random = CreateObject<UniformRandomVariable>();
+}
+
+TschSlotEngine::~TschSlotEngine()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TschSlotEngine::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_radios.clear();
+    m_accesses.clear();
+    m_dispatched.clear();
+    m_predictions.clear();
+    m_random = nullptr;
+    TschSlotClock::DoDispose();
+}
+
+bool
+TschSlotEngine::IsValidating() const
+{
+    return m_validate;
+}
+
+void
+TschSlotEngine::AddAccess(LrWpanTschMac* mac, uint8_t channel, Ptr<Packet> frame)
+{
+    NS_LOG_FUNCTION(this << mac << (int)channel << frame);
+
+    // Only the first link of a MAC is used in a timeslot.
+    if (!m_accesses.empty() && m_accesses.back().mac == mac)
+    {
+        return;
+    }
+
+    auto it = m_radios.find(mac);
+    if (it == m_radios.end())
+    {
+        Radio radio;
+        radio.phy = mac->GetPhy();
+        radio.mobility = radio.phy->GetMobility();
+        NS_ASSERT_MSG(radio.mobility, "The PHY of a slot engine MAC needs a mobility model");
+        Ptr<SpectrumChannel> channel = radio.phy->GetChannel();
+        radio.lossModel = channel->GetPropagationLossModel();
+        DoubleValue maxLossDb;
+        channel->GetAttribute("MaxLossDb", maxLossDb);
+        radio.maxLossDb = maxLossDb.Get();
+        it = m_radios.emplace(mac, radio).first;
+    }
+
+    Access access;
+    access.mac = mac;
+    access.radio = &it->second;
+    access.channel = channel;
+    access.frame = frame;
+    access.ackRequest = false;
+    if (frame)
+    {
+        LrWpanMacHeader macHdr;
+        frame->PeekHeader(macHdr);
+        access.ackRequest = macHdr.IsAckReq();
+    }
+    access.peer = NONE;
+    m_accesses.push_back(access);
+}
+
+void
+TschSlotEngine::NotifyTxOutcome(LrWpanTschMac* mac, bool success)
+{
+    NS_LOG_FUNCTION(this << mac << success);
+
+    auto it = m_predictions.find(mac);
+    if (it == m_predictions.end())
+    {
+        return;
+    }
+
+    double p = it->second;
+    m_predictions.erase(it);
+
+    m_transmissions++;
+    m_expected += p;
+    if (success)
+    {
+        m_successes++;
+    }
+    if ((success && p < MISMATCH_PROBABILITY) || (!success && p > 1 - MISMATCH_PROBABILITY))
+    {
+        m_mismatches++;
+        NS_LOG_WARN("MAC " << mac << " transmission " << (success ? "succeeded" : "failed")
+                           << " with a predicted success probability of " << p);
+    }
+}
+
+uint64_t
+TschSlotEngine::GetTransmissionCount() const
+{
+    return m_transmissions;
+}
+
+uint64_t
+TschSlotEngine::GetSuccessCount() const
+{
+    return m_successes;
+}
+
+double
+TschSlotEngine::GetExpectedSuccessCount() const
+{
+    return m_expected;
+}
+
+uint64_t
+TschSlotEngine::GetMismatchCount() const
+{
+    return m_mismatches;
+}
+
+int64_t
+TschSlotEngine::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_random->SetStream(stream);
+    return 1;
+}
+
+void
+TschSlotEngine::Dispatch(const std::vector<LrWpanTschMac*>& macs)
+{
+    NS_LOG_FUNCTION(this);
+    m_accesses.clear();
+    m_dispatched = macs;
+
+    if (m_validate)
+    {
+        // The packet-level timeslots start in the events of the MACs, which
+        // add their access.
+        TschSlotClock::Dispatch(macs);
+        Simulator::ScheduleNow(&TschSlotEngine::EndDispatch, this);
+        return;
+    }
+
+    // The timeslots decided by the engine start in its own event, once the
+    // hooks of the upper layers ran in the context of their node.
+    bool hooks = false;
+    for (LrWpanTschMac* mac : macs)
+    {
+        if (mac->m_nextAsnPending && mac->m_nextAsnTime == Simulator::Now() &&
+            mac->HasSlotStartHooks())
+        {
+            Simulator::ScheduleWithContext(GetNodeContext(mac),
+                                           Time(0),
+                                           &LrWpanTschMac::AdvanceClockedAsn,
+                                           mac);
+            hooks = true;
+        }
+    }
+    if (hooks)
+    {
+        Simulator::ScheduleNow(&TschSlotEngine::EndDispatch, this);
+    }
+    else
+    {
+        EndDispatch();
+    }
+}
+
+void
+TschSlotEngine::EndDispatch()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_validate)
+    {
+        // The transmissions aborted before their outcome, e.g. by CCA.
+        for (LrWpanTschMac* mac : m_dispatched)
+        {
+            m_predictions.erase(mac);
+        }
+        Predict();
+    }
+    else
+    {
+        // The MACs report their outcome of the previous timeslot, and add
+        // their access to the current one.
+        for (LrWpanTschMac* mac : m_dispatched)
+        {
+            mac->StartClockedSlot();
+        }
+        Resolve();
+    }
+    m_dispatched.clear();
+}
+
+std::vector<uint32_t>
+TschSlotEngine::GetSenders(uint32_t access, bool acks) const
+{
+    std::vector<uint32_t> senders;
+    for (uint32_t i = 0; i < m_accesses.size(); i++)
+    {
+        const Access& sender = m_accesses[i];
+        if (i != access && sender.channel == m_accesses[access].channel &&
+            (acks ? bool(sender.ack) : bool(sender.frame)))
+        {
+            senders.push_back(i);
+        }
+    }
+    return senders;
+}
+
+TschSlotEngine::Reception
+TschSlotEngine::Receive(uint32_t rx, const std::vector<uint32_t>& senders) const
+{
+    const Radio& receiver = *m_accesses[rx].radio;
+
+    // The received power and the distance of each frame.
+    std::vector<std::tuple<double, double, uint32_t>> arrivals;
+    for (uint32_t i : senders)
+    {
+        const Radio& sender = *m_accesses[i].radio;
+        double txPowerDbm = sender.phy->GetNominalTxPower();
+        double rxPowerDbm =
+            receiver.lossModel->CalcRxPower(txPowerDbm, sender.mobility, receiver.mobility);
+        if (txPowerDbm - rxPowerDbm > receiver.maxLossDb)
+        {
+            continue;
+        }
+        arrivals.emplace_back(sender.mobility->GetDistanceFrom(receiver.mobility),
+                              std::pow(10.0, (rxPowerDbm - 30) / 10.0),
+                              i);
+    }
+    std::sort(arrivals.begin(), arrivals.end());
+
+    Reception reception;
+    reception.sender = NONE;
+    reception.collided = false;
+    reception.sinr = 0;
+
+    // The PHY synchronizes to the first frame with a SINR above -5 dB, and
+    // drops it when another frame arrives.
+    double noise = receiver.phy->GetNoisePower();
+    double interference = 0;
+    for (const auto& arrival : arrivals)
+    {
+        double power = std::get<1>(arrival);
+        if (reception.sender != NONE)
+        {
+            reception.collided = true;
+            break;
+        }
+        double sinr = power / (interference + noise);
+        if (10 * std::log10(sinr) > -5)
+        {
+            reception.sender = std::get<2>(arrival);
+            reception.sinr = sinr;
+        }
+        interference += power;
+    }
+    return reception;
+}
+
+void
+TschSlotEngine::Resolve()
+{
+    NS_LOG_FUNCTION(this);
+
+    // The data frames, at the receivers.
+    for (uint32_t rx = 0; rx < m_accesses.size(); rx++)
+    {
+        Access& receiver = m_accesses[rx];
+        if (receiver.frame)
+        {
+            continue;
+        }
+
+        Reception reception = Receive(rx, GetSenders(rx, false));
+        Ptr<Packet> frame;
+        double p = 0;
+        if (reception.sender != NONE && !reception.collided)
+        {
+            frame = m_accesses[reception.sender].frame;
+            p = receiver.radio->phy->GetFrameSuccessRate(frame, reception.sinr);
+            if (m_random->GetValue() >= p)
+            {
+                frame = nullptr;
+            }
+        }
+
+        if (frame)
+        {
+            uint8_t lqi = static_cast<uint8_t>(std::numeric_limits<uint8_t>::max() * p);
+            receiver.ack = receiver.mac->EndAbstractRx(frame, true, lqi);
+            receiver.peer = reception.sender;
+        }
+        else
+        {
+            receiver.mac->EndAbstractRx(nullptr, reception.sender != NONE, 0);
+        }
+    }
+
+    // The acknowledgments, at the transmitters.
+    for (uint32_t tx = 0; tx < m_accesses.size(); tx++)
+    {
+        Access& transmitter = m_accesses[tx];
+        if (!transmitter.frame)
+        {
+            continue;
+        }
+
+        Ptr<Packet> ack;
+        if (transmitter.ackRequest)
+        {
+            Reception reception = Receive(tx, GetSenders(tx, true));
+            if (reception.sender != NONE && !reception.collided &&
+                m_accesses[reception.sender].peer == tx)
+            {
+                ack = m_accesses[reception.sender].ack;
+                double p = transmitter.radio->phy->GetFrameSuccessRate(ack, reception.sinr);
+                if (m_random->GetValue() >= p)
+                {
+                    ack = nullptr;
+                }
+            }
+        }
+
+        m_transmissions++;
+        if (!transmitter.ackRequest || ack)
+        {
+            m_successes++;
+        }
+        transmitter.mac->EndAbstractTx(ack);
+    }
+}
+
+void
+TschSlotEngine::Predict()
+{
+    NS_LOG_FUNCTION(this);
+
+    // The data frames that the receivers would acknowledge, with their
+    // success probability. The acknowledgments are assumed sent whatever the
+    // success of their data frame.
+    std::vector<double> dataSuccess(m_accesses.size(), 0);
+    for (uint32_t rx = 0; rx < m_accesses.size(); rx++)
+    {
+        Access& receiver = m_accesses[rx];
+        if (receiver.frame || receiver.mac->m_macPromiscuousMode)
+        {
+            continue;
+        }
+
+        Reception reception = Receive(rx, GetSenders(rx, false));
+        if (reception.sender == NONE || reception.collided)
+        {
+            continue;
+        }
+
+        const Access& sender = m_accesses[reception.sender];
+        LrWpanMacHeader macHdr;
+        sender.frame->PeekHeader(macHdr);
+        if (!macHdr.IsData() || !macHdr.IsAckReq() || !receiver.mac->AcceptFrame(macHdr))
+        {
+            continue;
+        }
+
+        receiver.ack = receiver.mac->CreateAck(macHdr.GetSeqNum(), macHdr.IsSeqNumSup());
+        receiver.peer = reception.sender;
+        dataSuccess[rx] = receiver.radio->phy->GetFrameSuccessRate(sender.frame, reception.sinr);
+    }
+
+    for (uint32_t tx = 0; tx < m_accesses.size(); tx++)
+    {
+        const Access& transmitter = m_accesses[tx];
+        if (!transmitter.frame)
+        {
+            continue;
+        }
+
+        double p = 1;
+        if (transmitter.ackRequest)
+        {
+            p = 0;
+            Reception reception = Receive(tx, GetSenders(tx, true));
+            if (reception.sender != NONE && !reception.collided &&
+                m_accesses[reception.sender].peer == tx)
+            {
+                const Access& receiver = m_accesses[reception.sender];
+                p = dataSuccess[reception.sender] *
+                    transmitter.radio->phy->GetFrameSuccessRate(receiver.ack, reception.sinr);
+            }
+        }
+        NS_LOG_DEBUG("MAC " << transmitter.mac << " predicted success probability " << p);
+        m_predictions[transmitter.mac] = p;
+    }
+}
+
+} // namespace lrwpan
+} // namespace ns3
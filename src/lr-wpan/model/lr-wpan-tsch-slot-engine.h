@@ -0,0 +1,262 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LR_WPAN_TSCH_SLOT_ENGINE_H
+#define LR_WPAN_TSCH_SLOT_ENGINE_H
+
+#include "lr-wpan-tsch-slot-clock.h"
+
+#include <ns3/packet.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+class MobilityModel;
+class PropagationLossModel;
+class UniformRandomVariable;
+
+namespace lrwpan
+{
+
+class LrWpanPhy;
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Slot-level TSCH engine, deciding each timeslot in a single step.
+ *
+ * The MACs attached to a slot engine start their timeslots as with a
+ * TschSlotClock, but instead of running the PHY state machine, they report
+ * who transmits which frame and who listens on which channel. Once all the
+ * MACs of a timeslot are started, the engine decides the outcome of the
+ * timeslot:
+ *
+ * - a receiver synchronizes to the first frame sent on its channel with a
+ *   SINR above -5 dB, and loses it if another frame arrives, as LrWpanPhy
+ *   does; the frames arrive in the order of the distances to the receiver;
+ * - a synchronized frame is received with the probability given by the
+ *   error model of the receiver for its SINR;
+ * - the acknowledgments sent by the receivers are decided in the same way
+ *   at the transmitters.
+ *
+ * The MACs then fire the same traces as at the end of a packet-level
+ * timeslot (MacTxDataRxAck, MacTxOk, MacWaitAck, MacRxDataTxAck, MacIdle,
+ * ...), at the start of the timeslot. The timeslots decided by the engine
+ * run in its event, and their traces fire in its context; the hooks of the
+ * upper layers at the start of a timeslot and the MCPS-DATA indications and
+ * confirms, of acknowledged transmissions as of dropped ones, run in the
+ * context of the node of the MAC. CCA is not performed, as all the
+ * frames of a timeslot start at the same time. Only the MACs of the engine
+ * are considered, with the propagation loss model and the MaxLossDb
+ * attribute of the spectrum channel of their PHY; the transmit filters of
+ * the channel are ignored.
+ *
+ * With the Validate attribute, the engine leaves the timeslots to the
+ * packet-level engine, predicts the success probability of each
+ * transmission and compares it to the outcome reported by the MAC. The
+ * outcomes that the prediction deems impossible are counted as mismatches.
+ */
+class TschSlotEngine : public TschSlotClock
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TschSlotEngine();
+    ~TschSlotEngine() override;
+
+    /**
+     * \return true if the engine validates the timeslots of the packet-level
+     * engine, instead of deciding them
+     */
+    bool IsValidating() const;
+
+    /**
+     * Add the channel access of a MAC in the current timeslot.
+     *
+     * \param mac the MAC
+     * \param channel the channel of the timeslot
+     * \param frame the frame transmitted, or nullptr if the MAC receives
+     */
+    void AddAccess(LrWpanTschMac* mac, uint8_t channel, Ptr<Packet> frame);
+
+    /**
+     * Report the outcome of a transmission of the packet-level engine.
+     *
+     * \param mac the MAC
+     * \param success whether the frame was acknowledged, or sent for a frame
+     * without acknowledgment request
+     */
+    void NotifyTxOutcome(LrWpanTschMac* mac, bool success);
+
+    /**
+     * \return the number of transmissions decided, or validated
+     */
+    uint64_t GetTransmissionCount() const;
+
+    /**
+     * \return the number of successful transmissions decided, or validated
+     */
+    uint64_t GetSuccessCount() const;
+
+    /**
+     * \return the sum of the predicted success probabilities of the
+     * validated transmissions
+     */
+    double GetExpectedSuccessCount() const;
+
+    /**
+     * \return the number of validated transmissions with an outcome of
+     * predicted probability below 1e-6
+     */
+    uint64_t GetMismatchCount() const;
+
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this model.  Return the number of streams that have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this model
+     */
+    int64_t AssignStreams(int64_t stream);
+
+  protected:
+    void DoDispose() override;
+    void Dispatch(const std::vector<LrWpanTschMac*>& macs) override;
+
+  private:
+    /**
+     * The radio of a MAC, read at its first timeslot.
+     */
+    struct Radio
+    {
+        Ptr<LrWpanPhy> phy;                  //!< The PHY
+        Ptr<MobilityModel> mobility;         //!< The mobility of the PHY
+        Ptr<PropagationLossModel> lossModel; //!< The loss model of its spectrum channel
+        double maxLossDb;                    //!< The MaxLossDb of its spectrum channel
+    };
+
+    /**
+     * The channel access of a MAC in the current timeslot.
+     */
+    struct Access
+    {
+        LrWpanTschMac* mac; //!< The MAC
+        const Radio* radio; //!< The radio of the MAC
+        uint8_t channel;    //!< The channel of the timeslot
+        Ptr<Packet> frame;  //!< The frame transmitted, nullptr for a receiver
+        bool ackRequest;    //!< Whether the frame requests an acknowledgment
+        Ptr<Packet> ack;    //!< The acknowledgment sent by a receiver
+        uint32_t peer;      //!< The transmitter acknowledged by a receiver
+    };
+
+    /**
+     * The outcome of the frames sent to a receiver.
+     */
+    struct Reception
+    {
+        uint32_t sender; //!< The access the receiver synchronized to, or NONE
+        bool collided;   //!< Whether another frame arrived after it
+        double sinr;     //!< The SINR of the synchronized frame
+    };
+
+    /**
+     * Find the frame a receiver synchronizes to.
+     *
+     * \param rx the access of the receiver
+     * \param senders the accesses sending a frame on its channel
+     * \return the reception
+     */
+    Reception Receive(uint32_t rx, const std::vector<uint32_t>& senders) const;
+
+    /**
+     * Get the accesses sending on the channel of an access.
+     *
+     * \param access the access
+     * \param acks whether to return the receivers sending an acknowledgment,
+     * instead of the transmitters
+     * \return the indexes of the accesses
+     */
+    std::vector<uint32_t> GetSenders(uint32_t access, bool acks) const;
+
+    /**
+     * Decide or validate the current timeslot, once the events scheduled by
+     * the dispatch ran.
+     */
+    void EndDispatch();
+
+    /**
+     * Decide the outcome of the current timeslot.
+     */
+    void Resolve();
+
+    /**
+     * Predict the success probability of the transmissions of the current
+     * timeslot.
+     */
+    void Predict();
+
+    /**
+     * The index of no access.
+     */
+    static const uint32_t NONE = 0xffffffff;
+
+    /**
+     * Whether to validate the packet-level engine instead of deciding.
+     */
+    bool m_validate;
+
+    /**
+     * The radios of the MACs.
+     */
+    std::unordered_map<LrWpanTschMac*, Radio> m_radios;
+
+    /**
+     * The channel accesses of the current timeslot.
+     */
+    std::vector<Access> m_accesses;
+
+    /**
+     * The MACs of the current timeslot.
+     */
+    std::vector<LrWpanTschMac*> m_dispatched;
+
+    /**
+     * The predicted success probability of the pending transmission of each
+     * MAC, when validating.
+     */
+    std::unordered_map<LrWpanTschMac*, double> m_predictions;
+
+    /**
+     * The random variable of the frame receptions.
+     */
+    Ptr<UniformRandomVariable> m_random;
+
+    uint64_t m_transmissions; //!< Number of transmissions decided or validated
+    uint64_t m_successes;     //!< Number of successful transmissions
+    double m_expected;        //!< Sum of the predicted success probabilities
+    uint64_t m_mismatches;    //!< Number of outcomes predicted impossible
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_TSCH_SLOT_ENGINE_H */
@@ -0,0 +1,270 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lr-wpan-tsch-stats-collector.h"
+
+#include "lr-wpan-phy.h"
+#include "lr-wpan-tsch-mac.h"
+#include "lr-wpan-tsch-net-device.h"
+
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <charconv>
+#include <string>
+
+namespace ns3
+{
+namespace lrwpan
+{
+
+NS_LOG_COMPONENT_DEFINE("TschStatsCollector");
+NS_OBJECT_ENSURE_REGISTERED(TschStatsCollector);
+
+/** The first channel of the cube. */
+static const uint8_t FIRST_CHANNEL = 11;
+
+TypeId
+TschStatsCollector::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TschStatsCollector")
+                            .SetParent<Object>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<TschStatsCollector>();
+    return tid;
+}
+
+TschStatsCollector::TschStatsCollector()
+    : m_nodes(0),
+      m_timeslots(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TschStatsCollector::~TschStatsCollector()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TschStatsCollector::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_counters.clear();
+    m_radioOn.clear();
+    Object::DoDispose();
+}
+
+void
+TschStatsCollector::Install(NetDeviceContainer devs, uint32_t timeslots)
+{
+    NS_LOG_FUNCTION(this << devs.GetN() << timeslots);
+    NS_ASSERT_MSG(timeslots > 0, "No timeslot");
+    NS_ASSERT_MSG(m_timeslots == 0 || m_timeslots == timeslots,
+                  "The devices were installed with " << m_timeslots << " timeslots");
+    m_timeslots = timeslots;
+
+    // The nodes are the outermost dimension: new nodes extend the cube.
+    uint32_t cells = m_timeslots * CHANNELS * COUNTER_COUNT;
+    for (uint32_t i = 0; i < devs.GetN(); i++)
+    {
+        Ptr<LrWpanTschNetDevice> dev = devs.Get(i)->GetObject<LrWpanTschNetDevice>();
+        NS_ASSERT_MSG(dev, "Device " << i << " is not a LrWpanTschNetDevice");
+        uint32_t node = m_nodes++;
+        m_counters.resize(m_counters.size() + cells, 0);
+        m_radioOn.push_back(0);
+
+        // Bound to the raw MAC, which holds the callbacks.
+        LrWpanTschMac* mac = PeekPointer(dev->GetNMac());
+        const std::pair<const char*, uint32_t> traces[] = {
+            {"MacTxData", (1 << ATTEMPTS) | (1 << ENERGY)},
+            {"MacWaitAck", (1 << ATTEMPTS) | (1 << NO_ACK) | (1 << ENERGY)},
+            {"MacRxData", 1 << ENERGY},
+            {"MacRxDataTxAck", 1 << ENERGY},
+            {"MacIdle", 1 << ENERGY},
+            {"MacChannelBusy", (1 << CCA_BUSY) | (1 << ENERGY)},
+            {"MacEmptyBuffer", 1 << EMPTY},
+        };
+        for (const auto& trace : traces)
+        {
+            mac->TraceConnectWithoutContext(
+                trace.first,
+                MakeCallback(&TschStatsCollector::MacEvent, this).Bind(node, mac, trace.second));
+        }
+        mac->TraceConnectWithoutContext(
+            "MacTxDataRxAck",
+            MakeCallback(&TschStatsCollector::TxDataRxAck, this).Bind(node, mac));
+        dev->GetPhy()->TraceConnectWithoutContext(
+            "PhyPacketCollision",
+            MakeCallback(&TschStatsCollector::Collision, this).Bind(node, mac));
+    }
+}
+
+uint32_t
+TschStatsCollector::GetNNodes() const
+{
+    return m_nodes;
+}
+
+uint32_t
+TschStatsCollector::GetNTimeslots() const
+{
+    return m_timeslots;
+}
+
+void
+TschStatsCollector::Count(uint32_t node, uint64_t asn, uint8_t channel, uint32_t counters)
+{
+    if (channel < FIRST_CHANNEL || channel >= FIRST_CHANNEL + CHANNELS)
+    {
+        // e.g. a collision before the first timeslot
+        NS_LOG_LOGIC("Event on channel " << unsigned(channel) << " out of the cube");
+        return;
+    }
+    uint32_t* cell = &m_counters[((std::size_t(node) * m_timeslots + asn % m_timeslots) * CHANNELS +
+                                  channel - FIRST_CHANNEL) *
+                                 COUNTER_COUNT];
+    // The radio is on once per timeslot, whatever the number of events.
+    if ((counters & (1 << ENERGY)) && m_radioOn[node] == asn + 1)
+    {
+        counters &= ~(1 << ENERGY);
+    }
+    else if (counters & (1 << ENERGY))
+    {
+        m_radioOn[node] = asn + 1;
+    }
+    for (uint32_t counter = 0; counters; counter++, counters >>= 1)
+    {
+        cell[counter] += counters & 1;
+    }
+}
+
+void
+TschStatsCollector::MacEvent(uint32_t node, LrWpanTschMac* mac, uint32_t counters, uint32_t psize)
+{
+    Count(node, mac->GetCurrentAsn(), mac->GetCurrentChannel(), counters);
+}
+
+void
+TschStatsCollector::TxDataRxAck(uint32_t node,
+                                LrWpanTschMac* mac,
+                                std::pair<uint8_t, uint32_t> info)
+{
+    Count(node, mac->GetCurrentAsn(), info.first, (1 << ATTEMPTS) | (1 << ACKS) | (1 << ENERGY));
+}
+
+void
+TschStatsCollector::Collision(uint32_t node, LrWpanTschMac* mac, Ptr<const Packet> p)
+{
+    Count(node, mac->GetCurrentAsn(), mac->GetCurrentChannel(), (1 << COLLISIONS) | (1 << ENERGY));
+}
+
+uint32_t
+TschStatsCollector::Get(uint32_t node, uint32_t timeslot, uint8_t channel, Counter counter) const
+{
+    NS_ASSERT(node < m_nodes && timeslot < m_timeslots && counter < COUNTER_COUNT);
+    NS_ASSERT(channel >= FIRST_CHANNEL && channel < FIRST_CHANNEL + CHANNELS);
+    return m_counters[((std::size_t(node) * m_timeslots + timeslot) * CHANNELS + channel -
+                       FIRST_CHANNEL) *
+                          COUNTER_COUNT +
+                      counter];
+}
+
+uint64_t
+TschStatsCollector::GetTotal(Counter counter) const
+{
+    NS_ASSERT(counter < COUNTER_COUNT);
+    uint64_t total = 0;
+    for (std::size_t i = counter; i < m_counters.size(); i += COUNTER_COUNT)
+    {
+        total += m_counters[i];
+    }
+    return total;
+}
+
+std::vector<uint32_t>
+TschStatsCollector::Snapshot() const
+{
+    return m_counters;
+}
+
+void
+TschStatsCollector::Reset()
+{
+    NS_LOG_FUNCTION(this);
+    std::fill(m_counters.begin(), m_counters.end(), 0);
+    std::fill(m_radioOn.begin(), m_radioOn.end(), 0);
+}
+
+const char*
+TschStatsCollector::GetCounterName(Counter counter)
+{
+    static const char* names[COUNTER_COUNT] =
+        {"attempts", "acks", "collisions", "noAck", "ccaBusy", "empty", "energy"};
+    return counter < COUNTER_COUNT ? names[counter] : "unknown";
+}
+
+void
+TschStatsCollector::Dump(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::string line = "node,timeslot,channel";
+    for (uint32_t counter = 0; counter < COUNTER_COUNT; counter++)
+    {
+        line += ",";
+        line += GetCounterName(Counter(counter));
+    }
+    line += "\n";
+    os << line;
+
+    // Formatted without the streams, which dominate a dump of millions of cells.
+    std::string buffer;
+    buffer.reserve(1 << 16);
+    char number[24];
+    auto append = [&buffer, &number](uint64_t value, char separator) {
+        buffer.append(number, std::to_chars(number, number + sizeof(number), value).ptr);
+        buffer += separator;
+    };
+    const uint32_t* cell = m_counters.data();
+    for (uint32_t node = 0; node < m_nodes; node++)
+    {
+        for (uint32_t timeslot = 0; timeslot < m_timeslots; timeslot++)
+        {
+            for (uint32_t channel = 0; channel < CHANNELS; channel++, cell += COUNTER_COUNT)
+            {
+                if (std::all_of(cell, cell + COUNTER_COUNT, [](uint32_t c) { return c == 0; }))
+                {
+                    continue;
+                }
+                append(node, ',');
+                append(timeslot, ',');
+                append(FIRST_CHANNEL + channel, ',');
+                for (uint32_t counter = 0; counter < COUNTER_COUNT; counter++)
+                {
+                    append(cell[counter], counter + 1 < COUNTER_COUNT ? ',' : '\n');
+                }
+                if (buffer.size() > (1 << 16) - 256)
+                {
+                    os.write(buffer.data(), buffer.size());
+                    buffer.clear();
+                }
+            }
+        }
+    }
+    os.write(buffer.data(), buffer.size());
+}
+
+} // namespace lrwpan
+} // namespace ns3
@@ -0,0 +1,195 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LR_WPAN_TSCH_STATS_COLLECTOR_H
+#define LR_WPAN_TSCH_STATS_COLLECTOR_H
+
+#include <ns3/net-device-container.h>
+#include <ns3/object.h>
+
+#include <ostream>
+#include <vector>
+
+namespace ns3
+{
+
+class Packet;
+
+namespace lrwpan
+{
+
+class LrWpanTschMac;
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Counts the outcomes of the TSCH timeslots, by node, timeslot and
+ * channel.
+ *
+ * The counters are a dense cube in a flat array, indexed by node, then
+ * timeslot, then channel, then counter, and are updated by the trace sources
+ * of LrWpanTschMac and LrWpanPhy, connected without context. The timeslot
+ * of an event is its ASN modulo the number of timeslots given to Install(),
+ * e.g. the length of the slotframe or of the hopping sequence, and its
+ * channel is the channel of the timeslot, 11 to 26.
+ *
+ * The counters of different nodes are distinct, so that the PANs may run
+ * on different logical processes of MultithreadedSimulatorImpl.
+ */
+class TschStatsCollector : public Object
+{
+  public:
+    /** The counters of each node, timeslot and channel. */
+    enum Counter
+    {
+        ATTEMPTS = 0,   //!< Data transmissions: MacTxData, MacTxDataRxAck or MacWaitAck
+        ACKS = 1,       //!< Acknowledged transmissions: MacTxDataRxAck
+        COLLISIONS = 2, //!< Receptions destroyed by interference: PhyPacketCollision
+        NO_ACK = 3,     //!< Transmissions without ACK: MacWaitAck
+        CCA_BUSY = 4,   //!< Busy CCAs: MacChannelBusy
+        EMPTY = 5,      //!< Transmit links without packet: MacEmptyBuffer
+        ENERGY = 6,     //!< Timeslots with the radio on, whatever the outcome
+        COUNTER_COUNT = 7
+    };
+
+    /** The number of channels, 11 to 26. */
+    static const uint32_t CHANNELS = 16;
+
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TschStatsCollector();
+    ~TschStatsCollector() override;
+
+    /**
+     * Connect the trace sources of TSCH devices. The nodes are indexed in
+     * the order of the devices, after the ones of the previous calls.
+     *
+     * \param devs the LrWpanTschNetDevices
+     * \param timeslots the number of timeslots, the same for every call
+     */
+    void Install(NetDeviceContainer devs, uint32_t timeslots);
+
+    /**
+     * \return the number of nodes
+     */
+    uint32_t GetNNodes() const;
+
+    /**
+     * \return the number of timeslots
+     */
+    uint32_t GetNTimeslots() const;
+
+    /**
+     * Get a counter.
+     *
+     * \param node the node index
+     * \param timeslot the timeslot
+     * \param channel the channel, 11 to 26
+     * \param counter the counter
+     * \return the count
+     */
+    uint32_t Get(uint32_t node, uint32_t timeslot, uint8_t channel, Counter counter) const;
+
+    /**
+     * Get the sum of a counter over all the nodes, timeslots and channels.
+     *
+     * \param counter the counter
+     * \return the sum
+     */
+    uint64_t GetTotal(Counter counter) const;
+
+    /**
+     * Copy the counters, in the order of the cube: the counter at
+     * ((node * timeslots + timeslot) * CHANNELS + channel - 11) * COUNTER_COUNT
+     * + counter.
+     *
+     * \return the counters
+     */
+    std::vector<uint32_t> Snapshot() const;
+
+    /** Set the counters to 0. */
+    void Reset();
+
+    /**
+     * Print the non-zero cells of the cube as CSV, with a header line: the
+     * node index, timeslot, channel and counters.
+     *
+     * \param os the output stream
+     */
+    void Dump(std::ostream& os) const;
+
+    /**
+     * Get the name of a counter.
+     *
+     * \param counter the counter
+     * \return the name
+     */
+    static const char* GetCounterName(Counter counter);
+
+  private:
+    void DoDispose() override;
+
+    /**
+     * Count a MAC timeslot event.
+     *
+     * \param node the node index
+     * \param mac the MAC
+     * \param counters the counters to increment, a bit per Counter
+     * \param psize the packet size
+     */
+    void MacEvent(uint32_t node, LrWpanTschMac* mac, uint32_t counters, uint32_t psize);
+
+    /**
+     * Increment counters of an event.
+     *
+     * \param node the node index
+     * \param asn the ASN of the event
+     * \param channel the channel of the event
+     * \param counters the counters to increment, a bit per Counter
+     */
+    void Count(uint32_t node, uint64_t asn, uint8_t channel, uint32_t counters);
+
+    /**
+     * Count an acknowledged transmission.
+     *
+     * \param node the node index
+     * \param mac the MAC
+     * \param info the channel and hopping sequence index
+     */
+    void TxDataRxAck(uint32_t node, LrWpanTschMac* mac, std::pair<uint8_t, uint32_t> info);
+
+    /**
+     * Count a reception destroyed by interference.
+     *
+     * \param node the node index
+     * \param mac the MAC
+     * \param p the packet
+     */
+    void Collision(uint32_t node, LrWpanTschMac* mac, Ptr<const Packet> p);
+
+    uint32_t m_nodes;                 //!< The number of nodes
+    uint32_t m_timeslots;             //!< The number of timeslots
+    std::vector<uint32_t> m_counters; //!< The counter cube
+    std::vector<uint64_t> m_radioOn;  //!< ASN + 1 of the last timeslot with the radio on
+};
+
+} // namespace lrwpan
+} // namespace ns3
+
+#endif /* LR_WPAN_TSCH_STATS_COLLECTOR_H */
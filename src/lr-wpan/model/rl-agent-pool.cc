@@ -0,0 +1,334 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "rl-agent-pool.h"
+
+#include "rl-agent.h"
+
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("RlAgentPool");
+
+NS_OBJECT_ENSURE_REGISTERED(AgentPool);
+
+TypeId
+AgentPool::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::AgentPool")
+                            .SetParent<Object>()
+                            .SetGroupName("LrWpan")
+                            .AddConstructor<AgentPool>();
+    return tid;
+}
+
+AgentPool::AgentPool()
+    : m_channels(0),
+      m_rows(0),
+      m_maxQ(1, 0.0),
+      m_awaitedCount(0),
+      m_batchCount(0),
+      m_updateCount(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+AgentPool::~AgentPool()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+AgentPool::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_updateEvent.IsRunning())
+    {
+        m_updateEvent.Cancel();
+        UpdateBatch();
+    }
+    // The traces of the agents stay connected: move their tables back.
+    for (uint32_t i = 0; i < m_agents.size(); i++)
+    {
+        Ptr<Agent> agent = m_agents[i];
+        uint32_t slots = agent->m_timeslotCount;
+        agent->m_qTable.assign(GetQTable(i), GetQTable(i) + slots * m_channels);
+        agent->m_isSucceed.assign(GetSuccessMask(i), GetSuccessMask(i) + m_maskSize[i]);
+        agent->m_maxQ.assign(GetMaxQTable(i), GetMaxQTable(i) + slots);
+        agent->m_currentConfiguration.assign(GetConfiguration(i), GetConfiguration(i) + slots);
+        agent->m_pool = nullptr;
+    }
+    m_agents.clear();
+    m_qTable.clear();
+    m_successMask.clear();
+    m_configuration.clear();
+    Object::DoDispose();
+}
+
+void
+AgentPool::Add(Ptr<Agent> agent)
+{
+    NS_LOG_FUNCTION(this << agent);
+    NS_ASSERT_MSG(!agent->m_pool, "The agent is already in a pool");
+    NS_ASSERT_MSG(m_agents.empty() || agent->m_channelCount == m_channels,
+                  "The agents of a pool have the same number of channels");
+
+    m_channels = agent->m_channelCount;
+    uint32_t slots = agent->m_timeslotCount;
+    m_rowOffset.push_back(m_rows);
+    m_qTable.insert(m_qTable.end(), agent->m_qTable.begin(), agent->m_qTable.end());
+    m_maskOffset.push_back(m_successMask.size());
+    m_maskSize.push_back(agent->m_isSucceed.size());
+    for (uint32_t t = 0; t < slots; t++)
+    {
+        m_rowBit.push_back(m_successMask.size() * 64 + t * m_channels);
+    }
+    m_successMask.insert(m_successMask.end(),
+                         agent->m_isSucceed.begin(),
+                         agent->m_isSucceed.end());
+    m_configuration.insert(m_configuration.end(),
+                           agent->m_currentConfiguration.begin(),
+                           agent->m_currentConfiguration.end());
+    m_rows += slots;
+    m_maxQ.resize(m_rows + 1, 0.0);
+    m_rowAlpha.resize(m_rows, 0.0);
+    m_rowDiscount.resize(m_rows, 0.0);
+    m_queued.push_back(0);
+    m_awaited.push_back(0);
+
+    agent->m_qTable.clear();
+    agent->m_qTable.shrink_to_fit();
+    agent->m_isSucceed.clear();
+    agent->m_isSucceed.shrink_to_fit();
+    agent->m_maxQ.clear();
+    agent->m_maxQ.shrink_to_fit();
+    agent->m_currentConfiguration.clear();
+    agent->m_currentConfiguration.shrink_to_fit();
+    agent->m_pool = this;
+    agent->m_poolIndex = m_agents.size();
+    m_agents.push_back(agent);
+}
+
+uint32_t
+AgentPool::GetN() const
+{
+    return m_agents.size();
+}
+
+Ptr<Agent>
+AgentPool::Get(uint32_t i) const
+{
+    return m_agents[i];
+}
+
+uint64_t
+AgentPool::GetBatchCount() const
+{
+    return m_batchCount;
+}
+
+uint64_t
+AgentPool::GetUpdateCount() const
+{
+    return m_updateCount;
+}
+
+double*
+AgentPool::GetQTable(uint32_t index)
+{
+    return m_qTable.data() + m_rowOffset[index] * m_channels;
+}
+
+uint64_t*
+AgentPool::GetSuccessMask(uint32_t index)
+{
+    return m_successMask.data() + m_maskOffset[index];
+}
+
+double*
+AgentPool::GetMaxQTable(uint32_t index)
+{
+    return m_maxQ.data() + m_rowOffset[index];
+}
+
+uint8_t*
+AgentPool::GetConfiguration(uint32_t index)
+{
+    return m_configuration.data() + m_rowOffset[index];
+}
+
+void
+AgentPool::UpdateQTables(double* qTable,
+                         double* maxQ,
+                         const uint64_t* succeed,
+                         const uint32_t* rowBit,
+                         const uint8_t* configuration,
+                         const double* alpha,
+                         const double* discount,
+                         uint32_t rows,
+                         uint32_t channels)
+{
+    for (uint32_t row = 0; row < rows; ++row)
+    {
+        maxQ[row] = Agent::GetRowMax(qTable + row * channels, channels);
+    }
+
+    for (uint32_t row = 0; row < rows; ++row)
+    {
+        uint32_t c = configuration[row] - 11;
+        uint32_t bit = rowBit[row] + c;
+        int r = (succeed[bit / 64] >> (bit % 64)) & 1 ? 1 : -1;
+        double& q = qTable[row * channels + c];
+        q = (1 - alpha[row]) * q + alpha[row] * (r + discount[row] * maxQ[row + 1]);
+    }
+}
+
+void
+AgentPool::PeriodPassed(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+
+    if (m_queued[index])
+    {
+        // The trace of the agent fired twice in the same instant: the agent
+        // is updated twice, as without pool.
+        m_updateEvent.Cancel();
+        UpdateBatch();
+    }
+    if (m_awaited[index])
+    {
+        m_awaited[index] = 0;
+        m_awaitedCount--;
+    }
+    else if (m_batch.empty())
+    {
+        // First report of the instant: wait for the agents whose period
+        // ends later in the instant.
+        for (uint32_t i = 0; i < m_agents.size(); i++)
+        {
+            if (i != index && m_agents[i]->IsPeriodEndPending())
+            {
+                m_awaited[i] = 1;
+                m_awaitedCount++;
+            }
+        }
+    }
+    m_queued[index] = 1;
+    m_batch.push_back(index);
+    if (m_awaitedCount == 0)
+    {
+        // The last agent of the instant: the policies are deployed before
+        // any timeslot of the instant starts, as without pool.
+        m_updateEvent.Cancel();
+        UpdateBatch();
+    }
+    else if (!m_updateEvent.IsRunning())
+    {
+        // An awaited agent may not report, if its trace is not the one of
+        // its first device.
+        m_updateEvent = Simulator::ScheduleNow(&AgentPool::UpdateBatch, this);
+    }
+}
+
+void
+AgentPool::UpdateBatch()
+{
+    NS_LOG_FUNCTION(this);
+    NS_LOG_DEBUG("Updating " << m_batch.size() << " agents");
+
+    // Update the rows of the active agents of the batch, in runs of agents
+    // stored next to each other.
+    std::sort(m_batch.begin(), m_batch.end());
+    uint32_t first = 0;
+    uint32_t last = 0;
+    for (uint32_t i : m_batch)
+    {
+        Ptr<Agent> agent = m_agents[i];
+        if (!agent->active)
+        {
+            continue;
+        }
+        uint32_t begin = m_rowOffset[i];
+        uint32_t end = begin + agent->m_timeslotCount;
+        std::fill(m_rowAlpha.begin() + begin, m_rowAlpha.begin() + end, agent->m_params.alpha);
+        std::fill(m_rowDiscount.begin() + begin,
+                  m_rowDiscount.begin() + end - 1,
+                  agent->m_params.gamma);
+        m_rowDiscount[end - 1] = 0;
+        if (begin != last)
+        {
+            UpdateRows(first, last);
+            first = begin;
+        }
+        last = end;
+    }
+    UpdateRows(first, last);
+
+    // initialize the success masks
+    if (m_batch.size() == m_agents.size())
+    {
+        std::memset(m_successMask.data(), 0, m_successMask.size() * sizeof(uint64_t));
+    }
+    else
+    {
+        for (uint32_t i : m_batch)
+        {
+            std::memset(GetSuccessMask(i), 0, m_maskSize[i] * sizeof(uint64_t));
+        }
+    }
+
+    // The agents may be added to the next batch while deploying their policy.
+    std::vector<uint32_t> batch;
+    batch.swap(m_batch);
+    for (uint32_t i : batch)
+    {
+        m_queued[i] = 0;
+    }
+    std::fill(m_awaited.begin(), m_awaited.end(), 0);
+    m_awaitedCount = 0;
+    for (uint32_t i : batch)
+    {
+        m_agents[i]->EndPeriod();
+    }
+
+    m_batchCount++;
+    m_updateCount += batch.size();
+}
+
+void
+AgentPool::UpdateRows(uint32_t first, uint32_t last)
+{
+    if (first == last)
+    {
+        return;
+    }
+    UpdateQTables(m_qTable.data() + first * m_channels,
+                  m_maxQ.data() + first,
+                  m_successMask.data(),
+                  m_rowBit.data() + first,
+                  m_configuration.data() + first,
+                  m_rowAlpha.data() + first,
+                  m_rowDiscount.data() + first,
+                  last - first,
+                  m_channels);
+}
+
+} // namespace ns3
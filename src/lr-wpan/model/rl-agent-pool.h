@@ -0,0 +1,199 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTI_PAN_RL_AGENT_POOL_H
+#define MULTI_PAN_RL_AGENT_POOL_H
+
+#include <ns3/event-id.h>
+#include <ns3/object.h>
+#include <ns3/ptr.h>
+
+#include <vector>
+
+namespace ns3
+{
+
+class Agent;
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief Q-learning agents updated together.
+ *
+ * The pool owns the Q-tables, success masks, next-slot maxima and hopping
+ * sequences of its agents, each stored in a single contiguous block where a
+ * timeslot of an agent is a row. The agents whose hopping period end trace
+ * fires in the same instant are collected, and updated together when the
+ * last of them reports: a single pass over the rows of each run of batched
+ * agents stored next to each other, after which their new hopping sequences
+ * are deployed. The agents awaited are the ones whose first device has an
+ * ASN increment ending a hopping period pending in the instant, so the new
+ * hopping sequences are deployed before any timeslot of the instant starts,
+ * with or without slot clock, as without pool. If an awaited agent does not
+ * report, the batch is updated in a zero-delay event.
+ *
+ * When the pool is disposed of, the tables are moved back to the agents,
+ * which then update themselves.
+ */
+class AgentPool : public Object
+{
+  public:
+    /**
+     * Get the type ID.
+     *
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    AgentPool();
+    ~AgentPool() override;
+
+    /**
+     * Add an agent to the pool. The tables of the agent are moved to the
+     * pool. All the agents of a pool have the same number of channels.
+     *
+     * \param agent the agent
+     */
+    void Add(Ptr<Agent> agent);
+
+    /**
+     * \return the number of agents
+     */
+    uint32_t GetN() const;
+
+    /**
+     * \param i the index of the agent
+     * \return the agent
+     */
+    Ptr<Agent> Get(uint32_t i) const;
+
+    /**
+     * \return the number of batched updates
+     */
+    uint64_t GetBatchCount() const;
+
+    /**
+     * \return the number of agent updates
+     */
+    uint64_t GetUpdateCount() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    friend class Agent;
+
+    /**
+     * Add an agent to the batch of the current instant, and update the
+     * batch if no other agent is awaited in the instant.
+     *
+     * \param index the index of the agent whose period end trace fired
+     */
+    void PeriodPassed(uint32_t index);
+
+    /**
+     * Update the agents of the batch and deploy their new policies.
+     */
+    void UpdateBatch();
+
+    /**
+     * Update a range of rows of the batched agents.
+     *
+     * \param first the first row
+     * \param last the row after the last one
+     */
+    void UpdateRows(uint32_t first, uint32_t last);
+
+    /**
+     * Bellman update of the Q values of a hopping period, for a range of
+     * rows. The Q value of the channel used in each row is updated with the
+     * highest Q value of the next row before that one is updated.
+     *
+     * \param qTable the Q-table of the first row, [row * channels + channel]
+     * \param maxQ storage for the highest Q value of every row, and of the
+     *        row after the range
+     * \param succeed the success masks
+     * \param rowBit the bit of the first channel of every row in succeed
+     * \param configuration the channel used in every row
+     * \param alpha the learning rate of every row
+     * \param discount the discount factor of every row, zero for the last
+     *        timeslot of an agent
+     * \param rows the number of rows
+     * \param channels the number of channels
+     */
+    static void UpdateQTables(double* qTable,
+                              double* maxQ,
+                              const uint64_t* succeed,
+                              const uint32_t* rowBit,
+                              const uint8_t* configuration,
+                              const double* alpha,
+                              const double* discount,
+                              uint32_t rows,
+                              uint32_t channels);
+
+    /**
+     * \param index the index of the agent
+     * \return the Q-table of the agent
+     */
+    double* GetQTable(uint32_t index);
+
+    /**
+     * \param index the index of the agent
+     * \return the success mask of the agent
+     */
+    uint64_t* GetSuccessMask(uint32_t index);
+
+    /**
+     * \param index the index of the agent
+     * \return the next-slot maxima of the agent
+     */
+    double* GetMaxQTable(uint32_t index);
+
+    /**
+     * \param index the index of the agent
+     * \return the hopping sequence of the agent
+     */
+    uint8_t* GetConfiguration(uint32_t index);
+
+    std::vector<Ptr<Agent>> m_agents; //!< The agents
+
+    uint32_t m_channels; //!< Number of channels of the agents
+    uint32_t m_rows;     //!< Number of timeslots of all the agents
+
+    std::vector<double> m_qTable;         //!< The Q-tables of all the agents
+    std::vector<uint64_t> m_successMask;  //!< The success masks of all the agents
+    std::vector<double> m_maxQ;           //!< The next-slot maxima of all the rows, and one more
+    std::vector<uint8_t> m_configuration; //!< The channel of every row
+
+    std::vector<uint32_t> m_rowBit;     //!< Bit of the first channel of every row in m_successMask
+    std::vector<double> m_rowAlpha;     //!< Learning rate of every row
+    std::vector<double> m_rowDiscount;  //!< Discount factor of every row
+    std::vector<uint32_t> m_rowOffset;  //!< First row of each agent
+    std::vector<uint32_t> m_maskOffset; //!< Offset of each agent in m_successMask
+    std::vector<uint32_t> m_maskSize;   //!< Number of words of each agent in m_successMask
+    std::vector<uint8_t> m_queued;      //!< Whether each agent is in the batch
+    std::vector<uint8_t> m_awaited;     //!< Whether each agent is awaited in the current instant
+    uint32_t m_awaitedCount;            //!< Number of agents awaited in the current instant
+
+    std::vector<uint32_t> m_batch; //!< The agents whose trace fired in the current instant
+    EventId m_updateEvent;         //!< The update of the batch
+
+    uint64_t m_batchCount;  //!< Number of batched updates
+    uint64_t m_updateCount; //!< Number of agent updates
+};
+
+} // namespace ns3
+
+#endif // MULTI_PAN_RL_AGENT_POOL_H
@@ -1,5 +1,10 @@
 #include "rl-agent.h"
 
+#include "rl-agent-pool.h"
+
+#include <algorithm>
+#include <cstring>
+
 
 namespace ns3
 {
@@ -42,8 +47,9 @@ Agent::Agent(NetDeviceContainer devs)
     }
 
 
-    m_qTable.resize(m_timeslotCount, std::vector<double>(m_channelCount, 0.0));
-    m_isSucceed.resize(m_timeslotCount, std::vector<bool>(m_channelCount, false));
+    m_qTable.resize(m_timeslotCount * m_channelCount, 0.0);
+    m_isSucceed.resize((m_timeslotCount * m_channelCount + 63) / 64, 0);
+    m_maxQ.resize(m_timeslotCount, 0.0);
 
 
     for(auto i = m_devs.Begin(); i < m_devs.End(); i++)
@@ -70,17 +76,7 @@ Agent::ChooseAction(uint32_t slot)
 
     NS_LOG_DEBUG("PAN " << panId << " not active, only exploitation.");
     // exploitation
-    double maxQ = -1e10;
-    uint32_t bestChannel = 0;
-
-    for (uint32_t c = 0; c < m_channelCount; ++c)
-    {
-        if (m_qTable[slot][c] > maxQ)
-        {
-            maxQ = m_qTable[slot][c];
-            bestChannel = c;
-        }
-    }
+    uint32_t bestChannel = GetBestChannel(slot);
     NS_LOG_DEBUG("(exploitation) channel " << 11 + (int) bestChannel);
     return 11 + bestChannel;
 }
@@ -90,49 +86,39 @@ void
 Agent::OnePeriodHoppingSequencePassed(uint64_t macAsn)
 {
     NS_LOG_FUNCTION(this);
-    if (active)
+    if (m_pool)
     {
-        for (uint32_t t = 0; t < m_timeslotCount; ++t)
-        {
-            uint8_t c = m_currentConfiguration[t];
-            int r = m_isSucceed[t][c-11] ? 1 : -1;
-
-            // get best Q value from next slot
-            if (t >= m_timeslotCount - 1)
-            {
-                m_qTable[t][c-11] = (1-m_params.alpha) * m_qTable[t][c-11] + m_params.alpha * r;
-            }
-            else
-            {
-                double maxQNext = -1e10;
-                for (uint32_t c2 = 0; c2 < m_channelCount; ++c2)
-                {
-                    maxQNext = std::max(maxQNext, m_qTable[(t + 1) % m_timeslotCount][c2]);
-                }
-                m_qTable[t][c-11] = (1 - m_params.alpha) * m_qTable[t][c-11]
-                    + m_params.alpha * (r + m_params.gamma * maxQNext);
-            }
-            NS_LOG_DEBUG("giving reward " << r << " to timeslot: " << t << " channel: " << static_cast<int>(c));
-        }
+        m_pool->PeriodPassed(m_poolIndex);
+        return;
     }
-    else
+
+    if (active)
     {
-        NS_LOG_DEBUG("PAN " << panId << " not active, deactiveCount: " << deactiveCount << " of " << m_deactiveCount);
-        deactiveCount++;
+        UpdateQTable(GetQTable(),
+                     GetSuccessMask(),
+                     GetMaxQTable(),
+                     GetConfiguration(),
+                     m_timeslotCount,
+                     m_channelCount,
+                     m_params.alpha,
+                     m_params.gamma);
     }
 
     // initialize isSucceed
-    m_isSucceed.assign(m_timeslotCount, std::vector<bool>(m_channelCount, false));
+    std::memset(m_isSucceed.data(), 0, m_isSucceed.size() * sizeof(uint64_t));
+
+    EndPeriod();
+}
 
-    for (uint32_t t = 0; t < m_timeslotCount; ++t)
+void
+Agent::EndPeriod()
+{
+    if (!active)
     {
-        for (uint32_t c = 0; c < m_channelCount; ++c)
-        {
-            NS_ASSERT(m_isSucceed[t][c] == false);
-            // int r = m_isSucceed[t][c] ? 1 : -1;
-            // m_qTable[t][c] = m_qTable[t][c] + m_params.alpha * (r - m_qTable[t][c]);
-        }
+        NS_LOG_DEBUG("PAN " << panId << " not active, deactiveCount: " << deactiveCount << " of " << m_deactiveCount);
+        deactiveCount++;
     }
+
     DeployNewPolicy();
 
     if (deactiveCount == m_deactiveCount)
@@ -143,14 +129,61 @@ Agent::OnePeriodHoppingSequencePassed(uint64_t macAsn)
     }
 }
 
+bool
+Agent::IsPeriodEndPending() const
+{
+    if (m_devs.GetN() == 0)
+    {
+        return false;
+    }
+    return DynamicCast<LrWpanTschNetDevice>(m_devs.Get(0))->GetNMac()->IsHoppingSequenceEndPending();
+}
+
+void
+Agent::UpdateQTable(double* qTable,
+                    const uint64_t* succeed,
+                    double* maxQ,
+                    const uint8_t* configuration,
+                    uint32_t slots,
+                    uint32_t channels,
+                    double alpha,
+                    double gamma)
+{
+    // Each timeslot is updated with the best Q value of the next one
+    // before that one is updated, so the maxima of all the timeslots
+    // can be taken once beforehand.
+    for (uint32_t t = 1; t < slots; ++t)
+    {
+        maxQ[t] = GetRowMax(qTable + t * channels, channels);
+    }
+
+    for (uint32_t t = 0; t < slots; ++t)
+    {
+        uint8_t c = configuration[t];
+        uint32_t bit = t * channels + c - 11;
+        int r = (succeed[bit / 64] >> (bit % 64)) & 1 ? 1 : -1;
+        double& q = qTable[bit];
+
+        // get best Q value from next slot
+        if (t >= slots - 1)
+        {
+            q = (1 - alpha) * q + alpha * r;
+        }
+        else
+        {
+            q = (1 - alpha) * q + alpha * (r + gamma * maxQ[t + 1]);
+        }
+        NS_LOG_DEBUG("giving reward " << r << " to timeslot: " << t << " channel: " << static_cast<int>(c));
+    }
+}
+
 
 void
 Agent::DeployNewPolicy()
 {
     NS_LOG_FUNCTION(this);
     std::vector<uint8_t> slots; // slots[slot] = channel
-
-    m_currentConfiguration.clear();
+    uint8_t* configuration = GetConfiguration();
 
     // get actions
     NS_LOG_DEBUG("time slot configuration: ");
@@ -158,7 +191,7 @@ Agent::DeployNewPolicy()
     {
         uint8_t action = ChooseAction(i);
         slots.push_back(action);
-        m_currentConfiguration.push_back(action);
+        configuration[i] = action;
         NS_LOG_DEBUG("slot " << i << ": " << static_cast<int>(action));
     }
 
@@ -182,7 +215,64 @@ Agent::CountSucceed(std::pair<uint8_t, uint32_t> info)
 
     NS_LOG_DEBUG("transmission succeed at: [channel " << static_cast<int>(ch) << "\t, slot " << slot << "]");
 
-    m_isSucceed[slot][ch-11] = true;
+    uint32_t bit = slot * m_channelCount + ch - 11;
+    GetSuccessMask()[bit / 64] |= uint64_t(1) << (bit % 64);
+}
+
+double*
+Agent::GetQTable()
+{
+    return m_pool ? m_pool->GetQTable(m_poolIndex) : m_qTable.data();
+}
+
+uint64_t*
+Agent::GetSuccessMask()
+{
+    return m_pool ? m_pool->GetSuccessMask(m_poolIndex) : m_isSucceed.data();
+}
+
+double*
+Agent::GetMaxQTable()
+{
+    return m_pool ? m_pool->GetMaxQTable(m_poolIndex) : m_maxQ.data();
+}
+
+uint8_t*
+Agent::GetConfiguration()
+{
+    return m_pool ? m_pool->GetConfiguration(m_poolIndex) : m_currentConfiguration.data();
+}
+
+int64_t
+Agent::AssignStreams(int64_t stream)
+{
+    m_random->SetStream(stream);
+    return 1;
+}
+
+std::vector<double>
+Agent::GetQValues()
+{
+    return std::vector<double>(GetQTable(), GetQTable() + m_timeslotCount * m_channelCount);
+}
+
+double
+Agent::GetRowMax(const double* row, uint32_t channels)
+{
+    // Branch-free reduction, vectorized by the compiler.
+    double maxQ = row[0];
+    for (uint32_t c = 1; c < channels; ++c)
+    {
+        maxQ = row[c] > maxQ ? row[c] : maxQ;
+    }
+    return maxQ;
+}
+
+uint32_t
+Agent::GetBestChannel(uint32_t slot)
+{
+    const double* q = GetQTable() + slot * m_channelCount;
+    return std::find(q, q + m_channelCount, GetRowMax(q, m_channelCount)) - q;
 }
 
 
@@ -21,6 +21,8 @@ using namespace ns3::lrwpan;
 namespace ns3
 {
 
+class AgentPool;
+
 struct QAgentParams
 {
     double_t alpha;
@@ -77,6 +79,17 @@ class Agent: public Object
     */
     uint8_t ChooseAction(uint32_t slot);
     void CountSucceed(std::pair<uint8_t, uint32_t> info);
+    /**
+     * \return a copy of the Q-table, [timeslot * channel count + channel - 11]
+     */
+    std::vector<double> GetQValues();
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this agent.
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this agent
+     */
+    int64_t AssignStreams(int64_t stream);
 
     uint32_t success_count = 0;
     uint32_t total_count = 0;
@@ -89,14 +102,85 @@ class Agent: public Object
     const uint8_t m_deactiveCount = 5;
 
 private:
+    friend class AgentPool;
+
     LrWpanTschHelper* m_helper;
     Ptr<RandomVariableStream> m_random;
     NetDeviceContainer m_devs;
 
     QAgentParams m_params;
 
-    std::vector<std::vector<double>> m_qTable; // [timeslot][channel]
-    std::vector<std::vector<bool>> m_isSucceed; // [timeslot][channel]
+    /**
+     * \return the Q-table, [timeslot * m_channelCount + channel], in the
+     * agent pool if the agent is in one
+     */
+    double* GetQTable();
+    /**
+     * \return the success mask, bit [timeslot * m_channelCount + channel],
+     * in the agent pool if the agent is in one
+     */
+    uint64_t* GetSuccessMask();
+    /**
+     * \return the highest Q value of every timeslot, in the agent pool if
+     * the agent is in one
+     */
+    double* GetMaxQTable();
+    /**
+     * \return the channel of every timeslot, in the agent pool if the agent
+     * is in one
+     */
+    uint8_t* GetConfiguration();
+    /**
+     * Get the channel index with the highest Q value of a timeslot.
+     * \param slot the timeslot
+     * \return the first channel index (from 0) with the highest Q value
+     */
+    uint32_t GetBestChannel(uint32_t slot);
+    /**
+     * Finish a hopping period once the Q-table is updated: count the
+     * inactive periods and deploy the new policy.
+     */
+    void EndPeriod();
+    /**
+     * Whether the MAC of the first device, whose period end trace the
+     * agent is expected to follow, ends a hopping period later in the
+     * current instant.
+     * \return true if the agent reports a period end later in the instant
+     */
+    bool IsPeriodEndPending() const;
+
+    /**
+     * Get the highest value of a row of a Q-table.
+     * \param row the row
+     * \param channels the number of channels of the row
+     * \return the highest value
+     */
+    static double GetRowMax(const double* row, uint32_t channels);
+    /**
+     * Bellman update of the Q values of a hopping period.
+     * \param qTable the Q-table, [timeslot * channels + channel]
+     * \param succeed the success mask, bit [timeslot * channels + channel]
+     * \param maxQ storage for the highest Q value of every timeslot
+     * \param configuration the channel used in every timeslot
+     * \param slots the number of timeslots
+     * \param channels the number of channels
+     * \param alpha the learning rate
+     * \param gamma the discount factor
+     */
+    static void UpdateQTable(double* qTable,
+                             const uint64_t* succeed,
+                             double* maxQ,
+                             const uint8_t* configuration,
+                             uint32_t slots,
+                             uint32_t channels,
+                             double alpha,
+                             double gamma);
+
+    std::vector<double> m_qTable; // [timeslot * m_channelCount + channel]
+    std::vector<uint64_t> m_isSucceed; // bit [timeslot * m_channelCount + channel]
+    std::vector<double> m_maxQ; // m_maxQ[timeslot] = max_c m_qTable[timeslot][c]
+    AgentPool* m_pool = nullptr; // pool holding the tables above, if any
+    uint32_t m_poolIndex = 0; // index of the agent in m_pool
     std::vector<uint8_t> m_currentConfiguration; // currentConfiguration[timeSlot] = channel
     uint32_t m_timeslotCount;
     uint8_t m_channelCount;
@@ -0,0 +1,201 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/core-module.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/simulator.h>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-analytical-rx-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan analytical reception test
+ *
+ * Compares the analytical reception mode of the PHY with the full model in
+ * a TSCH network, on a link whose frames are lost to noise, where the
+ * delivery ratios must agree, and on two devices transmitting in the same
+ * timeslot, where the collisions must be the same.
+ */
+class LrWpanAnalyticalRxTestCase : public TestCase
+{
+  public:
+    LrWpanAnalyticalRxTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run a network once.
+     * \param analytical whether the PHYs use the analytical reception mode
+     * \param distance distance between the PAN coordinator and the devices, in meters
+     * \param collide whether the devices transmit in the same timeslot
+     * \param nDevices number of devices besides the PAN coordinator
+     */
+    void RunNetwork(bool analytical, double distance, bool collide, uint32_t nDevices);
+
+    /**
+     * \brief Count a PhyRxBegin event of the PAN coordinator.
+     * \param p the packet
+     */
+    void PhyRxBeginTrace(Ptr<const Packet> p);
+
+    /**
+     * \brief Count a PhyPacketCollision event of the PAN coordinator.
+     * \param p the packet
+     */
+    void PhyRxFailTrace(Ptr<const Packet> p);
+
+    uint32_t m_rxBegin; //!< Number of receptions started by the PAN coordinator
+    uint32_t m_rxFail;  //!< Number of receptions failed by the PAN coordinator
+};
+
+LrWpanAnalyticalRxTestCase::LrWpanAnalyticalRxTestCase()
+    : TestCase("Lrwpan: analytical reception"),
+      m_rxBegin(0),
+      m_rxFail(0)
+{
+}
+
+void
+LrWpanAnalyticalRxTestCase::PhyRxBeginTrace(Ptr<const Packet> p)
+{
+    m_rxBegin++;
+}
+
+void
+LrWpanAnalyticalRxTestCase::PhyRxFailTrace(Ptr<const Packet> p)
+{
+    m_rxFail++;
+}
+
+void
+LrWpanAnalyticalRxTestCase::RunNetwork(bool analytical,
+                                           double distance,
+                                           bool collide,
+                                           uint32_t nDevices)
+{
+    m_rxBegin = 0;
+    m_rxFail = 0;
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    Config::SetDefault("ns3::LrWpanPhy::AnalyticalRx", BooleanValue(analytical));
+
+    NodeContainer nodes;
+    nodes.Create(1 + nDevices);
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = helper.Install(nodes);
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        Ptr<ConstantPositionMobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(Vector(i ? distance : 0, i ? i : 0, 0));
+        nodes.Get(i)->AggregateObject(mob);
+    }
+    Ptr<LrWpanPhy> phy = devs.Get(0)->GetObject<LrWpanTschNetDevice>()->GetPhy();
+    phy->TraceConnectWithoutContext(
+        "PhyRxBegin",
+        MakeCallback(&LrWpanAnalyticalRxTestCase::PhyRxBeginTrace, this));
+    phy->TraceConnectWithoutContext(
+        "PhyPacketCollision",
+        MakeCallback(&LrWpanAnalyticalRxTestCase::PhyRxFailTrace, this));
+
+    helper.AssociateToPan(devs, 0);
+    if (collide)
+    {
+        helper.AddSlotframe(devs, 0, 2);
+        AddLinkParams params;
+        params.slotframeHandle = 0;
+        params.channelOffset = 0;
+        params.linkHandle = 0;
+        params.timeslot = 0;
+        helper.AddAdvLink(devs, 0, params);
+        for (uint32_t i = 1; i < devs.GetN(); i++)
+        {
+            params.linkHandle = i;
+            params.timeslot = 1;
+            helper.AddLink(devs, i, 0, params, false);
+        }
+    }
+    else
+    {
+        helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+    }
+    helper.AssignStreams(devs, 0);
+
+    helper.EnableTsch(devs, 0, 20);
+    for (uint32_t i = 1; i < devs.GetN(); i++)
+    {
+        helper.GenerateTraffic(devs.Get(i), devs.Get(0)->GetAddress(), 20, 1, 18, 0.05);
+    }
+
+    Simulator::Stop(Seconds(20));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    Config::Reset();
+}
+
+void
+LrWpanAnalyticalRxTestCase::DoRun()
+{
+    // Frames lost to noise: the delivery ratios must agree.
+    RunNetwork(false, 110, false, 1);
+    double fullPdr = 1.0 - static_cast<double>(m_rxFail) / m_rxBegin;
+    RunNetwork(true, 110, false, 1);
+    double analyticalPdr = 1.0 - static_cast<double>(m_rxFail) / m_rxBegin;
+
+    NS_TEST_EXPECT_MSG_GT(fullPdr, 0.2, "Too many frames lost to test the delivery ratio");
+    NS_TEST_EXPECT_MSG_LT(fullPdr, 0.9, "Too few frames lost to test the delivery ratio");
+    NS_TEST_EXPECT_MSG_EQ_TOL(analyticalPdr, fullPdr, 0.05, "Different delivery ratios");
+
+    // Frames lost to collisions: the collisions must be the same.
+    RunNetwork(false, 10, true, 2);
+    uint32_t rxBegin = m_rxBegin;
+    uint32_t rxFail = m_rxFail;
+    RunNetwork(true, 10, true, 2);
+
+    NS_TEST_EXPECT_MSG_GT(rxFail, 0, "No collision");
+    NS_TEST_EXPECT_MSG_EQ(m_rxBegin, rxBegin, "Different receptions");
+    NS_TEST_EXPECT_MSG_EQ(m_rxFail, rxFail, "Different collisions");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan analytical reception TestSuite
+ */
+class LrWpanAnalyticalRxTestSuite : public TestSuite
+{
+  public:
+    LrWpanAnalyticalRxTestSuite();
+};
+
+LrWpanAnalyticalRxTestSuite::LrWpanAnalyticalRxTestSuite()
+    : TestSuite("lr-wpan-analytical-rx", Type::UNIT)
+{
+    AddTestCase(new LrWpanAnalyticalRxTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanAnalyticalRxTestSuite
+    g_lrWpanAnalyticalRxTestSuite; //!< Static variable for test initialization
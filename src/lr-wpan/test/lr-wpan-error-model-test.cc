@@ -17,6 +17,7 @@
  * Author: Tom Henderson <thomas.r.henderson@boeing.com>
  */
 #include "ns3/rng-seed-manager.h"
+#include <ns3/boolean.h>
 #include <ns3/callback.h>
 #include <ns3/constant-position-mobility-model.h>
 #include <ns3/log.h>
@@ -86,6 +87,24 @@ class LrWpanErrorModelTestCase : public TestCase
     void DoRun() override;
 };
 
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan tabulated error model test
+ *
+ * Checks the BER of the tabulated error model against the values of the
+ * exact model test, and its chunk success rates against the exact model.
+ */
+class LrWpanTabulatedErrorModelTestCase : public TestCase
+{
+  public:
+    LrWpanTabulatedErrorModelTestCase();
+
+  private:
+    void DoRun() override;
+};
+
 LrWpanErrorDistanceTestCase::LrWpanErrorDistanceTestCase()
     : TestCase("Test the 802.15.4 error model vs distance"),
       m_received(0)
@@ -195,6 +214,59 @@ LrWpanErrorModelTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ_TOL(ber, 0.175, 0.001, "Model fails for SNR = " << snr);
 }
 
+// ==============================================================================
+LrWpanTabulatedErrorModelTestCase::LrWpanTabulatedErrorModelTestCase()
+    : TestCase("Test the tabulated 802.15.4 error model")
+{
+}
+
+void
+LrWpanTabulatedErrorModelTestCase::DoRun()
+{
+    Ptr<LrWpanErrorModel> exact = CreateObject<LrWpanErrorModel>();
+    Ptr<LrWpanErrorModel> model =
+        CreateObjectWithAttributes<LrWpanErrorModel>("Tabulated", BooleanValue(true));
+
+    NS_TEST_ASSERT_MSG_EQ(exact->GetTableError(), 0, "The exact model has a table");
+    NS_TEST_ASSERT_MSG_GT(model->GetTableError(), 0, "The table error was not measured");
+    NS_TEST_ASSERT_MSG_LT(model->GetTableError(), 1e-3, "The table error exceeds its bound");
+
+    // The values of the exact model test
+    double snr = 5;
+    double ber = 1.0 - model->GetChunkSuccessRate(pow(10.0, snr / 10.0), 1);
+    NS_TEST_ASSERT_MSG_EQ_TOL(ber, 7.38e-14, 0.01e-14, "Model fails for SNR = " << snr);
+    snr = 2;
+    ber = 1.0 - model->GetChunkSuccessRate(pow(10.0, snr / 10.0), 1);
+    NS_TEST_ASSERT_MSG_EQ_TOL(ber, 5.13e-7, 0.01e-7, "Model fails for SNR = " << snr);
+    snr = -1;
+    ber = 1.0 - model->GetChunkSuccessRate(pow(10.0, snr / 10.0), 1);
+    NS_TEST_ASSERT_MSG_EQ_TOL(ber, 0.00114, 0.00001, "Model fails for SNR = " << snr);
+    snr = -4;
+    ber = 1.0 - model->GetChunkSuccessRate(pow(10.0, snr / 10.0), 1);
+    NS_TEST_ASSERT_MSG_EQ_TOL(ber, 0.0391, 0.0001, "Model fails for SNR = " << snr);
+    snr = -7;
+    ber = 1.0 - model->GetChunkSuccessRate(pow(10.0, snr / 10.0), 1);
+    NS_TEST_ASSERT_MSG_EQ_TOL(ber, 0.175, 0.001, "Model fails for SNR = " << snr);
+
+    // The chunk error rate is within the relative BER error of the table
+    for (uint32_t nbits : {1, 8, 1016})
+    {
+        for (snr = -20; snr <= 15; snr += 0.37)
+        {
+            double linear = pow(10.0, snr / 10.0);
+            double exactError = 1.0 - exact->GetChunkSuccessRate(linear, nbits);
+            double error = 1.0 - model->GetChunkSuccessRate(linear, nbits);
+            if (exactError > 1e-10)
+            {
+                NS_TEST_EXPECT_MSG_EQ_TOL(error,
+                                          exactError,
+                                          exactError * 1e-3,
+                                          "Model fails for SNR = " << snr << ", bits = " << nbits);
+            }
+        }
+    }
+}
+
 /**
  * \ingroup lr-wpan-test
  * \ingroup tests
@@ -216,3 +288,24 @@ LrWpanErrorModelTestSuite::LrWpanErrorModelTestSuite()
 
 static LrWpanErrorModelTestSuite
     g_lrWpanErrorModelTestSuite; //!< Static variable for test initialization
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan tabulated error model TestSuite
+ */
+class LrWpanTabulatedErrorModelTestSuite : public TestSuite
+{
+  public:
+    LrWpanTabulatedErrorModelTestSuite();
+};
+
+LrWpanTabulatedErrorModelTestSuite::LrWpanTabulatedErrorModelTestSuite()
+    : TestSuite("lr-wpan-error-model-tabulated", Type::UNIT)
+{
+    AddTestCase(new LrWpanTabulatedErrorModelTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanTabulatedErrorModelTestSuite
+    g_lrWpanTabulatedErrorModelTestSuite; //!< Static variable for test initialization
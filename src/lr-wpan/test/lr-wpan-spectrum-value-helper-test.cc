@@ -16,8 +16,13 @@
  *
  * Author:  Tom Henderson <thomas.r.henderson@boeing.com>
  */
+#include <ns3/half-duplex-ideal-phy.h>
 #include <ns3/log.h>
+#include <ns3/lr-wpan-phy.h>
 #include <ns3/lr-wpan-spectrum-value-helper.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-model.h>
 #include <ns3/spectrum-value.h>
 #include <ns3/test.h>
 
@@ -73,6 +78,144 @@ LrWpanSpectrumValueHelperTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan compact SpectrumValue test
+ *
+ * Checks that the PSDs created over the bands of their channel only give
+ * the same powers as the PSDs created over the whole 2.4 GHz band.
+ */
+class LrWpanCompactSpectrumValueTestCase : public TestCase
+{
+  public:
+    LrWpanCompactSpectrumValueTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanCompactSpectrumValueTestCase::LrWpanCompactSpectrumValueTestCase()
+    : TestCase("Test the 802.15.4 compact SpectrumValue")
+{
+}
+
+void
+LrWpanCompactSpectrumValueTestCase::DoRun()
+{
+    LrWpanSpectrumValueHelper fullHelper;
+    LrWpanSpectrumValueHelper compactHelper;
+    compactHelper.SetCompactPsd(true);
+    for (uint32_t chan = 11; chan <= 26; chan++)
+    {
+        Ptr<SpectrumValue> full = fullHelper.CreateTxPowerSpectralDensity(0, chan);
+        Ptr<SpectrumValue> fullNoise = fullHelper.CreateNoisePowerSpectralDensity(chan);
+        Ptr<SpectrumValue> compact = compactHelper.CreateTxPowerSpectralDensity(0, chan);
+        Ptr<SpectrumValue> compactNoise = compactHelper.CreateNoisePowerSpectralDensity(chan);
+
+        NS_TEST_EXPECT_MSG_EQ(compact->GetSpectrumModel()->GetNumBands(), 5, "Not compact");
+        NS_TEST_EXPECT_MSG_EQ(compact->GetSpectrumModel(),
+                              LrWpanSpectrumValueHelper::GetSpectrumModel(chan, true),
+                              "Wrong spectrum model for channel " << chan);
+        NS_TEST_EXPECT_MSG_EQ(full->GetSpectrumModel(),
+                              LrWpanSpectrumValueHelper::GetSpectrumModel(chan, false),
+                              "Wrong spectrum model for channel " << chan);
+        NS_TEST_EXPECT_MSG_EQ_TOL(compact->ConstBandsBegin()[2].fc,
+                                  2405e6 + 5e6 * (chan - 11),
+                                  1,
+                                  "Wrong center frequency for channel " << chan);
+        NS_TEST_EXPECT_MSG_EQ(LrWpanSpectrumValueHelper::TotalAvgPower(compact, chan),
+                              LrWpanSpectrumValueHelper::TotalAvgPower(full, chan),
+                              "Different power for channel " << chan);
+        NS_TEST_EXPECT_MSG_EQ(LrWpanSpectrumValueHelper::TotalAvgPower(compactNoise, chan),
+                              LrWpanSpectrumValueHelper::TotalAvgPower(fullNoise, chan),
+                              "Different noise for channel " << chan);
+
+        uint32_t other = chan == 26 ? 11 : chan + 1;
+        NS_TEST_EXPECT_MSG_EQ(LrWpanSpectrumValueHelper::TotalAvgPower(compact, other),
+                              0.0,
+                              "Power of channel " << chan << " in channel " << other);
+        NS_TEST_EXPECT_MSG_EQ(LrWpanSpectrumValueHelper::TotalAvgPower(full, other),
+                              0.0,
+                              "Power of channel " << chan << " in channel " << other);
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan PHY compact PSD test
+ *
+ * Checks that a LrWpanPhy creates compact PSDs on the channels carrying
+ * LrWpan signals alone, and PSDs over the whole 2.4 GHz band on a channel
+ * another kind of PHY is attached to.
+ */
+class LrWpanPhyCompactPsdTestCase : public TestCase
+{
+  public:
+    LrWpanPhyCompactPsdTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Switch a PHY to a channel.
+     * \param phy the PHY
+     * \param channel the channel number per IEEE802.15.4
+     */
+    void SetChannel(Ptr<LrWpanPhy> phy, uint8_t channel);
+};
+
+LrWpanPhyCompactPsdTestCase::LrWpanPhyCompactPsdTestCase()
+    : TestCase("Test the compact PSDs of the 802.15.4 PHY")
+{
+}
+
+void
+LrWpanPhyCompactPsdTestCase::SetChannel(Ptr<LrWpanPhy> phy, uint8_t channel)
+{
+    Ptr<PhyPibAttributes> attributes = Create<PhyPibAttributes>();
+    attributes->phyCurrentChannel = channel;
+    phy->PlmeSetAttributeRequest(phyCurrentChannel, attributes);
+}
+
+void
+LrWpanPhyCompactPsdTestCase::DoRun()
+{
+    // The PHYs share the spectrum channels created by the last of them.
+    Ptr<LrWpanPhy> phy = CreateObject<LrWpanPhy>();
+    Ptr<LrWpanPhy> peer = CreateObject<LrWpanPhy>();
+
+    SetChannel(phy, 11);
+    SetChannel(peer, 12);
+    NS_TEST_EXPECT_MSG_EQ(phy->GetRxSpectrumModel(),
+                          LrWpanSpectrumValueHelper::GetSpectrumModel(11, true),
+                          "The PSDs of a LrWpan-only channel are not compact");
+
+    Ptr<HalfDuplexIdealPhy> other = CreateObject<HalfDuplexIdealPhy>();
+    peer->GetChannel()->AddRx(other);
+
+    SetChannel(phy, 12);
+    NS_TEST_EXPECT_MSG_EQ(phy->GetRxSpectrumModel(),
+                          LrWpanSpectrumValueHelper::GetSpectrumModel(12, false),
+                          "The PSDs of a shared channel are compact");
+    NS_TEST_EXPECT_MSG_EQ(phy->GetNoisePowerSpectralDensity()->GetSpectrumModel(),
+                          LrWpanSpectrumValueHelper::GetSpectrumModel(12, false),
+                          "The noise PSD of a shared channel is compact");
+
+    SetChannel(phy, 11);
+    NS_TEST_EXPECT_MSG_EQ(phy->GetRxSpectrumModel(),
+                          LrWpanSpectrumValueHelper::GetSpectrumModel(11, true),
+                          "The PSDs are not compact again on a LrWpan-only channel");
+
+    phy->Dispose();
+    peer->Dispose();
+    other->Dispose();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup lr-wpan-test
  * \ingroup tests
@@ -89,6 +232,8 @@ LrWpanSpectrumValueHelperTestSuite::LrWpanSpectrumValueHelperTestSuite()
     : TestSuite("lr-wpan-spectrum-value-helper", Type::UNIT)
 {
     AddTestCase(new LrWpanSpectrumValueHelperTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanCompactSpectrumValueTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanPhyCompactPsdTestCase, TestCase::Duration::QUICK);
 }
 
 static LrWpanSpectrumValueHelperTestSuite
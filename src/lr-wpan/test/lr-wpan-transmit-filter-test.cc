@@ -0,0 +1,182 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/core-module.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/simulator.h>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-transmit-filter-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan transmit filter test
+ *
+ * Runs a TSCH star network with a device out of range of the others, with
+ * and without receiver culling, and checks that the timeslot outcomes are the
+ * same while the signals of the far device are not delivered.
+ */
+class LrWpanTransmitFilterTestCase : public TestCase
+{
+  public:
+    LrWpanTransmitFilterTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the network once.
+     * \param culling whether the receivers are culled
+     */
+    void RunNetwork(bool culling);
+
+    /**
+     * \brief Count a MacTxDataRxAck event.
+     * \param info the channel and the index in the hopping sequence of the
+     * timeslot of the acknowledged transmission
+     */
+    void TxDataRxAckTrace(std::pair<uint8_t, uint32_t> info);
+
+    /**
+     * \brief Count a PhyRxBegin event.
+     * \param p the packet
+     */
+    void PhyRxBeginTrace(Ptr<const Packet> p);
+
+    uint32_t m_txDataRxAck;      //!< Number of acknowledged transmissions
+    uint32_t m_rxBegin;          //!< Number of receptions started
+    uint64_t m_events;           //!< Number of simulator events of the last run
+    uint64_t m_delivered;        //!< Number of signals delivered by the filter
+    uint64_t m_belowNoiseFloor;  //!< Number of signals culled by the filter
+};
+
+LrWpanTransmitFilterTestCase::LrWpanTransmitFilterTestCase()
+    : TestCase("Lrwpan: receiver culling by the transmit filter"),
+      m_txDataRxAck(0),
+      m_rxBegin(0),
+      m_events(0),
+      m_delivered(0),
+      m_belowNoiseFloor(0)
+{
+}
+
+void
+LrWpanTransmitFilterTestCase::TxDataRxAckTrace(std::pair<uint8_t, uint32_t> info)
+{
+    m_txDataRxAck++;
+}
+
+void
+LrWpanTransmitFilterTestCase::PhyRxBeginTrace(Ptr<const Packet> p)
+{
+    m_rxBegin++;
+}
+
+void
+LrWpanTransmitFilterTestCase::RunNetwork(bool culling)
+{
+    m_txDataRxAck = 0;
+    m_rxBegin = 0;
+
+    NodeContainer nodes;
+    nodes.Create(4);
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = helper.Install(nodes);
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        // The last device is about 137 dB away from the others.
+        Ptr<ConstantPositionMobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(Vector(i < 3 ? 10 * i : 1000, 0, 0));
+        nodes.Get(i)->AggregateObject(mob);
+
+        Ptr<LrWpanTschNetDevice> dev = devs.Get(i)->GetObject<LrWpanTschNetDevice>();
+        dev->GetNMac()->TraceConnectWithoutContext(
+            "MacTxDataRxAck",
+            MakeCallback(&LrWpanTransmitFilterTestCase::TxDataRxAckTrace, this));
+        dev->GetPhy()->TraceConnectWithoutContext(
+            "PhyRxBegin",
+            MakeCallback(&LrWpanTransmitFilterTestCase::PhyRxBeginTrace, this));
+    }
+    helper.AssociateToPan(devs, 0);
+    helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+
+    Ptr<LrWpanTransmitFilter> filter;
+    if (culling)
+    {
+        filter = helper.EnableReceiverCulling(10);
+    }
+
+    helper.EnableTsch(devs, 0, 10);
+    for (uint32_t i = 1; i < devs.GetN(); i++)
+    {
+        helper.GenerateTraffic(devs.Get(i), devs.Get(0)->GetAddress(), 20, 1.01 * i, 2, 0.1);
+    }
+
+    Simulator::Stop(Seconds(6));
+    Simulator::Run();
+    m_events = Simulator::GetEventCount();
+    if (filter)
+    {
+        m_delivered = filter->GetDeliveredCount();
+        m_belowNoiseFloor = filter->GetBelowNoiseFloorCount();
+    }
+    Simulator::Destroy();
+}
+
+void
+LrWpanTransmitFilterTestCase::DoRun()
+{
+    RunNetwork(false);
+    uint32_t txDataRxAck = m_txDataRxAck;
+    uint32_t rxBegin = m_rxBegin;
+    uint64_t events = m_events;
+
+    RunNetwork(true);
+
+    NS_TEST_EXPECT_MSG_GT(txDataRxAck, 0, "No packet was acknowledged");
+    NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck, txDataRxAck, "Different acknowledged transmissions");
+    NS_TEST_EXPECT_MSG_EQ(m_rxBegin, rxBegin, "Different receptions");
+    NS_TEST_EXPECT_MSG_GT(m_delivered, 0, "No signal was delivered");
+    NS_TEST_EXPECT_MSG_GT(m_belowNoiseFloor, 0, "No signal was culled");
+    NS_TEST_EXPECT_MSG_LT(m_events, events, "The culling did not save events");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan transmit filter TestSuite
+ */
+class LrWpanTransmitFilterTestSuite : public TestSuite
+{
+  public:
+    LrWpanTransmitFilterTestSuite();
+};
+
+LrWpanTransmitFilterTestSuite::LrWpanTransmitFilterTestSuite()
+    : TestSuite("lr-wpan-transmit-filter", Type::UNIT)
+{
+    AddTestCase(new LrWpanTransmitFilterTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanTransmitFilterTestSuite
+    g_lrWpanTransmitFilterTestSuite; //!< Static variable for test initialization
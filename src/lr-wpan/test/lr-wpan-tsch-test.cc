@@ -0,0 +1,2142 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/core-module.h>
+#include <ns3/log.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/multithreaded-simulator-impl.h>
+#include <ns3/simulator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::lrwpan;
+
+NS_LOG_COMPONENT_DEFINE("lr-wpan-tsch-test");
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Install TSCH devices on new nodes at fixed positions and associate
+ * them to a PAN.
+ *
+ * \param helper the helper installing the devices
+ * \param positions the positions of the nodes, the PAN coordinator first
+ * \param panId the PAN of the devices
+ * \return the devices
+ */
+static NetDeviceContainer
+InstallTschPan(LrWpanTschHelper& helper, const std::vector<Vector>& positions, uint16_t panId = 0)
+{
+    NodeContainer nodes;
+    nodes.Create(positions.size());
+    NetDeviceContainer devs = helper.Install(nodes);
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        Ptr<ConstantPositionMobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(positions[i]);
+        nodes.Get(i)->AggregateObject(mob);
+    }
+    helper.AssociateToPan(devs, panId);
+    return devs;
+}
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Get positions 10 m apart along the x axis.
+ *
+ * \param n the number of positions
+ * \param x the x coordinate of the first position
+ * \return the positions
+ */
+static std::vector<Vector>
+TschRow(uint32_t n, double x = 0)
+{
+    std::vector<Vector> positions;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        positions.emplace_back(x + 10 * i, 0, 0);
+    }
+    return positions;
+}
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Get the TSCH MAC of a device.
+ *
+ * \param devs the devices
+ * \param i the index of the device
+ * \return the MAC
+ */
+static Ptr<LrWpanTschMac>
+GetTschMac(const NetDeviceContainer& devs, uint32_t i)
+{
+    return devs.Get(i)->GetObject<LrWpanTschNetDevice>()->GetNMac();
+}
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Connect a callback to a trace source of the MAC of every device.
+ *
+ * \param devs the devices
+ * \param name the name of the trace source
+ * \param cb the callback
+ */
+static void
+ConnectTschMacs(const NetDeviceContainer& devs, const std::string& name, const CallbackBase& cb)
+{
+    for (uint32_t i = 0; i < devs.GetN(); i++)
+    {
+        GetTschMac(devs, i)->TraceConnectWithoutContext(name, cb);
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Count a MacTxDataRxAck event.
+ *
+ * \param count the number of acknowledged transmissions
+ * \param info the channel and the index in the hopping sequence of the
+ * timeslot of the acknowledged transmission
+ */
+static void
+CountTxDataRxAck(uint32_t* count, std::pair<uint8_t, uint32_t> info)
+{
+    (*count)++;
+}
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Count the acknowledged transmissions of the MAC of every device.
+ *
+ * \param devs the devices
+ * \param count the number of acknowledged transmissions
+ */
+static void
+CountTschAcks(const NetDeviceContainer& devs, uint32_t* count)
+{
+    ConnectTschMacs(devs, "MacTxDataRxAck", MakeBoundCallback(&CountTxDataRxAck, count));
+}
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Send 20 byte packets from every device to the PAN coordinator.
+ *
+ * \param helper the helper of the devices
+ * \param devs the devices, the PAN coordinator first
+ * \param start the start of the traffic, in seconds, of every device, or of
+ * the first one if staggered
+ * \param duration the duration of the traffic, in seconds
+ * \param interval the interval between the packets, in seconds
+ * \param staggered whether the device i starts at i times start
+ */
+static void
+GenerateTschTraffic(LrWpanTschHelper& helper,
+                    const NetDeviceContainer& devs,
+                    double start,
+                    double duration,
+                    double interval,
+                    bool staggered = false)
+{
+    for (uint32_t i = 1; i < devs.GetN(); i++)
+    {
+        helper.GenerateTraffic(devs.Get(i),
+                               devs.Get(0)->GetAddress(),
+                               20,
+                               staggered ? start * i : start,
+                               duration,
+                               interval);
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ *
+ * \brief Run the simulation, then destroy it.
+ *
+ * \param stop the end of the simulation
+ * \param collect called before the simulation is destroyed, if any
+ * \return the number of events executed
+ */
+static uint64_t
+RunTsch(Time stop, const std::function<void()>& collect = nullptr)
+{
+    Simulator::Stop(stop);
+    Simulator::Run();
+    uint64_t events = Simulator::GetEventCount();
+    if (collect)
+    {
+        collect();
+    }
+    Simulator::Destroy();
+    return events;
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH link table test
+ *
+ * Adds, deletes and modifies links on a TSCH MAC and checks that every
+ * timeslot of the slotframe is dispatched to the right link: transmit
+ * links with an empty queue report MacEmptyBuffer, unassigned timeslots
+ * report MacSleep.
+ */
+class LrWpanTschLinkTableTestCase : public TestCase
+{
+  public:
+    LrWpanTschLinkTableTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Record the timeslot of a MacSleep event.
+     * \param value trace value (unused)
+     */
+    void SleepTrace(uint32_t value);
+
+    /**
+     * \brief Record the timeslot of a MacEmptyBuffer event.
+     * \param value trace value (unused)
+     */
+    void EmptyBufferTrace(uint32_t value);
+
+    /**
+     * \brief Get the timeslot number of the current time.
+     * \return the timeslot offset within the slotframe
+     */
+    uint16_t CurrentTimeslot() const;
+
+    Time m_start;                           //!< Time the TSCH mode is enabled (on install)
+    uint16_t m_size;                        //!< Slotframe size
+    std::vector<uint16_t> m_sleepSlots;     //!< Timeslots reported as MacSleep
+    std::vector<uint16_t> m_emptyBufSlots;  //!< Timeslots reported as MacEmptyBuffer
+};
+
+LrWpanTschLinkTableTestCase::LrWpanTschLinkTableTestCase()
+    : TestCase("Lrwpan: TSCH link table add, delete and modify"),
+      m_start(Seconds(0)),
+      m_size(5)
+{
+}
+
+uint16_t
+LrWpanTschLinkTableTestCase::CurrentTimeslot() const
+{
+    int64_t asn = (Simulator::Now() - m_start).GetMicroSeconds() / 10000;
+    return asn % m_size;
+}
+
+void
+LrWpanTschLinkTableTestCase::SleepTrace(uint32_t value)
+{
+    m_sleepSlots.push_back(CurrentTimeslot());
+}
+
+void
+LrWpanTschLinkTableTestCase::EmptyBufferTrace(uint32_t value)
+{
+    m_emptyBufSlots.push_back(CurrentTimeslot());
+}
+
+void
+LrWpanTschLinkTableTestCase::DoRun()
+{
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(2));
+    helper.AddSlotframe(devs, 0, m_size);
+
+    AddLinkParams params;
+    params.slotframeHandle = 0;
+    params.channelOffset = 0;
+
+    // Two links sharing timeslot 1, one on timeslot 2 and one on timeslot 3.
+    params.linkHandle = 0;
+    params.timeslot = 1;
+    helper.AddLink(devs, 0, 1, params);
+    params.linkHandle = 1;
+    params.timeslot = 1;
+    helper.AddLink(devs, 0, 1, params);
+    params.linkHandle = 2;
+    params.timeslot = 2;
+    helper.AddLink(devs, 0, 1, params);
+    params.linkHandle = 3;
+    params.timeslot = 3;
+    helper.AddLink(devs, 0, 1, params);
+
+    // Drop timeslot 2 and move the link of timeslot 3 to timeslot 4.
+    params.linkHandle = 2;
+    params.timeslot = 2;
+    helper.DeleteLink(devs, 0, 1, params, false);
+    params.linkHandle = 3;
+    params.timeslot = 4;
+    helper.ModifyLink(devs, 0, 1, params, false);
+
+    Ptr<LrWpanTschMac> mac = GetTschMac(devs, 0);
+    mac->TraceConnectWithoutContext(
+        "MacSleep",
+        MakeCallback(&LrWpanTschLinkTableTestCase::SleepTrace, this));
+    mac->TraceConnectWithoutContext(
+        "MacEmptyBuffer",
+        MakeCallback(&LrWpanTschLinkTableTestCase::EmptyBufferTrace, this));
+
+    helper.EnableTsch(devs, m_start.GetSeconds(), 10);
+
+    // Run two full slotframes.
+    RunTsch(m_start + MicroSeconds(10000 * 2 * m_size - 5000));
+
+    std::vector<uint16_t> expectedSleep{0, 2, 3, 0, 2, 3};
+    std::vector<uint16_t> expectedEmptyBuf{1, 4, 1, 4};
+
+    NS_TEST_ASSERT_MSG_EQ(m_sleepSlots.size(),
+                          expectedSleep.size(),
+                          "Unexpected number of sleeping timeslots");
+    for (std::size_t i = 0; i < m_sleepSlots.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_sleepSlots[i], expectedSleep[i], "Wrong sleeping timeslot");
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(m_emptyBufSlots.size(),
+                          expectedEmptyBuf.size(),
+                          "Unexpected number of transmit timeslots");
+    for (std::size_t i = 0; i < m_emptyBufSlots.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_emptyBufSlots[i],
+                              expectedEmptyBuf[i],
+                              "Wrong transmit timeslot");
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH idle timeslot skipping test
+ *
+ * Runs the same sparse schedule with and without the SkipIdleSlots
+ * attribute and checks that the per-timeslot traces report the same
+ * results, while the simulation uses fewer events.
+ */
+class LrWpanTschSkipIdleSlotsTestCase : public TestCase
+{
+  public:
+    LrWpanTschSkipIdleSlotsTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the schedule once.
+     * \param skipIdleSlots the value of the SkipIdleSlots attribute
+     * \return the number of simulator events executed
+     */
+    uint64_t RunSchedule(bool skipIdleSlots);
+
+    /**
+     * \brief Count a MacSleep event.
+     * \param value trace value (unused)
+     */
+    void SleepTrace(uint32_t value);
+
+    /**
+     * \brief Record the time of a MacEmptyBuffer event.
+     * \param value trace value (unused)
+     */
+    void EmptyBufferTrace(uint32_t value);
+
+    /**
+     * \brief Count a PassedOneHoppingSequenceTrace event.
+     * \param asn the ASN of the start of the hopping sequence period
+     */
+    void HoppingSequenceTrace(uint64_t asn);
+
+    uint32_t m_sleepCount;            //!< Number of MacSleep events
+    std::vector<Time> m_emptyBufTime; //!< Times of the MacEmptyBuffer events
+    std::vector<uint64_t> m_periods;  //!< ASNs of the hopping sequence periods
+};
+
+LrWpanTschSkipIdleSlotsTestCase::LrWpanTschSkipIdleSlotsTestCase()
+    : TestCase("Lrwpan: TSCH idle timeslot skipping"),
+      m_sleepCount(0)
+{
+}
+
+void
+LrWpanTschSkipIdleSlotsTestCase::SleepTrace(uint32_t value)
+{
+    m_sleepCount++;
+}
+
+void
+LrWpanTschSkipIdleSlotsTestCase::EmptyBufferTrace(uint32_t value)
+{
+    m_emptyBufTime.push_back(Simulator::Now());
+}
+
+void
+LrWpanTschSkipIdleSlotsTestCase::HoppingSequenceTrace(uint64_t asn)
+{
+    m_periods.push_back(asn);
+}
+
+uint64_t
+LrWpanTschSkipIdleSlotsTestCase::RunSchedule(bool skipIdleSlots)
+{
+    m_sleepCount = 0;
+    m_emptyBufTime.clear();
+    m_periods.clear();
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(2));
+    for (uint32_t i = 0; i < devs.GetN(); i++)
+    {
+        GetTschMac(devs, i)->SetAttribute("SkipIdleSlots", BooleanValue(skipIdleSlots));
+    }
+    helper.AddSlotframe(devs, 0, 101);
+
+    AddLinkParams params;
+    params.slotframeHandle = 0;
+    params.channelOffset = 0;
+    params.linkHandle = 0;
+    params.timeslot = 7;
+    helper.AddLink(devs, 0, 1, params);
+
+    Ptr<LrWpanTschMac> mac = GetTschMac(devs, 0);
+    mac->TraceConnectWithoutContext(
+        "MacSleep",
+        MakeCallback(&LrWpanTschSkipIdleSlotsTestCase::SleepTrace, this));
+    mac->TraceConnectWithoutContext(
+        "MacEmptyBuffer",
+        MakeCallback(&LrWpanTschSkipIdleSlotsTestCase::EmptyBufferTrace, this));
+    mac->TraceConnectWithoutContext(
+        "PassedOneHoppingSequenceTrace",
+        MakeCallback(&LrWpanTschSkipIdleSlotsTestCase::HoppingSequenceTrace, this));
+
+    helper.EnableTsch(devs, 0, 10);
+
+    // Add a second link while the TSCH mode is running.
+    params.linkHandle = 1;
+    params.timeslot = 60;
+    Simulator::Schedule(Seconds(2.005), [&helper, devs, params]() {
+        helper.AddLink(devs, 0, 1, params);
+    });
+
+    // The last timeslot processed is always an active one, flushing the skipped ones.
+    return RunTsch(MicroSeconds(10000 * (4 * 101 + 60) + 5000));
+}
+
+void
+LrWpanTschSkipIdleSlotsTestCase::DoRun()
+{
+    uint64_t events = RunSchedule(false);
+    uint32_t sleepCount = m_sleepCount;
+    std::vector<Time> emptyBufTime = m_emptyBufTime;
+    std::vector<uint64_t> periods = m_periods;
+
+    uint64_t skipEvents = RunSchedule(true);
+
+    NS_TEST_EXPECT_MSG_EQ(m_sleepCount, sleepCount, "Different number of sleeping timeslots");
+    NS_TEST_ASSERT_MSG_EQ(m_emptyBufTime.size(),
+                          emptyBufTime.size(),
+                          "Different number of transmit timeslots");
+    for (std::size_t i = 0; i < m_emptyBufTime.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_emptyBufTime[i], emptyBufTime[i], "Wrong transmit timeslot");
+    }
+    NS_TEST_EXPECT_MSG_EQ((m_periods == periods), true, "Different hopping sequence periods");
+    NS_TEST_EXPECT_MSG_LT(skipEvents * 4, events, "Idle timeslots were not skipped");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH shared slot clock test
+ *
+ * Runs a star network with traffic towards the PAN coordinator, with and
+ * without a TschSlotClock shared by the devices, and checks that the
+ * timeslot outcomes are the same, that the clock saves the timeslot start
+ * events, and that the frames are sent in the context of their node.
+ */
+class LrWpanTschSlotClockTestCase : public TestCase
+{
+  public:
+    LrWpanTschSlotClockTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the network once.
+     * \param slotClock whether the devices share a slot clock
+     */
+    void RunNetwork(bool slotClock);
+
+    /**
+     * \brief Count a MacEmptyBuffer event.
+     * \param value trace value (unused)
+     */
+    void EmptyBufferTrace(uint32_t value);
+
+    /**
+     * \brief Count a MacSleep event, and check its context.
+     * \param node the node of the MAC
+     * \param value trace value (unused)
+     */
+    void SleepTrace(uint32_t node, uint32_t value);
+
+    /**
+     * \brief Check the context of a MacTx event.
+     * \param node the node of the MAC
+     * \param p the packet
+     */
+    void TxTrace(uint32_t node, Ptr<const Packet> p);
+
+    uint32_t m_txDataRxAck;       //!< Number of acknowledged transmissions
+    uint32_t m_emptyBuf;          //!< Number of MacEmptyBuffer events
+    uint32_t m_sleep;             //!< Number of MacSleep events
+    uint32_t m_wrongContexts;     //!< Number of traces fired out of the context of their node
+    uint64_t m_events;            //!< Number of simulator events of the last run
+    uint64_t m_dispatches;        //!< Number of timeslots dispatched by the slot clock
+    uint64_t m_ticks;             //!< Number of events of the slot clock
+};
+
+LrWpanTschSlotClockTestCase::LrWpanTschSlotClockTestCase()
+    : TestCase("Lrwpan: TSCH shared slot clock"),
+      m_txDataRxAck(0),
+      m_emptyBuf(0),
+      m_sleep(0),
+      m_wrongContexts(0),
+      m_events(0),
+      m_dispatches(0),
+      m_ticks(0)
+{
+}
+
+void
+LrWpanTschSlotClockTestCase::EmptyBufferTrace(uint32_t value)
+{
+    m_emptyBuf++;
+}
+
+void
+LrWpanTschSlotClockTestCase::SleepTrace(uint32_t node, uint32_t value)
+{
+    m_sleep++;
+    if (Simulator::GetContext() != node)
+    {
+        m_wrongContexts++;
+    }
+}
+
+void
+LrWpanTschSlotClockTestCase::TxTrace(uint32_t node, Ptr<const Packet> p)
+{
+    if (Simulator::GetContext() != node)
+    {
+        m_wrongContexts++;
+    }
+}
+
+void
+LrWpanTschSlotClockTestCase::RunNetwork(bool slotClock)
+{
+    m_txDataRxAck = 0;
+    m_emptyBuf = 0;
+    m_sleep = 0;
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(4));
+    CountTschAcks(devs, &m_txDataRxAck);
+    ConnectTschMacs(devs,
+                    "MacEmptyBuffer",
+                    MakeCallback(&LrWpanTschSlotClockTestCase::EmptyBufferTrace, this));
+    for (uint32_t i = 0; i < devs.GetN(); i++)
+    {
+        uint32_t node = devs.Get(i)->GetNode()->GetId();
+        GetTschMac(devs, i)->TraceConnectWithoutContext(
+            "MacSleep",
+            MakeCallback(&LrWpanTschSlotClockTestCase::SleepTrace, this).Bind(node));
+        GetTschMac(devs, i)->TraceConnectWithoutContext(
+            "MacTx",
+            MakeCallback(&LrWpanTschSlotClockTestCase::TxTrace, this).Bind(node));
+    }
+    helper.ConfigureSlotframeAllToPan(devs, 4, false, false);
+
+    Ptr<TschSlotClock> clock;
+    if (slotClock)
+    {
+        clock = helper.InstallSlotClock(devs);
+    }
+
+    helper.EnableTsch(devs, 0, 10);
+    GenerateTschTraffic(helper, devs, 1.01, 2, 0.1, true);
+
+    // Stop in the middle of the first timeslot of a slotframe, which is active
+    // for all the devices, so that no skipped timeslot is left to flush.
+    m_events = RunTsch(MicroSeconds(10000 * 8 * 50 + 5000), [this, clock]() {
+        if (clock)
+        {
+            m_dispatches = clock->GetDispatchCount();
+            m_ticks = clock->GetTickCount();
+        }
+    });
+}
+
+void
+LrWpanTschSlotClockTestCase::DoRun()
+{
+    RunNetwork(false);
+    uint32_t txDataRxAck = m_txDataRxAck;
+    uint32_t emptyBuf = m_emptyBuf;
+    uint32_t sleep = m_sleep;
+    uint64_t events = m_events;
+
+    RunNetwork(true);
+
+    NS_TEST_EXPECT_MSG_GT(txDataRxAck, 0, "No packet was acknowledged");
+    NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck, txDataRxAck, "Different acknowledged transmissions");
+    NS_TEST_EXPECT_MSG_EQ(m_emptyBuf, emptyBuf, "Different number of empty transmit timeslots");
+    NS_TEST_EXPECT_MSG_EQ(m_sleep, sleep, "Different number of sleeping timeslots");
+    NS_TEST_EXPECT_MSG_LT(m_ticks, m_dispatches, "Timeslots were not shared by the MACs");
+    NS_TEST_EXPECT_MSG_EQ(m_wrongContexts, 0, "Traces fired out of the context of their node");
+    // Each MAC starts its timeslot in a single event instead of two, for one
+    // tick per timeslot.
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(m_events + m_dispatches - m_ticks,
+                                events,
+                                "The slot clock did not save events");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH per-neighbor transmit queue limit test
+ */
+class LrWpanTschTxQueueLimitTestCase : public TestCase
+{
+  public:
+    LrWpanTschTxQueueLimitTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Count a MacTxEnqueue event.
+     * \param p the packet
+     */
+    void EnqueueTrace(Ptr<const Packet> p);
+
+    /**
+     * \brief Count a MacTxDrop event.
+     * \param p the packet
+     */
+    void DropTrace(Ptr<const Packet> p);
+
+    uint32_t m_enqueued; //!< Number of queued packets
+    uint32_t m_dropped;  //!< Number of dropped packets
+};
+
+LrWpanTschTxQueueLimitTestCase::LrWpanTschTxQueueLimitTestCase()
+    : TestCase("Lrwpan: TSCH per-neighbor transmit queue limit"),
+      m_enqueued(0),
+      m_dropped(0)
+{
+}
+
+void
+LrWpanTschTxQueueLimitTestCase::EnqueueTrace(Ptr<const Packet> p)
+{
+    m_enqueued++;
+}
+
+void
+LrWpanTschTxQueueLimitTestCase::DropTrace(Ptr<const Packet> p)
+{
+    m_dropped++;
+}
+
+void
+LrWpanTschTxQueueLimitTestCase::DoRun()
+{
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(3));
+
+    Ptr<LrWpanTschMac> mac = GetTschMac(devs, 0);
+    mac->SetAttribute("MaxTxQueueSizePerNeighbor", UintegerValue(2));
+    mac->TraceConnectWithoutContext(
+        "MacTxEnqueue",
+        MakeCallback(&LrWpanTschTxQueueLimitTestCase::EnqueueTrace, this));
+    mac->TraceConnectWithoutContext(
+        "MacTxDrop",
+        MakeCallback(&LrWpanTschTxQueueLimitTestCase::DropTrace, this));
+
+    McpsDataRequestParams params;
+    params.m_dstAddrMode = SHORT_ADDR;
+    params.m_srcAddrMode = SHORT_ADDR;
+    params.m_dstPanId = 0;
+    params.m_ACK_TX = true;
+    params.m_GTSTX = false;
+    params.m_IndirectTx = false;
+    params.m_SecurityLevel = 0;
+
+    // Five packets to the first neighbor and one to the second one.
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        params.m_dstAddr = Mac16Address::ConvertFrom(devs.Get(1)->GetAddress());
+        mac->McpsDataRequest(params, Create<Packet>(20));
+    }
+    params.m_dstAddr = Mac16Address::ConvertFrom(devs.Get(2)->GetAddress());
+    mac->McpsDataRequest(params, Create<Packet>(20));
+
+    NS_TEST_EXPECT_MSG_EQ(m_enqueued, 3, "Wrong number of queued packets");
+    NS_TEST_EXPECT_MSG_EQ(m_dropped, 3, "Wrong number of dropped packets");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH transmit queue element reuse test
+ *
+ * Sends a packet every few slotframes and checks that the transmit queue
+ * elements are reused instead of being allocated for each packet.
+ */
+class LrWpanTschTxQueuePoolTestCase : public TestCase
+{
+  public:
+    LrWpanTschTxQueuePoolTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanTschTxQueuePoolTestCase::LrWpanTschTxQueuePoolTestCase()
+    : TestCase("Lrwpan: TSCH transmit queue element reuse")
+{
+}
+
+void
+LrWpanTschTxQueuePoolTestCase::DoRun()
+{
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(2));
+    helper.ConfigureSlotframeAllToPan(devs, 2, false, false);
+
+    helper.EnableTsch(devs, 0, 10);
+    GenerateTschTraffic(helper, devs, 1.001, 1.95, 0.1);
+
+    Ptr<LrWpanTschMac> mac = GetTschMac(devs, 1);
+    UintegerValue allocations;
+    UintegerValue requests;
+    UintegerValue linkQueues;
+    RunTsch(Seconds(4), [&]() {
+        mac->GetAttribute("TxQueueElementAllocations", allocations);
+        mac->GetAttribute("TxQueueElementRequests", requests);
+        mac->GetAttribute("TxLinkQueueAllocations", linkQueues);
+    });
+
+    NS_TEST_EXPECT_MSG_EQ(requests.Get(), 20, "Wrong number of queued packets");
+    NS_TEST_EXPECT_MSG_EQ(allocations.Get(), 1, "Transmit queue elements were not reused");
+    NS_TEST_EXPECT_MSG_EQ(linkQueues.Get(), 1, "Transmit link queues were not reused");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH channel hopping test
+ *
+ * Checks that the PHY of a device is on the channel of the hopping sequence
+ * for the channel offset of the link in the timeslots with a link, and stays
+ * on the previous channel in the timeslots without one, while links are
+ * added, modified and deleted during the simulation.
+ */
+class LrWpanTschChannelHoppingTestCase : public TestCase
+{
+  public:
+    LrWpanTschChannelHoppingTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Timeslot start callback of the device.
+     *
+     * \param asn the ASN of the timeslot
+     */
+    void TimeslotStart(uint64_t asn);
+
+    /**
+     * Check the channel of the PHY during a timeslot.
+     *
+     * \param asn the ASN of the timeslot
+     */
+    void CheckChannel(uint64_t asn);
+
+    /**
+     * Move the link of timeslot 1 to another channel offset and add a link
+     * with a channel offset beyond the sequence length in timeslot 2.
+     */
+    void ChangeLinks();
+
+    /**
+     * Delete the link of timeslot 2.
+     */
+    void DeleteLink();
+
+    /**
+     * Send a link request to a device.
+     *
+     * \param dev the device
+     * \param operation the operation
+     * \param handle the link handle
+     * \param timeslot the timeslot of the link
+     * \param channelOffset the channel offset of the link
+     * \param peer the other device of the link
+     */
+    void SetLink(Ptr<LrWpanTschNetDevice> dev,
+                 LrWpanMlmeSetLinkRequestOperation operation,
+                 uint16_t handle,
+                 uint16_t timeslot,
+                 uint16_t channelOffset,
+                 Ptr<LrWpanTschNetDevice> peer);
+
+    Ptr<LrWpanTschNetDevice> m_dev;  //!< The device checked
+    Ptr<LrWpanTschNetDevice> m_peer; //!< The other device
+    std::vector<uint8_t> m_channels; //!< The hopping sequence
+    std::vector<int> m_offsets;      //!< Channel offset of each timeslot, -1 without link
+    uint8_t m_lastChannel;           //!< Channel of the last timeslot with a link
+    uint32_t m_checks;               //!< Number of timeslots checked
+};
+
+LrWpanTschChannelHoppingTestCase::LrWpanTschChannelHoppingTestCase()
+    : TestCase("Lrwpan: TSCH channel hopping"),
+      m_lastChannel(0),
+      m_checks(0)
+{
+}
+
+void
+LrWpanTschChannelHoppingTestCase::TimeslotStart(uint64_t asn)
+{
+    // The link changes run before the timeslot is processed.
+    if (asn == 62)
+    {
+        Simulator::ScheduleNow(&LrWpanTschChannelHoppingTestCase::ChangeLinks, this);
+    }
+    else if (asn == 90)
+    {
+        Simulator::ScheduleNow(&LrWpanTschChannelHoppingTestCase::DeleteLink, this);
+    }
+    Simulator::Schedule(MilliSeconds(1),
+                        &LrWpanTschChannelHoppingTestCase::CheckChannel,
+                        this,
+                        asn);
+}
+
+void
+LrWpanTschChannelHoppingTestCase::CheckChannel(uint64_t asn)
+{
+    int offset = m_offsets[asn % m_offsets.size()];
+    if (offset >= 0)
+    {
+        m_lastChannel = m_channels[(asn + offset) % m_channels.size()];
+    }
+    else if (m_lastChannel == 0)
+    {
+        return;
+    }
+    NS_TEST_EXPECT_MSG_EQ((uint32_t)m_dev->GetPhy()->GetCurrentChannelNum(),
+                          (uint32_t)m_lastChannel,
+                          "Wrong channel at ASN " << asn);
+    m_checks++;
+}
+
+void
+LrWpanTschChannelHoppingTestCase::SetLink(Ptr<LrWpanTschNetDevice> dev,
+                                          LrWpanMlmeSetLinkRequestOperation operation,
+                                          uint16_t handle,
+                                          uint16_t timeslot,
+                                          uint16_t channelOffset,
+                                          Ptr<LrWpanTschNetDevice> peer)
+{
+    MlmeSetLinkRequestParams params;
+    params.Operation = operation;
+    params.linkHandle = handle;
+    params.slotframeHandle = 0;
+    params.Timeslot = timeslot;
+    params.ChannelOffset = channelOffset;
+    params.linkOptions.reset();
+    params.linkOptions.set(dev == m_dev ? 0 : 1, 1);
+    params.linkType = MlmeSetLinkRequestlinkType_NORMAL;
+    params.nodeAddr = Mac16Address::ConvertFrom(peer->GetAddress());
+    params.TxID = 0;
+    params.RxID = 0;
+    dev->GetNMac()->MlmeSetLinkRequest(params);
+}
+
+void
+LrWpanTschChannelHoppingTestCase::ChangeLinks()
+{
+    SetLink(m_dev, MlmeSetLinkRequestOperation_MODIFY_LINK, 1, 1, 2, m_peer);
+    SetLink(m_peer, MlmeSetLinkRequestOperation_MODIFY_LINK, 1, 1, 2, m_dev);
+    SetLink(m_dev, MlmeSetLinkRequestOperation_ADD_LINK, 2, 2, 7, m_peer);
+    m_offsets = {0, 2, 7};
+}
+
+void
+LrWpanTschChannelHoppingTestCase::DeleteLink()
+{
+    SetLink(m_dev, MlmeSetLinkRequestOperation_DELETE_LINK, 2, 2, 7, m_peer);
+    m_offsets = {0, 2, -1};
+}
+
+void
+LrWpanTschChannelHoppingTestCase::DoRun()
+{
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(2));
+    helper.ConfigureSlotframeAllToPan(devs, 1, false, false);
+
+    m_channels = {15, 11, 11, 20, 26};
+    for (uint32_t i = 0; i < devs.GetN(); i++)
+    {
+        GetTschMac(devs, i)->SetHoppingSequence(m_channels, 1);
+    }
+    // Timeslots 0 and 1 of the slotframe have a link, timeslot 2 is empty.
+    m_offsets = {0, 0, -1};
+    m_peer = devs.Get(0)->GetObject<LrWpanTschNetDevice>();
+    m_dev = devs.Get(1)->GetObject<LrWpanTschNetDevice>();
+    m_dev->GetNMac()->SetMacTimeSlotStartCallback(
+        MakeCallback(&LrWpanTschChannelHoppingTestCase::TimeslotStart, this));
+
+    helper.EnableTsch(devs, 0, 10);
+    RunTsch(Seconds(1.5));
+    m_dev = nullptr;
+    m_peer = nullptr;
+
+    NS_TEST_EXPECT_MSG_GT(m_checks, 120, "Too few timeslots checked");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH deferred MAC tasks test
+ *
+ * Sends acknowledged packets from two devices with the zero-delay MAC
+ * transitions run as micro-tasks, then as scheduler events, and checks that
+ * the MAC and PHY states of all the devices go through the same sequence,
+ * in the same order across the devices, while the micro-tasks avoid
+ * scheduler events.
+ */
+class LrWpanTschMicroTaskTestCase : public TestCase
+{
+  public:
+    LrWpanTschMicroTaskTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the network once.
+     * \param microTasks whether the MAC transitions run as micro-tasks
+     */
+    void RunNetwork(bool microTasks);
+
+    /**
+     * \brief Record a MAC state change.
+     * \param node the node of the MAC
+     * \param oldState the previous state
+     * \param newState the new state
+     */
+    void MacStateTrace(uint32_t node, TschMacState oldState, TschMacState newState);
+
+    /**
+     * \brief Record a transceiver state change.
+     * \param node the node of the PHY
+     * \param time the time of the change
+     * \param oldState the previous state
+     * \param newState the new state
+     */
+    void TrxStateTrace(uint32_t node, Time time, PhyEnumeration oldState, PhyEnumeration newState);
+
+    uint32_t m_txDataRxAck;             //!< Number of acknowledged transmissions
+    uint64_t m_avoided;                 //!< Scheduler events avoided by the last run
+    std::vector<std::string> m_changes; //!< State changes of the last run, in order
+};
+
+LrWpanTschMicroTaskTestCase::LrWpanTschMicroTaskTestCase()
+    : TestCase("Lrwpan: TSCH deferred MAC tasks"),
+      m_txDataRxAck(0),
+      m_avoided(0)
+{
+}
+
+void
+LrWpanTschMicroTaskTestCase::MacStateTrace(uint32_t node,
+                                           TschMacState oldState,
+                                           TschMacState newState)
+{
+    std::ostringstream change;
+    change << Simulator::Now().GetNanoSeconds() << " node " << node << " MAC " << oldState
+           << " -> " << newState;
+    m_changes.push_back(change.str());
+}
+
+void
+LrWpanTschMicroTaskTestCase::TrxStateTrace(uint32_t node,
+                                           Time time,
+                                           PhyEnumeration oldState,
+                                           PhyEnumeration newState)
+{
+    std::ostringstream change;
+    change << time.GetNanoSeconds() << " node " << node << " PHY " << oldState << " -> "
+           << newState;
+    m_changes.push_back(change.str());
+}
+
+void
+LrWpanTschMicroTaskTestCase::RunNetwork(bool microTasks)
+{
+    m_txDataRxAck = 0;
+    m_changes.clear();
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(3));
+    helper.ConfigureSlotframeAllToPan(devs, 2, false, false);
+    helper.AssignStreams(devs, 0);
+
+    Ptr<LrWpanTschMac> mac = GetTschMac(devs, 1);
+    CountTschAcks(devs, &m_txDataRxAck);
+    for (uint32_t i = 0; i < devs.GetN(); i++)
+    {
+        uint32_t node = devs.Get(i)->GetNode()->GetId();
+        Ptr<LrWpanTschMac> m = GetTschMac(devs, i);
+        m->SetAttribute("MicroTasks", BooleanValue(microTasks));
+        m->TraceConnectWithoutContext(
+            "MacStateValue",
+            MakeCallback(&LrWpanTschMicroTaskTestCase::MacStateTrace, this).Bind(node));
+        m->GetPhy()->TraceConnectWithoutContext(
+            "TrxState",
+            MakeCallback(&LrWpanTschMicroTaskTestCase::TrxStateTrace, this).Bind(node));
+    }
+
+    helper.EnableTsch(devs, 0, 10);
+    GenerateTschTraffic(helper, devs, 1.001, 0.95, 0.1);
+
+    UintegerValue avoided;
+    RunTsch(Seconds(4), [&]() { mac->GetAttribute("AvoidedSchedulerEvents", avoided); });
+    m_avoided = avoided.Get();
+}
+
+void
+LrWpanTschMicroTaskTestCase::DoRun()
+{
+    RunNetwork(false);
+    uint32_t txDataRxAck = m_txDataRxAck;
+    std::vector<std::string> changes = m_changes;
+    NS_TEST_EXPECT_MSG_EQ(m_avoided, 0, "Scheduler events avoided without micro-tasks");
+
+    RunNetwork(true);
+
+    NS_TEST_EXPECT_MSG_EQ(txDataRxAck, 20, "Wrong number of acknowledged packets");
+    NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck, txDataRxAck, "Different acknowledged transmissions");
+    NS_TEST_ASSERT_MSG_EQ(m_changes.size(), changes.size(), "Different number of state changes");
+    auto mismatch = std::mismatch(m_changes.begin(), m_changes.end(), changes.begin());
+    NS_TEST_EXPECT_MSG_EQ((mismatch.first == m_changes.end() ? "" : *mismatch.first),
+                          (mismatch.second == changes.end() ? "" : *mismatch.second),
+                          "Different sequence of state changes");
+    // Every timeslot defers at least its radio switch-off or MAC state change.
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(m_avoided, 300, "Too few scheduler events avoided");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH Q-learning agent pool test
+ *
+ * Runs two PANs with a Q-learning agent each, the second one stopping
+ * half-way, without agent pool, with an agent pool, and with an agent pool
+ * disposed of half-way, with and without a shared slot clock, and checks
+ * that the Q-tables of the agents and the channels of the acknowledged
+ * transmissions are the same while the pool updates both agents together.
+ */
+class LrWpanTschAgentPoolTestCase : public TestCase
+{
+  public:
+    LrWpanTschAgentPoolTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the network once.
+     * \param pool whether the agents are in a pool
+     * \param dispose whether the pool is disposed of half-way
+     * \param slotClock whether the devices share a slot clock
+     * \return the Q-tables of the agents
+     */
+    std::vector<std::vector<double>> RunNetwork(bool pool, bool dispose, bool slotClock);
+
+    /**
+     * \brief Record the channel of a MacTxDataRxAck event.
+     * \param info the channel and the index in the hopping sequence of the
+     * timeslot of the acknowledged transmission
+     */
+    void TxDataRxAck(std::pair<uint8_t, uint32_t> info);
+
+    std::vector<uint8_t> m_ackChannels; //!< Channels of the acknowledged transmissions
+    uint64_t m_batches; //!< Number of batched updates of the last run
+    uint64_t m_updates; //!< Number of agent updates of the last run
+};
+
+LrWpanTschAgentPoolTestCase::LrWpanTschAgentPoolTestCase()
+    : TestCase("Lrwpan: TSCH Q-learning agent pool"),
+      m_batches(0),
+      m_updates(0)
+{
+}
+
+std::vector<std::vector<double>>
+LrWpanTschAgentPoolTestCase::RunNetwork(bool pool, bool dispose, bool slotClock)
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    m_ackChannels.clear();
+
+    LrWpanTschHelper helper;
+    Ptr<AgentPool> agentPool = pool ? CreateObject<AgentPool>() : nullptr;
+    std::vector<Ptr<Agent>> agents;
+    NetDeviceContainer allDevs;
+    for (uint32_t pan = 0; pan < 2; pan++)
+    {
+        NetDeviceContainer devs = InstallTschPan(helper, TschRow(3, 1000 * pan), pan);
+        // A slotframe one timeslot longer than the hopping sequence: the
+        // hopping periods also start in the timeslots of the data links.
+        helper.ConfigureSlotframeAllToPan(devs, 1, false, false);
+        helper.AssignStreams(devs, 10 * pan);
+        ConnectTschMacs(devs,
+                        "MacTxDataRxAck",
+                        MakeCallback(&LrWpanTschAgentPoolTestCase::TxDataRxAck, this));
+
+        Ptr<Agent> agent = CreateObject<Agent>(devs);
+        agent->SetQAgentParams({0.1, 0.95, 0.1, 0.8, 1, -1});
+        agent->panId = pan;
+        agent->AssignStreams(100 + pan);
+        agent->DeployNewPolicy();
+        GetTschMac(devs, 0)->TraceConnectWithoutContext(
+            "PassedOneHoppingSequenceTrace",
+            MakeCallback(&Agent::OnePeriodHoppingSequencePassed, PeekPointer(agent)));
+        if (agentPool)
+        {
+            agentPool->Add(agent);
+        }
+        agents.push_back(agent);
+
+        // The second PAN stops half-way: its agent must leave the batches.
+        helper.EnableTsch(devs, 0, pan == 0 ? 10 : 3);
+        GenerateTschTraffic(helper, devs, 1.01, 4, 0.05, true);
+        allDevs.Add(devs);
+    }
+    if (slotClock)
+    {
+        helper.InstallSlotClock(allDevs);
+    }
+
+    if (agentPool && dispose)
+    {
+        Simulator::Schedule(Seconds(2.5), &AgentPool::Dispose, agentPool);
+    }
+
+    std::vector<std::vector<double>> qTables;
+    RunTsch(Seconds(5), [&]() {
+        m_batches = agentPool ? agentPool->GetBatchCount() : 0;
+        m_updates = agentPool ? agentPool->GetUpdateCount() : 0;
+        for (Ptr<Agent> agent : agents)
+        {
+            qTables.push_back(agent->GetQValues());
+        }
+    });
+    return qTables;
+}
+
+void
+LrWpanTschAgentPoolTestCase::TxDataRxAck(std::pair<uint8_t, uint32_t> info)
+{
+    m_ackChannels.push_back(info.first);
+}
+
+void
+LrWpanTschAgentPoolTestCase::DoRun()
+{
+    for (bool slotClock : {false, true})
+    {
+        std::vector<std::vector<double>> qTables = RunNetwork(false, false, slotClock);
+        std::vector<uint8_t> ackChannels = m_ackChannels;
+
+        NS_TEST_EXPECT_MSG_EQ(qTables.size(), 2, "Wrong number of agents");
+        NS_TEST_EXPECT_MSG_EQ((qTables[0] == std::vector<double>(qTables[0].size(), 0.0)),
+                              false,
+                              "The agent did not learn");
+
+        NS_TEST_EXPECT_MSG_EQ((RunNetwork(true, false, slotClock) == qTables),
+                              true,
+                              "The pooled agents learnt differently");
+        NS_TEST_EXPECT_MSG_EQ((m_ackChannels == ackChannels),
+                              true,
+                              "The pooled agents deployed their policies at another time");
+        NS_TEST_EXPECT_MSG_GT(m_batches, 0, "No batched update");
+        NS_TEST_EXPECT_MSG_GT(m_updates, m_batches, "The agents were not updated together");
+
+        NS_TEST_EXPECT_MSG_EQ((RunNetwork(true, true, slotClock) == qTables),
+                              true,
+                              "The agents learnt differently once the pool was disposed of");
+        NS_TEST_EXPECT_MSG_EQ((m_ackChannels == ackChannels),
+                              true,
+                              "The agents hopped differently once the pool was disposed of");
+        NS_TEST_EXPECT_MSG_GT(m_batches, 0, "No batched update before the pool was disposed of");
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH spatial index test
+ *
+ * Runs star networks with a device beyond MaxLossDb of the others, with
+ * and without the spatial index of the spectrum channels, and checks that
+ * the timeslot outcomes and the events are the same while fewer path
+ * losses are computed. The second network has its devices on both sides of
+ * the cell boundaries, at negative and mixed-sign coordinates.
+ */
+class LrWpanTschSpatialIndexTestCase : public TestCase
+{
+  public:
+    LrWpanTschSpatialIndexTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the network once.
+     * \param spatialIndex whether the spectrum channels use a spatial index
+     * \param positions the positions of the devices, the coordinator first
+     */
+    void RunNetwork(bool spatialIndex, const std::vector<Vector>& positions);
+
+    /**
+     * \brief Compare the runs of a network with and without spatial index.
+     * \param positions the positions of the devices, the coordinator first
+     */
+    void CheckNetwork(const std::vector<Vector>& positions);
+
+    /**
+     * \brief Count a PathLoss event.
+     * \param txPhy the transmitter
+     * \param rxPhy the receiver
+     * \param lossDb the path loss
+     */
+    void PathLossTrace(Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+
+    uint32_t m_txDataRxAck; //!< Number of acknowledged transmissions
+    uint64_t m_pathLosses;  //!< Number of path losses computed
+    uint64_t m_events;      //!< Number of simulator events of the last run
+};
+
+LrWpanTschSpatialIndexTestCase::LrWpanTschSpatialIndexTestCase()
+    : TestCase("Lrwpan: TSCH spectrum channel spatial index"),
+      m_txDataRxAck(0),
+      m_pathLosses(0),
+      m_events(0)
+{
+}
+
+void
+LrWpanTschSpatialIndexTestCase::PathLossTrace(Ptr<const SpectrumPhy> txPhy,
+                                              Ptr<const SpectrumPhy> rxPhy,
+                                              double lossDb)
+{
+    m_pathLosses++;
+}
+
+void
+LrWpanTschSpatialIndexTestCase::RunNetwork(bool spatialIndex, const std::vector<Vector>& positions)
+{
+    m_txDataRxAck = 0;
+    m_pathLosses = 0;
+
+    Config::SetDefault("ns3::SpectrumChannel::MaxLossDb", DoubleValue(120));
+    Config::SetDefault("ns3::SingleModelSpectrumChannel::SpatialIndex", BooleanValue(spatialIndex));
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, positions);
+    CountTschAcks(devs, &m_txDataRxAck);
+    Config::ConnectWithoutContext(
+        "/ChannelList/*/$ns3::SpectrumChannel/PathLoss",
+        MakeCallback(&LrWpanTschSpatialIndexTestCase::PathLossTrace, this));
+    helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+    helper.EnableTsch(devs, 0, 10);
+    GenerateTschTraffic(helper, devs, 1.01, 2, 0.1, true);
+
+    m_events = RunTsch(Seconds(6));
+    Config::Reset();
+}
+
+void
+LrWpanTschSpatialIndexTestCase::CheckNetwork(const std::vector<Vector>& positions)
+{
+    RunNetwork(false, positions);
+    uint32_t txDataRxAck = m_txDataRxAck;
+    uint64_t pathLosses = m_pathLosses;
+    uint64_t events = m_events;
+
+    RunNetwork(true, positions);
+
+    NS_TEST_EXPECT_MSG_GT(txDataRxAck, 0, "No packet was acknowledged");
+    NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck, txDataRxAck, "Different acknowledged transmissions");
+    NS_TEST_EXPECT_MSG_EQ(m_events, events, "Different events");
+    NS_TEST_EXPECT_MSG_GT(m_pathLosses, 0, "No path loss was computed");
+    NS_TEST_EXPECT_MSG_LT(m_pathLosses, pathLosses, "The spatial index did not save path losses");
+}
+
+void
+LrWpanTschSpatialIndexTestCase::DoRun()
+{
+    // The last device is about 137 dB away from the others.
+    CheckNetwork({Vector(0, 0, 0), Vector(10, 0, 0), Vector(20, 0, 0), Vector(1000, 0, 0)});
+
+    // The cells are about 280 m wide: the devices close to the coordinator
+    // are in the cells below it along y, z, and all the axes.
+    CheckNetwork({Vector(5, 1, 1),
+                  Vector(5, -1, 1),
+                  Vector(5, 1, -1),
+                  Vector(-5, -1, -1),
+                  Vector(-1000, 1000, -1000)});
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH path loss cache test
+ *
+ * Runs a star network with and without a cache of the path losses, and
+ * checks that the timeslot outcomes and the events are the same while
+ * most path losses are found in the cache.
+ */
+class LrWpanTschPathLossCacheTestCase : public TestCase
+{
+  public:
+    LrWpanTschPathLossCacheTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the network once.
+     * \param cache whether the path losses are cached
+     */
+    void RunNetwork(bool cache);
+
+    uint32_t m_txDataRxAck; //!< Number of acknowledged transmissions
+    uint64_t m_events;      //!< Number of simulator events of the last run
+    uint64_t m_hits;        //!< Number of path losses found in the cache
+    uint64_t m_misses;      //!< Number of path losses computed
+};
+
+LrWpanTschPathLossCacheTestCase::LrWpanTschPathLossCacheTestCase()
+    : TestCase("Lrwpan: TSCH path loss cache"),
+      m_txDataRxAck(0),
+      m_events(0),
+      m_hits(0),
+      m_misses(0)
+{
+}
+
+void
+LrWpanTschPathLossCacheTestCase::RunNetwork(bool cache)
+{
+    m_txDataRxAck = 0;
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(helper, TschRow(4));
+    CountTschAcks(devs, &m_txDataRxAck);
+    helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+
+    Ptr<CachedPropagationLossModel> lossCache;
+    if (cache)
+    {
+        lossCache = helper.EnablePathLossCache();
+    }
+
+    helper.EnableTsch(devs, 0, 10);
+    GenerateTschTraffic(helper, devs, 1.01, 2, 0.1, true);
+
+    m_events = RunTsch(Seconds(6), [this, lossCache]() {
+        if (lossCache)
+        {
+            m_hits = lossCache->GetHitCount();
+            m_misses = lossCache->GetMissCount();
+        }
+    });
+}
+
+void
+LrWpanTschPathLossCacheTestCase::DoRun()
+{
+    RunNetwork(false);
+    uint32_t txDataRxAck = m_txDataRxAck;
+    uint64_t events = m_events;
+
+    RunNetwork(true);
+
+    NS_TEST_EXPECT_MSG_GT(txDataRxAck, 0, "No packet was acknowledged");
+    NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck, txDataRxAck, "Different acknowledged transmissions");
+    NS_TEST_EXPECT_MSG_EQ(m_events, events, "Different events");
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(m_misses, 12, "A path loss was computed more than once");
+    NS_TEST_EXPECT_MSG_GT(m_hits, 10 * m_misses, "The path losses were not cached");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH slot engine test
+ *
+ * Runs the same network with the packet-level engine, with the slot engine
+ * and with the slot engine validating the packet-level engine, once with
+ * a dedicated link per device and once with the devices colliding in a
+ * shared timeslot. The slot engine must give the same outcomes with far
+ * fewer events, with its MCPS-DATA confirms in the context of their node,
+ * and the validation must find no mismatch.
+ */
+class LrWpanTschSlotEngineTestCase : public TestCase
+{
+  public:
+    LrWpanTschSlotEngineTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run a network once.
+     * \param engine whether the devices share a slot engine, else a slot clock
+     * \param validate whether the slot engine validates the packet-level engine
+     * \param collide whether the devices transmit in the same timeslot
+     */
+    void RunNetwork(bool engine, bool validate, bool collide);
+
+    /**
+     * \brief Count a MacWaitAck event.
+     * \param value trace value (unused)
+     */
+    void WaitAckTrace(uint32_t value);
+
+    /**
+     * \brief Count a PassedOneHoppingSequenceTrace event.
+     * \param asn the ASN
+     */
+    void HoppingSequenceTrace(uint64_t asn);
+
+    /**
+     * \brief Count an MCPS-DATA.confirm, and check its context.
+     * \param node the node of the MAC
+     * \param params the confirm parameters
+     */
+    void DataConfirm(uint32_t node, McpsDataConfirmParams params);
+
+    uint32_t m_txDataRxAck;     //!< Number of acknowledged transmissions
+    uint32_t m_waitAck;         //!< Number of transmissions without acknowledgment
+    uint32_t m_hoppingSequence; //!< Number of hopping sequences passed
+    uint32_t m_confirms;        //!< Number of successful MCPS-DATA.confirm
+    uint32_t m_noAckConfirms;   //!< Number of MCPS-DATA.confirm of dropped transmissions
+    uint32_t m_wrongContexts;   //!< Number of confirms out of the context of their node
+    uint64_t m_events;          //!< Number of simulator events of the last run
+    uint64_t m_transmissions;   //!< Number of transmissions of the slot engine
+    uint64_t m_successes;       //!< Number of successful transmissions of the slot engine
+    double m_expected;          //!< Number of successes predicted by the slot engine
+    uint64_t m_mismatches;      //!< Number of mismatches of the slot engine
+};
+
+LrWpanTschSlotEngineTestCase::LrWpanTschSlotEngineTestCase()
+    : TestCase("Lrwpan: TSCH slot engine"),
+      m_txDataRxAck(0),
+      m_waitAck(0),
+      m_hoppingSequence(0),
+      m_confirms(0),
+      m_noAckConfirms(0),
+      m_wrongContexts(0),
+      m_events(0),
+      m_transmissions(0),
+      m_successes(0),
+      m_expected(0),
+      m_mismatches(0)
+{
+}
+
+void
+LrWpanTschSlotEngineTestCase::WaitAckTrace(uint32_t value)
+{
+    m_waitAck++;
+}
+
+void
+LrWpanTschSlotEngineTestCase::HoppingSequenceTrace(uint64_t asn)
+{
+    m_hoppingSequence++;
+}
+
+void
+LrWpanTschSlotEngineTestCase::DataConfirm(uint32_t node, McpsDataConfirmParams params)
+{
+    if (params.m_status == MacStatus::NO_ACK)
+    {
+        m_noAckConfirms++;
+    }
+    else
+    {
+        m_confirms++;
+    }
+    if (Simulator::GetContext() != node)
+    {
+        m_wrongContexts++;
+    }
+}
+
+void
+LrWpanTschSlotEngineTestCase::RunNetwork(bool engine, bool validate, bool collide)
+{
+    m_txDataRxAck = 0;
+    m_waitAck = 0;
+    m_hoppingSequence = 0;
+    m_confirms = 0;
+    m_noAckConfirms = 0;
+    m_wrongContexts = 0;
+    m_transmissions = 0;
+    m_successes = 0;
+    m_expected = 0;
+    m_mismatches = 0;
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    LrWpanTschHelper helper;
+    NetDeviceContainer devs = InstallTschPan(
+        helper,
+        {Vector(0, 0, 0), Vector(10, 1, 0), Vector(10, 2, 0), Vector(10, 3, 0)});
+    CountTschAcks(devs, &m_txDataRxAck);
+    ConnectTschMacs(devs,
+                    "MacWaitAck",
+                    MakeCallback(&LrWpanTschSlotEngineTestCase::WaitAckTrace, this));
+    ConnectTschMacs(devs,
+                    "PassedOneHoppingSequenceTrace",
+                    MakeCallback(&LrWpanTschSlotEngineTestCase::HoppingSequenceTrace, this));
+    for (uint32_t i = 0; i < devs.GetN(); i++)
+    {
+        GetTschMac(devs, i)->SetMcpsDataConfirmCallback(
+            MakeCallback(&LrWpanTschSlotEngineTestCase::DataConfirm, this)
+                .Bind(devs.Get(i)->GetNode()->GetId()));
+    }
+
+    if (collide)
+    {
+        helper.AddSlotframe(devs, 0, 2);
+        AddLinkParams params;
+        params.slotframeHandle = 0;
+        params.channelOffset = 0;
+        params.linkHandle = 0;
+        params.timeslot = 0;
+        helper.AddAdvLink(devs, 0, params);
+        for (uint32_t i = 1; i < devs.GetN(); i++)
+        {
+            params.linkHandle = i;
+            params.timeslot = 1;
+            helper.AddLink(devs, i, 0, params, false);
+        }
+    }
+    else
+    {
+        helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+    }
+    helper.AssignStreams(devs, 0);
+
+    Ptr<TschSlotEngine> slotEngine;
+    if (engine)
+    {
+        slotEngine = helper.InstallSlotEngine(devs, validate);
+        slotEngine->AssignStreams(0);
+    }
+    else
+    {
+        helper.InstallSlotClock(devs);
+    }
+
+    helper.EnableTsch(devs, 0, 20);
+    GenerateTschTraffic(helper, devs, 1, 18, 0.2);
+
+    m_events = RunTsch(Seconds(20), [this, slotEngine]() {
+        if (slotEngine)
+        {
+            m_transmissions = slotEngine->GetTransmissionCount();
+            m_successes = slotEngine->GetSuccessCount();
+            m_expected = slotEngine->GetExpectedSuccessCount();
+            m_mismatches = slotEngine->GetMismatchCount();
+        }
+    });
+}
+
+void
+LrWpanTschSlotEngineTestCase::DoRun()
+{
+    for (bool collide : {false, true})
+    {
+        RunNetwork(false, false, collide);
+        uint32_t txDataRxAck = m_txDataRxAck;
+        uint32_t waitAck = m_waitAck;
+        uint32_t hoppingSequence = m_hoppingSequence;
+        uint32_t confirms = m_confirms;
+        uint32_t noAckConfirms = m_noAckConfirms;
+        uint64_t events = m_events;
+
+        if (collide)
+        {
+            NS_TEST_EXPECT_MSG_GT(waitAck, 0, "No collision");
+            NS_TEST_EXPECT_MSG_GT(noAckConfirms, 0, "No transmission was dropped");
+        }
+        else
+        {
+            NS_TEST_EXPECT_MSG_GT(txDataRxAck, 0, "No packet was acknowledged");
+        }
+
+        RunNetwork(true, false, collide);
+
+        NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck, txDataRxAck, "Different acknowledged transmissions");
+        NS_TEST_EXPECT_MSG_EQ(m_waitAck, waitAck, "Different unacknowledged transmissions");
+        NS_TEST_EXPECT_MSG_EQ(m_hoppingSequence, hoppingSequence, "Different hopping sequences");
+        NS_TEST_EXPECT_MSG_EQ(m_confirms, confirms, "Different successful confirms");
+        NS_TEST_EXPECT_MSG_EQ(m_noAckConfirms, noAckConfirms, "Different dropped confirms");
+        NS_TEST_EXPECT_MSG_EQ(m_wrongContexts, 0, "Confirms out of the context of their node");
+        NS_TEST_EXPECT_MSG_EQ(m_successes, m_txDataRxAck, "Different engine successes");
+        NS_TEST_EXPECT_MSG_LT(m_events * 2, events, "The slot engine did not save events");
+
+        RunNetwork(true, true, collide);
+        double expected = m_expected;
+
+        NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck, txDataRxAck, "Validation changed the network");
+        NS_TEST_EXPECT_MSG_EQ(m_transmissions, txDataRxAck + waitAck, "Missed transmissions");
+        NS_TEST_EXPECT_MSG_EQ(m_successes, txDataRxAck, "Different validated successes");
+        NS_TEST_EXPECT_MSG_EQ_TOL(expected,
+                                  double(txDataRxAck),
+                                  1,
+                                  "Different predicted successes");
+        NS_TEST_EXPECT_MSG_EQ(m_mismatches, 0, "Outcomes predicted impossible");
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH logical process test
+ *
+ * Runs two distant PANs with the default simulator and with the
+ * multithreaded simulator, with one logical process or one per PAN. The
+ * logical processes run in turn on a single thread, and also on their own
+ * threads when built with the NS3_MTP option. Checks that the PANs
+ * acknowledge the same transmissions, and that the signals of other
+ * channels are filtered on the logical process of their transmitter.
+ */
+class LrWpanTschLogicalProcessTestCase : public TestCase
+{
+  public:
+    LrWpanTschLogicalProcessTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Run the network once.
+     * \param lps the number of logical processes, 0 for the default simulator
+     * \param threaded whether each logical process runs on its own thread
+     */
+    void RunNetwork(uint32_t lps, bool threaded);
+
+    std::vector<uint32_t> m_txDataRxAck; //!< Number of acknowledged transmissions of each PAN
+    Time m_lookahead;                    //!< Lookahead of the last run
+    uint64_t m_windows;                  //!< Number of windows of the last run
+    uint64_t m_outOfChannel;             //!< Signals of other channels filtered in the last run
+};
+
+LrWpanTschLogicalProcessTestCase::LrWpanTschLogicalProcessTestCase()
+    : TestCase("Lrwpan: TSCH PANs on logical processes"),
+      m_windows(0),
+      m_outOfChannel(0)
+{
+}
+
+void
+LrWpanTschLogicalProcessTestCase::RunNetwork(uint32_t lps, bool threaded)
+{
+    m_txDataRxAck.assign(2, 0);
+    m_windows = 0;
+    m_outOfChannel = 0;
+
+    if (lps > 0)
+    {
+        Simulator::SetImplementation(
+            CreateObjectWithAttributes<MultithreadedSimulatorImpl>("LogicalProcesses",
+                                                                   UintegerValue(lps),
+                                                                   "Threaded",
+                                                                   BooleanValue(threaded)));
+    }
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    LrWpanTschHelper helper;
+    std::vector<NetDeviceContainer> pans;
+    for (uint32_t pan = 0; pan < 2; pan++)
+    {
+        NetDeviceContainer devs = InstallTschPan(helper, TschRow(3, 1000 * pan), pan);
+        // Each PAN is only accessed by its logical process.
+        CountTschAcks(devs, &m_txDataRxAck[pan]);
+        // The slotframes of different sizes do not always collide.
+        helper.ConfigureSlotframeAllToPan(devs, pan, false, false);
+        helper.AssignStreams(devs, 10 * pan);
+        pans.push_back(devs);
+    }
+
+    if (lps > 0)
+    {
+        m_lookahead = helper.AssignLogicalProcesses(pans);
+    }
+
+    for (const NetDeviceContainer& devs : pans)
+    {
+        helper.EnableTsch(devs, 0, 10);
+        GenerateTschTraffic(helper, devs, 1, 5, 0.1);
+    }
+
+    RunTsch(Seconds(8), [this]() {
+        auto simulator = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+        if (simulator)
+        {
+            m_windows = simulator->GetWindowCount();
+        }
+        auto filter =
+            DynamicCast<const LrWpanTransmitFilter>(LrWpanPhy::GetChannelTransmitFilter());
+        if (filter)
+        {
+            m_outOfChannel = filter->GetOutOfChannelCount();
+        }
+    });
+}
+
+void
+LrWpanTschLogicalProcessTestCase::DoRun()
+{
+    RunNetwork(0, false);
+    std::vector<uint32_t> txDataRxAck = m_txDataRxAck;
+    NS_TEST_EXPECT_MSG_GT(txDataRxAck[0], 0, "No packet was acknowledged");
+    NS_TEST_EXPECT_MSG_GT(txDataRxAck[1], 0, "No packet was acknowledged");
+
+    std::vector<std::pair<uint32_t, bool>> runs{{1, false}, {2, false}};
+#ifdef NS3_MTP
+    runs.emplace_back(2, true);
+#endif
+    for (auto [lps, threaded] : runs)
+    {
+        RunNetwork(lps, threaded);
+        NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck[0], txDataRxAck[0], "Different transmissions");
+        NS_TEST_EXPECT_MSG_EQ(m_txDataRxAck[1], txDataRxAck[1], "Different transmissions");
+        if (lps > 1)
+        {
+            // The closest devices of the PANs are 980 m apart.
+            NS_TEST_EXPECT_MSG_EQ_TOL(double(m_lookahead.GetNanoSeconds()),
+                                      980 / 0.299792458,
+                                      1,
+                                      "Wrong lookahead");
+            NS_TEST_EXPECT_MSG_GT(m_windows, 1, "The simulation was not split in windows");
+            NS_TEST_EXPECT_MSG_GT(m_outOfChannel,
+                                  0,
+                                  "The signals of other channels reached the same process");
+        }
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH binary trace file test
+ *
+ * Writes records to binary trace files, compressed or not, across several
+ * blocks, and reads them back. Then traces a small PAN through
+ * LrWpanTschHelper::EnableEnergyAll and checks the records against the MAC
+ * trace sources.
+ */
+class LrWpanTschTraceFileTestCase : public TestCase
+{
+  public:
+    LrWpanTschTraceFileTestCase();
+
+  private:
+    void DoRun() override;
+
+    uint32_t m_txDataRxAck; //!< Number of acknowledged transmissions
+};
+
+LrWpanTschTraceFileTestCase::LrWpanTschTraceFileTestCase()
+    : TestCase("Lrwpan: TSCH binary trace file"),
+      m_txDataRxAck(0)
+{
+}
+
+void
+LrWpanTschTraceFileTestCase::DoRun()
+{
+    std::vector<TschTraceRecord> records;
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        // The nodes and ASNs go back and forth, as with several MACs.
+        records.push_back({i % 7 * 1000,
+                           (uint64_t(1) << 40) + i / 3 - i % 5,
+                           uint8_t(i % TSCH_TRACE_EVENT_COUNT),
+                           i % 128,
+                           uint8_t(11 + i % 16)});
+    }
+
+    for (bool compressed : {false, true})
+    {
+        std::string filename = CreateTempDirFilename("tsch-trace.bin");
+        {
+            Ptr<TschTraceWriter> writer = Create<TschTraceWriter>(filename, compressed, 300);
+            for (const TschTraceRecord& r : records)
+            {
+                writer->Write(r.node, r.asn, TschTraceEvent(r.event), r.size, r.channel);
+            }
+            NS_TEST_EXPECT_MSG_EQ(writer->GetRecordCount(), records.size(), "Records lost");
+        }
+
+        TschTraceReader reader(filename);
+        NS_TEST_EXPECT_MSG_EQ(reader.IsCompressed(), compressed, "Wrong compression flag");
+        TschTraceRecord record;
+        uint32_t n = 0;
+        while (reader.Read(record))
+        {
+            NS_TEST_ASSERT_MSG_LT(n, records.size(), "Too many records read");
+            const TschTraceRecord& expected = records[n];
+            bool same = record.node == expected.node && record.asn == expected.asn &&
+                        record.event == expected.event && record.size == expected.size &&
+                        record.channel == expected.channel;
+            NS_TEST_ASSERT_MSG_EQ(same, true, "Record " << n << " differs");
+            n++;
+        }
+        NS_TEST_EXPECT_MSG_EQ(n, records.size(), "Records not read");
+    }
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    std::string filename = CreateTempDirFilename("tsch-pan.bin");
+    Ptr<TschTraceWriter> writer = Create<TschTraceWriter>(filename, true);
+    {
+        LrWpanTschHelper helper;
+        NetDeviceContainer devs = InstallTschPan(helper, TschRow(3));
+        CountTschAcks(devs, &m_txDataRxAck);
+        helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+        helper.EnableEnergyAll(writer);
+        helper.EnableTsch(devs, 0, 3);
+        GenerateTschTraffic(helper, devs, 0.5, 2, 0.1);
+        RunTsch(Seconds(3));
+    }
+    writer->Flush();
+
+    TschTraceReader reader(filename);
+    TschTraceRecord record;
+    uint32_t txDataRxAck = 0;
+    uint64_t lastAsn = 0;
+    bool ordered = true;
+    while (reader.Read(record))
+    {
+        NS_TEST_ASSERT_MSG_LT(record.node, 3, "Wrong node id");
+        NS_TEST_ASSERT_MSG_LT(record.event, TSCH_TRACE_EVENT_COUNT, "Wrong event");
+        ordered = ordered && record.asn >= lastAsn;
+        lastAsn = record.asn;
+        if (record.event == TSCH_TRACE_RX_DATA_TX_ACK)
+        {
+            NS_TEST_EXPECT_MSG_EQ(record.node, 0, "Only the coordinator receives");
+            NS_TEST_EXPECT_MSG_GT(record.size, 20, "Wrong packet size");
+        }
+        txDataRxAck += record.event == TSCH_TRACE_TX_DATA_RX_ACK;
+    }
+    NS_TEST_EXPECT_MSG_EQ(ordered, true, "Records out of ASN order");
+    NS_TEST_EXPECT_MSG_GT(m_txDataRxAck, 0, "No packet was acknowledged");
+    NS_TEST_EXPECT_MSG_EQ(txDataRxAck, m_txDataRxAck, "MacTxDataRxAck events lost");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH statistics collector test
+ *
+ * Runs a small PAN with a TschStatsCollector and checks its counters
+ * against the MAC trace sources, then its snapshot, dump and reset.
+ */
+class LrWpanTschStatsCollectorTestCase : public TestCase
+{
+  public:
+    LrWpanTschStatsCollectorTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Count a MAC timeslot event.
+     * \param counter the number of events of the trace source
+     * \param psize the packet size
+     */
+    void MacTrace(uint32_t* counter, uint32_t psize);
+
+    uint32_t m_txData;      //!< Number of MacTxData events
+    uint32_t m_txDataRxAck; //!< Number of MacTxDataRxAck events
+    uint32_t m_waitAck;     //!< Number of MacWaitAck events
+    uint32_t m_emptyBuffer; //!< Number of MacEmptyBuffer events
+};
+
+LrWpanTschStatsCollectorTestCase::LrWpanTschStatsCollectorTestCase()
+    : TestCase("Lrwpan: TSCH statistics collector"),
+      m_txData(0),
+      m_txDataRxAck(0),
+      m_waitAck(0),
+      m_emptyBuffer(0)
+{
+}
+
+void
+LrWpanTschStatsCollectorTestCase::MacTrace(uint32_t* counter, uint32_t psize)
+{
+    (*counter)++;
+}
+
+void
+LrWpanTschStatsCollectorTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    const uint32_t timeslots = 10;
+    Ptr<TschStatsCollector> stats = CreateObject<TschStatsCollector>();
+    {
+        LrWpanTschHelper helper;
+        NetDeviceContainer devs = InstallTschPan(helper, TschRow(3));
+        ConnectTschMacs(
+            devs,
+            "MacTxData",
+            MakeCallback(&LrWpanTschStatsCollectorTestCase::MacTrace, this).Bind(&m_txData));
+        ConnectTschMacs(
+            devs,
+            "MacWaitAck",
+            MakeCallback(&LrWpanTschStatsCollectorTestCase::MacTrace, this).Bind(&m_waitAck));
+        ConnectTschMacs(
+            devs,
+            "MacEmptyBuffer",
+            MakeCallback(&LrWpanTschStatsCollectorTestCase::MacTrace, this).Bind(&m_emptyBuffer));
+        CountTschAcks(devs, &m_txDataRxAck);
+        helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+        stats->Install(devs, timeslots);
+        helper.EnableTsch(devs, 0, 3);
+        GenerateTschTraffic(helper, devs, 0.5, 2, 0.05);
+        RunTsch(Seconds(3));
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(stats->GetNNodes(), 3, "Wrong number of nodes");
+    NS_TEST_EXPECT_MSG_GT(m_txDataRxAck, 0, "No packet was acknowledged");
+    NS_TEST_EXPECT_MSG_EQ(stats->GetTotal(TschStatsCollector::ACKS),
+                          m_txDataRxAck,
+                          "Wrong number of acknowledged transmissions");
+    NS_TEST_EXPECT_MSG_EQ(stats->GetTotal(TschStatsCollector::NO_ACK),
+                          m_waitAck,
+                          "Wrong number of transmissions without ACK");
+    NS_TEST_EXPECT_MSG_EQ(stats->GetTotal(TschStatsCollector::ATTEMPTS),
+                          m_txData + m_txDataRxAck + m_waitAck,
+                          "Wrong number of transmissions");
+    NS_TEST_EXPECT_MSG_EQ(stats->GetTotal(TschStatsCollector::EMPTY),
+                          m_emptyBuffer,
+                          "Wrong number of empty transmit links");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(stats->GetTotal(TschStatsCollector::ENERGY),
+                                m_txData + m_txDataRxAck + m_waitAck,
+                                "The radio was off during transmissions");
+
+    // The cells add up to the totals.
+    uint64_t acks = 0;
+    uint32_t cells = 0;
+    for (uint32_t node = 0; node < 3; node++)
+    {
+        for (uint32_t timeslot = 0; timeslot < timeslots; timeslot++)
+        {
+            for (uint8_t channel = 11; channel <= 26; channel++)
+            {
+                acks += stats->Get(node, timeslot, channel, TschStatsCollector::ACKS);
+                bool used = false;
+                for (uint32_t c = 0; c < TschStatsCollector::COUNTER_COUNT; c++)
+                {
+                    used = used ||
+                           stats->Get(node, timeslot, channel, TschStatsCollector::Counter(c));
+                }
+                cells += used;
+            }
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(acks, m_txDataRxAck, "The cells do not add up");
+
+    std::vector<uint32_t> snapshot = stats->Snapshot();
+    NS_TEST_ASSERT_MSG_EQ(snapshot.size(),
+                          3 * timeslots * TschStatsCollector::CHANNELS *
+                              TschStatsCollector::COUNTER_COUNT,
+                          "Wrong snapshot size");
+    std::ostringstream dump;
+    stats->Dump(dump);
+    std::string text = dump.str();
+    NS_TEST_EXPECT_MSG_EQ(std::count(text.begin(), text.end(), '\n'),
+                          cells + 1,
+                          "The dump has not a line per used cell");
+
+    stats->Reset();
+    NS_TEST_EXPECT_MSG_EQ(stats->GetTotal(TschStatsCollector::ATTEMPTS), 0, "Not reset");
+    NS_TEST_EXPECT_MSG_EQ(stats->GetTotal(TschStatsCollector::ENERGY), 0, "Not reset");
+    NS_TEST_EXPECT_MSG_GT(std::accumulate(snapshot.begin(), snapshot.end(), uint64_t(0)),
+                          0,
+                          "The snapshot was reset");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH profiling counters test
+ *
+ * Runs a small PAN and checks that the profiling counters of the MAC, PHY and
+ * spectrum channels count the calls in the builds with NS3_PROFILE_COUNTERS
+ * only, and that LrWpanTschHelper::PrintProfile prints them.
+ */
+class LrWpanTschProfileTestCase : public TestCase
+{
+  public:
+    LrWpanTschProfileTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LrWpanTschProfileTestCase::LrWpanTschProfileTestCase()
+    : TestCase("Lrwpan: TSCH profiling counters")
+{
+}
+
+void
+LrWpanTschProfileTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    ProfileCounter counter;
+    {
+        NS_PROFILE_SCOPE(counter);
+    }
+    NS_TEST_EXPECT_MSG_EQ(counter.calls, uint64_t(ProfileCounter::IsEnabled()), "Wrong call count");
+
+    std::ostringstream profile;
+    {
+        LrWpanTschHelper helper;
+        NetDeviceContainer devs = InstallTschPan(helper, TschRow(2));
+        helper.ConfigureSlotframeAllToPan(devs, 0, false, false);
+        helper.EnableTsch(devs, 0, 3);
+        GenerateTschTraffic(helper, devs, 0.5, 1, 0.05);
+        RunTsch(Seconds(2), [&]() { LrWpanTschHelper::PrintProfile(devs, profile); });
+    }
+
+    // The receiver of the data frames, and its PHY.
+    std::string text = profile.str();
+    for (const char* name : {"node 0\n", "ScheduleTimeslot calls=", "PdDataIndication calls=",
+                             "StartRx calls=", "CheckInterference calls=", "StartTx calls="})
+    {
+        NS_TEST_EXPECT_MSG_NE(text.find(name), std::string::npos, "No line " << name);
+    }
+    std::size_t pos = text.find("PdDataIndication calls=") + std::strlen("PdDataIndication calls=");
+    uint64_t calls = std::stoull(text.substr(pos));
+    if (ProfileCounter::IsEnabled())
+    {
+        NS_TEST_EXPECT_MSG_GT(calls, 0, "No frame was received");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_EQ(calls, 0, "Counted without NS3_PROFILE_COUNTERS");
+    }
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan TSCH TestSuite
+ */
+class LrWpanTschTestSuite : public TestSuite
+{
+  public:
+    LrWpanTschTestSuite();
+};
+
+LrWpanTschTestSuite::LrWpanTschTestSuite()
+    : TestSuite("lr-wpan-tsch-test", Type::UNIT)
+{
+    AddTestCase(new LrWpanTschLinkTableTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschSkipIdleSlotsTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschSlotClockTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschTxQueueLimitTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschTxQueuePoolTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschChannelHoppingTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschMicroTaskTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschAgentPoolTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschSpatialIndexTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschPathLossCacheTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschSlotEngineTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschLogicalProcessTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschTraceFileTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschStatsCollectorTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LrWpanTschProfileTestCase, TestCase::Duration::QUICK);
+}
+
+static LrWpanTschTestSuite g_lrWpanTschTestSuite; //!< Static variable for test initialization
@@ -27,6 +27,7 @@
 
 #include "granted-time-window-mpi-interface.h"
 #include "null-message-mpi-interface.h"
+#include "threaded-mpi-interface.h"
 
 #include <ns3/global-value.h>
 #include <ns3/log.h>
@@ -107,6 +108,11 @@ MpiInterface::SetParallelSimulatorImpl()
             g_parallelCommunicationInterface = new GrantedTimeWindowMpiInterface();
             useDefault = false;
         }
+        else if (simulationType == "ns3::MultithreadedSimulatorImpl")
+        {
+            g_parallelCommunicationInterface = new ThreadedMpiInterface();
+            useDefault = false;
+        }
     }
 
     // User did not specify a valid parallel simulator; use the default.
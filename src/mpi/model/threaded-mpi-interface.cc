@@ -0,0 +1,199 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup mpi
+ * Implementation of class ns3::ThreadedMpiInterface.
+ */
+
+#include "threaded-mpi-interface.h"
+
+#include "mpi-receiver.h"
+
+#include "ns3/abort.h"
+#include "ns3/channel.h"
+#include "ns3/log.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/net-device.h"
+#include "ns3/node-list.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ThreadedMpiInterface");
+
+ThreadedMpiInterface::ThreadedMpiInterface()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+ThreadedMpiInterface::~ThreadedMpiInterface()
+{
+    NS_LOG_FUNCTION(this);
+    Destroy();
+}
+
+void
+ThreadedMpiInterface::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_interface)
+    {
+        m_interface->Dispose();
+        m_interface = nullptr;
+    }
+}
+
+uint32_t
+ThreadedMpiInterface::GetSystemId()
+{
+    NS_ASSERT(m_interface);
+    return Simulator::GetSystemId();
+}
+
+uint32_t
+ThreadedMpiInterface::GetSize()
+{
+    NS_ASSERT(m_interface);
+    return m_interface->GetSize();
+}
+
+bool
+ThreadedMpiInterface::IsEnabled()
+{
+    return m_interface && m_interface->IsEnabled();
+}
+
+MPI_Comm
+ThreadedMpiInterface::GetCommunicator()
+{
+    NS_FATAL_ERROR("The threaded MPI interface has no MPI communicator");
+    return MPI_COMM_NULL;
+}
+
+void
+ThreadedMpiInterface::Enable(int* pargc, char*** pargv)
+{
+    NS_LOG_FUNCTION(this << pargc << pargv);
+
+    NS_ASSERT(!m_interface);
+
+    m_interface = CreateObject<ThreadedCommunicationInterface>();
+    m_interface->Enable();
+    m_interface->SetStartCallback(MakeCallback(&ThreadedMpiInterface::Partition, this));
+}
+
+void
+ThreadedMpiInterface::Enable(MPI_Comm communicator)
+{
+    NS_FATAL_ERROR("The threaded MPI interface does not run on an MPI communicator");
+}
+
+void
+ThreadedMpiInterface::Disable()
+{
+    NS_LOG_FUNCTION(this);
+    Destroy();
+}
+
+void
+ThreadedMpiInterface::SendPacket(Ptr<Packet> p, const Time& rxTime, uint32_t node, uint32_t dev)
+{
+    NS_LOG_FUNCTION(this << p << rxTime.GetTimeStep() << node << dev);
+
+    m_interface->Send(node,
+                      rxTime - Simulator::Now(),
+                      &ThreadedMpiInterface::Receive,
+                      p,
+                      node,
+                      dev);
+}
+
+void
+ThreadedMpiInterface::Partition()
+{
+    NS_LOG_FUNCTION(this);
+
+    auto simulator = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    uint32_t size = m_interface->GetSize();
+    Time lookahead = Time::Max();
+    for (auto iter = NodeList::Begin(); iter != NodeList::End(); ++iter)
+    {
+        uint32_t systemId = (*iter)->GetSystemId();
+        NS_ABORT_MSG_UNLESS(systemId < size,
+                            "Node " << (*iter)->GetId() << " has system id " << systemId
+                                    << ", out of the " << size << " logical processes");
+        simulator->SetLogicalProcess((*iter)->GetId(), systemId);
+
+        for (uint32_t i = 0; i < (*iter)->GetNDevices(); ++i)
+        {
+            Ptr<NetDevice> localNetDevice = (*iter)->GetDevice(i);
+            // only works for p2p links currently
+            Ptr<Channel> channel = localNetDevice->GetChannel();
+            if (!localNetDevice->IsPointToPoint() || !channel)
+            {
+                continue;
+            }
+            Ptr<NetDevice> remoteNetDevice =
+                channel->GetDevice(0) == localNetDevice ? channel->GetDevice(1)
+                                                        : channel->GetDevice(0);
+            if (remoteNetDevice->GetNode()->GetSystemId() == systemId)
+            {
+                continue;
+            }
+            TimeValue delay;
+            channel->GetAttribute("Delay", delay);
+            lookahead = std::min(lookahead, delay.Get());
+        }
+    }
+
+    TimeValue current;
+    simulator->GetAttribute("Lookahead", current);
+    if (lookahead != Time::Max() &&
+        (!current.Get().IsStrictlyPositive() || lookahead < current.Get()))
+    {
+        NS_LOG_LOGIC("Lookahead " << lookahead.As(Time::US));
+        simulator->SetAttribute("Lookahead", TimeValue(lookahead));
+    }
+}
+
+void
+ThreadedMpiInterface::Receive(Ptr<Packet> p, uint32_t node, uint32_t dev)
+{
+    // Find the correct node/device to pass the packet to
+    Ptr<Node> pNode = NodeList::GetNode(node);
+    Ptr<MpiReceiver> pMpiRec = nullptr;
+    uint32_t nDevices = pNode->GetNDevices();
+    for (uint32_t i = 0; i < nDevices; ++i)
+    {
+        Ptr<NetDevice> pThisDev = pNode->GetDevice(i);
+        if (pThisDev->GetIfIndex() == dev)
+        {
+            pMpiRec = pThisDev->GetObject<MpiReceiver>();
+            break;
+        }
+    }
+
+    NS_ASSERT(pNode && pMpiRec);
+    pMpiRec->Receive(p);
+}
+
+} // namespace ns3
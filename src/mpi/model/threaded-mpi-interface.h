@@ -0,0 +1,97 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup mpi
+ * Declaration of class ns3::ThreadedMpiInterface.
+ */
+
+#ifndef NS3_THREADED_MPI_INTERFACE_H
+#define NS3_THREADED_MPI_INTERFACE_H
+
+#include "parallel-communication-interface.h"
+
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/threaded-communication-interface.h"
+
+#include <mpi.h>
+#include <stdint.h>
+
+namespace ns3
+{
+
+/**
+ * \ingroup mpi
+ *
+ * \brief MpiInterface backend running the ranks on the threads of a
+ * MultithreadedSimulatorImpl
+ *
+ * Lets a program written for DistributedSimulatorImpl run its partitions
+ * in a single process: each rank is a logical process of
+ * MultithreadedSimulatorImpl. MpiInterface uses this backend when the
+ * SimulatorImplementationType is ns3::MultithreadedSimulatorImpl. The
+ * packets of the remote point-to-point channels go through a
+ * ThreadedCommunicationInterface, which does not use MPI.
+ *
+ * Unlike with MPI, the program runs once and builds the whole topology: the
+ * events of each node run on the logical process of its system id, which
+ * must be lower than the LogicalProcesses attribute of the simulator. The
+ * lookahead of the simulator is lowered to the delay of the remote
+ * point-to-point channels, if needed.
+ *
+ * There is no MPI communicator: Enable (MPI_Comm) and GetCommunicator are
+ * not supported.
+ */
+class ThreadedMpiInterface : public ParallelCommunicationInterface
+{
+  public:
+    ThreadedMpiInterface();
+    ~ThreadedMpiInterface() override;
+
+    // Inherited
+    void Destroy() override;
+    uint32_t GetSystemId() override;
+    uint32_t GetSize() override;
+    bool IsEnabled() override;
+    void Enable(int* pargc, char*** pargv) override;
+    void Enable(MPI_Comm communicator) override;
+    void Disable() override;
+    void SendPacket(Ptr<Packet> p, const Time& rxTime, uint32_t node, uint32_t dev) override;
+    MPI_Comm GetCommunicator() override;
+
+  private:
+    /**
+     * Map the nodes to their logical process and compute the lookahead,
+     * before the first window.
+     */
+    void Partition();
+    /**
+     * Pass a packet to the receiver of its device, on the logical process
+     * of the node.
+     * \param p the packet
+     * \param node the destination node
+     * \param dev the destination device
+     */
+    static void Receive(Ptr<Packet> p, uint32_t node, uint32_t dev);
+
+    /** The interface between the logical processes. */
+    Ptr<ThreadedCommunicationInterface> m_interface;
+};
+
+} // namespace ns3
+
+#endif /* NS3_THREADED_MPI_INTERFACE_H */
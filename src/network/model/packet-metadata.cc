@@ -80,8 +80,7 @@ PacketMetadata::ReserveCopy(uint32_t size)
     PacketMetadata::Data* newData = PacketMetadata::Create(m_used + size);
     memcpy(newData->m_data, m_data->m_data, m_used);
     newData->m_dirtyEnd = m_used;
-    m_data->m_count--;
-    if (m_data->m_count == 0)
+    if (--m_data->m_count == 0)
     {
         PacketMetadata::Recycle(m_data);
     }
@@ -99,13 +98,24 @@ PacketMetadata::ReserveCopy(uint32_t size)
     }
 }
 
+bool
+PacketMetadata::IsWritable() const
+{
+#ifdef NS3_MTP
+    // Appending in place moves m_data->m_dirtyEnd, which the other
+    // metadata sharing the data may also do.
+    return m_data->m_count == 1;
+#else
+    return m_data->m_count == 1 || m_data->m_dirtyEnd == m_used;
+#endif
+}
+
 void
 PacketMetadata::Reserve(uint32_t size)
 {
     NS_LOG_FUNCTION(this << size);
     NS_ASSERT(m_data != nullptr);
-    if (m_data->m_size >= m_used + size &&
-        (m_head == 0xffff || m_data->m_count == 1 || m_data->m_dirtyEnd == m_used))
+    if (m_data->m_size >= m_used + size && (m_head == 0xffff || IsWritable()))
     {
         /* enough room, not dirty. */
     }
@@ -385,7 +395,7 @@ PacketMetadata::AddSmall(const PacketMetadata::SmallItem* item)
     uint32_t sizeSize = GetUleb128Size(item->size);
     uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2;
     if (m_used + n > m_data->m_size ||
-        (m_head != 0xffff && m_data->m_count != 1 && m_used != m_data->m_dirtyEnd))
+        (m_head != 0xffff && !IsWritable()))
     {
         ReserveCopy(n);
     }
@@ -422,7 +432,7 @@ PacketMetadata::AddBig(uint32_t next,
     uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2 + fragStartSize + fragEndSize + 4;
 
     if (m_used + n > m_data->m_size ||
-        (m_head != 0xffff && m_data->m_count != 1 && m_used != m_data->m_dirtyEnd))
+        (m_head != 0xffff && !IsWritable()))
     {
         ReserveCopy(n);
     }
@@ -567,6 +577,10 @@ PacketMetadata::Data*
 PacketMetadata::Create(uint32_t size)
 {
     NS_LOG_FUNCTION(size);
+#ifdef NS3_MTP
+    // m_freeList and m_maxSize are static members without lock.
+    return PacketMetadata::Allocate(size);
+#endif
     NS_LOG_LOGIC("create size=" << size << ", max=" << m_maxSize);
     if (size > m_maxSize)
     {
@@ -593,6 +607,10 @@ void
 PacketMetadata::Recycle(PacketMetadata::Data* data)
 {
     NS_LOG_FUNCTION(data);
+#ifdef NS3_MTP
+    PacketMetadata::Deallocate(data);
+    return;
+#endif
     if (!m_enable)
     {
         PacketMetadata::Deallocate(data);
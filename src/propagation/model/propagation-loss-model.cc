@@ -28,7 +28,9 @@
 #include "ns3/mobility-model.h"
 #include "ns3/pointer.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace ns3
@@ -917,6 +919,235 @@ MatrixPropagationLossModel::DoAssignStreams(int64_t stream)
 
 // ------------------------------------------------------------------------- //
 
+NS_OBJECT_ENSURE_REGISTERED(CachedPropagationLossModel);
+
+TypeId
+CachedPropagationLossModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::CachedPropagationLossModel")
+            .SetParent<PropagationLossModel>()
+            .SetGroupName("Propagation")
+            .AddConstructor<CachedPropagationLossModel>()
+            .AddAttribute("Model",
+                          "The propagation loss model whose losses are cached.",
+                          PointerValue(),
+                          MakePointerAccessor(&CachedPropagationLossModel::SetModel,
+                                              &CachedPropagationLossModel::GetModel),
+                          MakePointerChecker<PropagationLossModel>())
+            .AddAttribute("DenseLimit",
+                          "The maximum number of mobility models whose losses are kept "
+                          "in a dense matrix, instead of a hash table.",
+                          UintegerValue(256),
+                          MakeUintegerAccessor(&CachedPropagationLossModel::m_denseLimit),
+                          MakeUintegerChecker<uint32_t>());
+    return tid;
+}
+
+CachedPropagationLossModel::CachedPropagationLossModel()
+    : PropagationLossModel(),
+      m_denseLimit(256),
+      m_matrixSize(0),
+      m_dense(true),
+      m_hits(0),
+      m_misses(0)
+{
+}
+
+CachedPropagationLossModel::~CachedPropagationLossModel()
+{
+}
+
+void
+CachedPropagationLossModel::DoDispose()
+{
+    Clear();
+    m_model = nullptr;
+    PropagationLossModel::DoDispose();
+}
+
+void
+CachedPropagationLossModel::SetModel(Ptr<PropagationLossModel> model)
+{
+    m_model = model;
+    Clear();
+}
+
+Ptr<PropagationLossModel>
+CachedPropagationLossModel::GetModel() const
+{
+    return m_model;
+}
+
+void
+CachedPropagationLossModel::Clear()
+{
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    for (const auto& mobility : m_mobilities)
+    {
+        mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&CachedPropagationLossModel::CourseChanged, this));
+    }
+    m_indices.clear();
+    m_mobilities.clear();
+    m_generations.clear();
+    m_matrix.clear();
+    m_matrixSize = 0;
+    m_dense = true;
+    m_map.clear();
+}
+
+uint64_t
+CachedPropagationLossModel::GetHitCount() const
+{
+    return m_hits;
+}
+
+uint64_t
+CachedPropagationLossModel::GetMissCount() const
+{
+    return m_misses;
+}
+
+double
+CachedPropagationLossModel::GetHitRatio() const
+{
+    uint64_t total = m_hits + m_misses;
+    return total ? static_cast<double>(m_hits) / total : 0;
+}
+
+uint32_t
+CachedPropagationLossModel::GetIndex(Ptr<MobilityModel> mobility) const
+{
+    auto it = m_indices.find(PeekPointer(mobility));
+    if (it != m_indices.end())
+    {
+        return it->second;
+    }
+
+    uint32_t index = m_mobilities.size();
+    m_indices[PeekPointer(mobility)] = index;
+    m_mobilities.push_back(mobility);
+    m_generations.push_back(1);
+    mobility->TraceConnectWithoutContext(
+        "CourseChange",
+        MakeCallback(&CachedPropagationLossModel::CourseChanged,
+                     const_cast<CachedPropagationLossModel*>(this)));
+
+    if (m_dense && index >= m_denseLimit)
+    {
+        SwitchToMap();
+    }
+    else if (m_dense && index >= m_matrixSize)
+    {
+        uint32_t size = std::max(index + 1, std::min(2 * m_matrixSize, m_denseLimit));
+        std::vector<Entry> matrix(static_cast<size_t>(size) * size);
+        for (uint32_t i = 0; i < m_matrixSize; i++)
+        {
+            std::copy_n(m_matrix.begin() + static_cast<size_t>(i) * m_matrixSize,
+                        m_matrixSize,
+                        matrix.begin() + static_cast<size_t>(i) * size);
+        }
+        m_matrix.swap(matrix);
+        m_matrixSize = size;
+    }
+    return index;
+}
+
+void
+CachedPropagationLossModel::SwitchToMap() const
+{
+    NS_LOG_DEBUG("More than " << m_denseLimit << " mobility models, switching to a hash table");
+    for (uint32_t i = 0; i < m_matrixSize; i++)
+    {
+        for (uint32_t j = 0; j < m_matrixSize; j++)
+        {
+            const Entry& entry = m_matrix[static_cast<size_t>(i) * m_matrixSize + j];
+            if (entry.generationA == m_generations[i] && entry.generationB == m_generations[j])
+            {
+                m_map[(static_cast<uint64_t>(i) << 32) | j] = entry;
+            }
+        }
+    }
+    m_matrix.clear();
+    m_matrix.shrink_to_fit();
+    m_matrixSize = 0;
+    m_dense = false;
+}
+
+void
+CachedPropagationLossModel::CourseChanged(Ptr<const MobilityModel> mobility)
+{
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    auto it = m_indices.find(PeekPointer(mobility));
+    if (it != m_indices.end())
+    {
+        m_generations[it->second]++;
+    }
+}
+
+double
+CachedPropagationLossModel::DoCalcRxPower(double txPowerDbm,
+                                          Ptr<MobilityModel> a,
+                                          Ptr<MobilityModel> b) const
+{
+    NS_ASSERT_MSG(m_model, "No propagation loss model to cache");
+    uint32_t generationA;
+    uint32_t generationB;
+    {
+#ifdef NS3_MTP
+        std::unique_lock lock{m_mutex};
+#endif
+        uint32_t ia = GetIndex(a);
+        uint32_t ib = GetIndex(b);
+
+        const Entry& entry = m_dense ? m_matrix[static_cast<size_t>(ia) * m_matrixSize + ib]
+                                     : m_map[(static_cast<uint64_t>(ia) << 32) | ib];
+        generationA = m_generations[ia];
+        generationB = m_generations[ib];
+        if (entry.generationA == generationA && entry.generationB == generationB)
+        {
+            m_hits++;
+            return txPowerDbm - entry.lossDb;
+        }
+        m_misses++;
+    }
+
+    // The wrapped model runs unlocked: querying a position may notify a course
+    // change, which locks the cache in CourseChanged.
+    double lossDb = -m_model->CalcRxPower(0, a, b);
+
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    // The cache may have grown or been cleared meanwhile, and the loss is
+    // only kept if neither mobility model moved during the computation.
+    uint32_t ia = GetIndex(a);
+    uint32_t ib = GetIndex(b);
+    if (m_generations[ia] == generationA && m_generations[ib] == generationB)
+    {
+        Entry& entry = m_dense ? m_matrix[static_cast<size_t>(ia) * m_matrixSize + ib]
+                               : m_map[(static_cast<uint64_t>(ia) << 32) | ib];
+        entry.lossDb = lossDb;
+        entry.generationA = generationA;
+        entry.generationB = generationB;
+    }
+    return txPowerDbm - lossDb;
+}
+
+int64_t
+CachedPropagationLossModel::DoAssignStreams(int64_t stream)
+{
+    return m_model ? m_model->AssignStreams(stream) : 0;
+}
+
+// ------------------------------------------------------------------------- //
+
 NS_OBJECT_ENSURE_REGISTERED(RangePropagationLossModel);
 
 TypeId
@@ -28,6 +28,11 @@
 #include "ns3/random-variable-stream.h"
 
 #include <unordered_map>
+#include <vector>
+
+#ifdef NS3_MTP
+#include <mutex>
+#endif
 
 namespace ns3
 {
@@ -771,6 +776,139 @@ class MatrixPropagationLossModel : public PropagationLossModel
         m_loss; //!< Propagation loss between pair of nodes
 };
 
+/**
+ * \ingroup propagation
+ *
+ * \brief Memoizes the propagation loss of another model for each pair of
+ * mobility models.
+ *
+ * The loss of a pair is computed with the wrapped model, including its
+ * chained models, on the first call, and reused until one of the two
+ * mobility models notifies a course change. The wrapped model must thus be
+ * deterministic, its loss must not depend on the transmission power, and
+ * the mobility models must only move through course changes (which is the
+ * case of ConstantPositionMobilityModel, not of
+ * ConstantVelocityMobilityModel). A loss is not cached if one of the
+ * mobility models notifies a course change while the wrapped model computes
+ * it, as the models updating their position when queried may do. Paths
+ * a-->b and b-->a are cached separately.
+ *
+ * The losses are kept in a dense matrix as long as at most DenseLimit
+ * mobility models were seen, and in a hash table afterwards. With the
+ * NS3_MTP option, the cache can be shared by the logical processes of the
+ * multithreaded simulator.
+ */
+class CachedPropagationLossModel : public PropagationLossModel
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    CachedPropagationLossModel();
+    ~CachedPropagationLossModel() override;
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    CachedPropagationLossModel(const CachedPropagationLossModel&) = delete;
+    CachedPropagationLossModel& operator=(const CachedPropagationLossModel&) = delete;
+
+    /**
+     * \brief Set the model whose losses are cached, and clear the cache.
+     * \param model the wrapped model
+     */
+    void SetModel(Ptr<PropagationLossModel> model);
+
+    /**
+     * \return the model whose losses are cached
+     */
+    Ptr<PropagationLossModel> GetModel() const;
+
+    /**
+     * \brief Forget all the cached losses.
+     */
+    void Clear();
+
+    /**
+     * \return the number of losses found in the cache
+     */
+    uint64_t GetHitCount() const;
+
+    /**
+     * \return the number of losses computed with the wrapped model
+     */
+    uint64_t GetMissCount() const;
+
+    /**
+     * \return the ratio of the losses found in the cache, zero if no loss was requested
+     */
+    double GetHitRatio() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    double DoCalcRxPower(double txPowerDbm,
+                         Ptr<MobilityModel> a,
+                         Ptr<MobilityModel> b) const override;
+
+    int64_t DoAssignStreams(int64_t stream) override;
+
+    /**
+     * A cached loss. It is valid while the generations of the two mobility
+     * models are the ones it was computed with.
+     */
+    struct Entry
+    {
+        double lossDb;        //!< The loss, positive in dB
+        uint32_t generationA; //!< Generation of the source mobility model
+        uint32_t generationB; //!< Generation of the destination mobility model
+    };
+
+    /**
+     * \brief Get the index of a mobility model, giving it one on first use.
+     * \param mobility the mobility model
+     * \return the index
+     */
+    uint32_t GetIndex(Ptr<MobilityModel> mobility) const;
+
+    /**
+     * \brief Move the cached losses from the dense matrix to the hash table.
+     */
+    void SwitchToMap() const;
+
+    /**
+     * \brief Invalidate the cached losses of a mobility model.
+     * \param mobility the mobility model
+     */
+    void CourseChanged(Ptr<const MobilityModel> mobility);
+
+    Ptr<PropagationLossModel> m_model; //!< The wrapped model
+    uint32_t m_denseLimit;             //!< Maximum number of mobility models of the dense matrix
+
+    /// Index of each mobility model
+    mutable std::unordered_map<const MobilityModel*, uint32_t> m_indices;
+    /// The mobility models, whose course changes are tracked
+    mutable std::vector<Ptr<MobilityModel>> m_mobilities;
+    /// Generation of each mobility model, increased on each course change
+    mutable std::vector<uint32_t> m_generations;
+    /// Dense matrix of the losses, m_matrixSize rows of m_matrixSize entries
+    mutable std::vector<Entry> m_matrix;
+    mutable uint32_t m_matrixSize; //!< Number of rows of m_matrix
+    mutable bool m_dense;          //!< Whether the losses are kept in m_matrix
+    /// Losses by source and destination indices, once m_dense is false
+    mutable std::unordered_map<uint64_t, Entry> m_map;
+
+    mutable uint64_t m_hits;   //!< Number of losses found in the cache
+    mutable uint64_t m_misses; //!< Number of losses computed with the wrapped model
+
+#ifdef NS3_MTP
+    /// Mutex of the cache, which the threads of the multithreaded simulator can share
+    mutable std::mutex m_mutex;
+#endif
+};
+
 /**
  * \ingroup propagation
  *
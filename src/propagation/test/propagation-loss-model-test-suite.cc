@@ -23,6 +23,7 @@
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
 
 using namespace ns3;
 
@@ -444,6 +445,159 @@ MatrixPropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief A mobility model notifying a course change each time its position is
+ * queried, as the models updating their position when queried may do.
+ */
+class CourseChangingMobilityModel : public MobilityModel
+{
+  private:
+    Vector DoGetPosition() const override
+    {
+        NotifyCourseChange();
+        return m_position;
+    }
+
+    void DoSetPosition(const Vector& position) override
+    {
+        m_position = position;
+        NotifyCourseChange();
+    }
+
+    Vector DoGetVelocity() const override
+    {
+        return Vector(0, 0, 0);
+    }
+
+    Vector m_position; //!< The position
+};
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief CachedPropagationLossModel Test
+ */
+class CachedPropagationLossModelTestCase : public TestCase
+{
+  public:
+    CachedPropagationLossModelTestCase();
+    ~CachedPropagationLossModelTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the cached losses between all the pairs of mobility models.
+     *
+     * \param denseLimit the DenseLimit attribute of the cache
+     */
+    void CheckLosses(uint32_t denseLimit);
+
+    /**
+     * Check that a loss is not cached when a mobility model notifies a course
+     * change while the wrapped model queries its position.
+     */
+    void CheckCourseChangeDuringLoss();
+};
+
+CachedPropagationLossModelTestCase::CachedPropagationLossModelTestCase()
+    : TestCase("Test CachedPropagationLossModel")
+{
+}
+
+CachedPropagationLossModelTestCase::~CachedPropagationLossModelTestCase()
+{
+}
+
+void
+CachedPropagationLossModelTestCase::CheckLosses(uint32_t denseLimit)
+{
+    Ptr<MobilityModel> m[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        m[i] = CreateObject<ConstantPositionMobilityModel>();
+        m[i]->SetPosition(Vector(10 * i + 1, 0, 0));
+    }
+
+    Ptr<LogDistancePropagationLossModel> model = CreateObject<LogDistancePropagationLossModel>();
+    Ptr<CachedPropagationLossModel> cache = CreateObject<CachedPropagationLossModel>();
+    cache->SetAttribute("DenseLimit", UintegerValue(denseLimit));
+    cache->SetModel(model);
+
+    double tolerance = 1e-9;
+    for (int round = 0; round < 2; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                double rxPowerDbm = cache->CalcRxPower(10, m[i], m[j]);
+                NS_TEST_EXPECT_MSG_EQ_TOL(rxPowerDbm,
+                                          model->CalcRxPower(10, m[i], m[j]),
+                                          tolerance,
+                                          "Got unexpected rcv power");
+            }
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(cache->GetMissCount(), 16, "The losses were not computed once");
+    NS_TEST_EXPECT_MSG_EQ(cache->GetHitCount(), 16, "The losses were not cached");
+
+    // only the paths of the moved mobility model are computed again
+    m[2]->SetPosition(Vector(100, 0, 0));
+    for (int i = 0; i < 4; ++i)
+    {
+        double rxPowerDbm = cache->CalcRxPower(10, m[i], m[2]);
+        NS_TEST_EXPECT_MSG_EQ_TOL(rxPowerDbm,
+                                  model->CalcRxPower(10, m[i], m[2]),
+                                  tolerance,
+                                  "Got unexpected rcv power after a course change");
+    }
+    double rxPowerDbm = cache->CalcRxPower(10, m[0], m[1]);
+    NS_TEST_EXPECT_MSG_EQ_TOL(rxPowerDbm,
+                              model->CalcRxPower(10, m[0], m[1]),
+                              tolerance,
+                              "Got unexpected rcv power");
+    NS_TEST_EXPECT_MSG_EQ(cache->GetMissCount(), 20, "Unexpected computed losses");
+    NS_TEST_EXPECT_MSG_EQ(cache->GetHitCount(), 17, "Unexpected cached losses");
+    NS_TEST_EXPECT_MSG_EQ_TOL(cache->GetHitRatio(), 17.0 / 37, tolerance, "Unexpected hit ratio");
+}
+
+void
+CachedPropagationLossModelTestCase::CheckCourseChangeDuringLoss()
+{
+    Ptr<MobilityModel> a = CreateObject<CourseChangingMobilityModel>();
+    a->SetPosition(Vector(1, 0, 0));
+    Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+    b->SetPosition(Vector(11, 0, 0));
+
+    Ptr<LogDistancePropagationLossModel> model = CreateObject<LogDistancePropagationLossModel>();
+    Ptr<CachedPropagationLossModel> cache = CreateObject<CachedPropagationLossModel>();
+    cache->SetModel(model);
+
+    for (int round = 0; round < 2; ++round)
+    {
+        double rxPowerDbm = cache->CalcRxPower(10, a, b);
+        NS_TEST_EXPECT_MSG_EQ_TOL(rxPowerDbm,
+                                  model->CalcRxPower(10, a, b),
+                                  1e-9,
+                                  "Got unexpected rcv power");
+    }
+    NS_TEST_EXPECT_MSG_EQ(cache->GetMissCount(), 2, "A loss was cached during a course change");
+    NS_TEST_EXPECT_MSG_EQ(cache->GetHitCount(), 0, "A loss was cached during a course change");
+}
+
+void
+CachedPropagationLossModelTestCase::DoRun()
+{
+    CheckLosses(256);
+    // switch to the hash table after the second mobility model
+    CheckLosses(2);
+    CheckCourseChangeDuringLoss();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup propagation-tests
  *
@@ -499,6 +653,7 @@ RangePropagationLossModelTestCase::DoRun()
  *   - TwoRayGroundPropagationLossModel
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
+ *   - CachedPropagationLossModel
  *   - RangePropagationLossModel
  */
 class PropagationLossModelsTestSuite : public TestSuite
@@ -514,6 +669,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new TwoRayGroundPropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new CachedPropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::Duration::QUICK);
 }
 
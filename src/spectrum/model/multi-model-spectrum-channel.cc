@@ -229,6 +229,7 @@ void
 MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
 {
     NS_LOG_FUNCTION(this << txParams);
+    NS_PROFILE_SCOPE(m_startTxProfile);
 
     NS_ASSERT(txParams->txPhy);
     NS_ASSERT(txParams->psd);
@@ -25,6 +25,8 @@
 
 #include <ns3/angles.h>
 #include <ns3/antenna-model.h>
+#include <ns3/boolean.h>
+#include <ns3/constant-position-mobility-model.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/mobility-model.h>
@@ -38,6 +40,7 @@
 #include <ns3/simulator.h>
 
 #include <algorithm>
+#include <cmath>
 
 namespace ns3
 {
@@ -46,7 +49,14 @@ NS_LOG_COMPONENT_DEFINE("SingleModelSpectrumChannel");
 
 NS_OBJECT_ENSURE_REGISTERED(SingleModelSpectrumChannel);
 
+/// Cell key of the SpectrumPhy instances without a mobility model
+static const uint64_t UNLOCATED_CELL = UINT64_MAX;
+
 SingleModelSpectrumChannel::SingleModelSpectrumChannel()
+    : m_maxRange(0),
+      m_maxAntennaGainDb(0),
+      m_cellSize(0),
+      m_attachOrder(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -55,6 +65,16 @@ void
 SingleModelSpectrumChannel::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    for (const auto& mobility : m_trackedMobilities)
+    {
+        mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&SingleModelSpectrumChannel::CourseChanged, this));
+    }
+    m_trackedMobilities.clear();
+    m_receivers.clear();
+    m_cells.clear();
+    m_indexedPhys.clear();
     m_phyList.clear();
     m_spectrumModel = nullptr;
     SpectrumChannel::DoDispose();
@@ -67,7 +87,36 @@ SingleModelSpectrumChannel::GetTypeId()
     static TypeId tid = TypeId("ns3::SingleModelSpectrumChannel")
                             .SetParent<SpectrumChannel>()
                             .SetGroupName("Spectrum")
-                            .AddConstructor<SingleModelSpectrumChannel>();
+                            .AddConstructor<SingleModelSpectrumChannel>()
+                            .AddAttribute("SpatialIndex",
+                                          "Whether the receivers of a signal are looked up in "
+                                          "a grid of cells as large as the distance at which "
+                                          "the propagation loss reaches MaxLossDb. With the "
+                                          "default MaxLossDb, the range is unbounded and the "
+                                          "index is silently disabled.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(
+                                              &SingleModelSpectrumChannel::m_spatialIndex),
+                                          MakeBooleanChecker())
+                            .AddAttribute("MaxRange",
+                                          "The distance, in meters, beyond which the loss of "
+                                          "a signal, antenna gains included, always exceeds "
+                                          "MaxLossDb, used as the cell size of the spatial "
+                                          "index. With the default value, it is derived from "
+                                          "the propagation loss model.",
+                                          DoubleValue(0),
+                                          MakeDoubleAccessor(
+                                              &SingleModelSpectrumChannel::m_maxRange),
+                                          MakeDoubleChecker<double>(0))
+                            .AddAttribute("MaxAntennaGainDb",
+                                          "The largest sum of the transmit and receive "
+                                          "antenna gains, in dB, added to MaxLossDb when the "
+                                          "range of the spatial index is derived from the "
+                                          "propagation loss model.",
+                                          DoubleValue(0),
+                                          MakeDoubleAccessor(
+                                              &SingleModelSpectrumChannel::m_maxAntennaGainDb),
+                                          MakeDoubleChecker<double>());
     return tid;
 }
 
@@ -75,20 +124,44 @@ void
 SingleModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
     auto it = std::find(begin(m_phyList), end(m_phyList), phy);
     if (it != std::end(m_phyList))
     {
         m_phyList.erase(it);
     }
+
+    auto indexed = m_indexedPhys.find(PeekPointer(phy));
+    if (indexed != m_indexedPhys.end())
+    {
+        RemoveFromCell(indexed->second);
+        m_indexedPhys.erase(indexed);
+    }
 }
 
 void
 SingleModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
     if (std::find(m_phyList.cbegin(), m_phyList.cend(), phy) == m_phyList.cend())
     {
         m_phyList.push_back(phy);
+
+        if (m_spatialIndex)
+        {
+            IndexedPhy& indexed = m_indexedPhys[PeekPointer(phy)];
+            indexed.phy = phy;
+            indexed.order = m_attachOrder++;
+            if (m_cellSize > 0)
+            {
+                InsertInCell(indexed);
+            }
+        }
     }
 }
 
@@ -96,6 +169,11 @@ void
 SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
 {
     NS_LOG_FUNCTION(this << txParams->psd << txParams->duration << txParams->txPhy);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    // Under the lock, as the channel is shared by the logical processes.
+    NS_PROFILE_SCOPE(m_startTxProfile);
     NS_ASSERT_MSG(txParams->psd, "NULL txPsd");
     NS_ASSERT_MSG(txParams->txPhy, "NULL txPhy");
 
@@ -119,7 +197,19 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
 
     Ptr<MobilityModel> senderMobility = txParams->txPhy->GetMobility();
 
-    for (auto rxPhyIterator = m_phyList.begin(); rxPhyIterator != m_phyList.end(); ++rxPhyIterator)
+    if (m_spatialIndex && m_cellSize == 0)
+    {
+        BuildSpatialIndex();
+    }
+
+    const PhyList* receivers = &m_phyList;
+    if (m_cellSize > 0 && senderMobility)
+    {
+        CollectReceivers(senderMobility->GetPosition());
+        receivers = &m_receivers;
+    }
+
+    for (auto rxPhyIterator = receivers->begin(); rxPhyIterator != receivers->end(); ++rxPhyIterator)
     {
         Ptr<NetDevice> rxNetDevice = (*rxPhyIterator)->GetDevice();
         Ptr<NetDevice> txNetDevice = txParams->txPhy->GetDevice();
@@ -224,6 +314,7 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
             }
         }
     }
+    m_receivers.clear();
 }
 
 void
@@ -254,4 +345,202 @@ SingleModelSpectrumChannel::GetDevice(std::size_t i) const
     return m_phyList.at(i)->GetDevice()->GetObject<NetDevice>();
 }
 
+void
+SingleModelSpectrumChannel::BuildSpatialIndex()
+{
+    NS_LOG_FUNCTION(this);
+    double range = m_maxRange;
+    if (range == 0 && m_propagationLoss)
+    {
+        range = GetMaxRange();
+    }
+    if (range <= 0)
+    {
+        NS_LOG_DEBUG("Unbounded range, the spatial index is disabled");
+        m_cellSize = -1;
+        return;
+    }
+
+    m_cellSize = range;
+    NS_LOG_DEBUG("Cell size " << m_cellSize << " m");
+    for (auto& indexed : m_indexedPhys)
+    {
+        InsertInCell(indexed.second);
+    }
+}
+
+double
+SingleModelSpectrumChannel::GetMaxRange() const
+{
+    NS_LOG_FUNCTION(this);
+    Ptr<ConstantPositionMobilityModel> a = CreateObject<ConstantPositionMobilityModel>();
+    Ptr<ConstantPositionMobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+
+    // A cache would keep the probing mobility models, and count the probes:
+    // the model it wraps is probed instead, followed by the chained models.
+    Ptr<PropagationLossModel> model = m_propagationLoss;
+    Ptr<PropagationLossModel> next;
+    Ptr<CachedPropagationLossModel> cache = DynamicCast<CachedPropagationLossModel>(model);
+    if (cache && cache->GetModel())
+    {
+        model = cache->GetModel();
+        next = cache->GetNext();
+    }
+
+    auto inRange = [&](double distance) {
+        b->SetPosition(Vector(distance, 0, 0));
+        double rxPowerDbm = model->CalcRxPower(0, a, b);
+        if (next)
+        {
+            rxPowerDbm = next->CalcRxPower(rxPowerDbm, a, b);
+        }
+        return -rxPowerDbm <= m_maxLossDb + m_maxAntennaGainDb;
+    };
+
+    double lo = 0;
+    double hi = 1;
+    while (inRange(hi))
+    {
+        lo = hi;
+        hi *= 2;
+        if (hi > 1e7)
+        {
+            return 0;
+        }
+    }
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        double mid = (lo + hi) / 2;
+        if (inRange(mid))
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return hi;
+}
+
+void
+SingleModelSpectrumChannel::CollectReceivers(const Vector& position)
+{
+    auto ix = static_cast<int64_t>(std::floor(position.x / m_cellSize));
+    auto iy = static_cast<int64_t>(std::floor(position.y / m_cellSize));
+    auto iz = static_cast<int64_t>(std::floor(position.z / m_cellSize));
+    std::vector<const IndexedPhy*> candidates;
+    for (int64_t dx = -1; dx <= 1; dx++)
+    {
+        for (int64_t dy = -1; dy <= 1; dy++)
+        {
+            for (int64_t dz = -1; dz <= 1; dz++)
+            {
+                // the coordinates wrap around, which only adds candidates
+                auto cell = m_cells.find(PackCellKey(ix + dx, iy + dy, iz + dz));
+                if (cell != m_cells.end())
+                {
+                    candidates.insert(candidates.end(), cell->second.begin(), cell->second.end());
+                }
+            }
+        }
+    }
+    auto unlocated = m_cells.find(UNLOCATED_CELL);
+    if (unlocated != m_cells.end())
+    {
+        candidates.insert(candidates.end(), unlocated->second.begin(), unlocated->second.end());
+    }
+
+    // keep the order of m_phyList so that the events are scheduled as without index
+    std::sort(candidates.begin(), candidates.end(), [](const IndexedPhy* x, const IndexedPhy* y) {
+        return x->order < y->order;
+    });
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    m_receivers.clear();
+    for (const IndexedPhy* indexed : candidates)
+    {
+        m_receivers.push_back(indexed->phy);
+    }
+}
+
+uint64_t
+SingleModelSpectrumChannel::GetCellKey(const Vector& position) const
+{
+    auto ix = static_cast<int64_t>(std::floor(position.x / m_cellSize));
+    auto iy = static_cast<int64_t>(std::floor(position.y / m_cellSize));
+    auto iz = static_cast<int64_t>(std::floor(position.z / m_cellSize));
+    return PackCellKey(ix, iy, iz);
+}
+
+uint64_t
+SingleModelSpectrumChannel::PackCellKey(int64_t ix, int64_t iy, int64_t iz)
+{
+    return ((static_cast<uint64_t>(ix) & 0x1FFFFF) << 42) |
+           ((static_cast<uint64_t>(iy) & 0x1FFFFF) << 21) | (static_cast<uint64_t>(iz) & 0x1FFFFF);
+}
+
+void
+SingleModelSpectrumChannel::InsertInCell(IndexedPhy& indexed)
+{
+    indexed.mobility = indexed.phy->GetMobility();
+    if (!indexed.mobility)
+    {
+        indexed.cell = UNLOCATED_CELL;
+    }
+    else
+    {
+        indexed.cell = GetCellKey(indexed.mobility->GetPosition());
+        if (m_trackedMobilities.insert(indexed.mobility).second)
+        {
+            indexed.mobility->TraceConnectWithoutContext(
+                "CourseChange",
+                MakeCallback(&SingleModelSpectrumChannel::CourseChanged, this));
+        }
+    }
+    m_cells[indexed.cell].push_back(&indexed);
+}
+
+void
+SingleModelSpectrumChannel::RemoveFromCell(const IndexedPhy& indexed)
+{
+    auto cell = m_cells.find(indexed.cell);
+    if (cell == m_cells.end())
+    {
+        return;
+    }
+    auto it = std::find(cell->second.begin(), cell->second.end(), &indexed);
+    if (it != cell->second.end())
+    {
+        *it = cell->second.back();
+        cell->second.pop_back();
+    }
+    if (cell->second.empty())
+    {
+        m_cells.erase(cell);
+    }
+}
+
+void
+SingleModelSpectrumChannel::CourseChanged(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    if (m_cellSize <= 0)
+    {
+        return;
+    }
+    uint64_t cell = GetCellKey(mobility->GetPosition());
+    for (auto& indexed : m_indexedPhys)
+    {
+        if (indexed.second.mobility == mobility && indexed.second.cell != cell)
+        {
+            RemoveFromCell(indexed.second);
+            InsertInCell(indexed.second);
+        }
+    }
+}
+
 } // namespace ns3
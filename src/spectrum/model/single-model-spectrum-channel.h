@@ -24,16 +24,42 @@
 #include "spectrum-model.h"
 
 #include <ns3/traced-callback.h>
+#include <ns3/vector.h>
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#ifdef NS3_MTP
+#include <mutex>
+#endif
 
 namespace ns3
 {
 
+class MobilityModel;
+
 /**
  * \ingroup spectrum
  *
  * \brief SpectrumChannel implementation which handles a single spectrum model
  *
  * All SpectrumPhy layers attached to this SpectrumChannel
+ *
+ * If the SpatialIndex attribute is true, the attached SpectrumPhy instances
+ * are kept in a grid of cells as large as the range of the signals, and a
+ * signal is only sent to the instances in the cell of the transmitter and in
+ * the adjacent cells. The range is the MaxRange attribute if set. Otherwise
+ * it is the distance at which the propagation loss reaches MaxLossDb plus
+ * MaxAntennaGainDb, found by querying the propagation loss model with two
+ * mobility models of its own: the model must then be deterministic and
+ * increase with the distance, and a CachedPropagationLossModel is bypassed
+ * for the model it wraps. The grid is built on the first transmission, so
+ * these attributes and the propagation loss model must not change
+ * afterwards. The positions are updated when the mobility models notify a
+ * course change. Without MaxRange, MaxLossDb must be set below its default
+ * value (1e9 dB): otherwise the range is unbounded and the index disables
+ * itself, without notice.
  */
 class SingleModelSpectrumChannel : public SpectrumChannel
 {
@@ -69,15 +95,108 @@ class SingleModelSpectrumChannel : public SpectrumChannel
      */
     void StartRx(Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+    /**
+     * A SpectrumPhy instance in the spatial index.
+     */
+    struct IndexedPhy
+    {
+        Ptr<SpectrumPhy> phy;        //!< The SpectrumPhy instance
+        Ptr<MobilityModel> mobility; //!< Its mobility model, if any
+        uint64_t order;              //!< Its rank in the attach order
+        uint64_t cell;               //!< Its cell
+    };
+
+    /**
+     * Compute the cell size and put the attached SpectrumPhy instances in
+     * their cell, or disable the spatial index if the range is unbounded.
+     */
+    void BuildSpatialIndex();
+
+    /**
+     * Get the distance at which the propagation loss exceeds MaxLossDb plus
+     * MaxAntennaGainDb.
+     *
+     * \return the distance in meters, or zero if the loss never exceeds it
+     */
+    double GetMaxRange() const;
+
+    /**
+     * Fill m_receivers with the SpectrumPhy instances of the cells adjacent
+     * to a position, in the attach order.
+     *
+     * \param position the position of the transmitter
+     */
+    void CollectReceivers(const Vector& position);
+
+    /**
+     * \param position a position
+     * \return the key of the cell including the position
+     */
+    uint64_t GetCellKey(const Vector& position) const;
+
+    /**
+     * Pack cell coordinates in a cell key, each coordinate on 21 bits.
+     *
+     * \param ix the cell index along the x axis
+     * \param iy the cell index along the y axis
+     * \param iz the cell index along the z axis
+     * \return the key of the cell
+     */
+    static uint64_t PackCellKey(int64_t ix, int64_t iy, int64_t iz);
+
+    /**
+     * Put a SpectrumPhy instance of the spatial index in its current cell.
+     *
+     * \param indexed the SpectrumPhy instance
+     */
+    void InsertInCell(IndexedPhy& indexed);
+
+    /**
+     * Remove a SpectrumPhy instance of the spatial index from its cell.
+     *
+     * \param indexed the SpectrumPhy instance
+     */
+    void RemoveFromCell(const IndexedPhy& indexed);
+
+    /**
+     * Move the SpectrumPhy instances using a mobility model to their new cell.
+     *
+     * \param mobility the mobility model
+     */
+    void CourseChanged(Ptr<const MobilityModel> mobility);
+
     /**
      * List of SpectrumPhy instances attached to the channel.
      */
     PhyList m_phyList;
 
+    bool m_spatialIndex;       //!< Whether the receivers are looked up in a spatial index
+    double m_maxRange;         //!< Range of the spatial index, zero to derive it
+    double m_maxAntennaGainDb; //!< Antenna gain margin of the derived range
+    double m_cellSize;         //!< Size of the cells, zero until built, negative if disabled
+    uint64_t m_attachOrder;    //!< Rank of the next attached SpectrumPhy instance
+
+    /// The SpectrumPhy instances attached to the channel, when the spatial index is enabled
+    std::unordered_map<const SpectrumPhy*, IndexedPhy> m_indexedPhys;
+    /// The SpectrumPhy instances of each cell
+    std::unordered_map<uint64_t, std::vector<const IndexedPhy*>> m_cells;
+    /// The mobility models whose course changes are tracked
+    std::set<Ptr<MobilityModel>> m_trackedMobilities;
+    /// The receivers of the transmission in progress
+    PhyList m_receivers;
+
     /**
      * SpectrumModel that this channel instance is supporting.
      */
     Ptr<const SpectrumModel> m_spectrumModel;
+
+#ifdef NS3_MTP
+    /**
+     * Mutex of the receivers, as the PHYs of several logical processes of
+     * the multithreaded simulator can use the channel.
+     */
+    std::recursive_mutex m_mutex;
+#endif
 };
 
 } // namespace ns3
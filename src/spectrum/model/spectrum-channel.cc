@@ -159,6 +159,12 @@ SpectrumChannel::AddSpectrumTransmitFilter(Ptr<SpectrumTransmitFilter> filter)
     m_filter = filter;
 }
 
+void
+SpectrumChannel::PrintProfile(std::ostream& os) const
+{
+    m_startTxProfile.Print(os, "StartTx");
+}
+
 Ptr<SpectrumTransmitFilter>
 SpectrumChannel::GetSpectrumTransmitFilter() const
 {
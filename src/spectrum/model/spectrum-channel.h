@@ -30,6 +30,7 @@
 #include <ns3/mobility-model.h>
 #include <ns3/nstime.h>
 #include <ns3/object.h>
+#include <ns3/profile-counter.h>
 #include <ns3/propagation-delay-model.h>
 #include <ns3/propagation-loss-model.h>
 #include <ns3/traced-callback.h>
@@ -149,6 +150,14 @@ class SpectrumChannel : public Channel
      */
     virtual void StartTx(Ptr<SpectrumSignalParameters> params) = 0;
 
+    /**
+     * Print the profiling counters of StartTx, updated in the builds with
+     * the NS3_PROFILE_COUNTERS option.
+     *
+     * \param os the output stream
+     */
+    void PrintProfile(std::ostream& os) const;
+
     /**
      * This method calls AssignStreams() on any/all of the PropagationLossModel,
      * PropagationDelayModel, SpectrumPropagationLossModel,
@@ -293,6 +302,11 @@ class SpectrumChannel : public Channel
      * Transmit filter to be used with this channel
      */
     Ptr<SpectrumTransmitFilter> m_filter{nullptr};
+
+    /**
+     * Profiling counter of StartTx.
+     */
+    ProfileCounter m_startTxProfile;
 };
 
 } // namespace ns3
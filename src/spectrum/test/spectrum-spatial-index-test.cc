@@ -0,0 +1,397 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/boolean.h>
+#include <ns3/isotropic-antenna-model.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/net-device.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/simulator.h>
+#include <ns3/single-model-spectrum-channel.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/test.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("SpectrumSpatialIndexTest");
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SpectrumPhy recording the signals it receives.
+ */
+class SpatialIndexTestPhy : public SpectrumPhy
+{
+  public:
+    /**
+     * Constructor
+     * \param id the identifier of the PHY
+     * \param received the receivers of each transmission, indexed by the
+     * start time of the transmission in milliseconds
+     */
+    SpatialIndexTestPhy(uint32_t id, std::vector<std::vector<uint32_t>>* received);
+
+    /**
+     * Set the antenna of the PHY.
+     * \param antenna the antenna
+     */
+    void SetAntenna(Ptr<AntennaModel> antenna);
+
+    void SetDevice(Ptr<NetDevice> d) override;
+    Ptr<NetDevice> GetDevice() const override;
+    void SetMobility(Ptr<MobilityModel> m) override;
+    Ptr<MobilityModel> GetMobility() const override;
+    void SetChannel(Ptr<SpectrumChannel> c) override;
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override;
+    Ptr<Object> GetAntenna() const override;
+    void StartRx(Ptr<SpectrumSignalParameters> params) override;
+
+  private:
+    uint32_t m_id;                                  //!< Identifier of the PHY
+    std::vector<std::vector<uint32_t>>* m_received; //!< Receivers of each transmission
+    Ptr<MobilityModel> m_mobility;                  //!< Mobility model, if any
+    Ptr<AntennaModel> m_antenna;                    //!< Antenna, if any
+};
+
+SpatialIndexTestPhy::SpatialIndexTestPhy(uint32_t id,
+                                         std::vector<std::vector<uint32_t>>* received)
+    : m_id(id),
+      m_received(received)
+{
+}
+
+void
+SpatialIndexTestPhy::SetAntenna(Ptr<AntennaModel> antenna)
+{
+    m_antenna = antenna;
+}
+
+void
+SpatialIndexTestPhy::SetDevice(Ptr<NetDevice> d)
+{
+}
+
+Ptr<NetDevice>
+SpatialIndexTestPhy::GetDevice() const
+{
+    return nullptr;
+}
+
+void
+SpatialIndexTestPhy::SetMobility(Ptr<MobilityModel> m)
+{
+    m_mobility = m;
+}
+
+Ptr<MobilityModel>
+SpatialIndexTestPhy::GetMobility() const
+{
+    return m_mobility;
+}
+
+void
+SpatialIndexTestPhy::SetChannel(Ptr<SpectrumChannel> c)
+{
+}
+
+Ptr<const SpectrumModel>
+SpatialIndexTestPhy::GetRxSpectrumModel() const
+{
+    return nullptr;
+}
+
+Ptr<Object>
+SpatialIndexTestPhy::GetAntenna() const
+{
+    return m_antenna;
+}
+
+void
+SpatialIndexTestPhy::StartRx(Ptr<SpectrumSignalParameters> params)
+{
+    auto tx = static_cast<size_t>(Simulator::Now().GetMilliSeconds());
+    if (m_received->size() <= tx)
+    {
+        m_received->resize(tx + 1);
+    }
+    (*m_received)[tx].push_back(m_id);
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SingleModelSpectrumChannel spatial index test
+ *
+ * Sends a signal from each PHY of a lattice spanning several cells of the
+ * index, at negative and positive coordinates, with and without the
+ * SpatialIndex attribute, then moves a third of the PHYs across cell
+ * borders and sends again. The receivers of each signal must be the same,
+ * the PHYs without mobility model must receive all the signals, and the
+ * index must compute fewer path losses, unless MaxLossDb keeps its
+ * default value, which disables the index. The same holds with antenna
+ * gains covered by MaxAntennaGainDb, with an explicit MaxRange, and with a
+ * CachedPropagationLossModel, which must only see the path losses of the
+ * signals.
+ */
+class SpectrumSpatialIndexTestCase : public TestCase
+{
+  public:
+    SpectrumSpatialIndexTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the transmissions once.
+     * \param spatialIndex whether the channel uses a spatial index
+     * \param maxLossDb the MaxLossDb attribute of the channel, negative for
+     * its default value
+     * \param antennaGainDb the gain of the isotropic antenna of each PHY
+     * \param maxAntennaGainDb the MaxAntennaGainDb attribute of the channel
+     * \param cached whether the propagation losses go through a cache
+     * \param maxRange the MaxRange attribute of the channel
+     * \return the sorted receivers of each transmission
+     */
+    std::vector<std::vector<uint32_t>> RunTransmissions(bool spatialIndex,
+                                                        double maxLossDb,
+                                                        double antennaGainDb = 0,
+                                                        double maxAntennaGainDb = 0,
+                                                        bool cached = false,
+                                                        double maxRange = 0);
+
+    /**
+     * Count a PathLoss event.
+     * \param txPhy the transmitter
+     * \param rxPhy the receiver
+     * \param lossDb the loss
+     */
+    void PathLossTrace(Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+
+    uint64_t m_pathLosses;   //!< Number of path losses computed in the last run
+    uint64_t m_cacheLookups; //!< Number of losses requested to the cache in the last run
+};
+
+/// Number of PHYs without mobility model
+static const uint32_t UNLOCATED_PHYS = 3;
+
+SpectrumSpatialIndexTestCase::SpectrumSpatialIndexTestCase()
+    : TestCase("SingleModelSpectrumChannel spatial index"),
+      m_pathLosses(0),
+      m_cacheLookups(0)
+{
+}
+
+void
+SpectrumSpatialIndexTestCase::PathLossTrace(Ptr<const SpectrumPhy> txPhy,
+                                            Ptr<const SpectrumPhy> rxPhy,
+                                            double lossDb)
+{
+    m_pathLosses++;
+}
+
+std::vector<std::vector<uint32_t>>
+SpectrumSpatialIndexTestCase::RunTransmissions(bool spatialIndex,
+                                               double maxLossDb,
+                                               double antennaGainDb,
+                                               double maxAntennaGainDb,
+                                               bool cached,
+                                               double maxRange)
+{
+    m_pathLosses = 0;
+    m_cacheLookups = 0;
+    std::vector<std::vector<uint32_t>> received;
+
+    Ptr<SingleModelSpectrumChannel> channel = CreateObject<SingleModelSpectrumChannel>();
+    channel->SetAttribute("SpatialIndex", BooleanValue(spatialIndex));
+    if (maxLossDb >= 0)
+    {
+        channel->SetAttribute("MaxLossDb", DoubleValue(maxLossDb));
+    }
+    channel->SetAttribute("MaxAntennaGainDb", DoubleValue(maxAntennaGainDb));
+    channel->SetAttribute("MaxRange", DoubleValue(maxRange));
+    Ptr<CachedPropagationLossModel> cache;
+    if (cached)
+    {
+        cache = CreateObject<CachedPropagationLossModel>();
+        cache->SetModel(CreateObject<LogDistancePropagationLossModel>());
+        channel->AddPropagationLossModel(cache);
+    }
+    else
+    {
+        channel->AddPropagationLossModel(CreateObject<LogDistancePropagationLossModel>());
+    }
+    Ptr<AntennaModel> antenna;
+    if (antennaGainDb != 0)
+    {
+        antenna = CreateObjectWithAttributes<IsotropicAntennaModel>("Gain",
+                                                                    DoubleValue(antennaGainDb));
+    }
+    channel->TraceConnectWithoutContext(
+        "PathLoss",
+        MakeCallback(&SpectrumSpatialIndexTestCase::PathLossTrace, this));
+
+    // About 60 m of range with the default log distance model and a 100 dB
+    // loss: the 25 m lattice puts neighbours on both sides of the cell
+    // borders, which are at multiples of the range, around the origin.
+    std::vector<Ptr<SpatialIndexTestPhy>> phys;
+    std::vector<Ptr<ConstantPositionMobilityModel>> mobilities;
+    for (int32_t ix = -6; ix <= 6; ix++)
+    {
+        for (int32_t iy = -3; iy <= 3; iy++)
+        {
+            Ptr<SpatialIndexTestPhy> phy =
+                CreateObject<SpatialIndexTestPhy>(phys.size(), &received);
+            Ptr<ConstantPositionMobilityModel> mobility =
+                CreateObject<ConstantPositionMobilityModel>();
+            mobility->SetPosition(Vector(25.0 * ix + 0.3 * iy, 25.0 * iy, ix % 2 ? 20 : 0));
+            phy->SetMobility(mobility);
+            phy->SetAntenna(antenna);
+            channel->AddRx(phy);
+            phys.push_back(phy);
+            mobilities.push_back(mobility);
+        }
+    }
+    std::vector<Ptr<SpatialIndexTestPhy>> unlocated;
+    for (uint32_t i = 0; i < UNLOCATED_PHYS; i++)
+    {
+        Ptr<SpatialIndexTestPhy> phy =
+            CreateObject<SpatialIndexTestPhy>(phys.size() + unlocated.size(), &received);
+        channel->AddRx(phy);
+        unlocated.push_back(phy);
+    }
+
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(std::vector<double>{2.4e9, 2.401e9});
+    auto send = [&](uint32_t tx) {
+        Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters>();
+        params->psd = Create<SpectrumValue>(model);
+        *params->psd = 1e-3;
+        params->duration = MicroSeconds(100);
+        params->txPhy = phys[tx];
+        params->txAntenna = antenna;
+        channel->StartTx(params);
+    };
+
+    // One transmission per millisecond, the PHYs moving in between.
+    for (uint32_t tx = 0; tx < phys.size(); tx++)
+    {
+        Simulator::Schedule(MilliSeconds(tx), [&send, tx]() { send(tx); });
+    }
+    Simulator::Schedule(MilliSeconds(phys.size()) - MicroSeconds(500), [&]() {
+        for (uint32_t i = 0; i < mobilities.size(); i += 3)
+        {
+            Vector position = mobilities[i]->GetPosition();
+            mobilities[i]->SetPosition(Vector(position.x + 97, position.y - 61, 40 - position.z));
+        }
+    });
+    for (uint32_t tx = 0; tx < phys.size(); tx++)
+    {
+        Simulator::Schedule(MilliSeconds(phys.size() + tx), [&send, tx]() { send(tx); });
+    }
+
+    Simulator::Run();
+    if (cache)
+    {
+        m_cacheLookups = cache->GetHitCount() + cache->GetMissCount();
+    }
+    Simulator::Destroy();
+
+    received.resize(2 * phys.size());
+    for (auto& receivers : received)
+    {
+        std::sort(receivers.begin(), receivers.end());
+    }
+    return received;
+}
+
+void
+SpectrumSpatialIndexTestCase::DoRun()
+{
+    std::vector<std::vector<uint32_t>> expected = RunTransmissions(false, 100);
+    uint64_t pathLosses = m_pathLosses;
+
+    uint32_t located = expected.size() / 2;
+    bool limited = false;
+    for (const auto& receivers : expected)
+    {
+        NS_TEST_ASSERT_MSG_GT_OR_EQ(receivers.size(), UNLOCATED_PHYS, "A signal was lost");
+        for (uint32_t i = 0; i < UNLOCATED_PHYS; i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(receivers[receivers.size() - UNLOCATED_PHYS + i],
+                                  located + i,
+                                  "A PHY without mobility model missed a signal");
+        }
+        limited |= receivers.size() < located - 1 + UNLOCATED_PHYS;
+    }
+    NS_TEST_ASSERT_MSG_EQ(limited, true, "MaxLossDb did not limit the receivers");
+
+    std::vector<std::vector<uint32_t>> indexed = RunTransmissions(true, 100);
+    for (uint32_t tx = 0; tx < expected.size(); tx++)
+    {
+        NS_TEST_EXPECT_MSG_EQ((indexed[tx] == expected[tx]),
+                              true,
+                              "Different receivers of transmission " << tx);
+    }
+    NS_TEST_EXPECT_MSG_LT(m_pathLosses, pathLosses, "The index did not save path losses");
+
+    // The range of the log distance model at 100 dB is just below 60 m.
+    indexed = RunTransmissions(true, 100, 0, 0, false, 60);
+    NS_TEST_EXPECT_MSG_EQ((indexed == expected), true, "Different receivers with MaxRange");
+
+    // The probes of the range do not go through the cache.
+    indexed = RunTransmissions(true, 100, 0, 0, true);
+    NS_TEST_EXPECT_MSG_EQ((indexed == expected), true, "Different receivers with a cache");
+    NS_TEST_EXPECT_MSG_EQ(m_cacheLookups, m_pathLosses, "The range was probed through the cache");
+
+    // The antenna gains extend the range beyond the adjacent cells.
+    expected = RunTransmissions(false, 100, 5);
+    indexed = RunTransmissions(true, 100, 5, 10);
+    NS_TEST_EXPECT_MSG_EQ((indexed == expected), true, "Different receivers with antennas");
+    indexed = RunTransmissions(true, 100, 5);
+    NS_TEST_EXPECT_MSG_EQ((indexed != expected), true, "The antenna gains were not needed");
+
+    // The default MaxLossDb never limits the range: the index disables itself.
+    expected = RunTransmissions(false, -1);
+    pathLosses = m_pathLosses;
+    indexed = RunTransmissions(true, -1);
+    NS_TEST_EXPECT_MSG_EQ((indexed == expected), true, "Different receivers without range");
+    NS_TEST_EXPECT_MSG_EQ(m_pathLosses, pathLosses, "The index was used without range");
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SingleModelSpectrumChannel spatial index TestSuite
+ */
+class SpectrumSpatialIndexTestSuite : public TestSuite
+{
+  public:
+    SpectrumSpatialIndexTestSuite();
+};
+
+SpectrumSpatialIndexTestSuite::SpectrumSpatialIndexTestSuite()
+    : TestSuite("spectrum-spatial-index", Type::UNIT)
+{
+    AddTestCase(new SpectrumSpatialIndexTestCase, TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static SpectrumSpatialIndexTestSuite g_spectrumSpatialIndexTestSuite;